@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+// Built as a separate executable (see CMakeLists.txt), the replaced global operator new counts the allocations of the
+// whole process and would slow down the other benchmarks
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    // Counts the allocations of the benchmark process, to measure allocations per update
+    std::atomic<size_t> g_allocationCount{ 0u }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}
+
+void* operator new(std::size_t size)
+{
+    ++g_allocationCount;
+    if (void* memory = std::malloc(size == 0u ? 1u : size)) // NOLINT(cppcoreguidelines-no-malloc)
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory); // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory); // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+namespace rlogic
+{
+    static void BM_Property_StringLink_Update(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const bool changeLabel = (state.range(0) != 0);
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+        LuaScript* sourceScript = logicEngine.createLuaScript(R"(
+            local labels = { "a label which doesn't fit into small string buffer", "another label which doesn't fit into small string buffer" }
+            function interface()
+                IN.frame = INT
+                IN.changeLabel = BOOL
+                OUT.label = STRING
+            end
+            function run()
+                if IN.changeLabel then
+                    OUT.label = labels[IN.frame % 2 + 1]
+                else
+                    OUT.label = labels[1]
+                end
+            end
+        )", config);
+        LuaScript* targetScript = logicEngine.createLuaScript(R"(
+            function interface()
+                IN.label = STRING
+            end
+            function run()
+            end
+        )");
+        logicEngine.link(*sourceScript->getOutputs()->getChild("label"), *targetScript->getInputs()->getChild("label"));
+        sourceScript->getInputs()->getChild("changeLabel")->set<bool>(changeLabel);
+
+        Property* frame = sourceScript->getInputs()->getChild("frame");
+        int32_t frameCounter = 0;
+        logicEngine.update();
+
+        const size_t allocationsBefore = g_allocationCount;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            frame->set<int32_t>(++frameCounter);
+            logicEngine.update();
+        }
+        state.counters["AllocationsPerUpdate"] = benchmark::Counter(static_cast<double>(g_allocationCount - allocationsBefore), benchmark::Counter::kAvgIterations);
+    }
+
+    // Measures update of a script whose string output is linked to another script, and the heap allocations per update
+    // ARG: 0 - the script writes the same string every update, 1 - the script writes a different string every update
+    BENCHMARK(BM_Property_StringLink_Update)->Arg(0)->Arg(1);
+}
@@ -155,6 +155,42 @@ namespace rlogic
         RunAnimation(logicEngine, state, timeProp);
     }
 
+    static void BM_AnimationParallelUpdate(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        logicEngine.setUpdateThreadCount(static_cast<size_t>(state.range(1)));
+
+        const auto* animTimestamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 0.5f, 1.f, 1.5f }); // will be interpreted as seconds
+        const auto* animKeyframes = logicEngine.createDataArray(std::vector<rlogic::vec3f>{ {0.f, 0.f, 0.f}, {0.f, 0.f, 180.f}, {0.f, 0.f, 100.f}, {0.f, 0.f, 360.f} });
+        const auto* cubicAnimTangentsIn = logicEngine.createDataArray(std::vector<rlogic::vec3f>{ {0.f, 0.f, 0.f}, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f } });
+        const auto* cubicAnimTangentsOut = logicEngine.createDataArray(std::vector<rlogic::vec3f>{ {0.f, 0.f, 0.f}, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f } });
+        const rlogic::AnimationChannel channelCubic { "rotationZcubic", animTimestamps, animKeyframes, rlogic::EInterpolationType::Cubic, cubicAnimTangentsIn, cubicAnimTangentsOut };
+        const AnimationChannels channels(10, channelCubic);
+
+        std::vector<Property*> timeProps;
+        timeProps.reserve(nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            auto* node = logicEngine.createAnimationNode(channels);
+            node->getInputs()->getChild("play")->set(true);
+            node->getInputs()->getChild("loop")->set(true);
+            timeProps.push_back(node->getInputs()->getChild("timeDelta"));
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (auto* timeProp : timeProps)
+            {
+                timeProp->set(0.015f);
+            }
+            if (!logicEngine.update())
+            {
+                state.SkipWithError("failure running update()");
+            }
+        }
+    }
+
     // Compares animation objects with animations done in lua
     // ARG: number of animation channels
     BENCHMARK(BM_AnimationScriptLinear)->Arg(1)->Arg(10);
@@ -162,5 +198,12 @@ namespace rlogic
     BENCHMARK(BM_AnimationLinear)->Arg(1)->Arg(10);
     BENCHMARK(BM_AnimationKeyframes)->Arg(1)->Arg(10);
     BENCHMARK(BM_AnimationKeyframesCubic)->Arg(1)->Arg(10);
+
+    // Measures scaling of independent animation nodes (10 cubic channels each) over update threads
+    // ARG0: number of animation nodes
+    // ARG1: number of update threads
+    BENCHMARK(BM_AnimationParallelUpdate)
+        ->Args({ 100, 1 })->Args({ 100, 2 })->Args({ 100, 4 })
+        ->Args({ 1000, 1 })->Args({ 1000, 2 })->Args({ 1000, 4 })->Args({ 1000, 8 });
 }
 
@@ -48,6 +48,38 @@ namespace rlogic
     // Measures compilation times depending on the number of inputs in the interface
     // ARG: number of inputs in script's interface()
     BENCHMARK(BM_CompileLua_Interface)->Arg(1)->Arg(10)->Arg(100);
+
+    static void BM_CreateLuaScriptInstance(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        const int64_t scriptSize = state.range(0);
+
+        const std::string scriptSrc = fmt::format(R"(
+            function interface()
+                for i = 0,{},1 do
+                    IN["param"..tostring(i)] = INT
+                end
+            end
+            function run()
+            end
+        )", scriptSize);
+
+        const LuaScript* prototype = logicEngine.createLuaScript(scriptSrc, config);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LuaScript* script = logicEngine.createLuaScriptInstance(*prototype);
+            logicEngine.destroy(*script);
+        }
+    }
+
+    // Measures creation times of script instances, compare with BM_CompileLua_Interface
+    // ARG: number of inputs in script's interface()
+    BENCHMARK(BM_CreateLuaScriptInstance)->Arg(1)->Arg(10)->Arg(100);
 }
 
 
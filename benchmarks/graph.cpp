@@ -0,0 +1,79 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/Property.h"
+#include "impl/TimerNodeImpl.h"
+#include "impl/PropertyImpl.h"
+#include "internals/LogicNodeDependencies.h"
+#include "internals/ErrorReporting.h"
+
+#include <memory>
+#include <vector>
+
+namespace rlogic::internal
+{
+    static std::vector<std::unique_ptr<TimerNodeImpl>> CreateTimerNodes(size_t nodeCount)
+    {
+        std::vector<std::unique_ptr<TimerNodeImpl>> nodes;
+        nodes.reserve(nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            nodes.emplace_back(std::make_unique<TimerNodeImpl>("timer", i));
+        }
+        return nodes;
+    }
+
+    static void BM_Graph_CreateDestroyNodes(benchmark::State& state)
+    {
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        const bool linkNodes = state.range(1) != 0;
+
+        LogicNodeDependencies dependencies;
+        ErrorReporting errors;
+        std::vector<std::unique_ptr<TimerNodeImpl>> nodes;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // Only graph operations are measured, not construction and destruction of the nodes
+            state.PauseTiming();
+            nodes = CreateTimerNodes(nodeCount);
+            state.ResumeTiming();
+
+            for (auto& node : nodes)
+            {
+                dependencies.addNode(*node);
+            }
+
+            if (linkNodes)
+            {
+                for (size_t i = 1; i < nodeCount; ++i)
+                {
+                    PropertyImpl& output = *nodes[i - 1]->getOutputs()->getChild("ticker_us")->m_impl;
+                    PropertyImpl& input = *nodes[i]->getInputs()->getChild("ticker_us")->m_impl;
+                    dependencies.link(output, input, errors);
+                }
+            }
+
+            // Nodes are removed in order of creation (front to back of the chain)
+            for (auto& node : nodes)
+            {
+                dependencies.removeNode(*node);
+            }
+        }
+    }
+
+    // Measures bulk creation and destruction of nodes in the dependency graph, the cost per node should not depend on the node count
+    // ARG0: node count
+    // ARG1: 0 = no links, 1 = nodes linked to a chain
+    BENCHMARK(BM_Graph_CreateDestroyNodes)
+        ->Args({ 1000, 0 })->Args({ 10000, 0 })->Args({ 50000, 0 })
+        ->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 50000, 1 })
+        ->Unit(benchmark::kMillisecond);
+}
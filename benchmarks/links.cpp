@@ -15,6 +15,8 @@
 
 #include "fmt/format.h"
 
+#include <array>
+
 namespace rlogic
 {
     static void BM_Links_CreateDestroyLink(benchmark::State& state)
@@ -109,5 +111,167 @@ namespace rlogic
     // Same as BM_Links_CreateDestroyLink, but tests with many scripts (how fast is link (re)creation depending on scripts count)
     // ARG: script count
     BENCHMARK(BM_Links_CreateDestroyLink_ManyScripts)->Arg(8)->Arg(32)->Arg(128);
-}
 
+    static void BM_Links_ReverseLinkBetweenChains(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t chainLength = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface()
+                IN.value = INT
+                OUT.value = INT
+            end
+            function run()
+                OUT.value = IN.value
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        // Two chains of scripts, chain 0 is created first (and thus sorted first)
+        std::array<std::vector<LuaScript*>, 2> chains;
+        for (auto& chain : chains)
+        {
+            for (int64_t i = 0; i < chainLength; ++i)
+            {
+                chain.push_back(logicEngine.createLuaScript(scriptSrc, config));
+                if (i >= 1)
+                {
+                    logicEngine.link(*chain[i - 1]->getOutputs()->getChild("value"), *chain[i]->getInputs()->getChild("value"));
+                }
+            }
+        }
+
+        const auto chainOutput = [&chains](size_t chain) { return chains[chain].back()->getOutputs()->getChild("value"); };
+        const auto chainInput = [&chains](size_t chain) { return chains[chain].front()->getInputs()->getChild("value"); };
+
+        size_t firstChain = 0u;
+        logicEngine.link(*chainOutput(firstChain), *chainInput(1u - firstChain));
+        logicEngine.update();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // Swap the order of the chains, every second link contradicts the current topological order
+            logicEngine.unlink(*chainOutput(firstChain), *chainInput(1u - firstChain));
+            firstChain = 1u - firstChain;
+            logicEngine.link(*chainOutput(firstChain), *chainInput(1u - firstChain));
+            logicEngine.update();
+        }
+    }
+
+    // Measures link churn interleaved with update() when links change the order of large parts of the graph.
+    // The topological order is updated incrementally on link(), update() only executes the affected scripts
+    // ARG: length of each of the two chains
+    BENCHMARK(BM_Links_ReverseLinkBetweenChains)->Arg(10)->Arg(100)->Arg(1000);
+
+    static void BM_Links_RelinkInLargeGraph(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface()
+                IN.value = INT
+                OUT.value = INT
+            end
+            function run()
+                OUT.value = IN.value
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        // Many independent pairs of linked scripts
+        std::vector<LuaScript*> scripts(scriptCount);
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            scripts[i] = logicEngine.createLuaScript(scriptSrc, config);
+            if (i % 2 == 1)
+            {
+                logicEngine.link(*scripts[i - 1]->getOutputs()->getChild("value"), *scripts[i]->getInputs()->getChild("value"));
+            }
+        }
+        logicEngine.update();
+
+        // Relink a pair in reverse direction - affects only two scripts regardless of the graph size
+        const Property* output0 = scripts[0]->getOutputs()->getChild("value");
+        const Property* output1 = scripts[1]->getOutputs()->getChild("value");
+        Property* input0 = scripts[0]->getInputs()->getChild("value");
+        Property* input1 = scripts[1]->getInputs()->getChild("value");
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.unlink(*output0, *input1);
+            logicEngine.link(*output1, *input0);
+            logicEngine.update();
+            logicEngine.unlink(*output1, *input0);
+            logicEngine.link(*output0, *input1);
+            logicEngine.update();
+        }
+    }
+
+    // Measures link churn interleaved with update() in a large graph, where each link change affects only two scripts.
+    // The cost should not depend on the total number of scripts
+    // ARG: script count
+    BENCHMARK(BM_Links_RelinkInLargeGraph)->Arg(100)->Arg(1000)->Arg(10000);
+
+    static void BM_Links_PropagateValues_WideSparselyLinkedOutputs(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t outputCount = state.range(0);
+        const int64_t linkCount = state.range(1);
+
+        const std::string srcScriptSrc = fmt::format(R"(
+            function interface()
+                IN.trigger = INT
+                OUT.data = {{}}
+                for i = 0,{},1 do
+                    OUT.data["out"..tostring(i)] = INT
+                end
+            end
+            function run()
+                OUT.data.out0 = IN.trigger
+            end
+        )", outputCount - 1);
+
+        const std::string destScriptSrc = R"(
+            function interface()
+                IN.value = INT
+            end
+            function run()
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        LuaScript* srcScript = logicEngine.createLuaScript(srcScriptSrc, config);
+        const Property* srcOutputs = srcScript->getOutputs()->getChild("data");
+        for (int64_t i = 0; i < linkCount; ++i)
+        {
+            LuaScript* destScript = logicEngine.createLuaScript(destScriptSrc, config);
+            logicEngine.link(*srcOutputs->getChild(fmt::format("out{}", i * outputCount / linkCount)), *destScript->getInputs()->getChild("value"));
+        }
+
+        Property* trigger = srcScript->getInputs()->getChild("trigger");
+        int32_t triggerValue = 0;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            trigger->set<int32_t>(++triggerValue);
+            logicEngine.update();
+        }
+    }
+
+    // Measures the cost of propagating link values of a script which has many output properties, but only few of them are linked.
+    // The cost should depend only on the number of links and not on the number of outputs
+    // ARG0: output count of the source script
+    // ARG1: number of linked outputs
+    BENCHMARK(BM_Links_PropagateValues_WideSparselyLinkedOutputs)
+        ->Args({ 10, 1 })->Args({ 100, 1 })->Args({ 1000, 1 })
+        ->Args({ 10, 5 })->Args({ 100, 5 })->Args({ 1000, 5 });
+}
@@ -13,8 +13,12 @@
 #include "ramses-logic/Property.h"
 
 #include "impl/LogicEngineImpl.h"
+#include "impl/PropertyImpl.h"
+#include "internals/PropertyValueStore.h"
 #include "fmt/format.h"
 
+#include <vector>
+
 namespace rlogic
 {
     static void BM_Property_SetIntValue(benchmark::State& state)
@@ -49,6 +53,203 @@ namespace rlogic
     // Measures time to set the value of a property to script based on how many properties are there in the script's interface()
     // ARG: how many properties are in the script's interface
     BENCHMARK(BM_Property_SetIntValue)->Arg(10)->Arg(100)->Arg(1000);
-}
 
+    static LuaScript* CreateScriptWithNestedInput(LogicEngine& logicEngine)
+    {
+        return logicEngine.createLuaScript(R"(
+            function interface()
+                IN.vehicle = {
+                    doors = ARRAY(4, { angle = FLOAT, open = BOOL })
+                }
+            end
+            function run()
+            end
+        )");
+    }
+
+    static void BM_Property_SetNestedValue_ByPath(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        LuaScript* script = CreateScriptWithNestedInput(logicEngine);
+        float increasingValue = 0.f;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            script->getInputs()->getChild("vehicle")->getChild("doors")->getChild(2u)->getChild("angle")->set<float>(increasingValue);
+            increasingValue += 1.f;
+        }
+    }
+
+    // Measures time to look up a nested property and set its value
+    BENCHMARK(BM_Property_SetNestedValue_ByPath);
+
+    static void BM_Property_SetNestedValue_ByHandle(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        LuaScript* script = CreateScriptWithNestedInput(logicEngine);
+        const PropertyHandle handle = logicEngine.resolvePath(*script, "IN.vehicle.doors[2].angle");
+        float increasingValue = 0.f;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.set<float>(handle, increasingValue);
+            increasingValue += 1.f;
+        }
+    }
+
+    // Measures time to set the value of a nested property over a handle which was resolved once
+    BENCHMARK(BM_Property_SetNestedValue_ByHandle);
+
+    static LuaScript* CreateScriptWithVec4fArray(LogicEngine& logicEngine, int64_t arraySize)
+    {
+        return logicEngine.createLuaScript(fmt::format(R"(
+            function interface()
+                IN.array = ARRAY({}, VEC4F)
+            end
+            function run()
+            end
+        )", arraySize));
+    }
+
+    static void BM_Property_SetArrayElements(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto arraySize = static_cast<size_t>(state.range(0));
+        Property* array = CreateScriptWithVec4fArray(logicEngine, state.range(0))->getInputs()->getChild("array");
+        float increasingValue = 0.f;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (size_t i = 0; i < arraySize; ++i)
+            {
+                array->getChild(i)->set<vec4f>({ increasingValue, 0.f, 0.f, 1.f });
+            }
+            increasingValue += 1.f;
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // Measures time to set all elements of an array one by one
+    // ARG: size of the array
+    BENCHMARK(BM_Property_SetArrayElements)->Arg(16)->Arg(255);
+
+    static void BM_Property_SetArray(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto arraySize = static_cast<size_t>(state.range(0));
+        Property* array = CreateScriptWithVec4fArray(logicEngine, state.range(0))->getInputs()->getChild("array");
+        std::vector<vec4f> values(arraySize, vec4f{ 0.f, 0.f, 0.f, 1.f });
 
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (auto& value : values)
+            {
+                value[0] += 1.f;
+            }
+            array->setArray(values.data(), values.size());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // Measures time to set all elements of an array with one call
+    // ARG: size of the array
+    BENCHMARK(BM_Property_SetArray)->Arg(16)->Arg(255);
+
+    static internal::HierarchicalTypeData CreateFloatStructType(size_t propertyCount)
+    {
+        std::vector<internal::TypeData> properties;
+        properties.reserve(propertyCount);
+        for (size_t i = 0; i < propertyCount; ++i)
+        {
+            properties.emplace_back(fmt::format("param{}", i), EPropertyType::Float);
+        }
+        return internal::MakeStruct("root", properties);
+    }
+
+    static void BM_Property_CopyValues(benchmark::State& state)
+    {
+        const auto propertyCount = static_cast<size_t>(state.range(0));
+
+        // Same as the values of logic nodes in a logic engine, all properties share one store
+        internal::PropertyValueStore valueStore;
+        internal::PropertyImpl sourceA(CreateFloatStructType(propertyCount), internal::EPropertySemantics::ScriptOutput);
+        internal::PropertyImpl sourceB(CreateFloatStructType(propertyCount), internal::EPropertySemantics::ScriptOutput);
+        internal::PropertyImpl target(CreateFloatStructType(propertyCount), internal::EPropertySemantics::ScriptInput);
+        sourceA.moveValuesToStore(valueStore);
+        sourceB.moveValuesToStore(valueStore);
+        target.moveValuesToStore(valueStore);
+        for (size_t i = 0; i < propertyCount; ++i)
+        {
+            sourceB.getChild(i)->m_impl->setValue(1.f);
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // Alternate between the sources, every copy changes the value
+            for (const internal::PropertyImpl* source : { &sourceA, &sourceB })
+            {
+                for (size_t i = 0; i < propertyCount; ++i)
+                {
+                    benchmark::DoNotOptimize(target.getChild(i)->m_impl->copyValue(*source->getChild(i)->m_impl));
+                }
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(2u * propertyCount));
+    }
+
+    // Measures copying of property values like link propagation does, without the overhead of logic nodes
+    // ARG: how many properties are copied
+    BENCHMARK(BM_Property_CopyValues)->Arg(1000)->Arg(100000);
+
+    static void BM_Property_CreateDestroy(benchmark::State& state)
+    {
+        const auto propertyCount = static_cast<size_t>(state.range(0));
+        const internal::HierarchicalTypeData type = CreateFloatStructType(propertyCount);
+
+        internal::PropertyValueStore valueStore;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            internal::PropertyImpl property(type, internal::EPropertySemantics::ScriptInput);
+            property.moveValuesToStore(valueStore);
+        }
+
+        // Memory of the property objects and their values (the names are not included)
+        const size_t bytesPerProperty = sizeof(Property) + sizeof(internal::PropertyImpl) + valueStore.getAllocatedMemory() / propertyCount;
+        state.counters["BytesPerProperty"] = static_cast<double>(bytesPerProperty);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(propertyCount));
+    }
+
+    // Measures creation and destruction of properties and reports the memory footprint per property
+    // ARG: how many properties are created
+    BENCHMARK(BM_Property_CreateDestroy)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+    static void BM_Property_GetChildByName(benchmark::State& state)
+    {
+        const auto propertyCount = static_cast<size_t>(state.range(0));
+        const internal::PropertyImpl root(CreateFloatStructType(propertyCount), internal::EPropertySemantics::ScriptInput);
+
+        std::vector<std::string> names;
+        names.reserve(propertyCount);
+        for (size_t i = 0; i < propertyCount; ++i)
+        {
+            names.emplace_back(fmt::format("param{}", i));
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (const auto& name : names)
+            {
+                benchmark::DoNotOptimize(root.getChild(name));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(propertyCount));
+    }
+
+    // Measures lookup of struct fields by name
+    // ARG: how many fields the struct has
+    BENCHMARK(BM_Property_GetChildByName)->Arg(10)->Arg(50)->Arg(200);
+}
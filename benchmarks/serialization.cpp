@@ -18,6 +18,18 @@
 
 namespace rlogic
 {
+    static std::vector<char> SaveToBuffer(LogicEngine& logicEngine, std::string_view fileName, const SaveFileConfig& config = {})
+    {
+        logicEngine.saveToFile(fileName, config);
+
+        std::ifstream fileStream(std::string(fileName), std::ifstream::binary);
+        fileStream.seekg(0, std::ios::end);
+        std::vector<char> byteBuffer(static_cast<size_t>(fileStream.tellg()));
+        fileStream.seekg(0, std::ios::beg);
+        fileStream.read(byteBuffer.data(), static_cast<std::streamsize>(byteBuffer.size()));
+        return byteBuffer;
+    }
+
     static std::vector<char> CreateLargeLogicEngineBuffer(std::string_view fileName, int64_t scriptCount)
     {
         Logger::SetLogVerbosityLimit(ELogMessageType::Off);
@@ -54,14 +66,20 @@ namespace rlogic
             }
         }
 
-        logicEngine.saveToFile(fileName);
+        return SaveToBuffer(logicEngine, fileName);
+    }
 
-        std::ifstream fileStream(std::string(fileName), std::ifstream::binary);
-        fileStream.seekg(0, std::ios::end);
-        std::vector<char> byteBuffer(static_cast<size_t>(fileStream.tellg()));
-        fileStream.seekg(0, std::ios::beg);
-        fileStream.read(byteBuffer.data(), static_cast<std::streamsize>(byteBuffer.size()));
-        return byteBuffer;
+    // Reports the memory of the properties after loading, the scripts share the type information of their properties
+    static void ReportPropertyMemory(benchmark::State& state, const std::vector<char>& buffer)
+    {
+        LogicEngine logicEngine;
+        logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+
+        const MemoryStatistics statistics = logicEngine.getMemoryStatistics();
+        state.counters["PropertyObjectsBytes"] = static_cast<double>(statistics.propertyObjectsSize);
+        state.counters["PropertyValuesBytes"] = static_cast<double>(statistics.propertyValuesSize);
+        state.counters["PropertyTypesBytes"] = static_cast<double>(statistics.propertyTypesSize);
+        state.counters["PropertyTypesUnsharedBytes"] = static_cast<double>(statistics.propertyTypesUnsharedSize);
     }
 
     static void BM_LoadFromBuffer_WithVerifier(benchmark::State& state)
@@ -77,6 +95,8 @@ namespace rlogic
             LogicEngine logicEngine;
             logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, true);
         }
+
+        ReportPropertyMemory(state, buffer);
     }
 
     // ARG: script count
@@ -95,9 +115,101 @@ namespace rlogic
             LogicEngine logicEngine;
             logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
         }
+
+        ReportPropertyMemory(state, buffer);
     }
 
     // ARG: script count
     BENCHMARK(BM_LoadFromBuffer_WithoutVerifier)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
-}
 
+    static std::vector<char> CreateScriptsBuffer(std::string_view fileName, int64_t scriptCount)
+    {
+        LogicEngine logicEngine;
+
+        // Parsing cost grows with the size of the code, not with the interface
+        const std::string scriptSrc = R"(
+            function interface()
+                IN.speed = FLOAT
+                IN.gear = INT
+                IN.lights = ARRAY(4, BOOL)
+                OUT.needle = VEC3F
+                OUT.label = STRING
+                OUT.warning = BOOL
+            end
+            local function gearName(gear)
+                if gear < 0 then
+                    return "R"
+                elseif gear == 0 then
+                    return "N"
+                end
+                return "D" .. tostring(gear)
+            end
+            local function needleAngle(speed)
+                local maxSpeed = 260
+                local clamped = math.min(math.max(speed, 0), maxSpeed)
+                return -120 + 240 * clamped / maxSpeed
+            end
+            function run()
+                local lightsOn = 0
+                for i = 1, 4 do
+                    if IN.lights[i] then
+                        lightsOn = lightsOn + 1
+                    end
+                end
+                OUT.needle = { 0, 0, needleAngle(IN.speed) }
+                OUT.label = gearName(IN.gear) .. " " .. tostring(math.floor(IN.speed))
+                OUT.warning = lightsOn < 4 and IN.speed > 50
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+        config.addStandardModuleDependency(EStandardModule::Math);
+
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            logicEngine.createLuaScript(scriptSrc, config);
+        }
+
+        SaveFileConfig saveConfig;
+        saveConfig.setLuaByteCodeEnabled(true);
+        return SaveToBuffer(logicEngine, fileName, saveConfig);
+    }
+
+    static void BM_LoadFromBuffer_ScriptsFromByteCode(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::vector<char> buffer = CreateScriptsBuffer("scripts.bin", scriptCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false, true);
+        }
+    }
+
+    // ARG: script count
+    BENCHMARK(BM_LoadFromBuffer_ScriptsFromByteCode)->Arg(100)->Arg(1500)->Unit(benchmark::kMillisecond);
+
+    static void BM_LoadFromBuffer_ScriptsFromSource(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        // Same file as above, but the byte code is not loaded
+        const std::vector<char> buffer = CreateScriptsBuffer("scripts.bin", scriptCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        }
+    }
+
+    // ARG: script count
+    BENCHMARK(BM_LoadFromBuffer_ScriptsFromSource)->Arg(100)->Arg(1500)->Unit(benchmark::kMillisecond);
+}
@@ -10,10 +10,13 @@
 
 #include "ramses-logic/LogicEngine.h"
 #include "ramses-logic/LuaScript.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/ExpressionNode.h"
 #include "ramses-logic/Property.h"
 
 #include "impl/LogicEngineImpl.h"
 #include "fmt/format.h"
+#include <array>
 
 namespace rlogic
 {
@@ -132,14 +135,15 @@ namespace rlogic
     // first in the list has its 'dirty_trigger' value changed, all scripts in the change will be
     // triggered for re-execution, whereas setting the trigger on the last script will only have the
     // last script executed
-    // Read the results like this: the higher the arg (0 .. 99) the faster the update should be, ideally
-    // when the arg is close to 99, the time to update should be close to zero
+    // Read the results like this: the higher the second arg (0 .. scriptCount-1) the faster the update should be, ideally
+    // when the arg is close to the script count, the time to update should be close to zero regardless of the total
+    // number of scripts (only the dirty scripts are visited during update)
     static void BM_Update_IsFasterWithFewerDirtyScripts(benchmark::State& state)
     {
         LogicEngine logicEngine;
 
-        const int64_t scriptToSetDirty = state.range(0);
-        constexpr int64_t scriptCount = 100;
+        const int64_t scriptCount = state.range(0);
+        const int64_t scriptToSetDirty = state.range(1);
 
         const std::string scriptSrc = R"(
             function interface()
@@ -197,7 +201,331 @@ namespace rlogic
         }
     }
 
-    BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)->Arg(0)->Arg(49)->Arg(99)->Unit(benchmark::kMillisecond);
-}
+    // ARG0: total number of scripts in the chain
+    // ARG1: index of the script to set dirty (all scripts after it in the chain are executed too)
+    BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)
+        ->Args({ 100, 0 })->Args({ 100, 49 })->Args({ 100, 99 })
+        ->Args({ 10000, 9997 })->Args({ 20000, 19997 })
+        ->Unit(benchmark::kMillisecond);
+
+    // Measures how update() of many independent scripts scales when scripts are spread over execution groups
+    // (separate Lua states) and executed on several threads. All scripts are dirty in every iteration
+    static void BM_Update_ScriptsInExecutionGroups(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+        const int64_t groupCount = state.range(1);
+        logicEngine.setUpdateThreadCount(static_cast<size_t>(state.range(2)));
+
+        const std::string scriptSrc = R"(
+            function interface()
+                IN.param = INT
+                OUT.param = INT
+            end
+            function run()
+                local sum = 0
+                for i = 1,100,1 do
+                    sum = sum + IN.param * i
+                end
+                OUT.param = sum
+            end
+        )";
+
+        std::vector<Property*> inputs;
+        inputs.reserve(static_cast<size_t>(scriptCount));
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            LuaConfig config;
+            config.setExecutionGroup(static_cast<uint32_t>(i % groupCount));
+            inputs.push_back(logicEngine.createLuaScript(scriptSrc, config)->getInputs()->getChild("param"));
+        }
+
+        int32_t value = 1;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (Property* input : inputs)
+            {
+                input->set<int32_t>(value);
+            }
+            ++value;
+            logicEngine.update();
+        }
+    }
+
+    // ARG0: number of (unlinked) scripts
+    // ARG1: number of execution groups the scripts are distributed over round-robin
+    // ARG2: number of update threads
+    BENCHMARK(BM_Update_ScriptsInExecutionGroups)
+        ->Args({ 2000, 1, 1 })->Args({ 2000, 1, 4 })
+        ->Args({ 2000, 4, 1 })->Args({ 2000, 4, 2 })->Args({ 2000, 4, 4 })
+        ->Args({ 2000, 8, 8 })
+        ->Unit(benchmark::kMicrosecond);
+
+    // Measures the overhead of executing scripts, i.e. everything but the code in their run() function
+    // All scripts are dirty in every iteration
+    static void BM_Update_ScriptsWithEmptyRun(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface()
+                IN.param = INT
+            end
+            function run()
+            end
+        )";
 
+        std::vector<Property*> inputs;
+        inputs.reserve(static_cast<size_t>(scriptCount));
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            inputs.push_back(logicEngine.createLuaScript(scriptSrc)->getInputs()->getChild("param"));
+        }
 
+        int32_t value = 1;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (Property* input : inputs)
+            {
+                input->set<int32_t>(value);
+            }
+            ++value;
+            logicEngine.update();
+        }
+    }
+
+    // ARG: number of (unlinked) scripts
+    BENCHMARK(BM_Update_ScriptsWithEmptyRun)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    static std::string CreateVectorMathScript(std::string_view runBody, int64_t loopCount)
+    {
+        return fmt::format(R"(
+            function interface()
+                IN.position = VEC3F
+                IN.velocity = VEC3F
+                IN.dt = FLOAT
+                OUT.position = VEC3F
+            end
+            function run()
+                for i = 1,{},1 do
+                    {}
+                end
+            end
+        )", loopCount, runBody);
+    }
+
+    static void RunVectorMathScript(benchmark::State& state, std::string_view runBody)
+    {
+        LogicEngine logicEngine;
+
+        LuaScript* script = logicEngine.createLuaScript(CreateVectorMathScript(runBody, state.range(0)));
+        script->getInputs()->getChild("velocity")->set<vec3f>({ 1.f, 2.f, 3.f });
+        script->getInputs()->getChild("dt")->set<float>(0.1f);
+
+        logicEngine.m_impl->disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Integrates a position with vector math based on Lua tables
+    static void BM_Update_VectorMathWithTables(benchmark::State& state)
+    {
+        RunVectorMathScript(state, R"(
+                    local p = IN.position
+                    local v = IN.velocity
+                    local dt = IN.dt
+                    OUT.position = {p[1] + v[1] * dt, p[2] + v[2] * dt, p[3] + v[3] * dt})");
+    }
+
+    // Same as BM_Update_VectorMathWithTables, but with vec3 values and their arithmetic operators
+    static void BM_Update_VectorMathWithVectorTypes(benchmark::State& state)
+    {
+        RunVectorMathScript(state, "OUT.position = IN.position + IN.velocity * IN.dt");
+    }
+
+    // ARG: how many times the position is integrated in the script's run() method
+    BENCHMARK(BM_Update_VectorMathWithTables)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_Update_VectorMathWithVectorTypes)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    static void RunArrayScaleScript(benchmark::State& state, std::string_view runBody)
+    {
+        LogicEngine logicEngine;
+
+        const std::string scriptSrc = fmt::format(R"(
+            function interface()
+                IN.array = ARRAY(255, VEC4F)
+                OUT.array = ARRAY(255, VEC4F)
+            end
+            function run()
+                {}
+            end
+        )", runBody);
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::ArrayMath);
+        logicEngine.createLuaScript(scriptSrc, config);
+
+        logicEngine.m_impl->disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Scales all elements of an array property element by element in Lua
+    static void BM_Update_ScaleArrayInLua(benchmark::State& state)
+    {
+        RunArrayScaleScript(state, R"(
+                local result = {}
+                for i, v in rl_ipairs(IN.array) do
+                    result[i] = {v[1] * 2, v[2] * 2, v[3] * 2, v[4] * 2}
+                end
+                OUT.array = result)");
+    }
+
+    // Same as BM_Update_ScaleArrayInLua, but with a single call of the 'arraymath' standard module
+    static void BM_Update_ScaleArrayWithArrayMath(benchmark::State& state)
+    {
+        RunArrayScaleScript(state, "arraymath.scale(OUT.array, IN.array, 2)");
+    }
+
+    BENCHMARK(BM_Update_ScaleArrayInLua)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_Update_ScaleArrayWithArrayMath)->Unit(benchmark::kMicrosecond);
+
+    // Number of signals filtered by each node of the smoothing filter benchmarks (arrays can have up to 255 elements)
+    constexpr size_t SmoothingFilterSignals = 200u;
+
+    // Low-pass filter which moves its outputs towards the input signals, with a Lua script per node
+    static void BM_Update_SmoothingFilterInLua(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const std::string scriptSrc = fmt::format(R"(
+            function interface()
+                IN.factor = FLOAT
+                IN.signals = ARRAY({0}, FLOAT)
+                OUT.smoothed = ARRAY({0}, FLOAT)
+            end
+            function run()
+                local factor = IN.factor
+                local signals = IN.signals
+                local smoothed = OUT.smoothed
+                local result = {{}}
+                for i = 1,{0},1 do
+                    local last = smoothed[i]
+                    result[i] = last + (signals[i] - last) * factor
+                end
+                OUT.smoothed = result
+            end
+        )", SmoothingFilterSignals);
+
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            LuaScript* script = logicEngine.createLuaScript(scriptSrc);
+            script->getInputs()->getChild("factor")->set<float>(0.1f);
+        }
+
+        logicEngine.m_impl->disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Same as BM_Update_SmoothingFilterInLua, but with a native node type
+    static void BM_Update_SmoothingFilterInNativeNode(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        logicEngine.registerNativeNodeType("smoothing",
+            { {"factor", EPropertyType::Float}, {"signals", EPropertyType::Array, EPropertyType::Float, SmoothingFilterSignals} },
+            { {"smoothed", EPropertyType::Array, EPropertyType::Float, SmoothingFilterSignals} },
+            [](NativeNodeUpdateContext& context) {
+                const float factor = *context.getInputs().getChild(0u)->get<float>();
+                std::array<float, SmoothingFilterSignals> signals{};
+                std::array<float, SmoothingFilterSignals> smoothed{};
+                context.getInputs().getChild(1u)->getArray(signals.data(), signals.size());
+                context.getOutputs().getChild(0u)->getArray(smoothed.data(), smoothed.size());
+                for (size_t i = 0; i < smoothed.size(); ++i)
+                    smoothed[i] += (signals[i] - smoothed[i]) * factor;
+                context.setOutputArray(0u, smoothed.data(), smoothed.size());
+            });
+
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            NativeNode* nativeNode = logicEngine.createNativeNode("smoothing");
+            nativeNode->getInputs()->getChild("factor")->set<float>(0.1f);
+        }
+
+        logicEngine.m_impl->disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // ARG: number of filter nodes, each filters SmoothingFilterSignals signals
+    BENCHMARK(BM_Update_SmoothingFilterInLua)->Arg(1)->Arg(2)->Arg(10)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_Update_SmoothingFilterInNativeNode)->Arg(1)->Arg(2)->Arg(10)->Unit(benchmark::kMicrosecond);
+
+    // Small expression like it is typically used to scale or offset a value, with a Lua script per node
+    static void BM_Update_ExpressionInLua(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const std::string_view scriptSrc = R"(
+            function interface()
+                IN.a = FLOAT
+                IN.b = FLOAT
+                IN.c = FLOAT
+                OUT.x = FLOAT
+            end
+            function run()
+                OUT.x = IN.a * IN.b + IN.c
+            end
+        )";
+
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            LuaScript* script = logicEngine.createLuaScript(scriptSrc);
+            script->getInputs()->getChild("a")->set<float>(2.f);
+        }
+
+        logicEngine.m_impl->disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Same as BM_Update_ExpressionInLua, but with an expression node
+    static void BM_Update_ExpressionNode(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            ExpressionNode* expressionNode = logicEngine.createExpressionNode("OUT.x = IN.a * IN.b + IN.c", { {"a"}, {"b"}, {"c"} });
+            expressionNode->getInputs()->getChild("a")->set<float>(2.f);
+        }
+
+        logicEngine.m_impl->disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // ARG: number of nodes
+    BENCHMARK(BM_Update_ExpressionInLua)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_Update_ExpressionNode)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+}
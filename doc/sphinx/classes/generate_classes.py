@@ -33,6 +33,7 @@ content = [
         'Iterator',
         'Collection',
         'LuaConfig',
+        'SaveFileConfig',
     ],
     },
     {
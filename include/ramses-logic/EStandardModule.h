@@ -22,6 +22,7 @@ namespace rlogic
         Table,      //< The Table module mapped to the Lua environment as a table named 'table'
         Math,       //< The Math module mapped to the Lua environment as a table named 'math'
         Debug,      //< The Debug module mapped to the Lua environment as a table named 'debug'
+        ArrayMath,  //< Native functions which process whole array properties (copy, scale, add, lerp, transform, clamp, sum), mapped as a table named 'arraymath'
         All,        //< Use this to load all standard modules
     };
 }
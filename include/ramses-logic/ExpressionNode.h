@@ -0,0 +1,92 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicNode.h"
+#include <memory>
+#include <string_view>
+
+namespace rlogic::internal
+{
+    class ExpressionNodeImpl;
+}
+
+namespace rlogic
+{
+    /**
+    * A logic node which computes its outputs from its inputs with simple expressions, without executing Lua.
+    * Expression nodes are created with #rlogic::LogicEngine::createExpressionNode. They are meant to replace
+    * one-line scripts like 'OUT.x = IN.a * IN.b + IN.c' - the expression is compiled once into a compact
+    * list of typed instructions, which is much cheaper to execute than a Lua script.
+    *
+    * The expression consists of one or more assignments 'OUT.name = <expression>' (optionally separated with ';').
+    * Each assignment creates an output with the type of its expression, in the order of the assignments.
+    * Expressions use Lua syntax and can contain:
+    * - inputs ('IN.name'), number literals ('1' is an Int32, '1.0' or '1e3' are Float), 'true' and 'false'
+    * - arithmetic operators + - * / and unary -, on Int32, Float and vectors (component-wise, or between a vector and a number).
+    *   Int32 operands are converted to Float when mixed with Float operands, '/' always converts to Float
+    * - comparisons < <= > >= on numbers, == and ~= on numbers, vectors and bools
+    * - 'and', 'or' and 'not' on bools
+    * - vector constructors vec2(), vec3() and vec4() with numbers as arguments, vector components ('.x', '.y', '.z', '.w')
+    * - the functions min(a, b), max(a, b), clamp(x, min, max), abs(x), floor(x), ceil(x), sqrt(x), lerp(a, b, t),
+    *   dot(a, b), length(v) and select(condition, a, b), which returns a if condition is true and b otherwise.
+    *   Note that floor() and ceil() return a Float (or vector), unlike their Lua counterparts
+    * - comments starting with '--' until the end of the line
+    *
+    * Expression nodes behave like scripts otherwise: they can be linked with other logic nodes, are only updated when
+    * one of their inputs changed and are saved to files (together with the compiled expression).
+    */
+    class ExpressionNode : public LogicNode
+    {
+    public:
+        /**
+        * Returns the expression which was passed to #rlogic::LogicEngine::createExpressionNode
+        *
+        * @return the expression of the node
+        */
+        [[nodiscard]] RLOGIC_API std::string_view getExpression() const;
+
+        /**
+        * Constructor of ExpressionNode. User is not supposed to call this - ExpressionNodes are created by other factory classes
+        *
+        * @param impl implementation details of the ExpressionNode
+        */
+        explicit ExpressionNode(std::unique_ptr<internal::ExpressionNodeImpl> impl) noexcept;
+
+        /**
+        * Destructor of ExpressionNode.
+        */
+        ~ExpressionNode() noexcept override;
+
+        /**
+        * Copy Constructor of ExpressionNode is deleted because ExpressionNodes are not supposed to be copied
+        */
+        ExpressionNode(const ExpressionNode&) = delete;
+
+        /**
+        * Move Constructor of ExpressionNode is deleted because ExpressionNodes are not supposed to be moved
+        */
+        ExpressionNode(ExpressionNode&&) = delete;
+
+        /**
+        * Assignment operator of ExpressionNode is deleted because ExpressionNodes are not supposed to be copied
+        */
+        ExpressionNode& operator=(const ExpressionNode&) = delete;
+
+        /**
+        * Move assignment operator of ExpressionNode is deleted because ExpressionNodes are not supposed to be moved
+        */
+        ExpressionNode& operator=(ExpressionNode&&) = delete;
+
+        /**
+        * Implementation of ExpressionNode
+        */
+        internal::ExpressionNodeImpl& m_expressionNodeImpl;
+    };
+}
@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EPropertyType.h"
+#include <vector>
+#include <string>
+
+namespace rlogic
+{
+    /**
+    * Declares one input of an #rlogic::ExpressionNode, see #rlogic::LogicEngine::createExpressionNode.
+    * Expressions support inputs of type #rlogic::EPropertyType::Float, #rlogic::EPropertyType::Vec2f,
+    * #rlogic::EPropertyType::Vec3f, #rlogic::EPropertyType::Vec4f, #rlogic::EPropertyType::Int32
+    * and #rlogic::EPropertyType::Bool.
+    */
+    struct ExpressionNodeInput
+    {
+        /// Name of the input, must be a valid identifier (letters, digits and '_', not starting with a digit) and unique within the inputs
+        std::string name;
+        /// Type of the input
+        EPropertyType type = EPropertyType::Float;
+    };
+    using ExpressionNodeInputs = std::vector<ExpressionNodeInput>;
+}
@@ -12,13 +12,22 @@
 #include "ramses-logic/Collection.h"
 #include "ramses-logic/ErrorData.h"
 #include "ramses-logic/LuaConfig.h"
+#include "ramses-logic/SaveFileConfig.h"
 #include "ramses-logic/EPropertyType.h"
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/ERotationType.h"
 #include "ramses-logic/LogicEngineReport.h"
+#include "ramses-logic/MemoryStatistics.h"
+#include "ramses-logic/PropertyHandle.h"
+#include "ramses-logic/NativeNodeTypes.h"
+#include "ramses-logic/ExpressionNodeTypes.h"
 
 #include <vector>
 #include <string_view>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <utility>
 
 namespace ramses
 {
@@ -45,6 +54,8 @@ namespace rlogic
     class DataArray;
     class AnimationNode;
     class TimerNode;
+    class NativeNode;
+    class ExpressionNode;
 
     /**
     * Central object which creates and manages the lifecycle and execution
@@ -128,6 +139,26 @@ namespace rlogic
             const LuaConfig& config = {},
             std::string_view scriptName = "");
 
+        /**
+        * Creates a new instance of an existing Lua script. The instance shares the source code and the compiled
+        * Lua code with the \p prototype, and uses the same module dependencies and execution group. The source is
+        * not compiled again and interface() is not executed again, the instance has the same inputs and outputs as the
+        * \p prototype, initialized with default values (not with the current values of the \p prototype). The instance
+        * gets its own Lua environment and GLOBAL table, init() is executed for it if the script defines it.
+        * Use this to create many scripts from the same source, e.g. one per UI widget, which is much faster
+        * than calling #createLuaScript for each of them. When saved to a file, the source code is stored only once.
+        * Instances are independent scripts, destroying the \p prototype doesn't affect them.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param prototype the script to instantiate, must be created by this #LogicEngine
+        * @param scriptName name to assign to the instance once it's created
+        * @return a pointer to the created object or nullptr if
+        * something went wrong during creation. In that case, use #getErrors() to obtain errors.
+        * The script can be destroyed by calling the #destroy method
+        */
+        RLOGIC_API LuaScript* createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName = "");
+
         /**
          * Creates a new #rlogic::LuaModule from Lua source code.
          * LuaModules can be used to share code and data constants across scripts or
@@ -272,6 +303,59 @@ namespace rlogic
         */
         RLOGIC_API TimerNode* createTimerNode(std::string_view name = "");
 
+        /**
+        * Registers a type of #rlogic::NativeNode, i.e. a logic node which executes the C++ function \p updateFunction instead
+        * of a Lua script. Nodes of the type are created with #createNativeNode, they have the inputs and outputs declared
+        * here in the same order. The inputs and outputs can be primitives or arrays of primitives, see
+        * #rlogic::NativeNodePropertyDeclaration. Registered types can't be changed or removed.
+        *
+        * The type is not saved to files, only the nodes of the type are (with their type name and property values).
+        * All native node types which are used in a file must be registered with the same name and interface before
+        * the file is loaded with #loadFromFile or #loadFromBuffer, otherwise loading fails.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param typeName unique name of the type, used to find the type when a file is loaded
+        * @param inputs the inputs of the nodes of the type
+        * @param outputs the outputs of the nodes of the type
+        * @param updateFunction the function which is called when a node of the type is updated, see #rlogic::NativeNodeUpdateFunction
+        * @return true if the type was registered, false if a type with the name already exists or any declaration is invalid.
+        * In that case, use #getErrors() to obtain errors.
+        */
+        RLOGIC_API bool registerNativeNodeType(
+            std::string_view typeName,
+            const NativeNodePropertyDeclarations& inputs,
+            const NativeNodePropertyDeclarations& outputs,
+            NativeNodeUpdateFunction updateFunction);
+
+        /**
+        * Creates a new #rlogic::NativeNode of a type which was registered with #registerNativeNodeType.
+        * Refer to #rlogic::NativeNode for more information about its use.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param typeName the name of a registered native node type
+        * @param name a name for the new #rlogic::NativeNode.
+        * @return a pointer to the created object or nullptr if
+        * the type is not registered. In that case, use #getErrors() to obtain errors.
+        */
+        RLOGIC_API NativeNode* createNativeNode(std::string_view typeName, std::string_view name = "");
+
+        /**
+        * Creates a new #rlogic::ExpressionNode which computes its outputs from its inputs with the given \p expression,
+        * e.g. 'OUT.x = IN.a * IN.b + IN.c'. The inputs are declared with \p inputs, the outputs are created from the
+        * assignments in the expression. The expression is compiled once here, see #rlogic::ExpressionNode for the syntax.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param expression the expression which assigns the outputs
+        * @param inputs names and types of the inputs which can be used in the expression
+        * @param name a name for the new #rlogic::ExpressionNode.
+        * @return a pointer to the created object or nullptr if
+        * the expression or the inputs are invalid. In that case, use #getErrors() to obtain errors.
+        */
+        RLOGIC_API ExpressionNode* createExpressionNode(std::string_view expression, const ExpressionNodeInputs& inputs, std::string_view name = "");
+
         /**
          * Updates all #rlogic::LogicNode's which were created by this #LogicEngine instance.
          * The order in which #rlogic::LogicNode's are executed is determined by the links created
@@ -279,8 +363,7 @@ namespace rlogic
          * between then are executed in arbitrary order, but the order is always the same between two
          * invocations of #update without any calls to #link or #unlink between them.
          * As an optimization #rlogic::LogicNode's are only updated, if at least one input of a #rlogic::LogicNode
-         * has changed since the last call to #update. If the links between logic nodes create a loop,
-         * this method will fail with an error and will not execute any of the logic nodes.
+         * has changed since the last call to #update.
          *
          * Attention! This method clears all previous errors! See also docs of #getErrors()
          *
@@ -289,6 +372,106 @@ namespace rlogic
          */
         RLOGIC_API bool update();
 
+        /**
+         * Same as #update, but stops executing #rlogic::LogicNode's when the execution took longer than \p timeBudget.
+         * Use this to spread expensive updates over several frames. If the update was interrupted, #isUpdatePending returns
+         * true and the next call to #update or #update(std::chrono::microseconds) continues with the remaining dirty
+         * #rlogic::LogicNode's (timer nodes are not updated again for the continued update). The budget is checked between
+         * two executed #rlogic::LogicNode's, at least one #rlogic::LogicNode is executed per call. The update is never
+         * interrupted between a binding (e.g. #rlogic::RamsesNodeBinding) and the #rlogic::LogicNode's which provide its input
+         * values, so that Ramses objects never receive a mix of values from interrupted and continued updates.
+         * Links can be changed and objects destroyed between two calls, the continued update respects the changes.
+         * While the update report is enabled (see #enableUpdateReport), it lists the #rlogic::LogicNode's executed
+         * by each call with their execution times, but no skipped nodes.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param timeBudget the time after which no further #rlogic::LogicNode is executed
+         * @return true if the update was successful (also if it was interrupted), false otherwise
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool update(std::chrono::microseconds timeBudget);
+
+        /**
+         * Returns true if the last call to #update(std::chrono::microseconds) was interrupted because the time budget
+         * was exceeded and there are still #rlogic::LogicNode's which need to be executed.
+         *
+         * @return true if an interrupted update has to be continued, false otherwise
+         */
+        [[nodiscard]] RLOGIC_API bool isUpdatePending() const;
+
+        /**
+         * Same as #update, but executes the #rlogic::LogicNode's on a worker thread and returns right away, so that
+         * the application can do other work on the calling thread meanwhile. The returned future provides the result
+         * which #update would return.
+         *
+         * Bindings (e.g. #rlogic::RamsesNodeBinding) don't pass their values to Ramses while updating asynchronously,
+         * the values are recorded instead and applied to the Ramses objects by #commit. Until then, the Ramses objects keep
+         * the values of the last commit, i.e. the scene can be used (and rendered) during the update. Any call to #update,
+         * #updateSubgraph or #updateAsync before #commit records the binding values too, #commit applies all of them.
+         *
+         * All methods of #LogicEngine wait until the update has finished, after that all properties have the values of the
+         * finished update - same as after a call to #update. The same applies to #rlogic::Property::get, #rlogic::Property::set,
+         * #rlogic::Property::getArray and #rlogic::Property::setArray of the properties of this #LogicEngine's logic nodes.
+         * All other methods of the logic objects must not be called while the update is running.
+         *
+         * The update is executed by a worker thread of the #LogicEngine, which is started with the first call to #updateAsync
+         * and kept until the #LogicEngine is destroyed.
+         *
+         * Attention! This method clears all previous errors once the update starts! See also docs of #getErrors()
+         *
+         * @return a future which holds true if the update was successful, false otherwise.
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API std::shared_future<bool> updateAsync();
+
+        /**
+         * Applies the binding values recorded by #updateAsync (and the updates which followed it) to the Ramses objects.
+         * Has to be called on the thread which owns the Ramses scene. Waits for a running #updateAsync to finish first.
+         * After #commit, bindings pass their values to Ramses during the update again, until the next call to #updateAsync.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @return true if all values were applied, false if Ramses reported an error. The other values are applied nevertheless,
+         * the bindings whose values Ramses rejected apply them again in the next update.
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool commit();
+
+        /**
+         * Updates only the \p target #rlogic::LogicNode and the #rlogic::LogicNode's it depends on, i.e. all nodes which are linked
+         * to its inputs directly or over other nodes. Use this if only the values of one #rlogic::LogicNode are needed,
+         * e.g. a #rlogic::RamsesCameraBinding for rendering a thumbnail. Same as with #update, only dirty #rlogic::LogicNode's
+         * are executed and links are resolved in the same order. All other #rlogic::LogicNode's are not executed - if they
+         * have changed inputs (also because of links from the executed subgraph), they are executed by the next call to #update.
+         * The set of nodes which \p target depends on is cached until links are changed with #link, #unlink or #destroy.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param target the #rlogic::LogicNode which should be updated together with the nodes it depends on
+         * @return true if the update was successful, false otherwise
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool updateSubgraph(const LogicNode& target);
+
+        /**
+        * Sets the number of threads which #update uses to execute logic nodes. By default only the thread
+        * which calls #update is used. With more threads, #rlogic::AnimationNode's, #rlogic::TimerNode's, #rlogic::ExpressionNode's and
+        * #rlogic::LuaScript's which don't depend on each other (i.e. are not linked directly or indirectly) are
+        * executed in parallel. Scripts of the same execution group share a Lua state and are therefore executed
+        * one after another, see #rlogic::LuaConfig::setExecutionGroup. Ramses bindings are always executed on the
+        * thread which calls #update, because Ramses objects can't be modified from multiple threads. Values are
+        * propagated over links on the calling thread too, so the results of #update don't depend on the thread count.
+        * Parallel execution pays off only when many independent nodes need to be updated at once, for few nodes
+        * the synchronization overhead outweighs the gain.
+        * Note that nodes are executed sequentially while the update report is enabled (see #enableUpdateReport).
+        *
+        * @param threadCount number of threads to use, including the thread which calls #update. 0 and 1 disable
+        *        parallel execution. Worker threads are started by this call and stopped when the count is reduced
+        *        or the #LogicEngine is destroyed.
+        */
+        RLOGIC_API void setUpdateThreadCount(size_t threadCount);
+
         /**
         * Enables collecting of statistics during call to #update which can be obtained using #getLastUpdateReport.
         * Once enabled every subsequent call to #update will be instructed to collect various statistical data
@@ -312,6 +495,16 @@ namespace rlogic
         */
         [[nodiscard]] RLOGIC_API LogicEngineReport getLastUpdateReport() const;
 
+        /**
+        * Returns the memory used by the properties of all logic nodes, and how much memory is saved by
+        * sharing the type information of properties with the same layout, as well as the memory of the Lua states.
+        * See #rlogic::MemoryStatistics for details. The statistics are collected when calling this method, it is not
+        * recommended to call it every frame.
+        *
+        * @return memory statistics of the properties of all logic nodes and of the Lua states
+        */
+        [[nodiscard]] RLOGIC_API MemoryStatistics getMemoryStatistics() const;
+
         /**
          * Links a property of a #rlogic::LogicNode to another #rlogic::Property of another #rlogic::LogicNode.
          * After linking, calls to #update will propagate the value of \p sourceProperty to
@@ -327,10 +520,8 @@ namespace rlogic
          * - \p targetProperty is not an input (see #rlogic::LogicNode::getInputs())
          * - either \p sourceProperty or \p targetProperty is not a primitive property (you have to link sub-properties
          *   of structs and arrays individually)
-         *
-         * Creating link loops will cause the next call to #update() to fail with an error. Loops
-         * are directional, it is OK to have A->B, A->C and B->C, but is not OK to have
-         * A->B->C->A.
+         * - the link would create a loop. Loops are directional, it is OK to have A->B, A->C and B->C, but is not OK
+         *   to have A->B->C->A. The error lists the links which form the loop
          *
          * After calling #link, the value of the \p targetProperty will not change until the next call to #update. Creating
          * and destroying links generally has no effect until #update is called.
@@ -366,6 +557,48 @@ namespace rlogic
          */
         [[nodiscard]] RLOGIC_API bool isLinked(const LogicNode& logicNode) const;
 
+        /**
+         * Resolves a path to a primitive property of \p logicNode and returns a handle to it. The value of the
+         * property can then be accessed with #set and #get, without looking up the property again. This is
+         * faster than walking the property tree with #rlogic::Property::getChild for every access.
+         *
+         * The path starts with the name of the root property ('IN' for inputs, 'OUT' for outputs), followed
+         * by struct field names separated by '.' and array indices in square brackets. Array indices are
+         * zero-based, same as in #rlogic::Property::getChild(size_t). Example: 'IN.vehicle.doors[2].angle'
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param logicNode the node which owns the property
+         * @param path the path to the property as described above
+         * @return a valid handle if the path refers to a primitive property, an invalid handle otherwise. In that case,
+         * use #getErrors() to obtain errors.
+         */
+        [[nodiscard]] RLOGIC_API PropertyHandle resolvePath(LogicNode& logicNode, std::string_view path);
+
+        /**
+         * Sets the value of the property which \p handle refers to. Same as #rlogic::Property::set, but without
+         * looking up the property. Setting the value fails if T does not match the type of the property,
+         * if the property is an output or if it is linked. It also fails if the handle was resolved by another #LogicEngine
+         * or if the #rlogic::LogicNode which owns the property was destroyed. Errors are logged, same as with
+         * #rlogic::Property::set, this method doesn't change the errors of #getErrors()
+         *
+         * @param handle a valid handle obtained from #resolvePath
+         * @param value the value to set
+         * @return true if the value was set, false otherwise
+         */
+        template <typename T>
+        bool set(PropertyHandle handle, T value);
+
+        /**
+         * Returns the value of the property which \p handle refers to. Same as #rlogic::Property::get, but without
+         * looking up the property. Fails for the same handles as #set, errors are logged.
+         *
+         * @param handle a valid handle obtained from #resolvePath
+         * @return the value of the property or std::nullopt if T does not match the type of the property or the handle can't be used
+         */
+        template <typename T>
+        [[nodiscard]] std::optional<T> get(PropertyHandle handle) const;
+
         /**
          * Returns the list of all errors which occurred during the last API call to a #LogicEngine method
          * or any other method of its subclasses (scripts, bindings etc). Note that errors get wiped by all
@@ -417,10 +650,11 @@ namespace rlogic
          * Attention! This method clears all previous errors! See also docs of #getErrors()
          *
          * @param filename path to file to save the data (relative or absolute). The file will be created or overwritten if it exists!
+         * @param config optional settings which influence what is saved, see #rlogic::SaveFileConfig
          * @return true if saving was successful, false otherwise. To get more detailed
          * error information use #getErrors()
          */
-        RLOGIC_API bool saveToFile(std::string_view filename);
+        RLOGIC_API bool saveToFile(std::string_view filename, const SaveFileConfig& config = {});
 
         /**
          * Loads the whole LogicEngine data from the given file. See also #saveToFile().
@@ -441,10 +675,14 @@ namespace rlogic
          * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
          * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
          *        Disable this only if the file comes from a trusted source and performance is paramount.
+         * @param loadLuaByteCode flag to load the Lua byte code of scripts and modules instead of compiling their source, if the file
+         *        contains byte code (see #rlogic::SaveFileConfig::setLuaByteCodeEnabled) which is compatible with the Lua version and
+         *        architecture of the application. Lua can't verify byte code, therefore it's never loaded if \p enableMemoryVerification
+         *        is true. Enable this only if the file comes from a trusted source.
          * @return true if deserialization was successful, false otherwise. To get more detailed
          * error information use #getErrors()
          */
-        RLOGIC_API bool loadFromFile(std::string_view filename, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
+        RLOGIC_API bool loadFromFile(std::string_view filename, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true, bool loadLuaByteCode = false);
 
         /**
         * Loads the whole LogicEngine data from the given memory buffer. This method is equivalent to
@@ -458,10 +696,12 @@ namespace rlogic
         * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
         * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
         *        Disable this only if the file comes from a trusted source and performance is paramount.
+        * @param loadLuaByteCode flag to load the Lua byte code of scripts and modules instead of compiling their source,
+        *        see #loadFromFile. Never used if \p enableMemoryVerification is true.
         * @return true if deserialization was successful, false otherwise. To get more detailed
         * error information use #getErrors()
         */
-        RLOGIC_API bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
+        RLOGIC_API bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true, bool loadLuaByteCode = false);
 
         /**
         * Copy Constructor of LogicEngine is deleted because logic engines hold named resources and are not supposed to be copied
@@ -530,6 +770,25 @@ namespace rlogic
         template <typename T>
         RLOGIC_API DataArray* createDataArrayInternal(const std::vector<T>& data, std::string_view name);
 
+        /**
+        * Internal implementation of #set
+        *
+        * @param handle the handle
+        * @param value the value
+        * @return true if the value was set
+        */
+        template <typename T>
+        RLOGIC_API bool setInternal(PropertyHandle handle, T value);
+
+        /**
+        * Internal implementation of #get
+        *
+        * @param handle the handle
+        * @return the value
+        */
+        template <typename T>
+        [[nodiscard]] RLOGIC_API std::optional<T> getInternal(PropertyHandle handle) const;
+
         /// Internal static helper to validate type
         template <typename T>
         static void StaticTypeCheck();
@@ -564,6 +823,20 @@ namespace rlogic
         return createDataArrayInternal<T>(data, name);
     }
 
+    template <typename T>
+    bool LogicEngine::set(PropertyHandle handle, T value)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call set<T> only with types which have a value! Read the docs of the method!");
+        return setInternal<T>(handle, std::move(value));
+    }
+
+    template <typename T>
+    std::optional<T> LogicEngine::get(PropertyHandle handle) const
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call get<T> only with types which have a value! Read the docs of the method!");
+        return getInternal<T>(handle);
+    }
+
     template <typename T>
     void LogicEngine::StaticTypeCheck()
     {
@@ -576,7 +849,9 @@ namespace rlogic
             std::is_same_v<T, RamsesCameraBinding> ||
             std::is_same_v<T, DataArray> ||
             std::is_same_v<T, AnimationNode> ||
-            std::is_same_v<T, TimerNode>,
+            std::is_same_v<T, TimerNode> ||
+            std::is_same_v<T, NativeNode> ||
+            std::is_same_v<T, ExpressionNode>,
             "Attempting to retrieve invalid type of object.");
     }
 }
@@ -12,6 +12,7 @@
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <cstdint>
 
 namespace rlogic::internal
 {
@@ -79,6 +80,40 @@ namespace rlogic
         */
         [[nodiscard]] RLOGIC_API size_t getTotalLinkActivations() const;
 
+        /**
+        * Obtain the number of writes to Ramses objects (e.g. node translation, appearance uniform) which were applied
+        * by bindings during update. The writes are collected during update and applied in one batch at the end
+        * (or by #rlogic::LogicEngine::commit after #rlogic::LogicEngine::updateAsync).
+        *
+        * @return the number of applied writes to Ramses objects
+        */
+        [[nodiscard]] RLOGIC_API size_t getAppliedRamsesCommands() const;
+
+        /**
+        * Obtain the number of writes to Ramses objects which were skipped, because a later write in the same batch
+        * set the same property of the same Ramses object again.
+        *
+        * @return the number of skipped redundant writes to Ramses objects
+        */
+        [[nodiscard]] RLOGIC_API size_t getElidedRamsesCommands() const;
+
+        /**
+        * Obtain the number of allocations (including reallocations) of all Lua states during update, e.g. of the
+        * tables and strings created by the run() functions of the scripts. Frequent allocations in every update
+        * make the Lua garbage collector run often, see also #rlogic::LuaScript::getLuaMemoryStatistics.
+        *
+        * @return the number of Lua allocations during update
+        */
+        [[nodiscard]] RLOGIC_API size_t getLuaAllocations() const;
+
+        /**
+        * Obtain how much the memory allocated by all Lua states changed during update, in bytes. The value is
+        * negative if the Lua garbage collector freed more memory than was allocated.
+        *
+        * @return the change of the allocated Lua memory during update
+        */
+        [[nodiscard]] RLOGIC_API int64_t getLuaAllocatedBytesDelta() const;
+
         /**
         * Default constructor of LogicEngineReport.
         */
@@ -13,6 +13,7 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 
 namespace rlogic::internal
 {
@@ -58,6 +59,37 @@ namespace rlogic
          */
         RLOGIC_API bool addStandardModuleDependency(EStandardModule stdModule);
 
+        /**
+         * Sets the execution group of scripts created with this config. Scripts of the same group share a Lua state,
+         * scripts of different groups are executed in separate Lua states. By default all scripts are in group 0.
+         * When #rlogic::LogicEngine::setUpdateThreadCount enables parallel update, scripts of different groups
+         * which don't depend on each other can be executed in parallel, while scripts of the same group are always
+         * executed one after another. Grouping scripts which are linked together (e.g. all scripts of one HMI widget)
+         * typically gives the best results. Modules which are used in scripts of several groups are transparently
+         * loaded into the Lua state of each of those groups. The group has no effect on module creation.
+         *
+         * Note that each additional group allocates a new Lua state, which costs memory.
+         *
+         * @param executionGroup the group id of scripts created with this config
+         */
+        RLOGIC_API void setExecutionGroup(uint32_t executionGroup);
+
+        /**
+         * Limits the Lua memory of scripts created with this config (see #rlogic::LuaMemoryStatistics for which allocations
+         * count towards the limit of a script). Lua fails allocations which would exceed the limit with a "not enough memory"
+         * error. If that happens during #rlogic::LogicEngine::update, the update fails with a runtime error of the script, also
+         * if the script catches the Lua error with pcall. Memory which is no longer used counts towards the limit until the Lua
+         * garbage collector frees it, therefore a full garbage collection is done before the next update of a script which
+         * exceeded its limit. The failed run() is not repeated within the same update. Instances created
+         * with #rlogic::LogicEngine::createLuaScriptInstance have the same limit as their prototype. The limit is saved with
+         * the script. It has no effect on module creation.
+         *
+         * By default scripts have no memory limit.
+         *
+         * @param memoryLimit the maximum Lua memory of each script in bytes, or 0 for no limit
+         */
+        RLOGIC_API void setMemoryLimit(size_t memoryLimit);
+
         /**
          * Destructor of #LuaConfig
          */
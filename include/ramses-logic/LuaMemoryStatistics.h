@@ -0,0 +1,35 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+namespace rlogic
+{
+    /**
+    * Memory allocated by Lua, obtained with #rlogic::LuaScript::getLuaMemoryStatistics, #rlogic::LuaModule::getLuaMemoryStatistics
+    * or for the whole #rlogic::LogicEngine with #rlogic::LogicEngine::getMemoryStatistics. Each allocation of a Lua state is
+    * attributed to the script or module which was executed when it was allocated (or last resized), e.g. the GLOBAL table
+    * and the temporary tables and strings created in run() are attributed to the script. Allocations of module
+    * functions called by a script are attributed to the script, only the allocations while loading the module are
+    * attributed to the module. Memory stays attributed to a script until the Lua garbage collector frees it, also
+    * after the script was destroyed. All sizes are in bytes as requested by Lua, without the overhead of the allocator.
+    */
+    struct LuaMemoryStatistics
+    {
+        /// Memory which is currently allocated
+        size_t allocatedBytes = 0u;
+        /// Highest value of allocatedBytes so far. For modules which are loaded into several Lua states (see
+        /// #rlogic::LuaConfig::setExecutionGroup) and for the whole logic engine, it's the highest peak of a single Lua state,
+        /// because the peaks of different Lua states are reached at different times
+        size_t peakAllocatedBytes = 0u;
+        /// Number of allocations so far, including reallocations (e.g. when a table grows)
+        size_t allocationCount = 0u;
+    };
+}
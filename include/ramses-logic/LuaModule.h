@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ramses-logic/LogicObject.h"
+#include "ramses-logic/LuaMemoryStatistics.h"
 
 namespace rlogic::internal
 {
@@ -86,6 +87,14 @@ namespace rlogic
         */
         LuaModule& operator=(LuaModule&&) = delete;
 
+        /**
+        * Returns the memory which Lua allocated while loading this module, summed over all Lua states the module
+        * is loaded in (see #rlogic::LuaConfig::setExecutionGroup). See #rlogic::LuaMemoryStatistics for details.
+        *
+        * @return Lua memory statistics of the module
+        */
+        [[nodiscard]] RLOGIC_API LuaMemoryStatistics getLuaMemoryStatistics() const;
+
         /**
         * Implementation detail of #LuaModule
         */
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ramses-logic/LogicNode.h"
+#include "ramses-logic/LuaMemoryStatistics.h"
 
 #include <string>
 #include <memory>
@@ -108,6 +109,14 @@ namespace rlogic
         */
         LuaScript& operator=(LuaScript&& other) = delete;
 
+        /**
+        * Returns the memory which Lua allocated for this script, i.e. while compiling and initializing it and
+        * while executing its run() function. See #rlogic::LuaMemoryStatistics for details.
+        *
+        * @return Lua memory statistics of the script
+        */
+        [[nodiscard]] RLOGIC_API LuaMemoryStatistics getLuaMemoryStatistics() const;
+
         /**
         * Implementation detail of LuaScript
         */
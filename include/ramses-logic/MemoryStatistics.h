@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LuaMemoryStatistics.h"
+
+#include <cstddef>
+
+namespace rlogic
+{
+    /**
+    * Memory used by the properties of all logic nodes and by the Lua states of a #rlogic::LogicEngine, obtained with
+    * #rlogic::LogicEngine::getMemoryStatistics. Properties with the same layout (e.g. the inputs
+    * of scripts created from the same source) share their type information (names, types and children),
+    * only the values and links are kept per property. All sizes are in bytes, the sizes of the properties
+    * are estimates of the heap memory.
+    */
+    struct MemoryStatistics
+    {
+        /// Number of properties of all logic nodes (including nested properties)
+        size_t propertyCount = 0u;
+        /// Memory of the property objects (children and links, without values and type information)
+        size_t propertyObjectsSize = 0u;
+        /// Memory of the property values, which are kept together for all logic nodes
+        size_t propertyValuesSize = 0u;
+        /// Number of distinct property types (including nested types)
+        size_t propertyTypeCount = 0u;
+        /// Memory of the type information of all properties, shared by properties with the same layout
+        size_t propertyTypesSize = 0u;
+        /// Memory which the type information would need if each property had its own copy
+        size_t propertyTypesUnsharedSize = 0u;
+        /// Memory allocated by all Lua states, including the Lua standard libraries and the memory of scripts and modules
+        LuaMemoryStatistics luaMemory;
+        /// Memory reserved by the pools of small Lua allocations in all Lua states, including unused blocks
+        size_t luaPoolsSize = 0u;
+    };
+}
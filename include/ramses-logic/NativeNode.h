@@ -0,0 +1,184 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicNode.h"
+#include "ramses-logic/NativeNodeTypes.h"
+#include "ramses-logic/EPropertyType.h"
+#include <memory>
+#include <string_view>
+
+namespace rlogic::internal
+{
+    class NativeNodeImpl;
+}
+
+namespace rlogic
+{
+    /**
+    * A logic node which executes a C++ function instead of a Lua script. Native nodes have the inputs, outputs and update
+    * function of a type which is registered with #rlogic::LogicEngine::registerNativeNodeType, and are created with
+    * #rlogic::LogicEngine::createNativeNode.
+    *
+    * Native nodes behave like scripts: they can be linked with other logic nodes, they are only updated when
+    * one of their inputs changed (or the first time after their creation) and they are listed in the
+    * #rlogic::LogicEngineReport. They avoid the overhead of Lua for simple logic which is executed in high volume,
+    * for example filters on many signals.
+    *
+    * When saved to a file, the type name and the values of the properties of the node are stored. The
+    * type must be registered before the file is loaded, otherwise loading fails.
+    */
+    class NativeNode : public LogicNode
+    {
+    public:
+        /**
+        * Returns the name of the type of the node, as passed to #rlogic::LogicEngine::registerNativeNodeType
+        *
+        * @return the type name of the native node
+        */
+        [[nodiscard]] RLOGIC_API std::string_view getTypeName() const;
+
+        /**
+        * Constructor of NativeNode. User is not supposed to call this - NativeNodes are created by other factory classes
+        *
+        * @param impl implementation details of the NativeNode
+        */
+        explicit NativeNode(std::unique_ptr<internal::NativeNodeImpl> impl) noexcept;
+
+        /**
+        * Destructor of NativeNode.
+        */
+        ~NativeNode() noexcept override;
+
+        /**
+        * Copy Constructor of NativeNode is deleted because NativeNodes are not supposed to be copied
+        */
+        NativeNode(const NativeNode&) = delete;
+
+        /**
+        * Move Constructor of NativeNode is deleted because NativeNodes are not supposed to be moved
+        */
+        NativeNode(NativeNode&&) = delete;
+
+        /**
+        * Assignment operator of NativeNode is deleted because NativeNodes are not supposed to be copied
+        */
+        NativeNode& operator=(const NativeNode&) = delete;
+
+        /**
+        * Move assignment operator of NativeNode is deleted because NativeNodes are not supposed to be moved
+        */
+        NativeNode& operator=(NativeNode&&) = delete;
+
+        /**
+        * Implementation of NativeNode
+        */
+        internal::NativeNodeImpl& m_nativeNodeImpl;
+    };
+
+    /**
+    * Passed to the #rlogic::NativeNodeUpdateFunction of a native node type, gives access to the properties of the
+    * #rlogic::NativeNode which is updated. The inputs can be read with the usual #rlogic::Property methods, the outputs
+    * are set with #setOutput and #setOutputArray (outputs can't be set with #rlogic::Property::set). The outputs keep
+    * their values between updates, so they can also be used as state of the node, e.g. for a filter.
+    */
+    class NativeNodeUpdateContext
+    {
+    public:
+        /**
+        * Returns the inputs of the updated node, a property of type Struct with the inputs declared by the node type
+        *
+        * @return the inputs of the updated node
+        */
+        [[nodiscard]] RLOGIC_API const Property& getInputs() const;
+
+        /**
+        * Returns the outputs of the updated node, a property of type Struct with the outputs declared by the node type.
+        * The outputs have the values which were set during the previous update (or default values before the first update).
+        *
+        * @return the outputs of the updated node
+        */
+        [[nodiscard]] RLOGIC_API const Property& getOutputs() const;
+
+        /**
+        * Sets the value of a primitive output. Same rules apply to template parameter T as in #rlogic::Property::get(),
+        * T must match the type of the output.
+        *
+        * @param index index of the output in the declaration of the node type
+        * @param value the value to set
+        * @return true if the value was set, false if there is no such output or it has a different type
+        */
+        template <typename T> bool setOutput(size_t index, T value);
+
+        /**
+        * Sets all elements of an array output in one call. Same rules apply to template parameter T as in
+        * #rlogic::Property::get(), T must match the type of the array elements.
+        *
+        * @param index index of the output in the declaration of the node type
+        * @param values pointer to \p count values, the value of the first element is written to the element with index 0
+        * @param count the number of values, must be equal to the size of the array
+        * @return true if the values were set, false if there is no such output, it is not an array of elements of
+        * type T or \p count doesn't match the size of the array
+        */
+        template <typename T> bool setOutputArray(size_t index, const T* values, size_t count);
+
+        /**
+        * Fails the update of the node with the given error message. The logic engine stops the update after the
+        * update function returned, and reports the error (see #rlogic::LogicEngine::getErrors).
+        *
+        * @param message description of the error
+        */
+        RLOGIC_API void reportError(std::string_view message);
+
+        /**
+        * Constructor of NativeNodeUpdateContext. User is not supposed to call this - the context is created when a
+        * native node is updated
+        *
+        * @param impl the updated native node
+        */
+        explicit NativeNodeUpdateContext(internal::NativeNodeImpl& impl) noexcept;
+
+        /**
+        * Copy Constructor of NativeNodeUpdateContext is deleted because the context is only valid during one update
+        */
+        NativeNodeUpdateContext(const NativeNodeUpdateContext&) = delete;
+
+        /**
+        * Assignment operator of NativeNodeUpdateContext is deleted because the context is only valid during one update
+        */
+        NativeNodeUpdateContext& operator=(const NativeNodeUpdateContext&) = delete;
+
+        /**
+        * The updated native node
+        */
+        internal::NativeNodeImpl& m_impl;
+
+    private:
+        /**
+         * Internal implementation of #setOutput
+         */
+        template <typename T> RLOGIC_API bool setOutputInternal(size_t index, T value);
+        /**
+         * Internal implementation of #setOutputArray
+         */
+        template <typename T> RLOGIC_API bool setOutputArrayInternal(size_t index, const T* values, size_t count);
+    };
+
+    template <typename T> bool NativeNodeUpdateContext::setOutput(size_t index, T value)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call setOutput<T> only with types which have a value! Read the docs of the method!");
+        return setOutputInternal<T>(index, value);
+    }
+
+    template <typename T> bool NativeNodeUpdateContext::setOutputArray(size_t index, const T* values, size_t count)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call setOutputArray<T> only with types which have a value! Read the docs of the method!");
+        return setOutputArrayInternal<T>(index, values, count);
+    }
+}
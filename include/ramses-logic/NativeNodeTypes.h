@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/APIExport.h"
+#include "ramses-logic/EPropertyType.h"
+#include <vector>
+#include <string>
+#include <functional>
+
+namespace rlogic
+{
+    class NativeNodeUpdateContext;
+
+    /**
+    * Declares one input or output property of a native node type, see #rlogic::LogicEngine::registerNativeNodeType.
+    * The properties of a native node are either primitives (see #rlogic::IsPrimitiveProperty) or arrays of primitives.
+    */
+    struct NativeNodePropertyDeclaration
+    {
+        /// Name of the property, must not be empty and must be unique within the inputs (or outputs) of the type
+        std::string name;
+        /// Type of the property, a primitive type or #rlogic::EPropertyType::Array
+        EPropertyType type = EPropertyType::Float;
+        /// Type of the array elements (must be a primitive type), only used if #type is #rlogic::EPropertyType::Array
+        EPropertyType arrayElementType = EPropertyType::Float;
+        /// Number of array elements (1 to 255, same as for arrays in scripts), only used if #type is #rlogic::EPropertyType::Array
+        size_t arraySize = 0u;
+    };
+    using NativeNodePropertyDeclarations = std::vector<NativeNodePropertyDeclaration>;
+
+    /**
+    * Function which is called when a native node is updated, see #rlogic::NativeNodeUpdateContext for the
+    * access to the properties of the node. The function is executed on the thread which updates the
+    * logic engine and must not call any methods of the #rlogic::LogicEngine. It must not throw exceptions,
+    * use #rlogic::NativeNodeUpdateContext::reportError to fail the update instead.
+    */
+    using NativeNodeUpdateFunction = std::function<void(NativeNodeUpdateContext& context)>;
+}
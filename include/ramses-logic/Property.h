@@ -129,6 +129,34 @@ namespace rlogic
         */
         template <typename T> bool set(T value);
 
+        /**
+        * Sets all elements of this Property, which must be an array of primitives (see #rlogic::EPropertyType::Array),
+        * in one call. This is faster than setting each element with #set, the #rlogic::LogicNode which owns the
+        * array is marked as dirty once if any of the elements changes. Same rules apply to template parameter T
+        * as in #get(), T must match the type of the array elements.
+        *
+        * Setting the array fails and none of its elements is changed if:
+        * - the property is not an array of elements of type T
+        * - \p count doesn't match the size of the array (see #getChildCount)
+        * - the property is an output or any of its elements is linked
+        *
+        * @param values pointer to \p count values, the value of the first element is written to the element with index 0
+        * @param count the number of values, must be equal to the size of the array
+        * @return true if setting the values was successful, false otherwise.
+        */
+        template <typename T> bool setArray(const T* values, size_t count);
+
+        /**
+        * Gets the values of all elements of this Property, which must be an array of primitives (see #rlogic::EPropertyType::Array),
+        * in one call. Same rules apply to template parameter T as in #get(), T must match the type of the array elements.
+        *
+        * @param values pointer to memory for \p count values, receives the value of the element with index 0 first
+        * @param count the number of values, must be equal to the size of the array (see #getChildCount)
+        * @return true if the values were written to \p values, false if the property is not an array of elements of
+        * type T or \p count doesn't match the size of the array
+        */
+        template <typename T> bool getArray(T* values, size_t count) const;
+
         /**
         * Checks if an input property is linked to an output property of another node. Setting values of linked inputs will result in errors,
         * use this to check an input is not linked before setting it.
@@ -188,6 +216,14 @@ namespace rlogic
          * Internal implementation of #set
          */
         template <typename T> RLOGIC_API bool setInternal(T value);
+        /**
+         * Internal implementation of #setArray
+         */
+        template <typename T> RLOGIC_API bool setArrayInternal(const T* values, size_t count);
+        /**
+         * Internal implementation of #getArray
+         */
+        template <typename T> RLOGIC_API bool getArrayInternal(T* values, size_t count) const;
     };
 
     template <typename T> std::optional<T> Property::get() const
@@ -201,4 +237,16 @@ namespace rlogic
         static_assert(IsPrimitiveProperty<T>::value, "Call set<T> only with types which have a value! Read the docs of the method!");
         return setInternal<T>(value);
     }
+
+    template <typename T> bool Property::setArray(const T* values, size_t count)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call setArray<T> only with types which have a value! Read the docs of the method!");
+        return setArrayInternal<T>(values, count);
+    }
+
+    template <typename T> bool Property::getArray(T* values, size_t count) const
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call getArray<T> only with types which have a value! Read the docs of the method!");
+        return getArrayInternal<T>(values, count);
+    }
 }
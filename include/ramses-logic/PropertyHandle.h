@@ -0,0 +1,104 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EPropertyType.h"
+
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    class PropertyImpl;
+    class LogicEngineImpl;
+}
+
+namespace rlogic
+{
+    /**
+    * A handle to a primitive #rlogic::Property of a #rlogic::LogicNode, obtained with #rlogic::LogicEngine::resolvePath.
+    * The value of the property can be accessed with #rlogic::LogicEngine::set and #rlogic::LogicEngine::get
+    * without looking up the property by name or index again. Use handles for properties which are accessed
+    * repeatedly, e.g. every frame.
+    *
+    * A handle is a small value type which can be copied freely. It can only be used with the #rlogic::LogicEngine
+    * which resolved it, until the #rlogic::LogicNode which owns the property is destroyed (also by loading a file into
+    * the #rlogic::LogicEngine). #rlogic::LogicEngine::set and #rlogic::LogicEngine::get reject handles of other logic
+    * engines and handles of destroyed logic nodes with an error. Handles must not be used after their
+    * #rlogic::LogicEngine was destroyed.
+    */
+    class PropertyHandle
+    {
+    public:
+        /**
+        * Creates an invalid handle
+        */
+        PropertyHandle() = default;
+
+        /**
+        * Returns true if the handle refers to a property, i.e. it was returned by a successful
+        * call to #rlogic::LogicEngine::resolvePath
+        *
+        * @return true if the handle refers to a property
+        */
+        [[nodiscard]] bool isValid() const
+        {
+            return m_property != nullptr;
+        }
+
+        /**
+        * Returns the type of the property which the handle refers to. Only valid if #isValid returns true.
+        *
+        * @return the type of the property
+        */
+        [[nodiscard]] EPropertyType getType() const
+        {
+            return m_type;
+        }
+
+    private:
+        friend class internal::LogicEngineImpl;
+
+        /**
+        * Internal constructor, used by #rlogic::LogicEngine::resolvePath
+        */
+        PropertyHandle(const internal::LogicEngineImpl& logicEngine, uint64_t generation, uint64_t logicNodeId, internal::PropertyImpl& property, EPropertyType type)
+            : m_logicEngine(&logicEngine)
+            , m_generation(generation)
+            , m_logicNodeId(logicNodeId)
+            , m_property(&property)
+            , m_type(type)
+        {
+        }
+
+        /**
+        * The logic engine which resolved the handle
+        */
+        const internal::LogicEngineImpl* m_logicEngine = nullptr;
+
+        /**
+        * Objects generation of the logic engine when the handle was resolved, the generation changes when a file is loaded
+        */
+        uint64_t m_generation = 0u;
+
+        /**
+        * Id of the logic node which owns the property, used to detect that the logic node was destroyed
+        */
+        uint64_t m_logicNodeId = 0u;
+
+        /**
+        * The referenced property, only accessed after the handle was checked
+        */
+        internal::PropertyImpl* m_property = nullptr;
+
+        /**
+        * Type of the referenced property
+        */
+        EPropertyType m_type = EPropertyType::Float;
+    };
+}
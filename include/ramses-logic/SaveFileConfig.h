@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/APIExport.h"
+
+#include <memory>
+
+namespace rlogic::internal
+{
+    class SaveFileConfigImpl;
+}
+
+namespace rlogic
+{
+    /**
+     * Holds configuration settings for saving the #rlogic::LogicEngine to a file with #rlogic::LogicEngine::saveToFile.
+     * Can be default-constructed, moved and copied.
+     */
+    class SaveFileConfig
+    {
+    public:
+        RLOGIC_API SaveFileConfig() noexcept;
+
+        /**
+         * Enables saving the compiled Lua byte code of scripts and modules in addition to their source code. Loading
+         * the byte code is faster than compiling the source, but it's only used if it's explicitly requested when
+         * loading the file (see #rlogic::LogicEngine::loadFromFile). Lua can't verify byte code, byte code which was
+         * corrupted or tampered with can crash the application or execute arbitrary code. Save byte code only for
+         * files which are loaded from a trusted source.
+         *
+         * By default only the source code is saved.
+         *
+         * @param enabled true to save the byte code of scripts and modules
+         */
+        RLOGIC_API void setLuaByteCodeEnabled(bool enabled);
+
+        /**
+         * Destructor of #SaveFileConfig
+         */
+        RLOGIC_API ~SaveFileConfig() noexcept;
+
+        /**
+         * Copy Constructor of #SaveFileConfig
+         * @param other the other #SaveFileConfig to copy from
+         */
+        RLOGIC_API SaveFileConfig(const SaveFileConfig& other);
+
+        /**
+         * Move Constructor of #SaveFileConfig
+         * @param other the other #SaveFileConfig to move from
+         */
+        RLOGIC_API SaveFileConfig(SaveFileConfig&& other) noexcept;
+
+        /**
+         * Assignment operator of #SaveFileConfig
+         * @param other the other #SaveFileConfig to copy from
+         * @return self
+         */
+        RLOGIC_API SaveFileConfig& operator=(const SaveFileConfig& other);
+
+        /**
+         * Move assignment operator of #SaveFileConfig
+         * @param other the other #SaveFileConfig to move from
+         * @return self
+         */
+        RLOGIC_API SaveFileConfig& operator=(SaveFileConfig&& other) noexcept;
+
+        /**
+         * Implementation detail of #SaveFileConfig
+         */
+        std::unique_ptr<internal::SaveFileConfigImpl> m_impl;
+    };
+}
@@ -8,9 +8,11 @@
 
 #include "AnimationNodeGen.h"
 #include "DataArrayGen.h"
+#include "ExpressionNodeGen.h"
 #include "LinkGen.h"
 #include "LuaModuleGen.h"
 #include "LuaScriptGen.h"
+#include "NativeNodeGen.h"
 #include "PropertyGen.h"
 #include "RamsesAppearanceBindingGen.h"
 #include "RamsesBindingGen.h"
@@ -36,7 +38,9 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_DATAARRAYS = 14,
     VT_ANIMATIONNODES = 16,
     VT_TIMERNODES = 18,
-    VT_LINKS = 20
+    VT_LINKS = 20,
+    VT_NATIVENODES = 22,
+    VT_EXPRESSIONNODES = 24
   };
   const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaModule>> *luaModules() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaModule>> *>(VT_LUAMODULES);
@@ -65,6 +69,12 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>> *links() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>> *>(VT_LINKS);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeNode>> *nativeNodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeNode>> *>(VT_NATIVENODES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> *expressionNodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> *>(VT_EXPRESSIONNODES);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_LUAMODULES) &&
@@ -94,6 +104,12 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_LINKS) &&
            verifier.VerifyVector(links()) &&
            verifier.VerifyVectorOfTables(links()) &&
+           VerifyOffset(verifier, VT_NATIVENODES) &&
+           verifier.VerifyVector(nativeNodes()) &&
+           verifier.VerifyVectorOfTables(nativeNodes()) &&
+           VerifyOffset(verifier, VT_EXPRESSIONNODES) &&
+           verifier.VerifyVector(expressionNodes()) &&
+           verifier.VerifyVectorOfTables(expressionNodes()) &&
            verifier.EndTable();
   }
 };
@@ -129,6 +145,12 @@ struct ApiObjectsBuilder {
   void add_links(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>>> links) {
     fbb_.AddOffset(ApiObjects::VT_LINKS, links);
   }
+  void add_nativeNodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeNode>>> nativeNodes) {
+    fbb_.AddOffset(ApiObjects::VT_NATIVENODES, nativeNodes);
+  }
+  void add_expressionNodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>>> expressionNodes) {
+    fbb_.AddOffset(ApiObjects::VT_EXPRESSIONNODES, expressionNodes);
+  }
   explicit ApiObjectsBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -151,8 +173,12 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjects(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::DataArray>>> dataArrays = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>>> animationNodes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::TimerNode>>> timerNodes = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>>> links = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Link>>> links = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::NativeNode>>> nativeNodes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>>> expressionNodes = 0) {
   ApiObjectsBuilder builder_(_fbb);
+  builder_.add_expressionNodes(expressionNodes);
+  builder_.add_nativeNodes(nativeNodes);
   builder_.add_links(links);
   builder_.add_timerNodes(timerNodes);
   builder_.add_animationNodes(animationNodes);
@@ -180,7 +206,9 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
     const std::vector<flatbuffers::Offset<rlogic_serialization::DataArray>> *dataArrays = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>> *animationNodes = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::TimerNode>> *timerNodes = nullptr,
-    const std::vector<flatbuffers::Offset<rlogic_serialization::Link>> *links = nullptr) {
+    const std::vector<flatbuffers::Offset<rlogic_serialization::Link>> *links = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::NativeNode>> *nativeNodes = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> *expressionNodes = nullptr) {
   auto luaModules__ = luaModules ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaModule>>(*luaModules) : 0;
   auto luaScripts__ = luaScripts ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaScript>>(*luaScripts) : 0;
   auto nodeBindings__ = nodeBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>>(*nodeBindings) : 0;
@@ -190,6 +218,8 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
   auto animationNodes__ = animationNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::AnimationNode>>(*animationNodes) : 0;
   auto timerNodes__ = timerNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::TimerNode>>(*timerNodes) : 0;
   auto links__ = links ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::Link>>(*links) : 0;
+  auto nativeNodes__ = nativeNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::NativeNode>>(*nativeNodes) : 0;
+  auto expressionNodes__ = expressionNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>>(*expressionNodes) : 0;
   return rlogic_serialization::CreateApiObjects(
       _fbb,
       luaModules__,
@@ -200,7 +230,9 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
       dataArrays__,
       animationNodes__,
       timerNodes__,
-      links__);
+      links__,
+      nativeNodes__,
+      expressionNodes__);
 }
 
 }  // namespace rlogic_serialization
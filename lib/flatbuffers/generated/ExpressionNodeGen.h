@@ -0,0 +1,210 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_EXPRESSIONNODE_RLOGIC_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_EXPRESSIONNODE_RLOGIC_SERIALIZATION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+#include "PropertyGen.h"
+
+namespace rlogic_serialization {
+
+struct ExpressionNode;
+struct ExpressionNodeBuilder;
+
+struct ExpressionNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ExpressionNodeBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_ID = 6,
+    VT_EXPRESSION = 8,
+    VT_ROOTINPUT = 10,
+    VT_ROOTOUTPUT = 12,
+    VT_REGISTERCOUNT = 14,
+    VT_INSTRUCTIONS = 16,
+    VT_CONSTANTREGISTERS = 18,
+    VT_CONSTANTFLOATS = 20,
+    VT_CONSTANTINTS = 22,
+    VT_OUTPUTREGISTERS = 24
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  uint64_t id() const {
+    return GetField<uint64_t>(VT_ID, 0);
+  }
+  const flatbuffers::String *expression() const {
+    return GetPointer<const flatbuffers::String *>(VT_EXPRESSION);
+  }
+  const rlogic_serialization::Property *rootInput() const {
+    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTINPUT);
+  }
+  const rlogic_serialization::Property *rootOutput() const {
+    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTOUTPUT);
+  }
+  uint32_t registerCount() const {
+    return GetField<uint32_t>(VT_REGISTERCOUNT, 0);
+  }
+  const flatbuffers::Vector<uint16_t> *instructions() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_INSTRUCTIONS);
+  }
+  const flatbuffers::Vector<uint16_t> *constantRegisters() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_CONSTANTREGISTERS);
+  }
+  const flatbuffers::Vector<float> *constantFloats() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_CONSTANTFLOATS);
+  }
+  const flatbuffers::Vector<int32_t> *constantInts() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_CONSTANTINTS);
+  }
+  const flatbuffers::Vector<uint16_t> *outputRegisters() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_OUTPUTREGISTERS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint64_t>(verifier, VT_ID) &&
+           VerifyOffset(verifier, VT_EXPRESSION) &&
+           verifier.VerifyString(expression()) &&
+           VerifyOffset(verifier, VT_ROOTINPUT) &&
+           verifier.VerifyTable(rootInput()) &&
+           VerifyOffset(verifier, VT_ROOTOUTPUT) &&
+           verifier.VerifyTable(rootOutput()) &&
+           VerifyField<uint32_t>(verifier, VT_REGISTERCOUNT) &&
+           VerifyOffset(verifier, VT_INSTRUCTIONS) &&
+           verifier.VerifyVector(instructions()) &&
+           VerifyOffset(verifier, VT_CONSTANTREGISTERS) &&
+           verifier.VerifyVector(constantRegisters()) &&
+           VerifyOffset(verifier, VT_CONSTANTFLOATS) &&
+           verifier.VerifyVector(constantFloats()) &&
+           VerifyOffset(verifier, VT_CONSTANTINTS) &&
+           verifier.VerifyVector(constantInts()) &&
+           VerifyOffset(verifier, VT_OUTPUTREGISTERS) &&
+           verifier.VerifyVector(outputRegisters()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ExpressionNodeBuilder {
+  typedef ExpressionNode Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(ExpressionNode::VT_NAME, name);
+  }
+  void add_id(uint64_t id) {
+    fbb_.AddElement<uint64_t>(ExpressionNode::VT_ID, id, 0);
+  }
+  void add_expression(flatbuffers::Offset<flatbuffers::String> expression) {
+    fbb_.AddOffset(ExpressionNode::VT_EXPRESSION, expression);
+  }
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::Property> rootInput) {
+    fbb_.AddOffset(ExpressionNode::VT_ROOTINPUT, rootInput);
+  }
+  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::Property> rootOutput) {
+    fbb_.AddOffset(ExpressionNode::VT_ROOTOUTPUT, rootOutput);
+  }
+  void add_registerCount(uint32_t registerCount) {
+    fbb_.AddElement<uint32_t>(ExpressionNode::VT_REGISTERCOUNT, registerCount, 0);
+  }
+  void add_instructions(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> instructions) {
+    fbb_.AddOffset(ExpressionNode::VT_INSTRUCTIONS, instructions);
+  }
+  void add_constantRegisters(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> constantRegisters) {
+    fbb_.AddOffset(ExpressionNode::VT_CONSTANTREGISTERS, constantRegisters);
+  }
+  void add_constantFloats(flatbuffers::Offset<flatbuffers::Vector<float>> constantFloats) {
+    fbb_.AddOffset(ExpressionNode::VT_CONSTANTFLOATS, constantFloats);
+  }
+  void add_constantInts(flatbuffers::Offset<flatbuffers::Vector<int32_t>> constantInts) {
+    fbb_.AddOffset(ExpressionNode::VT_CONSTANTINTS, constantInts);
+  }
+  void add_outputRegisters(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> outputRegisters) {
+    fbb_.AddOffset(ExpressionNode::VT_OUTPUTREGISTERS, outputRegisters);
+  }
+  explicit ExpressionNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ExpressionNodeBuilder &operator=(const ExpressionNodeBuilder &);
+  flatbuffers::Offset<ExpressionNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ExpressionNode>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ExpressionNode> CreateExpressionNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    uint64_t id = 0,
+    flatbuffers::Offset<flatbuffers::String> expression = 0,
+    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0,
+    uint32_t registerCount = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> instructions = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> constantRegisters = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> constantFloats = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> constantInts = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> outputRegisters = 0) {
+  ExpressionNodeBuilder builder_(_fbb);
+  builder_.add_id(id);
+  builder_.add_outputRegisters(outputRegisters);
+  builder_.add_constantInts(constantInts);
+  builder_.add_constantFloats(constantFloats);
+  builder_.add_constantRegisters(constantRegisters);
+  builder_.add_instructions(instructions);
+  builder_.add_registerCount(registerCount);
+  builder_.add_rootOutput(rootOutput);
+  builder_.add_rootInput(rootInput);
+  builder_.add_expression(expression);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct ExpressionNode::Traits {
+  using type = ExpressionNode;
+  static auto constexpr Create = CreateExpressionNode;
+};
+
+inline flatbuffers::Offset<ExpressionNode> CreateExpressionNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    uint64_t id = 0,
+    const char *expression = nullptr,
+    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0,
+    uint32_t registerCount = 0,
+    const std::vector<uint16_t> *instructions = nullptr,
+    const std::vector<uint16_t> *constantRegisters = nullptr,
+    const std::vector<float> *constantFloats = nullptr,
+    const std::vector<int32_t> *constantInts = nullptr,
+    const std::vector<uint16_t> *outputRegisters = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto expression__ = expression ? _fbb.CreateString(expression) : 0;
+  auto instructions__ = instructions ? _fbb.CreateVector<uint16_t>(*instructions) : 0;
+  auto constantRegisters__ = constantRegisters ? _fbb.CreateVector<uint16_t>(*constantRegisters) : 0;
+  auto constantFloats__ = constantFloats ? _fbb.CreateVector<float>(*constantFloats) : 0;
+  auto constantInts__ = constantInts ? _fbb.CreateVector<int32_t>(*constantInts) : 0;
+  auto outputRegisters__ = outputRegisters ? _fbb.CreateVector<uint16_t>(*outputRegisters) : 0;
+  return rlogic_serialization::CreateExpressionNode(
+      _fbb,
+      name__,
+      id,
+      expression__,
+      rootInput,
+      rootOutput,
+      registerCount,
+      instructions__,
+      constantRegisters__,
+      constantFloats__,
+      constantInts__,
+      outputRegisters__);
+}
+
+}  // namespace rlogic_serialization
+
+#endif  // FLATBUFFERS_GENERATED_EXPRESSIONNODE_RLOGIC_SERIALIZATION_H_
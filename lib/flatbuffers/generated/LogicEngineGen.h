@@ -9,9 +9,11 @@
 #include "AnimationNodeGen.h"
 #include "ApiObjectsGen.h"
 #include "DataArrayGen.h"
+#include "ExpressionNodeGen.h"
 #include "LinkGen.h"
 #include "LuaModuleGen.h"
 #include "LuaScriptGen.h"
+#include "NativeNodeGen.h"
 #include "PropertyGen.h"
 #include "RamsesAppearanceBindingGen.h"
 #include "RamsesBindingGen.h"
@@ -22,7 +22,8 @@ struct LuaModule FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_ID = 6,
     VT_SOURCE = 8,
     VT_DEPENDENCIES = 10,
-    VT_STANDARDMODULES = 12
+    VT_STANDARDMODULES = 12,
+    VT_BYTECODE = 14
   };
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
@@ -39,6 +40,9 @@ struct LuaModule FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<uint8_t> *standardModules() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_STANDARDMODULES);
   }
+  const flatbuffers::Vector<uint8_t> *byteCode() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_BYTECODE);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_NAME) &&
@@ -51,6 +55,8 @@ struct LuaModule FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVectorOfTables(dependencies()) &&
            VerifyOffset(verifier, VT_STANDARDMODULES) &&
            verifier.VerifyVector(standardModules()) &&
+           VerifyOffset(verifier, VT_BYTECODE) &&
+           verifier.VerifyVector(byteCode()) &&
            verifier.EndTable();
   }
 };
@@ -74,6 +80,9 @@ struct LuaModuleBuilder {
   void add_standardModules(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> standardModules) {
     fbb_.AddOffset(LuaModule::VT_STANDARDMODULES, standardModules);
   }
+  void add_byteCode(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> byteCode) {
+    fbb_.AddOffset(LuaModule::VT_BYTECODE, byteCode);
+  }
   explicit LuaModuleBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -92,9 +101,11 @@ inline flatbuffers::Offset<LuaModule> CreateLuaModule(
     uint64_t id = 0,
     flatbuffers::Offset<flatbuffers::String> source = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>> dependencies = 0,
-    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> standardModules = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> standardModules = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> byteCode = 0) {
   LuaModuleBuilder builder_(_fbb);
   builder_.add_id(id);
+  builder_.add_byteCode(byteCode);
   builder_.add_standardModules(standardModules);
   builder_.add_dependencies(dependencies);
   builder_.add_source(source);
@@ -113,18 +124,21 @@ inline flatbuffers::Offset<LuaModule> CreateLuaModuleDirect(
     uint64_t id = 0,
     const char *source = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>> *dependencies = nullptr,
-    const std::vector<uint8_t> *standardModules = nullptr) {
+    const std::vector<uint8_t> *standardModules = nullptr,
+    const std::vector<uint8_t> *byteCode = nullptr) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   auto source__ = source ? _fbb.CreateString(source) : 0;
   auto dependencies__ = dependencies ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>(*dependencies) : 0;
   auto standardModules__ = standardModules ? _fbb.CreateVector<uint8_t>(*standardModules) : 0;
+  auto byteCode__ = byteCode ? _fbb.CreateVector<uint8_t>(*byteCode) : 0;
   return rlogic_serialization::CreateLuaModule(
       _fbb,
       name__,
       id,
       source__,
       dependencies__,
-      standardModules__);
+      standardModules__,
+      byteCode__);
 }
 
 struct LuaModuleUsage FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
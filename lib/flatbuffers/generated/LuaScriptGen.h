@@ -24,7 +24,11 @@ struct LuaScript FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_USERMODULES = 10,
     VT_STANDARDMODULES = 12,
     VT_ROOTINPUT = 14,
-    VT_ROOTOUTPUT = 16
+    VT_ROOTOUTPUT = 16,
+    VT_EXECUTIONGROUP = 18,
+    VT_SOURCESCRIPTID = 20,
+    VT_LUABYTECODE = 22,
+    VT_MEMORYLIMIT = 24
   };
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
@@ -47,6 +51,18 @@ struct LuaScript FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const rlogic_serialization::Property *rootOutput() const {
     return GetPointer<const rlogic_serialization::Property *>(VT_ROOTOUTPUT);
   }
+  uint32_t executionGroup() const {
+    return GetField<uint32_t>(VT_EXECUTIONGROUP, 0);
+  }
+  uint64_t sourceScriptId() const {
+    return GetField<uint64_t>(VT_SOURCESCRIPTID, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *luaByteCode() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_LUABYTECODE);
+  }
+  uint64_t memoryLimit() const {
+    return GetField<uint64_t>(VT_MEMORYLIMIT, 0);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_NAME) &&
@@ -63,6 +79,11 @@ struct LuaScript FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(rootInput()) &&
            VerifyOffset(verifier, VT_ROOTOUTPUT) &&
            verifier.VerifyTable(rootOutput()) &&
+           VerifyField<uint32_t>(verifier, VT_EXECUTIONGROUP) &&
+           VerifyField<uint64_t>(verifier, VT_SOURCESCRIPTID) &&
+           VerifyOffset(verifier, VT_LUABYTECODE) &&
+           verifier.VerifyVector(luaByteCode()) &&
+           VerifyField<uint64_t>(verifier, VT_MEMORYLIMIT) &&
            verifier.EndTable();
   }
 };
@@ -92,6 +113,18 @@ struct LuaScriptBuilder {
   void add_rootOutput(flatbuffers::Offset<rlogic_serialization::Property> rootOutput) {
     fbb_.AddOffset(LuaScript::VT_ROOTOUTPUT, rootOutput);
   }
+  void add_executionGroup(uint32_t executionGroup) {
+    fbb_.AddElement<uint32_t>(LuaScript::VT_EXECUTIONGROUP, executionGroup, 0);
+  }
+  void add_sourceScriptId(uint64_t sourceScriptId) {
+    fbb_.AddElement<uint64_t>(LuaScript::VT_SOURCESCRIPTID, sourceScriptId, 0);
+  }
+  void add_luaByteCode(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> luaByteCode) {
+    fbb_.AddOffset(LuaScript::VT_LUABYTECODE, luaByteCode);
+  }
+  void add_memoryLimit(uint64_t memoryLimit) {
+    fbb_.AddElement<uint64_t>(LuaScript::VT_MEMORYLIMIT, memoryLimit, 0);
+  }
   explicit LuaScriptBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -112,9 +145,17 @@ inline flatbuffers::Offset<LuaScript> CreateLuaScript(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>> userModules = 0,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> standardModules = 0,
     flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0,
+    uint32_t executionGroup = 0,
+    uint64_t sourceScriptId = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> luaByteCode = 0,
+    uint64_t memoryLimit = 0) {
   LuaScriptBuilder builder_(_fbb);
+  builder_.add_memoryLimit(memoryLimit);
+  builder_.add_sourceScriptId(sourceScriptId);
   builder_.add_id(id);
+  builder_.add_luaByteCode(luaByteCode);
+  builder_.add_executionGroup(executionGroup);
   builder_.add_rootOutput(rootOutput);
   builder_.add_rootInput(rootInput);
   builder_.add_standardModules(standardModules);
@@ -137,11 +178,16 @@ inline flatbuffers::Offset<LuaScript> CreateLuaScriptDirect(
     const std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>> *userModules = nullptr,
     const std::vector<uint8_t> *standardModules = nullptr,
     flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0,
+    uint32_t executionGroup = 0,
+    uint64_t sourceScriptId = 0,
+    const std::vector<uint8_t> *luaByteCode = nullptr,
+    uint64_t memoryLimit = 0) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   auto luaSourceCode__ = luaSourceCode ? _fbb.CreateString(luaSourceCode) : 0;
   auto userModules__ = userModules ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>(*userModules) : 0;
   auto standardModules__ = standardModules ? _fbb.CreateVector<uint8_t>(*standardModules) : 0;
+  auto luaByteCode__ = luaByteCode ? _fbb.CreateVector<uint8_t>(*luaByteCode) : 0;
   return rlogic_serialization::CreateLuaScript(
       _fbb,
       name__,
@@ -150,7 +196,11 @@ inline flatbuffers::Offset<LuaScript> CreateLuaScriptDirect(
       userModules__,
       standardModules__,
       rootInput,
-      rootOutput);
+      rootOutput,
+      executionGroup,
+      sourceScriptId,
+      luaByteCode__,
+      memoryLimit);
 }
 
 }  // namespace rlogic_serialization
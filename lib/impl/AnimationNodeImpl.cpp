@@ -62,16 +62,22 @@ namespace rlogic::internal
         return m_channels;
     }
 
+    bool AnimationNodeImpl::supportsConcurrentUpdate() const
+    {
+        // Reads only its own inputs and the (immutable) data arrays, writes only its own outputs
+        return true;
+    }
+
     std::optional<LogicNodeRuntimeError> AnimationNodeImpl::update()
     {
-        float timeDelta = *getInputs()->getChild(EInputIdx_TimeDelta)->get<float>();
+        float timeDelta = getInputs()->getChild(EInputIdx_TimeDelta)->m_impl->getValueAs<float>();
         if (timeDelta < 0.f)
             return LogicNodeRuntimeError{ fmt::format("AnimationNode '{}' failed to update - cannot use negative timeDelta ({})", getName(), timeDelta) };
 
-        const bool play = *getInputs()->getChild(EInputIdx_Play)->get<bool>();
+        const bool play = getInputs()->getChild(EInputIdx_Play)->m_impl->getValueAs<bool>();
         if (!play)
         {
-            if (m_elapsedPlayTime > 0.f && *getInputs()->getChild(EInputIdx_RewindOnStop)->get<bool>())
+            if (m_elapsedPlayTime > 0.f && getInputs()->getChild(EInputIdx_RewindOnStop)->m_impl->getValueAs<bool>())
             {
                 // rewind, i.e. reset progress and update with zero timeDelta
                 m_elapsedPlayTime = 0.f;
@@ -84,7 +90,7 @@ namespace rlogic::internal
         }
 
         // determine duration from time range input property
-        const vec2f userProvidedTimeRange = *getInputs()->getChild(EInputIdx_TimeRange)->get<vec2f>();
+        const vec2f userProvidedTimeRange = getInputs()->getChild(EInputIdx_TimeRange)->m_impl->getValueAs<vec2f>();
         vec2f timeRange = userProvidedTimeRange;
         if (timeRange[1] <= 0.f) // end range not set, set to animation duration
             timeRange[1] = m_maxChannelDuration;
@@ -95,7 +101,7 @@ namespace rlogic::internal
         }
         const float duration = timeRange[1] - timeRange[0];
 
-        const bool loop = *getInputs()->getChild(EInputIdx_Loop)->get<bool>();
+        const bool loop = getInputs()->getChild(EInputIdx_Loop)->m_impl->getValueAs<bool>();
         if (m_elapsedPlayTime >= duration && !loop)
             return std::nullopt;
 
@@ -39,6 +39,7 @@ namespace rlogic::internal
         [[nodiscard]] const AnimationChannels& getChannels() const;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool supportsConcurrentUpdate() const override;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::AnimationNode> Serialize(
             const AnimationNodeImpl& animNode,
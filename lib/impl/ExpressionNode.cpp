@@ -0,0 +1,27 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/ExpressionNode.h"
+#include "impl/ExpressionNodeImpl.h"
+
+namespace rlogic
+{
+    ExpressionNode::ExpressionNode(std::unique_ptr<internal::ExpressionNodeImpl> impl) noexcept
+        : LogicNode(std::move(impl))
+        /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast) */
+        , m_expressionNodeImpl{ static_cast<internal::ExpressionNodeImpl&>(LogicNode::m_impl) }
+    {
+    }
+
+    ExpressionNode::~ExpressionNode() noexcept = default;
+
+    std::string_view ExpressionNode::getExpression() const
+    {
+        return m_expressionNodeImpl.getExpression();
+    }
+}
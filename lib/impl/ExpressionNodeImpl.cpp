@@ -0,0 +1,302 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/ExpressionNodeImpl.h"
+#include "ramses-logic/Property.h"
+#include "impl/PropertyImpl.h"
+#include "internals/ErrorReporting.h"
+#include "generated/ExpressionNodeGen.h"
+#include "flatbuffers/flatbuffers.h"
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // Number of uint16 values per serialized instruction: op code, width, dst, a, b, c
+        constexpr size_t SerializedInstructionSize = 6u;
+
+        template <size_t N>
+        void LoadVector(const PropertyImpl& input, ExpressionRegister& reg)
+        {
+            const auto& value = input.getValueAs<std::array<float, N>>();
+            std::copy(value.cbegin(), value.cend(), reg.f.begin());
+        }
+
+        template <size_t N>
+        void StoreVector(const ExpressionRegister& reg, PropertyImpl& output)
+        {
+            std::array<float, N> value{};
+            std::copy(reg.f.cbegin(), reg.f.cbegin() + N, value.begin());
+            output.setValueAs<std::array<float, N>>(value);
+        }
+
+        void LoadRegister(const PropertyImpl& input, ExpressionRegister& reg)
+        {
+            switch (input.getType())
+            {
+            case EPropertyType::Float:
+                reg.f[0] = input.getValueAs<float>();
+                break;
+            case EPropertyType::Vec2f:
+                LoadVector<2>(input, reg);
+                break;
+            case EPropertyType::Vec3f:
+                LoadVector<3>(input, reg);
+                break;
+            case EPropertyType::Vec4f:
+                LoadVector<4>(input, reg);
+                break;
+            case EPropertyType::Int32:
+                reg.i = input.getValueAs<int32_t>();
+                break;
+            case EPropertyType::Bool:
+                reg.i = input.getValueAs<bool>() ? 1 : 0;
+                break;
+            case EPropertyType::Int64:
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                assert(false && "Type not supported by expressions");
+                break;
+            }
+        }
+
+        void StoreRegister(const ExpressionRegister& reg, PropertyImpl& output)
+        {
+            switch (output.getType())
+            {
+            case EPropertyType::Float:
+                output.setValueAs<float>(reg.f[0]);
+                break;
+            case EPropertyType::Vec2f:
+                StoreVector<2>(reg, output);
+                break;
+            case EPropertyType::Vec3f:
+                StoreVector<3>(reg, output);
+                break;
+            case EPropertyType::Vec4f:
+                StoreVector<4>(reg, output);
+                break;
+            case EPropertyType::Int32:
+                output.setValueAs<int32_t>(reg.i);
+                break;
+            case EPropertyType::Bool:
+                output.setValueAs<bool>(reg.i != 0);
+                break;
+            case EPropertyType::Int64:
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                assert(false && "Type not supported by expressions");
+                break;
+            }
+        }
+
+        // Interface of the program from the (deserialized) properties, nullopt if they are not a flat struct
+        std::optional<std::vector<TypeData>> GetInterface(const Property& rootProperty)
+        {
+            if (rootProperty.getType() != EPropertyType::Struct)
+                return std::nullopt;
+
+            std::vector<TypeData> properties;
+            properties.reserve(rootProperty.getChildCount());
+            for (size_t i = 0; i < rootProperty.getChildCount(); ++i)
+            {
+                const Property& child = *rootProperty.getChild(i);
+                if (child.getChildCount() != 0u)
+                    return std::nullopt;
+                properties.emplace_back(std::string(child.getName()), child.getType());
+            }
+            return properties;
+        }
+    }
+
+    ExpressionNodeImpl::ExpressionNodeImpl(std::string_view expression, ExpressionProgram program, std::string_view name, uint64_t id) noexcept
+        : LogicNodeImpl(name, id)
+        , m_expression(expression)
+        , m_program(std::move(program))
+        , m_registers(m_program.createRegisters())
+    {
+        auto inputsImpl = std::make_unique<PropertyImpl>(MakeStruct("IN", m_program.inputs), EPropertySemantics::ScriptInput);
+        auto outputsImpl = std::make_unique<PropertyImpl>(MakeStruct("OUT", m_program.outputs), EPropertySemantics::ScriptOutput);
+
+        setRootProperties(std::make_unique<Property>(std::move(inputsImpl)), std::make_unique<Property>(std::move(outputsImpl)));
+    }
+
+    std::optional<LogicNodeRuntimeError> ExpressionNodeImpl::update()
+    {
+        const Property& inputs = *getInputs();
+        for (size_t i = 0; i < m_program.inputs.size(); ++i)
+            LoadRegister(*inputs.getChild(i)->m_impl, m_registers[i]);
+
+        m_program.execute(m_registers);
+
+        Property& outputs = *getOutputs();
+        for (size_t i = 0; i < m_program.outputRegisters.size(); ++i)
+            StoreRegister(m_registers[m_program.outputRegisters[i]], *outputs.getChild(i)->m_impl);
+
+        return std::nullopt;
+    }
+
+    bool ExpressionNodeImpl::supportsConcurrentUpdate() const
+    {
+        return true;
+    }
+
+    std::string_view ExpressionNodeImpl::getExpression() const
+    {
+        return m_expression;
+    }
+
+    const ExpressionProgram& ExpressionNodeImpl::getProgram() const
+    {
+        return m_program;
+    }
+
+    flatbuffers::Offset<rlogic_serialization::ExpressionNode> ExpressionNodeImpl::Serialize(
+        const ExpressionNodeImpl& expressionNode,
+        flatbuffers::FlatBufferBuilder& builder,
+        SerializationMap& serializationMap)
+    {
+        const ExpressionProgram& program = expressionNode.m_program;
+
+        std::vector<uint16_t> instructions;
+        instructions.reserve(program.instructions.size() * SerializedInstructionSize);
+        for (const auto& instr : program.instructions)
+            instructions.insert(instructions.end(), { static_cast<uint16_t>(instr.op), instr.width, instr.dst, instr.a, instr.b, instr.c });
+
+        std::vector<uint16_t> constantRegisters;
+        std::vector<float> constantFloats;
+        std::vector<int32_t> constantInts;
+        constantRegisters.reserve(program.constants.size());
+        constantFloats.reserve(program.constants.size() * 4u);
+        constantInts.reserve(program.constants.size());
+        for (const auto& constant : program.constants)
+        {
+            constantRegisters.push_back(constant.reg);
+            constantFloats.insert(constantFloats.end(), constant.value.f.cbegin(), constant.value.f.cend());
+            constantInts.push_back(constant.value.i);
+        }
+
+        return rlogic_serialization::CreateExpressionNode(
+            builder,
+            builder.CreateString(expressionNode.getName()),
+            expressionNode.getId(),
+            builder.CreateString(expressionNode.m_expression),
+            PropertyImpl::Serialize(*expressionNode.getInputs()->m_impl, builder, serializationMap),
+            PropertyImpl::Serialize(*expressionNode.getOutputs()->m_impl, builder, serializationMap),
+            static_cast<uint32_t>(program.registerCount),
+            builder.CreateVector(instructions),
+            builder.CreateVector(constantRegisters),
+            builder.CreateVector(constantFloats),
+            builder.CreateVector(constantInts),
+            builder.CreateVector(program.outputRegisters)
+        );
+    }
+
+    std::unique_ptr<ExpressionNodeImpl> ExpressionNodeImpl::Deserialize(
+        const rlogic_serialization::ExpressionNode& expressionNodeFB,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        if (!expressionNodeFB.name() || expressionNodeFB.id() == 0u || !expressionNodeFB.expression() || !expressionNodeFB.rootInput() || !expressionNodeFB.rootOutput())
+        {
+            errorReporting.add("Fatal error during loading of ExpressionNode from serialized data: missing name, id, expression or in/out property data!", nullptr);
+            return nullptr;
+        }
+
+        const auto name = expressionNodeFB.name()->string_view();
+
+        if (!expressionNodeFB.instructions() || !expressionNodeFB.constantRegisters() || !expressionNodeFB.constantFloats() || !expressionNodeFB.constantInts() || !expressionNodeFB.outputRegisters())
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of ExpressionNode '{}' from serialized data: missing compiled expression!", name), nullptr);
+            return nullptr;
+        }
+
+        auto rootInProperty = PropertyImpl::Deserialize(*expressionNodeFB.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
+        auto rootOutProperty = PropertyImpl::Deserialize(*expressionNodeFB.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
+        if (!rootInProperty || !rootOutProperty)
+            return nullptr;
+
+        auto rootInput = std::make_unique<Property>(std::move(rootInProperty));
+        auto rootOutput = std::make_unique<Property>(std::move(rootOutProperty));
+
+        const auto& instructionsFB = *expressionNodeFB.instructions();
+        const auto& constantRegistersFB = *expressionNodeFB.constantRegisters();
+        const auto& constantFloatsFB = *expressionNodeFB.constantFloats();
+        const auto& constantIntsFB = *expressionNodeFB.constantInts();
+
+        std::optional<std::vector<TypeData>> inputs = GetInterface(*rootInput);
+        std::optional<std::vector<TypeData>> outputs = GetInterface(*rootOutput);
+        const bool hasConsistentSizes = (instructionsFB.size() % SerializedInstructionSize == 0u)
+            && (constantFloatsFB.size() == constantRegistersFB.size() * 4u)
+            && (constantIntsFB.size() == constantRegistersFB.size());
+
+        ExpressionProgram program;
+        bool isValid = inputs && outputs && hasConsistentSizes;
+        if (isValid)
+        {
+            program.inputs = std::move(*inputs);
+            program.outputs = std::move(*outputs);
+            program.registerCount = expressionNodeFB.registerCount();
+            program.outputRegisters.assign(expressionNodeFB.outputRegisters()->cbegin(), expressionNodeFB.outputRegisters()->cend());
+
+            program.constants.resize(constantRegistersFB.size());
+            for (flatbuffers::uoffset_t i = 0; i < constantRegistersFB.size(); ++i)
+            {
+                ExpressionConstant& constant = program.constants[i];
+                constant.reg = constantRegistersFB[i];
+                for (flatbuffers::uoffset_t k = 0; k < 4u; ++k)
+                    constant.value.f[k] = constantFloatsFB[i * 4u + k];
+                constant.value.i = constantIntsFB[i];
+            }
+
+            program.instructions.resize(instructionsFB.size() / SerializedInstructionSize);
+            for (size_t i = 0; i < program.instructions.size(); ++i)
+            {
+                const auto offset = static_cast<flatbuffers::uoffset_t>(i * SerializedInstructionSize);
+                // Check before the conversion, op codes are 8 bit
+                if (instructionsFB[offset] >= static_cast<uint16_t>(EExpressionOpCode::Count) || instructionsFB[offset + 1u] > 4u)
+                {
+                    isValid = false;
+                    break;
+                }
+                ExpressionInstruction& instr = program.instructions[i];
+                instr.op = static_cast<EExpressionOpCode>(instructionsFB[offset]);
+                instr.width = static_cast<uint8_t>(instructionsFB[offset + 1u]);
+                instr.dst = instructionsFB[offset + 2u];
+                instr.a = instructionsFB[offset + 3u];
+                instr.b = instructionsFB[offset + 4u];
+                instr.c = instructionsFB[offset + 5u];
+            }
+        }
+
+        if (!isValid || !program.isValid())
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of ExpressionNode '{}' from serialized data: invalid compiled expression!", name), nullptr);
+            return nullptr;
+        }
+
+        auto deserialized = std::make_unique<ExpressionNodeImpl>(expressionNodeFB.expression()->string_view(), std::move(program), name, expressionNodeFB.id());
+        // overwrite constructor generated properties, they have the values from the file
+        deserialized->setRootProperties(std::move(rootInput), std::move(rootOutput));
+
+        return deserialized;
+    }
+}
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/ExpressionProgram.h"
+#include <string>
+#include <optional>
+#include <memory>
+
+namespace rlogic_serialization
+{
+    struct ExpressionNode;
+}
+
+namespace flatbuffers
+{
+    template<typename T> struct Offset;
+    class FlatBufferBuilder;
+}
+
+namespace rlogic::internal
+{
+    class SerializationMap;
+    class DeserializationMap;
+    class ErrorReporting;
+
+    class ExpressionNodeImpl : public LogicNodeImpl
+    {
+    public:
+        ExpressionNodeImpl(std::string_view expression, ExpressionProgram program, std::string_view name, uint64_t id) noexcept;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+        // Reads only its own inputs and writes only its own outputs
+        [[nodiscard]] bool supportsConcurrentUpdate() const override;
+
+        [[nodiscard]] std::string_view getExpression() const;
+        [[nodiscard]] const ExpressionProgram& getProgram() const;
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::ExpressionNode> Serialize(
+            const ExpressionNodeImpl& expressionNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+        [[nodiscard]] static std::unique_ptr<ExpressionNodeImpl> Deserialize(
+            const rlogic_serialization::ExpressionNode& expressionNodeFB,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+    private:
+        std::string m_expression;
+        ExpressionProgram m_program;
+        // Kept between updates, so that the constants are only initialized once
+        std::vector<ExpressionRegister> m_registers;
+    };
+}
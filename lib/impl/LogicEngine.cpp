@@ -16,12 +16,16 @@
 #include "ramses-logic/DataArray.h"
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/TimerNode.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/ExpressionNode.h"
 
 #include "impl/LogicEngineImpl.h"
 #include "impl/LuaConfigImpl.h"
+#include "impl/SaveFileConfigImpl.h"
 #include "internals/ApiObjects.h"
 
 #include <string>
+#include <utility>
 
 namespace rlogic
 {
@@ -87,6 +91,11 @@ namespace rlogic
         return m_impl->createLuaScript(source, *config.m_impl, scriptName);
     }
 
+    LuaScript* LogicEngine::createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName)
+    {
+        return m_impl->createLuaScriptInstance(prototype, scriptName);
+    }
+
     LuaModule* LogicEngine::createLuaModule(std::string_view source, const LuaConfig& config, std::string_view moduleName)
     {
         return m_impl->createLuaModule(source, *config.m_impl, moduleName);
@@ -134,6 +143,25 @@ namespace rlogic
         return m_impl->createTimerNode(name);
     }
 
+    bool LogicEngine::registerNativeNodeType(
+        std::string_view typeName,
+        const NativeNodePropertyDeclarations& inputs,
+        const NativeNodePropertyDeclarations& outputs,
+        NativeNodeUpdateFunction updateFunction)
+    {
+        return m_impl->registerNativeNodeType(typeName, inputs, outputs, std::move(updateFunction));
+    }
+
+    NativeNode* LogicEngine::createNativeNode(std::string_view typeName, std::string_view name)
+    {
+        return m_impl->createNativeNode(typeName, name);
+    }
+
+    ExpressionNode* LogicEngine::createExpressionNode(std::string_view expression, const ExpressionNodeInputs& inputs, std::string_view name)
+    {
+        return m_impl->createExpressionNode(expression, inputs, name);
+    }
+
     const std::vector<ErrorData>& LogicEngine::getErrors() const
     {
         return m_impl->getErrors();
@@ -144,6 +172,36 @@ namespace rlogic
         return m_impl->update();
     }
 
+    bool LogicEngine::update(std::chrono::microseconds timeBudget)
+    {
+        return m_impl->update(timeBudget);
+    }
+
+    bool LogicEngine::isUpdatePending() const
+    {
+        return m_impl->isUpdatePending();
+    }
+
+    std::shared_future<bool> LogicEngine::updateAsync()
+    {
+        return m_impl->updateAsync();
+    }
+
+    bool LogicEngine::commit()
+    {
+        return m_impl->commit();
+    }
+
+    bool LogicEngine::updateSubgraph(const LogicNode& target)
+    {
+        return m_impl->updateSubgraph(target);
+    }
+
+    void LogicEngine::setUpdateThreadCount(size_t threadCount)
+    {
+        m_impl->setUpdateThreadCount(threadCount);
+    }
+
     void LogicEngine::enableUpdateReport(bool enable)
     {
         m_impl->enableUpdateReport(enable);
@@ -154,19 +212,24 @@ namespace rlogic
         return m_impl->getLastUpdateReport();
     }
 
-    bool LogicEngine::loadFromFile(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
+    MemoryStatistics LogicEngine::getMemoryStatistics() const
     {
-        return m_impl->loadFromFile(filename, ramsesScene, enableMemoryVerification);
+        return m_impl->getMemoryStatistics();
     }
 
-    bool LogicEngine::loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
+    bool LogicEngine::loadFromFile(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */, bool loadLuaByteCode /* = false */)
     {
-        return m_impl->loadFromBuffer(rawBuffer, bufferSize, ramsesScene, enableMemoryVerification);
+        return m_impl->loadFromFile(filename, ramsesScene, enableMemoryVerification, loadLuaByteCode);
     }
 
-    bool LogicEngine::saveToFile(std::string_view filename)
+    bool LogicEngine::loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */, bool loadLuaByteCode /* = false */)
     {
-        return m_impl->saveToFile(filename);
+        return m_impl->loadFromBuffer(rawBuffer, bufferSize, ramsesScene, enableMemoryVerification, loadLuaByteCode);
+    }
+
+    bool LogicEngine::saveToFile(std::string_view filename, const SaveFileConfig& config /* = {} */)
+    {
+        return m_impl->saveToFile(filename, *config.m_impl);
     }
 
     bool LogicEngine::link(const Property& sourceProperty, const Property& targetProperty)
@@ -184,6 +247,23 @@ namespace rlogic
         return m_impl->isLinked(logicNode);
     }
 
+    PropertyHandle LogicEngine::resolvePath(LogicNode& logicNode, std::string_view path)
+    {
+        return m_impl->resolvePath(logicNode, path);
+    }
+
+    template <typename T>
+    bool LogicEngine::setInternal(PropertyHandle handle, T value)
+    {
+        return m_impl->setPropertyValue<T>(handle, std::move(value));
+    }
+
+    template <typename T>
+    std::optional<T> LogicEngine::getInternal(PropertyHandle handle) const
+    {
+        return m_impl->getPropertyValue<T>(handle);
+    }
+
     template RLOGIC_API Collection<LogicObject>             LogicEngine::getLogicObjectsInternal<LogicObject>() const;
     template RLOGIC_API Collection<LuaScript>               LogicEngine::getLogicObjectsInternal<LuaScript>() const;
     template RLOGIC_API Collection<LuaModule>               LogicEngine::getLogicObjectsInternal<LuaModule>() const;
@@ -193,6 +273,8 @@ namespace rlogic
     template RLOGIC_API Collection<DataArray>               LogicEngine::getLogicObjectsInternal<DataArray>() const;
     template RLOGIC_API Collection<AnimationNode>           LogicEngine::getLogicObjectsInternal<AnimationNode>() const;
     template RLOGIC_API Collection<TimerNode>               LogicEngine::getLogicObjectsInternal<TimerNode>() const;
+    template RLOGIC_API Collection<NativeNode>              LogicEngine::getLogicObjectsInternal<NativeNode>() const;
+    template RLOGIC_API Collection<ExpressionNode>          LogicEngine::getLogicObjectsInternal<ExpressionNode>() const;
 
     template RLOGIC_API const LogicObject*             LogicEngine::findLogicObjectInternal<LogicObject>(std::string_view) const;
     template RLOGIC_API const LuaScript*               LogicEngine::findLogicObjectInternal<LuaScript>(std::string_view) const;
@@ -203,6 +285,8 @@ namespace rlogic
     template RLOGIC_API const DataArray*               LogicEngine::findLogicObjectInternal<DataArray>(std::string_view) const;
     template RLOGIC_API const AnimationNode*           LogicEngine::findLogicObjectInternal<AnimationNode>(std::string_view) const;
     template RLOGIC_API const TimerNode*               LogicEngine::findLogicObjectInternal<TimerNode>(std::string_view) const;
+    template RLOGIC_API const NativeNode*              LogicEngine::findLogicObjectInternal<NativeNode>(std::string_view) const;
+    template RLOGIC_API const ExpressionNode*          LogicEngine::findLogicObjectInternal<ExpressionNode>(std::string_view) const;
 
     template RLOGIC_API LogicObject*             LogicEngine::findLogicObjectInternal<LogicObject>(std::string_view);
     template RLOGIC_API LuaScript*               LogicEngine::findLogicObjectInternal<LuaScript>(std::string_view);
@@ -213,6 +297,8 @@ namespace rlogic
     template RLOGIC_API DataArray*               LogicEngine::findLogicObjectInternal<DataArray>(std::string_view);
     template RLOGIC_API AnimationNode*           LogicEngine::findLogicObjectInternal<AnimationNode>(std::string_view);
     template RLOGIC_API TimerNode*               LogicEngine::findLogicObjectInternal<TimerNode>(std::string_view);
+    template RLOGIC_API NativeNode*              LogicEngine::findLogicObjectInternal<NativeNode>(std::string_view);
+    template RLOGIC_API ExpressionNode*          LogicEngine::findLogicObjectInternal<ExpressionNode>(std::string_view);
 
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<float>(const std::vector<float>&, std::string_view);
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<vec2f>(const std::vector<vec2f>&, std::string_view);
@@ -222,4 +308,28 @@ namespace rlogic
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<vec2i>(const std::vector<vec2i>&, std::string_view);
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<vec3i>(const std::vector<vec3i>&, std::string_view);
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<vec4i>(const std::vector<vec4i>&, std::string_view);
+
+    template RLOGIC_API bool LogicEngine::setInternal<float>(PropertyHandle, float);
+    template RLOGIC_API bool LogicEngine::setInternal<vec2f>(PropertyHandle, vec2f);
+    template RLOGIC_API bool LogicEngine::setInternal<vec3f>(PropertyHandle, vec3f);
+    template RLOGIC_API bool LogicEngine::setInternal<vec4f>(PropertyHandle, vec4f);
+    template RLOGIC_API bool LogicEngine::setInternal<int32_t>(PropertyHandle, int32_t);
+    template RLOGIC_API bool LogicEngine::setInternal<int64_t>(PropertyHandle, int64_t);
+    template RLOGIC_API bool LogicEngine::setInternal<vec2i>(PropertyHandle, vec2i);
+    template RLOGIC_API bool LogicEngine::setInternal<vec3i>(PropertyHandle, vec3i);
+    template RLOGIC_API bool LogicEngine::setInternal<vec4i>(PropertyHandle, vec4i);
+    template RLOGIC_API bool LogicEngine::setInternal<std::string>(PropertyHandle, std::string);
+    template RLOGIC_API bool LogicEngine::setInternal<bool>(PropertyHandle, bool);
+
+    template RLOGIC_API std::optional<float>       LogicEngine::getInternal<float>(PropertyHandle) const;
+    template RLOGIC_API std::optional<vec2f>       LogicEngine::getInternal<vec2f>(PropertyHandle) const;
+    template RLOGIC_API std::optional<vec3f>       LogicEngine::getInternal<vec3f>(PropertyHandle) const;
+    template RLOGIC_API std::optional<vec4f>       LogicEngine::getInternal<vec4f>(PropertyHandle) const;
+    template RLOGIC_API std::optional<int32_t>     LogicEngine::getInternal<int32_t>(PropertyHandle) const;
+    template RLOGIC_API std::optional<int64_t>     LogicEngine::getInternal<int64_t>(PropertyHandle) const;
+    template RLOGIC_API std::optional<vec2i>       LogicEngine::getInternal<vec2i>(PropertyHandle) const;
+    template RLOGIC_API std::optional<vec3i>       LogicEngine::getInternal<vec3i>(PropertyHandle) const;
+    template RLOGIC_API std::optional<vec4i>       LogicEngine::getInternal<vec4i>(PropertyHandle) const;
+    template RLOGIC_API std::optional<std::string> LogicEngine::getInternal<std::string>(PropertyHandle) const;
+    template RLOGIC_API std::optional<bool>        LogicEngine::getInternal<bool>(PropertyHandle) const;
 }
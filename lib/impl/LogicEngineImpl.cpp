@@ -10,13 +10,18 @@
 
 #include "ramses-framework-api/RamsesVersion.h"
 #include "ramses-logic/LogicNode.h"
+#include "ramses-logic/Property.h"
 #include "ramses-logic/DataArray.h"
 #include "ramses-logic/TimerNode.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/ExpressionNode.h"
 
 #include "impl/LogicNodeImpl.h"
+#include "impl/PropertyImpl.h"
 #include "impl/LoggerImpl.h"
 #include "impl/LuaModuleImpl.h"
 #include "impl/LuaConfigImpl.h"
+#include "impl/SaveFileConfigImpl.h"
 #include "impl/LogicEngineReportImpl.h"
 
 #include "internals/FileUtils.h"
@@ -24,6 +29,7 @@
 #include "internals/FileFormatVersions.h"
 #include "internals/RamsesObjectResolver.h"
 #include "internals/ApiObjects.h"
+#include "internals/ExpressionCompiler.h"
 
 #include "generated/LogicEngineGen.h"
 #include "ramses-logic-build-config.h"
@@ -33,24 +39,95 @@
 #include <string>
 #include <fstream>
 #include <streambuf>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <charconv>
+#include <optional>
+#include <unordered_set>
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        // Type of the inputs or outputs of a native node type, reports an error if a declaration is invalid
+        std::optional<HierarchicalTypeData> CreateNativeNodeInterface(
+            std::string_view typeName,
+            std::string_view rootName,
+            const NativeNodePropertyDeclarations& declarations,
+            ErrorReporting& errorReporting)
+        {
+            // Same limit as for arrays declared in scripts
+            constexpr size_t MaxArraySize = 255u;
+
+            std::vector<HierarchicalTypeData> properties;
+            properties.reserve(declarations.size());
+            std::unordered_set<std::string_view> names;
+            for (const NativeNodePropertyDeclaration& declaration : declarations)
+            {
+                if (declaration.name.empty())
+                {
+                    errorReporting.add(fmt::format("Failed to register native node type '{}': {} property without name!", typeName, rootName), nullptr);
+                    return std::nullopt;
+                }
+                if (!names.insert(declaration.name).second)
+                {
+                    errorReporting.add(fmt::format("Failed to register native node type '{}': {} property '{}' is declared twice!", typeName, rootName, declaration.name), nullptr);
+                    return std::nullopt;
+                }
+
+                if (TypeUtils::IsPrimitiveType(declaration.type))
+                {
+                    properties.push_back(MakeType(declaration.name, declaration.type));
+                }
+                else if (declaration.type == EPropertyType::Array &&
+                    TypeUtils::IsPrimitiveType(declaration.arrayElementType) &&
+                    declaration.arraySize != 0u && declaration.arraySize <= MaxArraySize)
+                {
+                    properties.push_back(MakeArray(declaration.name, declaration.arraySize, declaration.arrayElementType));
+                }
+                else
+                {
+                    errorReporting.add(fmt::format("Failed to register native node type '{}': {} property '{}' must be a primitive or an array of 1 to {} primitives!",
+                        typeName, rootName, declaration.name, MaxArraySize), nullptr);
+                    return std::nullopt;
+                }
+            }
+
+            return HierarchicalTypeData(TypeData(std::string(rootName), EPropertyType::Struct), std::move(properties));
+        }
+    }
+
     LogicEngineImpl::LogicEngineImpl()
         : m_apiObjects(std::make_unique<ApiObjects>())
     {
+        m_apiObjects->setAsyncUpdateThread(&m_asyncUpdateThread);
     }
 
-    LogicEngineImpl::~LogicEngineImpl() noexcept = default;
+    LogicEngineImpl::~LogicEngineImpl() noexcept
+    {
+        // The update thread works on the objects owned by this class
+        waitForAsyncUpdate();
+    }
 
     LuaScript* LogicEngineImpl::createLuaScript(std::string_view source, const LuaConfigImpl& config, std::string_view scriptName)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->createLuaScript(source, config, scriptName, m_errors);
     }
 
+    LuaScript* LogicEngineImpl::createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName)
+    {
+        waitForAsyncUpdate();
+        m_errors.clear();
+        return m_apiObjects->createLuaScriptInstance(prototype, scriptName, m_errors);
+    }
+
     LuaModule* LogicEngineImpl::createLuaModule(std::string_view source, const LuaConfigImpl& config, std::string_view moduleName)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->createLuaModule(source, config, moduleName, m_errors);
     }
@@ -70,18 +147,21 @@ namespace rlogic::internal
 
     RamsesNodeBinding* LogicEngineImpl::createRamsesNodeBinding(ramses::Node& ramsesNode, ERotationType rotationType, std::string_view name)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->createRamsesNodeBinding(ramsesNode, rotationType,  name);
     }
 
     RamsesAppearanceBinding* LogicEngineImpl::createRamsesAppearanceBinding(ramses::Appearance& ramsesAppearance, std::string_view name)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->createRamsesAppearanceBinding(ramsesAppearance, name);
     }
 
     RamsesCameraBinding* LogicEngineImpl::createRamsesCameraBinding(ramses::Camera& ramsesCamera, std::string_view name)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->createRamsesCameraBinding(ramsesCamera, name);
     }
@@ -89,6 +169,7 @@ namespace rlogic::internal
     template <typename T>
     DataArray* LogicEngineImpl::createDataArray(const std::vector<T>& data, std::string_view name)
     {
+        waitForAsyncUpdate();
         static_assert(CanPropertyTypeBeStoredInDataArray(PropertyTypeToEnum<T>::TYPE));
         m_errors.clear();
         if (data.empty())
@@ -102,6 +183,7 @@ namespace rlogic::internal
 
     rlogic::AnimationNode* LogicEngineImpl::createAnimationNode(const AnimationChannels& channels, std::string_view name)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
 
         auto containsDataArray = [this](const DataArray* da) {
@@ -194,47 +276,107 @@ namespace rlogic::internal
 
     TimerNode* LogicEngineImpl::createTimerNode(std::string_view name)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->createTimerNode(name);
     }
 
+    bool LogicEngineImpl::registerNativeNodeType(
+        std::string_view typeName,
+        const NativeNodePropertyDeclarations& inputs,
+        const NativeNodePropertyDeclarations& outputs,
+        NativeNodeUpdateFunction updateFunction)
+    {
+        waitForAsyncUpdate();
+        m_errors.clear();
+
+        if (typeName.empty())
+        {
+            m_errors.add("Failed to register native node type: type name must not be empty!", nullptr);
+            return false;
+        }
+
+        if (m_nativeNodeTypes.find(std::string(typeName)) != m_nativeNodeTypes.cend())
+        {
+            m_errors.add(fmt::format("Failed to register native node type '{}': a type with this name is already registered!", typeName), nullptr);
+            return false;
+        }
+
+        if (!updateFunction)
+        {
+            m_errors.add(fmt::format("Failed to register native node type '{}': missing update function!", typeName), nullptr);
+            return false;
+        }
+
+        std::optional<HierarchicalTypeData> inputsType = CreateNativeNodeInterface(typeName, "IN", inputs, m_errors);
+        if (!inputsType)
+            return false;
+        std::optional<HierarchicalTypeData> outputsType = CreateNativeNodeInterface(typeName, "OUT", outputs, m_errors);
+        if (!outputsType)
+            return false;
+
+        auto type = std::make_shared<NativeNodeType>(NativeNodeType{ std::string(typeName), std::move(*inputsType), std::move(*outputsType), std::move(updateFunction) });
+        m_nativeNodeTypes.emplace(std::string(typeName), std::move(type));
+        return true;
+    }
+
+    NativeNode* LogicEngineImpl::createNativeNode(std::string_view typeName, std::string_view name)
+    {
+        waitForAsyncUpdate();
+        m_errors.clear();
+
+        const auto typeIter = m_nativeNodeTypes.find(std::string(typeName));
+        if (typeIter == m_nativeNodeTypes.cend())
+        {
+            m_errors.add(fmt::format("Failed to create NativeNode '{}': type '{}' is not registered!", name, typeName), nullptr);
+            return nullptr;
+        }
+
+        return m_apiObjects->createNativeNode(typeIter->second, name);
+    }
+
+    ExpressionNode* LogicEngineImpl::createExpressionNode(std::string_view expression, const ExpressionNodeInputs& inputs, std::string_view name)
+    {
+        waitForAsyncUpdate();
+        m_errors.clear();
+
+        std::vector<TypeData> inputTypes;
+        inputTypes.reserve(inputs.size());
+        for (const auto& input : inputs)
+            inputTypes.emplace_back(input.name, input.type);
+
+        std::optional<ExpressionProgram> program = ExpressionCompiler::Compile(expression, inputTypes, name, m_errors);
+        if (!program)
+            return nullptr;
+
+        return m_apiObjects->createExpressionNode(expression, std::move(*program), name);
+    }
+
     bool LogicEngineImpl::destroy(LogicObject& object)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
         return m_apiObjects->destroy(object, m_errors);
     }
 
     bool LogicEngineImpl::isLinked(const LogicNode& logicNode) const
     {
+        waitForAsyncUpdate();
         return m_apiObjects->getLogicNodeDependencies().isLinked(logicNode.m_impl);
     }
 
-    size_t LogicEngineImpl::activateLinksRecursive(PropertyImpl& output)
+    size_t LogicEngineImpl::activateLinks(LogicNodeImpl& node)
     {
         size_t activatedLinks = 0u;
 
-        const auto childCount = output.getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
+        for (const LinkInstruction& link : node.getLinkProgram())
         {
-            PropertyImpl& child = *output.getChild(i)->m_impl;
-
-            if (TypeUtils::CanHaveChildren(child.getType()))
-            {
-                activatedLinks += activateLinksRecursive(child);
-            }
-            else
+            PropertyImpl& linkedInput = *link.target;
+            const bool valueChanged = linkedInput.copyValue(*link.source);
+            if (valueChanged || linkedInput.getPropertySemantics() == EPropertySemantics::AnimationInput)
             {
-                std::vector<PropertyImpl*>& outgoingProperties = child.getLinkedOutgoingProperties();
-
-                for (auto* linkedInput : outgoingProperties)
-                {
-                    const bool valueChanged = linkedInput->setValue(child.getValue());
-                    if (valueChanged || linkedInput->getPropertySemantics() == EPropertySemantics::AnimationInput)
-                    {
-                        linkedInput->getLogicNode().setDirty(true);
-                        ++activatedLinks;
-                    }
-                }
+                linkedInput.getLogicNode().setDirty(true);
+                ++activatedLinks;
             }
         }
 
@@ -243,17 +385,81 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::update()
     {
+        waitForAsyncUpdate();
+        return updateUntil(std::nullopt);
+    }
+
+    bool LogicEngineImpl::update(std::chrono::microseconds timeBudget)
+    {
+        waitForAsyncUpdate();
+        return updateUntil(UpdateReport::Clock::now() + timeBudget);
+    }
+
+    std::shared_future<bool> LogicEngineImpl::updateAsync()
+    {
+        waitForAsyncUpdate();
+
+        // Bindings record their values until commit(), the worker thread never accesses Ramses objects
+        m_apiObjects->getRamsesCommandBuffer().setDeferred(true);
+        return m_asyncUpdateThread.start([this]() { return updateUntil(std::nullopt); });
+    }
+
+    bool LogicEngineImpl::commit()
+    {
+        waitForAsyncUpdate();
         m_errors.clear();
 
+        m_apiObjects->getRamsesCommandBuffer().setDeferred(false);
+        return applyRamsesCommands();
+    }
+
+    bool LogicEngineImpl::applyRamsesCommands()
+    {
+        RamsesCommandBuffer& commandBuffer = m_apiObjects->getRamsesCommandBuffer();
+        const std::vector<RamsesCommandBuffer::CommandError> errors = commandBuffer.applyRecordedCommands();
+
+        if (m_updateReportEnabled)
+        {
+            const RamsesCommandBuffer::FlushStatistics& statistics = commandBuffer.getLastFlushStatistics();
+            m_updateReport.ramsesCommandsApplied(statistics.appliedCommands, statistics.elidedCommands);
+        }
+
+        for (const RamsesCommandBuffer::CommandError& error : errors)
+        {
+            m_errors.add(error.message, m_apiObjects->getApiObject(*error.binding));
+            // Same as a binding which failed to update, the binding tries again in the next update
+            error.binding->setDirty(true);
+        }
+
+        return errors.empty();
+    }
+
+    void LogicEngineImpl::waitForAsyncUpdate() const
+    {
+        m_asyncUpdateThread.wait();
+    }
+
+    bool LogicEngineImpl::isUpdatePending() const
+    {
+        waitForAsyncUpdate();
+        return m_updatePending;
+    }
+
+    bool LogicEngineImpl::updateUntil(std::optional<UpdateReport::TimePoint> deadline)
+    {
+        m_errors.clear();
+
+        LuaMemoryStatistics luaMemoryBeforeUpdate;
         if (m_updateReportEnabled)
         {
             m_updateReport.clear();
             m_updateReport.sectionStarted(UpdateReport::ETimingSection::TotalUpdate);
             m_updateReport.sectionStarted(UpdateReport::ETimingSection::TopologySort);
+            luaMemoryBeforeUpdate = m_apiObjects->getLuaMemoryStatistics();
         }
 
-        const std::optional<NodeVector>& sortedNodes = m_apiObjects->getLogicNodeDependencies().getTopologicallySortedNodes();
-        if (!sortedNodes)
+        LogicNodeDependencies& logicNodeDependencies = m_apiObjects->getLogicNodeDependencies();
+        if (!logicNodeDependencies.updateTopologicalOrder())
         {
             m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling update()!", nullptr);
             return false;
@@ -262,18 +468,110 @@ namespace rlogic::internal
         if (m_updateReportEnabled)
             m_updateReport.sectionFinished(UpdateReport::ETimingSection::TopologySort);
 
-        // force dirty all timer nodes so they update their tickers
+        // force dirty all timer nodes so they update their tickers (only once, not again when an interrupted update is resumed)
+        if (!m_updatePending)
+        {
+            for (TimerNode* timerNode : m_apiObjects->getApiObjectContainer<TimerNode>())
+                timerNode->m_impl.setDirty(true);
+        }
+        m_updatePending = false;
+        m_updateDeadline = deadline;
+        m_pendingAtomicNodes.clear();
+
+        // Binding writes are collected and applied in one batch after the nodes were updated, unless an asynchronous
+        // update defers them until commit()
+        RamsesCommandBuffer& commandBuffer = m_apiObjects->getRamsesCommandBuffer();
+        const bool applyCommandsAfterUpdate = !commandBuffer.isDeferred();
+        commandBuffer.setDeferred(true);
+
+        // The dirty node queue is only used when no report is collected - the report lists also the skipped nodes.
+        // Time budgeted updates always use the queue, it keeps the remaining nodes when the update is interrupted. Their
+        // report lists the executed nodes, but not the skipped ones
+        bool success = ((m_nodeDirtyMechanismEnabled && !m_updateReportEnabled) || deadline) ?
+            updateDirtyNodes() :
+            updateNodes(*logicNodeDependencies.getTopologicallySortedNodes());
+
+        // Also the writes of the bindings which were updated before a failing node are applied
+        if (applyCommandsAfterUpdate)
+        {
+            commandBuffer.setDeferred(false);
+            success = applyRamsesCommands() && success;
+        }
+
+        if (m_updateReportEnabled)
+        {
+            const LuaMemoryStatistics luaMemoryAfterUpdate = m_apiObjects->getLuaMemoryStatistics();
+            m_updateReport.luaMemoryChanged(luaMemoryAfterUpdate.allocationCount - luaMemoryBeforeUpdate.allocationCount,
+                static_cast<int64_t>(luaMemoryAfterUpdate.allocatedBytes) - static_cast<int64_t>(luaMemoryBeforeUpdate.allocatedBytes));
+            m_updateReport.sectionFinished(UpdateReport::ETimingSection::TotalUpdate);
+        }
+
+        return success;
+    }
+
+    bool LogicEngineImpl::updateSubgraph(const LogicNode& target)
+    {
+        waitForAsyncUpdate();
+        m_errors.clear();
+
+        LogicNodeDependencies& logicNodeDependencies = m_apiObjects->getLogicNodeDependencies();
+        if (!logicNodeDependencies.containsNode(target.m_impl))
+        {
+            m_errors.add(fmt::format("LogicNode '{}' is not an instance of this LogicEngine", target.getName()), nullptr);
+            return false;
+        }
+
+        if (!logicNodeDependencies.updateTopologicalOrder())
+        {
+            m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling updateSubgraph()!", nullptr);
+            return false;
+        }
+
+        // Same as in update(), timer nodes outside of the subgraph are executed by the next update() anyway
         for (TimerNode* timerNode : m_apiObjects->getApiObjectContainer<TimerNode>())
             timerNode->m_impl.setDirty(true);
 
-        const bool success = updateNodes(*sortedNodes);
+        RamsesCommandBuffer& commandBuffer = m_apiObjects->getRamsesCommandBuffer();
+        const bool applyCommandsAfterUpdate = !commandBuffer.isDeferred();
+        commandBuffer.setDeferred(true);
 
-        if (m_updateReportEnabled)
-            m_updateReport.sectionFinished(UpdateReport::ETimingSection::TotalUpdate);
+        const bool success = updateUpstreamNodes(target.m_impl);
+
+        if (applyCommandsAfterUpdate)
+        {
+            commandBuffer.setDeferred(false);
+            return applyRamsesCommands() && success;
+        }
 
         return success;
     }
 
+    bool LogicEngineImpl::updateUpstreamNodes(const LogicNodeImpl& target)
+    {
+        LogicNodeDependencies& logicNodeDependencies = m_apiObjects->getLogicNodeDependencies();
+
+        // The executed nodes keep their (now stale) entries in the dirty node queue, nodes outside of the subgraph stay
+        // queued as they are, also the ones which become dirty because of activated links
+        for (LogicNodeImpl* nodeIter : logicNodeDependencies.getUpstreamNodes(target))
+        {
+            LogicNodeImpl& node = *nodeIter;
+            if (!node.isDirty())
+                continue;
+
+            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+            if (potentialError)
+            {
+                m_errors.add(potentialError->message, m_apiObjects->getApiObject(node));
+                return false;
+            }
+
+            activateLinks(node);
+            node.setDirty(false);
+        }
+
+        return true;
+    }
+
     bool LogicEngineImpl::updateNodes(const NodeVector& sortedNodes)
     {
         for (LogicNodeImpl* nodeIter : sortedNodes)
@@ -300,18 +598,213 @@ namespace rlogic::internal
                 return false;
             }
 
-            Property* outputs = node.getOutputs();
-            if (outputs != nullptr)
+            const size_t activatedLinks = activateLinks(node);
+            if (m_updateReportEnabled)
+                m_updateReport.linksActivated(activatedLinks);
+
+            if (m_updateReportEnabled)
+                m_updateReport.nodeExecutionFinished();
+
+            node.setDirty(false);
+        }
+
+        // All nodes were visited and are clean now, no need to keep their queue entries
+        m_apiObjects->getLogicNodeDependencies().getDirtyNodes().clear();
+
+        return true;
+    }
+
+    bool LogicEngineImpl::updateDirtyNodes()
+    {
+        DirtyNodeQueue& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodes();
+
+        bool executedNodes = false;
+        while (!dirtyNodes.empty())
+        {
+            LogicNodeImpl& node = dirtyNodes.top();
+            dirtyNodes.pop();
+
+            // Skip stale entries (nodes can become clean while queued, e.g. after an update which failed midway)
+            if (!node.isDirty())
+                continue;
+
+            // Every call makes progress, also if the budget is smaller than the execution time of a single node
+            if (executedNodes && isUpdateDeadlineReached())
+            {
+                dirtyNodes.push(node);
+                m_updatePending = true;
+                return true;
+            }
+            executedNodes = true;
+
+            // Nodes are timed one after another for the report
+            if (m_threadPool && node.supportsConcurrentUpdate() && !m_updateReportEnabled)
             {
-                const size_t activatedLinks = activateLinksRecursive(*outputs->m_impl);
+                if (!updateConcurrentNodes(node))
+                    return false;
+                continue;
+            }
 
-                if (m_updateReportEnabled)
-                    m_updateReport.linksActivated(activatedLinks);
+            if (m_updateReportEnabled)
+                m_updateReport.nodeExecutionStarted(m_apiObjects->getApiObject(node));
+
+            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+            if (potentialError)
+            {
+                // Keep the node queued, it's still dirty
+                dirtyNodes.push(node);
+                m_errors.add(potentialError->message, m_apiObjects->getApiObject(node));
+                return false;
             }
 
+            // Pushes linked nodes with changed inputs to the queue - they always have higher rank than this node
+            const size_t activatedLinks = activateLinks(node);
             if (m_updateReportEnabled)
+            {
+                m_updateReport.linksActivated(activatedLinks);
                 m_updateReport.nodeExecutionFinished();
+            }
+            if (m_updateDeadline)
+                collectPendingAtomicNodes(node);
+
+            node.setDirty(false);
+        }
+
+        return true;
+    }
+
+    bool LogicEngineImpl::isUpdateDeadlineReached()
+    {
+        if (!m_updateDeadline || UpdateReport::Clock::now() < *m_updateDeadline)
+            return false;
+
+        // Not interrupted as long as a node which must be updated atomically with its sources got new values in this call
+        m_pendingAtomicNodes.erase(
+            std::remove_if(m_pendingAtomicNodes.begin(), m_pendingAtomicNodes.end(), [](const LogicNodeImpl* node) { return !node->isDirty(); }),
+            m_pendingAtomicNodes.end());
+        return m_pendingAtomicNodes.empty();
+    }
+
+    void LogicEngineImpl::collectPendingAtomicNodes(LogicNodeImpl& node)
+    {
+        for (const LinkInstruction& link : node.getLinkProgram())
+        {
+            LogicNodeImpl& targetNode = link.target->getLogicNode();
+            if (targetNode.isDirty() && targetNode.updatesAtomicallyWithSources())
+                m_pendingAtomicNodes.push_back(&targetNode);
+        }
+    }
+
+    bool LogicEngineImpl::updateConcurrentNodes(LogicNodeImpl& firstNode)
+    {
+        DirtyNodeQueue& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodes();
+        const size_t level = firstNode.getTopologicalLevel();
+
+        // Collect all dirty nodes of the same level - they are next to each other in the queue and can't be linked
+        // to each other. Nodes which don't support concurrent update are executed afterwards on this thread
+        m_concurrentNodes.clear();
+        m_deferredNodes.clear();
+        m_concurrentNodes.push_back(&firstNode);
+        while (!dirtyNodes.empty())
+        {
+            LogicNodeImpl& node = dirtyNodes.top();
+            const bool skipEntry = !node.isDirty();
+            if (!skipEntry && node.getTopologicalLevel() != level)
+                break;
+
+            dirtyNodes.pop();
+            if (skipEntry)
+                continue;
+
+            if (node.supportsConcurrentUpdate())
+                m_concurrentNodes.push_back(&node);
+            else
+                m_deferredNodes.push_back(&node);
+        }
+
+        // One task per group of nodes sharing the same concurrent update key, one task per node without a key
+        const size_t nodeCount = m_concurrentNodes.size();
+        m_concurrentNodeOrder.resize(nodeCount);
+        std::iota(m_concurrentNodeOrder.begin(), m_concurrentNodeOrder.end(), size_t(0u));
+        std::stable_sort(m_concurrentNodeOrder.begin(), m_concurrentNodeOrder.end(), [this](size_t lhs, size_t rhs) {
+            return std::less<const void*>()(m_concurrentNodes[lhs]->getConcurrentUpdateKey(), m_concurrentNodes[rhs]->getConcurrentUpdateKey());
+        });
 
+        m_concurrentTaskBegins.clear();
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            const void* key = m_concurrentNodes[m_concurrentNodeOrder[i]]->getConcurrentUpdateKey();
+            if (i == 0u || key == nullptr || key != m_concurrentNodes[m_concurrentNodeOrder[i - 1]]->getConcurrentUpdateKey())
+                m_concurrentTaskBegins.push_back(i);
+        }
+        const size_t taskCount = m_concurrentTaskBegins.size();
+        m_concurrentTaskBegins.push_back(nodeCount);
+
+        std::vector<std::optional<LogicNodeRuntimeError>> results(nodeCount);
+        const auto runTask = [this, &results](size_t task) {
+            // Nodes which read their inputs through the public API must not wait for the update which executes them
+            AsyncUpdateThread::UpdateScope updateScope(m_asyncUpdateThread);
+            for (size_t i = m_concurrentTaskBegins[task]; i < m_concurrentTaskBegins[task + 1]; ++i)
+            {
+                const size_t nodeIndex = m_concurrentNodeOrder[i];
+                results[nodeIndex] = m_concurrentNodes[nodeIndex]->update();
+            }
+        };
+
+        if (taskCount == 1u)
+        {
+            runTask(0u);
+        }
+        else
+        {
+            m_threadPool->execute(taskCount, runTask);
+        }
+
+        // Links are activated on this thread and in queue order, same as in serial execution
+        std::optional<size_t> firstFailedNode;
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            LogicNodeImpl& node = *m_concurrentNodes[i];
+            if (results[i])
+            {
+                // Keep the node queued, it's still dirty
+                dirtyNodes.push(node);
+                if (!firstFailedNode)
+                    firstFailedNode = i;
+                continue;
+            }
+
+            activateLinks(node);
+            if (m_updateDeadline)
+                collectPendingAtomicNodes(node);
+            node.setDirty(false);
+        }
+
+        if (firstFailedNode)
+        {
+            for (LogicNodeImpl* deferredNode : m_deferredNodes)
+                dirtyNodes.push(*deferredNode);
+
+            m_errors.add(results[*firstFailedNode]->message, m_apiObjects->getApiObject(*m_concurrentNodes[*firstFailedNode]));
+            return false;
+        }
+
+        for (size_t i = 0; i < m_deferredNodes.size(); ++i)
+        {
+            LogicNodeImpl& node = *m_deferredNodes[i];
+            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+            if (potentialError)
+            {
+                for (size_t j = i; j < m_deferredNodes.size(); ++j)
+                    dirtyNodes.push(*m_deferredNodes[j]);
+
+                m_errors.add(potentialError->message, m_apiObjects->getApiObject(node));
+                return false;
+            }
+
+            activateLinks(node);
+            if (m_updateDeadline)
+                collectPendingAtomicNodes(node);
             node.setDirty(false);
         }
 
@@ -320,6 +813,7 @@ namespace rlogic::internal
 
     const std::vector<ErrorData>& LogicEngineImpl::getErrors() const
     {
+        waitForAsyncUpdate();
         return m_errors.getErrors();
     }
 
@@ -352,13 +846,15 @@ namespace rlogic::internal
         return static_cast<int>(ramsesVersion.v_major()) == ramses::GetRamsesVersion().major;
     }
 
-    bool LogicEngineImpl::loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification)
+    bool LogicEngineImpl::loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification, bool loadLuaByteCode)
     {
-        return loadFromByteData(rawBuffer, bufferSize, scene, enableMemoryVerification, fmt::format("data buffer '{}' (size: {})", rawBuffer, bufferSize));
+        waitForAsyncUpdate();
+        return loadFromByteData(rawBuffer, bufferSize, scene, enableMemoryVerification, loadLuaByteCode, fmt::format("data buffer '{}' (size: {})", rawBuffer, bufferSize));
     }
 
-    bool LogicEngineImpl::loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification)
+    bool LogicEngineImpl::loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification, bool loadLuaByteCode)
     {
+        waitForAsyncUpdate();
         std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(std::string(filename));
         if (!maybeBytesFromFile)
         {
@@ -367,12 +863,12 @@ namespace rlogic::internal
         }
 
         const size_t fileSize = (*maybeBytesFromFile).size();
-        return loadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize));
+        return loadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, loadLuaByteCode, fmt::format("file '{}' (size: {})", filename, fileSize));
     }
 
     // TODO Violin consider handling errors gracefully, e.g. don't change state when error occurs
     // Idea: collect data, and only move() in the end when everything was loaded correctly
-    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription)
+    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, bool loadLuaByteCode, const std::string& dataSourceDescription)
     {
         m_errors.clear();
 
@@ -420,7 +916,14 @@ namespace rlogic::internal
 
         RamsesObjectResolver ramsesResolver(m_errors, scene);
 
-        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver, dataSourceDescription, m_errors);
+        // Lua can't verify byte code, a corrupted file could crash the Lua state or execute arbitrary code
+        if (loadLuaByteCode && enableMemoryVerification)
+        {
+            LOG_WARN("Lua byte code of {} is not loaded because memory verification is enabled, compiling the Lua source code instead", dataSourceDescription);
+        }
+        const bool useLuaByteCode = loadLuaByteCode && !enableMemoryVerification;
+
+        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver, dataSourceDescription, m_nativeNodeTypes, useLuaByteCode, m_errors);
 
         if (!deserializedObjects)
         {
@@ -429,12 +932,15 @@ namespace rlogic::internal
 
         // No errors -> move data into member
         m_apiObjects = std::move(deserializedObjects);
+        m_apiObjects->setAsyncUpdateThread(&m_asyncUpdateThread);
+        ++m_apiObjectsGeneration;
 
         return true;
     }
 
-    bool LogicEngineImpl::saveToFile(std::string_view filename)
+    bool LogicEngineImpl::saveToFile(std::string_view filename, const SaveFileConfigImpl& config)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
 
         if (!m_apiObjects->checkBindingsReferToSameRamsesScene(m_errors))
@@ -444,7 +950,7 @@ namespace rlogic::internal
         }
 
         // Refuse save() if logic graph has loops
-        if (!m_apiObjects->getLogicNodeDependencies().getTopologicallySortedNodes())
+        if (!m_apiObjects->getLogicNodeDependencies().updateTopologicalOrder())
         {
             m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling saveToFile()!", nullptr);
             return false;
@@ -476,7 +982,7 @@ namespace rlogic::internal
         const auto logicEngine = rlogic_serialization::CreateLogicEngine(builder,
             ramsesVersionOffset,
             ramsesLogicVersionOffset,
-            ApiObjects::Serialize(*m_apiObjects, builder));
+            ApiObjects::Serialize(*m_apiObjects, builder, config.getLuaByteCodeEnabled()));
         builder.Finish(logicEngine);
 
         if (!FileUtils::SaveBinary(std::string(filename), builder.GetBufferPointer(), builder.GetSize()))
@@ -492,6 +998,7 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::link(const Property& sourceProperty, const Property& targetProperty)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
 
         return m_apiObjects->getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, m_errors);
@@ -499,13 +1006,154 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::unlink(const Property& sourceProperty, const Property& targetProperty)
     {
+        waitForAsyncUpdate();
         m_errors.clear();
 
         return m_apiObjects->getLogicNodeDependencies().unlink(*sourceProperty.m_impl, *targetProperty.m_impl, m_errors);
     }
 
+    PropertyHandle LogicEngineImpl::resolvePath(LogicNode& logicNode, std::string_view path)
+    {
+        waitForAsyncUpdate();
+        m_errors.clear();
+
+        if (!m_apiObjects->getLogicNodeDependencies().containsNode(logicNode.m_impl))
+        {
+            m_errors.add(fmt::format("LogicNode '{}' is not an instance of this LogicEngine", logicNode.getName()), nullptr);
+            return {};
+        }
+
+        const auto reportError = [this, &logicNode, path](std::string_view reason) {
+            m_errors.add(fmt::format("Failed to resolve path '{}' of LogicNode '{}': {}", path, logicNode.getName(), reason), &logicNode);
+            return PropertyHandle{};
+        };
+
+        size_t position = std::min(path.find_first_of(".["), path.size());
+        const std::string_view rootName = path.substr(0, position);
+        Property* property = nullptr;
+        LogicNodeImpl& logicNodeImpl = logicNode.m_impl;
+        if (logicNodeImpl.getInputs() != nullptr && logicNodeImpl.getInputs()->getName() == rootName)
+        {
+            property = logicNodeImpl.getInputs();
+        }
+        else if (logicNodeImpl.getOutputs() != nullptr && logicNodeImpl.getOutputs()->getName() == rootName)
+        {
+            property = logicNodeImpl.getOutputs();
+        }
+        else
+        {
+            return reportError(fmt::format("no root property with name '{}'", rootName));
+        }
+
+        while (position < path.size())
+        {
+            const PropertyImpl& parent = *property->m_impl;
+            if (path[position] == '.')
+            {
+                const size_t nameEnd = std::min(path.find_first_of(".[", position + 1), path.size());
+                const std::string_view childName = path.substr(position + 1, nameEnd - position - 1);
+                if (parent.getType() != EPropertyType::Struct)
+                {
+                    return reportError(fmt::format("property '{}' is not a struct, can't access field '{}'", parent.getName(), childName));
+                }
+                const std::optional<size_t> childIndex = parent.findChildIndex(childName);
+                if (!childIndex)
+                {
+                    return reportError(fmt::format("property '{}' has no field '{}'", parent.getName(), childName));
+                }
+                property = property->m_impl->getChild(*childIndex);
+                position = nameEnd;
+            }
+            else if (path[position] == '[')
+            {
+                const size_t indexEnd = path.find(']', position + 1);
+                if (indexEnd == std::string_view::npos)
+                {
+                    return reportError("missing ']'");
+                }
+                const std::string_view indexString = path.substr(position + 1, indexEnd - position - 1);
+                size_t index = 0u;
+                const auto [parseEnd, parseError] = std::from_chars(indexString.data(), indexString.data() + indexString.size(), index);
+                if (indexString.empty() || parseError != std::errc() || parseEnd != indexString.data() + indexString.size())
+                {
+                    return reportError(fmt::format("invalid array index '{}'", indexString));
+                }
+                if (parent.getType() != EPropertyType::Array)
+                {
+                    return reportError(fmt::format("property '{}' is not an array, can't access index {}", parent.getName(), index));
+                }
+                if (index >= parent.getChildCount())
+                {
+                    return reportError(fmt::format("index {} is out of range of array '{}' with size {}", index, parent.getName(), parent.getChildCount()));
+                }
+                property = property->m_impl->getChild(index);
+                position = indexEnd + 1;
+            }
+            else
+            {
+                return reportError(fmt::format("unexpected character '{}' at position {}", path[position], position));
+            }
+        }
+
+        if (!TypeUtils::IsPrimitiveType(property->getType()))
+        {
+            return reportError("only properties with primitive types have a value");
+        }
+
+        return PropertyHandle{ *this, m_apiObjectsGeneration, logicNodeImpl.getId(), *property->m_impl, property->getType() };
+    }
+
+    template <typename T>
+    bool LogicEngineImpl::setPropertyValue(PropertyHandle handle, T value)
+    {
+        waitForAsyncUpdate();
+        if (!checkPropertyHandle(handle, "set"))
+        {
+            return false;
+        }
+
+        return handle.m_property->setValue_PublicApi<T>(std::move(value));
+    }
+
+    template <typename T>
+    std::optional<T> LogicEngineImpl::getPropertyValue(PropertyHandle handle) const
+    {
+        waitForAsyncUpdate();
+        if (!checkPropertyHandle(handle, "get"))
+        {
+            return std::nullopt;
+        }
+
+        return handle.m_property->getValue_PublicApi<T>();
+    }
+
+    bool LogicEngineImpl::checkPropertyHandle(PropertyHandle handle, std::string_view access) const
+    {
+        if (!handle.isValid())
+        {
+            LOG_ERROR("Can't {} value of invalid property handle", access);
+            return false;
+        }
+
+        if (handle.m_logicEngine != this)
+        {
+            LOG_ERROR("Can't {} value of property handle which was resolved by another LogicEngine", access);
+            return false;
+        }
+
+        // Ids are not reused by the objects of one generation, the property is only accessed if its node still exists
+        if (handle.m_generation != m_apiObjectsGeneration || m_apiObjects->getApiObjectById(handle.m_logicNodeId) == nullptr)
+        {
+            LOG_ERROR("Can't {} value of stale property handle, the LogicNode which owns the property was destroyed", access);
+            return false;
+        }
+
+        return true;
+    }
+
     ApiObjects& LogicEngineImpl::getApiObjects()
     {
+        waitForAsyncUpdate();
         return *m_apiObjects;
     }
 
@@ -514,8 +1162,24 @@ namespace rlogic::internal
         m_nodeDirtyMechanismEnabled = false;
     }
 
+    void LogicEngineImpl::setUpdateThreadCount(size_t threadCount)
+    {
+        waitForAsyncUpdate();
+        if (threadCount <= 1u)
+        {
+            m_threadPool.reset();
+        }
+        else if (!m_threadPool || m_threadPool->getThreadCount() != threadCount)
+        {
+            // Destroy the old pool first, its threads are joined before new ones are started
+            m_threadPool.reset();
+            m_threadPool = std::make_unique<ThreadPool>(threadCount);
+        }
+    }
+
     void LogicEngineImpl::enableUpdateReport(bool enable)
     {
+        waitForAsyncUpdate();
         m_updateReportEnabled = enable;
         if (!m_updateReportEnabled)
             m_updateReport.clear();
@@ -523,9 +1187,16 @@ namespace rlogic::internal
 
     LogicEngineReport LogicEngineImpl::getLastUpdateReport() const
     {
+        waitForAsyncUpdate();
         return LogicEngineReport{ std::make_unique<LogicEngineReportImpl>(m_updateReport) };
     }
 
+    MemoryStatistics LogicEngineImpl::getMemoryStatistics() const
+    {
+        waitForAsyncUpdate();
+        return m_apiObjects->getMemoryStatistics();
+    }
+
     template DataArray* LogicEngineImpl::createDataArray<float>(const std::vector<float>&, std::string_view name);
     template DataArray* LogicEngineImpl::createDataArray<vec2f>(const std::vector<vec2f>&, std::string_view name);
     template DataArray* LogicEngineImpl::createDataArray<vec3f>(const std::vector<vec3f>&, std::string_view name);
@@ -534,4 +1205,28 @@ namespace rlogic::internal
     template DataArray* LogicEngineImpl::createDataArray<vec2i>(const std::vector<vec2i>&, std::string_view name);
     template DataArray* LogicEngineImpl::createDataArray<vec3i>(const std::vector<vec3i>&, std::string_view name);
     template DataArray* LogicEngineImpl::createDataArray<vec4i>(const std::vector<vec4i>&, std::string_view name);
+
+    template bool LogicEngineImpl::setPropertyValue<float>(PropertyHandle, float);
+    template bool LogicEngineImpl::setPropertyValue<vec2f>(PropertyHandle, vec2f);
+    template bool LogicEngineImpl::setPropertyValue<vec3f>(PropertyHandle, vec3f);
+    template bool LogicEngineImpl::setPropertyValue<vec4f>(PropertyHandle, vec4f);
+    template bool LogicEngineImpl::setPropertyValue<int32_t>(PropertyHandle, int32_t);
+    template bool LogicEngineImpl::setPropertyValue<int64_t>(PropertyHandle, int64_t);
+    template bool LogicEngineImpl::setPropertyValue<vec2i>(PropertyHandle, vec2i);
+    template bool LogicEngineImpl::setPropertyValue<vec3i>(PropertyHandle, vec3i);
+    template bool LogicEngineImpl::setPropertyValue<vec4i>(PropertyHandle, vec4i);
+    template bool LogicEngineImpl::setPropertyValue<std::string>(PropertyHandle, std::string);
+    template bool LogicEngineImpl::setPropertyValue<bool>(PropertyHandle, bool);
+
+    template std::optional<float> LogicEngineImpl::getPropertyValue<float>(PropertyHandle) const;
+    template std::optional<vec2f> LogicEngineImpl::getPropertyValue<vec2f>(PropertyHandle) const;
+    template std::optional<vec3f> LogicEngineImpl::getPropertyValue<vec3f>(PropertyHandle) const;
+    template std::optional<vec4f> LogicEngineImpl::getPropertyValue<vec4f>(PropertyHandle) const;
+    template std::optional<int32_t> LogicEngineImpl::getPropertyValue<int32_t>(PropertyHandle) const;
+    template std::optional<int64_t> LogicEngineImpl::getPropertyValue<int64_t>(PropertyHandle) const;
+    template std::optional<vec2i> LogicEngineImpl::getPropertyValue<vec2i>(PropertyHandle) const;
+    template std::optional<vec3i> LogicEngineImpl::getPropertyValue<vec3i>(PropertyHandle) const;
+    template std::optional<vec4i> LogicEngineImpl::getPropertyValue<vec4i>(PropertyHandle) const;
+    template std::optional<std::string> LogicEngineImpl::getPropertyValue<std::string>(PropertyHandle) const;
+    template std::optional<bool> LogicEngineImpl::getPropertyValue<bool>(PropertyHandle) const;
 }
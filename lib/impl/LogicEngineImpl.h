@@ -11,9 +11,16 @@
 #include "ramses-logic/ERotationType.h"
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/LogicEngineReport.h"
+#include "ramses-logic/MemoryStatistics.h"
+#include "ramses-logic/PropertyHandle.h"
+#include "ramses-logic/NativeNodeTypes.h"
+#include "ramses-logic/ExpressionNodeTypes.h"
 #include "internals/LogicNodeDependencies.h"
 #include "internals/ErrorReporting.h"
 #include "internals/UpdateReport.h"
+#include "internals/ThreadPool.h"
+#include "internals/AsyncUpdateThread.h"
+#include "internals/NativeNodeType.h"
 
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 
@@ -21,6 +28,8 @@
 #include <vector>
 #include <string>
 #include <string_view>
+#include <future>
+#include <optional>
 
 namespace ramses
 {
@@ -39,6 +48,8 @@ namespace rlogic
     class DataArray;
     class AnimationNode;
     class TimerNode;
+    class NativeNode;
+    class ExpressionNode;
     class LuaScript;
     class LuaModule;
     class LogicNode;
@@ -53,6 +64,7 @@ namespace rlogic_serialization
 namespace rlogic::internal
 {
     class LuaConfigImpl;
+    class SaveFileConfigImpl;
     class LogicNodeImpl;
     class RamsesBindingImpl;
     class ApiObjects;
@@ -66,13 +78,15 @@ namespace rlogic::internal
         LogicEngineImpl();
         ~LogicEngineImpl() noexcept;
 
-        LogicEngineImpl(LogicEngineImpl&& other) noexcept = default;
-        LogicEngineImpl& operator=(LogicEngineImpl&& other) noexcept = default;
+        // The logic objects refer to the update thread of their engine, the engine is moved by moving LogicEngine::m_impl
+        LogicEngineImpl(LogicEngineImpl&& other) noexcept = delete;
+        LogicEngineImpl& operator=(LogicEngineImpl&& other) noexcept = delete;
         LogicEngineImpl(const LogicEngineImpl& other)                = delete;
         LogicEngineImpl& operator=(const LogicEngineImpl& other) = delete;
 
         // Public API
         LuaScript* createLuaScript(std::string_view source, const LuaConfigImpl& config, std::string_view scriptName);
+        LuaScript* createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName);
         LuaModule* createLuaModule(std::string_view source, const LuaConfigImpl& config, std::string_view moduleName);
         bool extractLuaDependencies(std::string_view source, const std::function<void(const std::string&)>& callbackFunc);
         RamsesNodeBinding* createRamsesNodeBinding(ramses::Node& ramsesNode, ERotationType rotationType, std::string_view name);
@@ -82,43 +96,97 @@ namespace rlogic::internal
         DataArray* createDataArray(const std::vector<T>& data, std::string_view name);
         AnimationNode* createAnimationNode(const AnimationChannels& channels, std::string_view name);
         TimerNode* createTimerNode(std::string_view name);
+        bool registerNativeNodeType(
+            std::string_view typeName,
+            const NativeNodePropertyDeclarations& inputs,
+            const NativeNodePropertyDeclarations& outputs,
+            NativeNodeUpdateFunction updateFunction);
+        NativeNode* createNativeNode(std::string_view typeName, std::string_view name);
+        ExpressionNode* createExpressionNode(std::string_view expression, const ExpressionNodeInputs& inputs, std::string_view name);
 
         bool destroy(LogicObject& object);
 
         bool update();
+        bool update(std::chrono::microseconds timeBudget);
+        [[nodiscard]] bool isUpdatePending() const;
+        std::shared_future<bool> updateAsync();
+        bool commit();
+        bool updateSubgraph(const LogicNode& target);
         [[nodiscard]] const std::vector<ErrorData>& getErrors() const;
 
-        bool loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification);
-        bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification);
-        bool saveToFile(std::string_view filename);
+        bool loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification, bool loadLuaByteCode);
+        bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification, bool loadLuaByteCode);
+        bool saveToFile(std::string_view filename, const SaveFileConfigImpl& config);
 
         bool link(const Property& sourceProperty, const Property& targetProperty);
         bool unlink(const Property& sourceProperty, const Property& targetProperty);
 
         [[nodiscard]] bool isLinked(const LogicNode& logicNode) const;
 
+        [[nodiscard]] PropertyHandle resolvePath(LogicNode& logicNode, std::string_view path);
+        template <typename T>
+        bool setPropertyValue(PropertyHandle handle, T value);
+        template <typename T>
+        [[nodiscard]] std::optional<T> getPropertyValue(PropertyHandle handle) const;
+
         [[nodiscard]] ApiObjects& getApiObjects();
 
         // for benchmarking purposes only
         void disableTrackingDirtyNodes();
 
+        void setUpdateThreadCount(size_t threadCount);
+
         void enableUpdateReport(bool enable);
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
+        [[nodiscard]] MemoryStatistics getMemoryStatistics() const;
 
     private:
-        size_t activateLinksRecursive(PropertyImpl& output);
+        size_t activateLinks(LogicNodeImpl& node);
 
         bool checkLogicVersionFromFile(std::string_view dataSourceDescription, uint32_t fileVersion);
         static bool CheckRamsesVersionFromFile(const rlogic_serialization::Version& ramsesVersion);
 
+        // All methods which access logic objects wait for the update thread first
+        void waitForAsyncUpdate() const;
+        [[nodiscard]] bool updateUntil(std::optional<UpdateReport::TimePoint> deadline);
         [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateUpstreamNodes(const LogicNodeImpl& target);
+        // Applies the recorded binding writes, reports an error if a Ramses object rejects a value
+        [[nodiscard]] bool applyRamsesCommands();
+        [[nodiscard]] bool updateDirtyNodes();
+        [[nodiscard]] bool updateConcurrentNodes(LogicNodeImpl& firstNode);
+        [[nodiscard]] bool isUpdateDeadlineReached();
+        void collectPendingAtomicNodes(LogicNodeImpl& node);
+
+        // Logs an error if the handle is invalid, from another logic engine or if its logic node doesn't exist anymore
+        [[nodiscard]] bool checkPropertyHandle(PropertyHandle handle, std::string_view access) const;
 
-        [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription);
+        [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, bool loadLuaByteCode, const std::string& dataSourceDescription);
 
         std::unique_ptr<ApiObjects> m_apiObjects;
+        // Incremented when m_apiObjects is replaced by loading a file, property handles of the previous objects are stale
+        uint64_t m_apiObjectsGeneration = 0u;
+        // Not part of the API objects, the types are needed to re-create native nodes when a file is loaded
+        NativeNodeTypeRegistry m_nativeNodeTypes;
         ErrorReporting m_errors;
         bool m_nodeDirtyMechanismEnabled = true;
 
+        // Only created when more than one update thread is requested
+        std::unique_ptr<ThreadPool> m_threadPool;
+        NodeVector m_concurrentNodes;
+        NodeVector m_deferredNodes;
+        std::vector<size_t> m_concurrentNodeOrder;
+        std::vector<size_t> m_concurrentTaskBegins;
+
+        // Set while an update with time budget is interrupted, the remaining dirty nodes stay in the dirty node queue
+        bool m_updatePending = false;
+        std::optional<UpdateReport::TimePoint> m_updateDeadline;
+        // Nodes which must be executed before the update can be interrupted (see LogicNodeImpl::updatesAtomicallyWithSources())
+        NodeVector m_pendingAtomicNodes;
+
+        // Executes updateAsync(), the logic nodes wait for it when their properties are accessed
+        AsyncUpdateThread m_asyncUpdateThread;
+
         bool m_updateReportEnabled = false;
         UpdateReport m_updateReport;
     };
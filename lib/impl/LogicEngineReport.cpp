@@ -50,4 +50,24 @@ namespace rlogic
         return m_impl->getTotalLinkActivations();
     }
 
+    size_t LogicEngineReport::getAppliedRamsesCommands() const
+    {
+        return m_impl->getAppliedRamsesCommands();
+    }
+
+    size_t LogicEngineReport::getElidedRamsesCommands() const
+    {
+        return m_impl->getElidedRamsesCommands();
+    }
+
+    size_t LogicEngineReport::getLuaAllocations() const
+    {
+        return m_impl->getLuaAllocations();
+    }
+
+    int64_t LogicEngineReport::getLuaAllocatedBytesDelta() const
+    {
+        return m_impl->getLuaAllocatedBytesDelta();
+    }
+
 }
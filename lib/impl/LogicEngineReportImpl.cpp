@@ -42,4 +42,24 @@ namespace rlogic::internal
         return m_reportData.getLinkActivations();
     }
 
+    size_t LogicEngineReportImpl::getAppliedRamsesCommands() const
+    {
+        return m_reportData.getAppliedRamsesCommands();
+    }
+
+    size_t LogicEngineReportImpl::getElidedRamsesCommands() const
+    {
+        return m_reportData.getElidedRamsesCommands();
+    }
+
+    size_t LogicEngineReportImpl::getLuaAllocations() const
+    {
+        return m_reportData.getLuaAllocations();
+    }
+
+    int64_t LogicEngineReportImpl::getLuaAllocatedBytesDelta() const
+    {
+        return m_reportData.getLuaAllocatedBytesDelta();
+    }
+
 }
@@ -24,6 +24,10 @@ namespace rlogic::internal
         [[nodiscard]] std::chrono::microseconds getTopologySortExecutionTime() const;
         [[nodiscard]] std::chrono::microseconds getTotalUpdateExecutionTime() const;
         [[nodiscard]] size_t getTotalLinkActivations() const;
+        [[nodiscard]] size_t getAppliedRamsesCommands() const;
+        [[nodiscard]] size_t getElidedRamsesCommands() const;
+        [[nodiscard]] size_t getLuaAllocations() const;
+        [[nodiscard]] int64_t getLuaAllocatedBytesDelta() const;
 
     private:
         UpdateReport m_reportData;
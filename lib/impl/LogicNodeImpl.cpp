@@ -12,6 +12,10 @@
 
 #include "impl/PropertyImpl.h"
 
+#include "internals/TypeUtils.h"
+#include "internals/DirtyNodeQueue.h"
+#include "internals/AsyncUpdateThread.h"
+
 namespace rlogic::internal
 {
     LogicNodeImpl::LogicNodeImpl(std::string_view name, uint64_t id) noexcept
@@ -43,6 +47,10 @@ namespace rlogic::internal
 
     void LogicNodeImpl::setDirty(bool dirty)
     {
+        if (dirty && !m_dirty && m_dirtyNodeQueue != nullptr)
+        {
+            m_dirtyNodeQueue->push(*this);
+        }
         m_dirty = dirty;
     }
 
@@ -51,6 +59,120 @@ namespace rlogic::internal
         return m_dirty;
     }
 
+    void LogicNodeImpl::setDirtyNodeQueue(DirtyNodeQueue* dirtyNodeQueue)
+    {
+        m_dirtyNodeQueue = dirtyNodeQueue;
+    }
+
+    void LogicNodeImpl::setAsyncUpdateThread(const AsyncUpdateThread* asyncUpdateThread)
+    {
+        m_asyncUpdateThread = asyncUpdateThread;
+    }
+
+    void LogicNodeImpl::waitForAsyncUpdate() const
+    {
+        if (m_asyncUpdateThread != nullptr)
+        {
+            m_asyncUpdateThread->wait();
+        }
+    }
+
+    void LogicNodeImpl::setTopologicalRank(size_t rank)
+    {
+        m_topologicalRank = rank;
+    }
+
+    size_t LogicNodeImpl::getTopologicalRank() const
+    {
+        return m_topologicalRank;
+    }
+
+    void LogicNodeImpl::setTopologicalLevel(size_t level)
+    {
+        m_topologicalLevel = level;
+    }
+
+    size_t LogicNodeImpl::getTopologicalLevel() const
+    {
+        return m_topologicalLevel;
+    }
+
+    void LogicNodeImpl::setGraphIndex(size_t index)
+    {
+        m_graphIndex = index;
+    }
+
+    size_t LogicNodeImpl::getGraphIndex() const
+    {
+        return m_graphIndex;
+    }
+
+    void LogicNodeImpl::setDirtyNodeQueuePosition(size_t position)
+    {
+        m_dirtyNodeQueuePosition = position;
+    }
+
+    size_t LogicNodeImpl::getDirtyNodeQueuePosition() const
+    {
+        return m_dirtyNodeQueuePosition;
+    }
+
+    bool LogicNodeImpl::supportsConcurrentUpdate() const
+    {
+        return false;
+    }
+
+    const void* LogicNodeImpl::getConcurrentUpdateKey() const
+    {
+        return nullptr;
+    }
+
+    bool LogicNodeImpl::updatesAtomicallyWithSources() const
+    {
+        return false;
+    }
+
+    const LinkProgram& LogicNodeImpl::getLinkProgram()
+    {
+        if (m_linkProgramOutdated)
+        {
+            m_linkProgram.clear();
+            if (m_outputs)
+            {
+                compileLinkProgramRecursive(*m_outputs->m_impl);
+            }
+            m_linkProgramOutdated = false;
+        }
+
+        return m_linkProgram;
+    }
+
+    void LogicNodeImpl::invalidateLinkProgram()
+    {
+        m_linkProgramOutdated = true;
+    }
+
+    void LogicNodeImpl::compileLinkProgramRecursive(PropertyImpl& output)
+    {
+        const auto childCount = output.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            PropertyImpl& child = *output.getChild(i)->m_impl;
+
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                compileLinkProgramRecursive(child);
+            }
+            else
+            {
+                for (PropertyImpl* linkedInput : child.getLinkedOutgoingProperties())
+                {
+                    m_linkProgram.push_back({ &child, linkedInput });
+                }
+            }
+        }
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput)
     {
         m_inputs = std::move(rootInput);
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <limits>
 
 namespace rlogic
 {
@@ -23,9 +24,25 @@ namespace rlogic
 namespace rlogic::internal
 {
     class PropertyImpl;
+    class DirtyNodeQueue;
+    class AsyncUpdateThread;
 
     struct LogicNodeRuntimeError { std::string message; };
 
+    // A single (output leaf -> linked input leaf) pair of a node. The link program of a node is the flat
+    // list of all its outgoing links, in the same order in which a depth-first traversal of the outputs
+    // would visit them. It's cached so that propagating values after update() only costs as much as there
+    // are links, regardless of how many (unlinked) output properties the node has.
+    struct LinkInstruction
+    {
+        PropertyImpl* source;
+        PropertyImpl* target;
+    };
+    using LinkProgram = std::vector<LinkInstruction>;
+
+    // Index value of nodes which are not part of a DirectedAcyclicGraph or DirtyNodeQueue
+    constexpr size_t InvalidNodeIndex = std::numeric_limits<size_t>::max();
+
     class LogicNodeImpl : public LogicObjectImpl
     {
     public:
@@ -42,9 +59,43 @@ namespace rlogic::internal
 
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
 
+        // Nodes which only access their own properties and state in update() (no Lua, no Ramses objects)
+        // can be executed on worker threads, concurrently with other such nodes of the same topological level
+        [[nodiscard]] virtual bool supportsConcurrentUpdate() const;
+        // Nodes with the same non-null key share state which must not be accessed concurrently (e.g. a Lua state),
+        // they are updated one after another on the same thread
+        [[nodiscard]] virtual const void* getConcurrentUpdateKey() const;
+        // Nodes which must receive the values of all their dirty sources in the same update call, e.g. bindings which
+        // pass the values to Ramses. A time budgeted update is never interrupted between such a node and its sources
+        [[nodiscard]] virtual bool updatesAtomicallyWithSources() const;
+
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Nodes which become dirty are pushed into this queue (set when the node is added to the dependency graph)
+        void setDirtyNodeQueue(DirtyNodeQueue* dirtyNodeQueue);
+        // Position of the node in the topologically sorted node list, used to execute dirty nodes in correct order
+        void setTopologicalRank(size_t rank);
+        [[nodiscard]] size_t getTopologicalRank() const;
+        // Length of the longest link path leading to this node. Nodes of the same level can't depend on each other
+        void setTopologicalLevel(size_t level);
+        [[nodiscard]] size_t getTopologicalLevel() const;
+        // Dense index of the node in the dependency graph, recycled when nodes are removed (see DirectedAcyclicGraph)
+        void setGraphIndex(size_t index);
+        [[nodiscard]] size_t getGraphIndex() const;
+        // Position of the node in the heap of the dirty node queue, InvalidNodeIndex if not queued
+        void setDirtyNodeQueuePosition(size_t position);
+        [[nodiscard]] size_t getDirtyNodeQueuePosition() const;
+
+        // Property values are accessed through the public API only after an asynchronous update of the logic engine
+        // has finished (set when the node is added to the logic engine)
+        void setAsyncUpdateThread(const AsyncUpdateThread* asyncUpdateThread);
+        void waitForAsyncUpdate() const;
+
+        // Rebuilt lazily when invalidated (i.e. when outgoing links were added or removed)
+        [[nodiscard]] const LinkProgram& getLinkProgram();
+        void invalidateLinkProgram();
+
     protected:
         void setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput);
 
@@ -53,5 +104,16 @@ namespace rlogic::internal
         std::unique_ptr<Property> m_outputs;
         // Dirty after creation (every node gets executed at least once after creation)
         bool                      m_dirty = true;
+        DirtyNodeQueue*           m_dirtyNodeQueue = nullptr;
+        const AsyncUpdateThread*  m_asyncUpdateThread = nullptr;
+        size_t                    m_topologicalRank = 0u;
+        size_t                    m_topologicalLevel = 0u;
+        size_t                    m_graphIndex = InvalidNodeIndex;
+        size_t                    m_dirtyNodeQueuePosition = InvalidNodeIndex;
+
+        LinkProgram               m_linkProgram;
+        bool                      m_linkProgramOutdated = false;
+
+        void compileLinkProgramRecursive(PropertyImpl& output);
     };
 }
@@ -15,6 +15,8 @@
 #include "ramses-logic/DataArray.h"
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/TimerNode.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/ExpressionNode.h"
 #include "impl/LogicObjectImpl.h"
 
 namespace rlogic
@@ -64,6 +66,8 @@ namespace rlogic
     template RLOGIC_API const DataArray*               LogicObject::internalCast() const;
     template RLOGIC_API const AnimationNode*           LogicObject::internalCast() const;
     template RLOGIC_API const TimerNode*               LogicObject::internalCast() const;
+    template RLOGIC_API const NativeNode*              LogicObject::internalCast() const;
+    template RLOGIC_API const ExpressionNode*          LogicObject::internalCast() const;
 
     template RLOGIC_API LogicObject*             LogicObject::internalCast();
     template RLOGIC_API LogicNode*               LogicObject::internalCast();
@@ -76,4 +80,6 @@ namespace rlogic
     template RLOGIC_API DataArray*               LogicObject::internalCast();
     template RLOGIC_API AnimationNode*           LogicObject::internalCast();
     template RLOGIC_API TimerNode*               LogicObject::internalCast();
+    template RLOGIC_API NativeNode*              LogicObject::internalCast();
+    template RLOGIC_API ExpressionNode*          LogicObject::internalCast();
 }
@@ -42,4 +42,14 @@ namespace rlogic
     {
         return m_impl->addStandardModuleDependency(stdModule);
     }
+
+    void LuaConfig::setExecutionGroup(uint32_t executionGroup)
+    {
+        m_impl->setExecutionGroup(executionGroup);
+    }
+
+    void LuaConfig::setMemoryLimit(size_t memoryLimit)
+    {
+        m_impl->setMemoryLimit(memoryLimit);
+    }
 }
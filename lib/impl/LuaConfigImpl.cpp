@@ -74,4 +74,24 @@ namespace rlogic::internal
         return m_stdModules;
     }
 
+    void LuaConfigImpl::setExecutionGroup(uint32_t executionGroup)
+    {
+        m_executionGroup = executionGroup;
+    }
+
+    uint32_t LuaConfigImpl::getExecutionGroup() const
+    {
+        return m_executionGroup;
+    }
+
+    void LuaConfigImpl::setMemoryLimit(size_t memoryLimit)
+    {
+        m_memoryLimit = memoryLimit;
+    }
+
+    size_t LuaConfigImpl::getMemoryLimit() const
+    {
+        return m_memoryLimit;
+    }
+
 }
@@ -14,6 +14,7 @@
 #include <string>
 #include <string_view>
 #include <vector>
+#include <cstdint>
 
 namespace rlogic
 {
@@ -30,12 +31,18 @@ namespace rlogic::internal
     public:
         bool addDependency(std::string_view aliasName, const LuaModule& moduleInstance);
         bool addStandardModuleDependency(EStandardModule stdModule);
+        void setExecutionGroup(uint32_t executionGroup);
+        void setMemoryLimit(size_t memoryLimit);
 
         [[nodiscard]] const ModuleMapping& getModuleMapping() const;
         [[nodiscard]] const StandardModules& getStandardModules() const;
+        [[nodiscard]] uint32_t getExecutionGroup() const;
+        [[nodiscard]] size_t getMemoryLimit() const;
 
     private:
         ModuleMapping m_modulesMapping;
         StandardModules m_stdModules;
+        uint32_t m_executionGroup = 0u;
+        size_t m_memoryLimit = 0u;
     };
 }
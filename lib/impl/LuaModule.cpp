@@ -19,4 +19,9 @@ namespace rlogic
     }
 
     LuaModule::~LuaModule() noexcept = default;
+
+    LuaMemoryStatistics LuaModule::getLuaMemoryStatistics() const
+    {
+        return m_impl.getLuaMemoryStatistics();
+    }
 }
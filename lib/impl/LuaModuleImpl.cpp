@@ -22,10 +22,13 @@
 
 namespace rlogic::internal
 {
-    LuaModuleImpl::LuaModuleImpl(LuaCompiledModule module, std::string_view name, uint64_t id)
+    LuaModuleImpl::LuaModuleImpl(LuaCompiledModule module, std::string_view name, uint64_t id, LuaMemoryAccount memoryAccount)
         : LogicObjectImpl(name, id)
+        , m_memoryAccount{ std::move(memoryAccount) }
         , m_sourceCode{ std::move(module.source.sourceCode) }
+        , m_solState{ module.source.solState.get() }
         , m_module{ std::move(module.moduleTable) }
+        , m_mainFunction{ std::move(module.mainFunction) }
         , m_dependencies{std::move(module.source.userModules)}
         , m_stdModules {std::move(module.source.stdModules)}
     {
@@ -37,12 +40,36 @@ namespace rlogic::internal
         return m_sourceCode;
     }
 
-    const sol::table& LuaModuleImpl::getModule() const
+    const sol::table* LuaModuleImpl::getModule(SolState& solState, ErrorReporting& errorReporting)
     {
-        return m_module;
+        if (&solState == &m_solState)
+        {
+            return &m_module;
+        }
+
+        auto moduleIter = m_moduleInOtherStates.find(&solState);
+        if (moduleIter == m_moduleInOtherStates.end())
+        {
+            LuaMemoryAccount memoryAccount = solState.createMemoryAccount();
+            LuaMemoryScope memoryScope(memoryAccount);
+
+            // Dependencies are loaded into the other state recursively when its environment is created
+            ErrorReporting moduleErrors;
+            std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModule(solState, m_dependencies, m_stdModules, m_sourceCode, getName(), moduleErrors);
+            if (!compiledModule)
+            {
+                // Can only happen if the module's main chunk behaves differently than when the module was created.
+                // Not cached, so that the next environment which uses the module reports the error again
+                errorReporting.add(fmt::format("Failed to load LuaModule '{}' into the Lua state of another execution group: {}", getName(), moduleErrors.getErrors().front().message), nullptr);
+                return nullptr;
+            }
+            moduleIter = m_moduleInOtherStates.emplace(&solState, ModuleInState{ std::move(memoryAccount), std::move(compiledModule->moduleTable) }).first;
+        }
+
+        return &moduleIter->second.module;
     }
 
-    flatbuffers::Offset<rlogic_serialization::LuaModule> LuaModuleImpl::Serialize(const LuaModuleImpl& module, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
+    flatbuffers::Offset<rlogic_serialization::LuaModule> LuaModuleImpl::Serialize(const LuaModuleImpl& module, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap, bool saveByteCode)
     {
         std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>> modulesFB;
         modulesFB.reserve(module.m_dependencies.size());
@@ -61,18 +88,27 @@ namespace rlogic::internal
             stdModules.push_back(static_cast<uint8_t>(stdModule));
         }
 
+        flatbuffers::Offset<flatbuffers::Vector<uint8_t>> byteCode = 0;
+        if (saveByteCode)
+        {
+            const sol::bytecode dumpedByteCode = SolState::DumpByteCode(module.m_mainFunction);
+            byteCode = builder.CreateVector(reinterpret_cast<const uint8_t*>(dumpedByteCode.data()), dumpedByteCode.size());
+        }
+
         return rlogic_serialization::CreateLuaModule(builder,
             builder.CreateString(module.getName()),
             module.getId(),
             builder.CreateString(module.getSourceCode()),
             builder.CreateVector(modulesFB),
-            builder.CreateVector(stdModules)
+            builder.CreateVector(stdModules),
+            byteCode
         );
     }
 
     std::unique_ptr<LuaModuleImpl> LuaModuleImpl::Deserialize(
         SolState& solState,
         const rlogic_serialization::LuaModule& module,
+        bool loadByteCode,
         ErrorReporting& errorReporting,
         DeserializationMap& deserializationMap)
     {
@@ -123,7 +159,18 @@ namespace rlogic::internal
             modulesUsed.emplace(mod->name()->str(), &moduleUsed);
         }
 
-        std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModule(solState, modulesUsed, stdModules, source, name, errorReporting);
+        std::string_view byteCode;
+        if (loadByteCode && module.byteCode())
+        {
+            byteCode = std::string_view(reinterpret_cast<const char*>(module.byteCode()->data()), module.byteCode()->size());
+        }
+
+        LuaMemoryAccount memoryAccount = solState.createMemoryAccount();
+        std::optional<LuaCompiledModule> compiledModule;
+        {
+            LuaMemoryScope memoryScope(memoryAccount);
+            compiledModule = LuaCompilationUtils::CompileModule(solState, modulesUsed, stdModules, source, name, errorReporting, byteCode);
+        }
         if (!compiledModule)
         {
             errorReporting.add(fmt::format("Fatal error during loading of LuaModule '{}' from serialized data: failed parsing Lua module source code.", name), nullptr);
@@ -132,11 +179,21 @@ namespace rlogic::internal
 
         return std::make_unique<LuaModuleImpl>(
             std::move(*compiledModule),
-            name, module.id());
+            name, module.id(), std::move(memoryAccount));
     }
 
     const ModuleMapping& LuaModuleImpl::getDependencies() const
     {
         return m_dependencies;
     }
+
+    LuaMemoryStatistics LuaModuleImpl::getLuaMemoryStatistics() const
+    {
+        LuaMemoryStatistics statistics = m_memoryAccount.getStatistics();
+        for (const auto& moduleInState : m_moduleInOtherStates)
+        {
+            AddLuaMemoryStatistics(statistics, moduleInState.second.memoryAccount.getStatistics());
+        }
+        return statistics;
+    }
 }
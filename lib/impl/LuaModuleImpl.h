@@ -11,7 +11,9 @@
 #include "impl/LogicObjectImpl.h"
 #include "internals/LuaCompilationUtils.h"
 #include "internals/SolWrapper.h"
+#include "internals/LuaAllocator.h"
 #include <string>
+#include <unordered_map>
 
 namespace rlogic_serialization
 {
@@ -39,26 +41,44 @@ namespace rlogic::internal
     class LuaModuleImpl : public LogicObjectImpl
     {
     public:
-        LuaModuleImpl(LuaCompiledModule module, std::string_view name, uint64_t id);
+        LuaModuleImpl(LuaCompiledModule module, std::string_view name, uint64_t id, LuaMemoryAccount memoryAccount);
 
         [[nodiscard]] std::string_view getSourceCode() const;
-        [[nodiscard]] const sol::table& getModule() const;
+        // Returns the module table in the given Lua state. The module is loaded from its source code
+        // the first time it's requested from a different state than the one it was created in.
+        // Returns nullptr and reports an error if the module can't be loaded into the state
+        [[nodiscard]] const sol::table* getModule(SolState& solState, ErrorReporting& errorReporting);
         [[nodiscard]] const ModuleMapping& getDependencies() const;
+        // Sum over all Lua states the module is loaded in
+        [[nodiscard]] LuaMemoryStatistics getLuaMemoryStatistics() const;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaModule> Serialize(
             const LuaModuleImpl& module,
             flatbuffers::FlatBufferBuilder& builder,
-            SerializationMap& serializationMap);
+            SerializationMap& serializationMap,
+            bool saveByteCode);
 
         [[nodiscard]] static std::unique_ptr<LuaModuleImpl> Deserialize(
             SolState& solState,
             const rlogic_serialization::LuaModule& module,
+            bool loadByteCode,
             ErrorReporting& errorReporting,
             DeserializationMap& deserializationMap);
 
     private:
+        struct ModuleInState
+        {
+            LuaMemoryAccount memoryAccount;
+            sol::table module;
+        };
+
+        LuaMemoryAccount m_memoryAccount;
         std::string m_sourceCode;
+        SolState& m_solState;
         sol::table m_module;
+        // Main chunk of the module in m_solState, serialized as byte code
+        sol::protected_function m_mainFunction;
+        std::unordered_map<const SolState*, ModuleInState> m_moduleInOtherStates;
         ModuleMapping m_dependencies;
         StandardModules m_stdModules;
     };
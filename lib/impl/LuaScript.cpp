@@ -19,4 +19,9 @@ namespace rlogic
     }
 
     LuaScript::~LuaScript() noexcept = default;
+
+    LuaMemoryStatistics LuaScript::getLuaMemoryStatistics() const
+    {
+        return m_script.getLuaMemoryStatistics();
+    }
 }
@@ -24,28 +24,121 @@
 
 namespace rlogic::internal
 {
-    LuaScriptImpl::LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id)
+    LuaScriptImpl::LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id, uint32_t executionGroup, LuaMemoryAccount memoryAccount)
         : LogicNodeImpl(name, id)
-        , m_source(std::move(compiledScript.source.sourceCode))
+        , m_memoryAccount(std::move(memoryAccount))
+        , m_source(std::make_shared<const std::string>(std::move(compiledScript.source.sourceCode)))
         , m_wrappedRootInput(*compiledScript.rootInput->m_impl)
         , m_wrappedRootOutput(*compiledScript.rootOutput->m_impl)
         , m_solFunction(std::move(compiledScript.mainFunction))
+        , m_environment(sol::get_environment(m_solFunction))
+        , m_runFunction(m_environment.get<sol::protected_function>("run"))
         , m_modules(std::move(compiledScript.source.userModules))
         , m_stdModules(std::move(compiledScript.source.stdModules))
+        , m_solState(compiledScript.source.solState.get())
+        , m_executionGroup(executionGroup)
     {
         setRootProperties(std::move(compiledScript.rootInput), std::move(compiledScript.rootOutput));
 
-        sol::environment env = sol::get_environment(m_solFunction);
+        LuaMemoryScope memoryScope(m_memoryAccount);
+        m_environment["IN"] = std::ref(m_wrappedRootInput);
+        m_environment["OUT"] = std::ref(m_wrappedRootOutput);
+    }
+
+    LuaScriptImpl::LuaScriptImpl(
+        const LuaScriptImpl& prototype,
+        LuaMemoryAccount memoryAccount,
+        sol::protected_function mainFunction,
+        std::unique_ptr<PropertyImpl> rootInput,
+        std::unique_ptr<PropertyImpl> rootOutput,
+        std::string_view name,
+        uint64_t id)
+        : LogicNodeImpl(name, id)
+        , m_memoryAccount(std::move(memoryAccount))
+        , m_source(prototype.m_source)
+        , m_wrappedRootInput(*rootInput)
+        , m_wrappedRootOutput(*rootOutput)
+        , m_solFunction(std::move(mainFunction))
+        , m_environment(sol::get_environment(m_solFunction))
+        , m_runFunction(m_environment.get<sol::protected_function>("run"))
+        , m_modules(prototype.m_modules)
+        , m_stdModules(prototype.m_stdModules)
+        , m_solState(prototype.m_solState)
+        , m_executionGroup(prototype.m_executionGroup)
+    {
+        setRootProperties(std::make_unique<Property>(std::move(rootInput)), std::make_unique<Property>(std::move(rootOutput)));
+
+        LuaMemoryScope memoryScope(m_memoryAccount);
+        m_environment["IN"] = std::ref(m_wrappedRootInput);
+        m_environment["OUT"] = std::ref(m_wrappedRootOutput);
+    }
 
-        env["IN"] = std::ref(m_wrappedRootInput);
-        env["OUT"] = std::ref(m_wrappedRootOutput);
+    std::unique_ptr<LuaScriptImpl> LuaScriptImpl::CreateInstance(const LuaScriptImpl& prototype, std::string_view name, uint64_t id, ErrorReporting& errorReporting)
+    {
+        // Same interface as the prototype, but default values
+        return CreateInstance(prototype,
+            std::make_unique<PropertyImpl>(prototype.getInputs()->m_impl->getTypeDescriptor(), EPropertySemantics::ScriptInput),
+            std::make_unique<PropertyImpl>(prototype.getOutputs()->m_impl->getTypeDescriptor(), EPropertySemantics::ScriptOutput),
+            name, id, errorReporting);
     }
 
-    flatbuffers::Offset<rlogic_serialization::LuaScript> LuaScriptImpl::Serialize(const LuaScriptImpl& luaScript, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
+    std::unique_ptr<LuaScriptImpl> LuaScriptImpl::CreateInstance(
+        const LuaScriptImpl& prototype,
+        std::unique_ptr<PropertyImpl> rootInput,
+        std::unique_ptr<PropertyImpl> rootOutput,
+        std::string_view name,
+        uint64_t id,
+        ErrorReporting& errorReporting)
     {
-        // TODO Violin investigate options to save byte code, instead of plain text, e.g.:
-        //sol::bytecode scriptCode = m_solFunction.dump();
+        LuaMemoryAccount memoryAccount = prototype.m_solState.createMemoryAccount(prototype.getMemoryLimit());
+        LuaMemoryScope memoryScope(memoryAccount);
+
+        std::optional<sol::environment> maybeEnv = prototype.m_solState.createEnvironment(prototype.m_stdModules, prototype.m_modules, errorReporting);
+        if (!maybeEnv)
+        {
+            return nullptr;
+        }
+        sol::environment& env = *maybeEnv;
+        env["GLOBAL"] = prototype.m_solState.createTable();
+
+        // Lua functions keep the environment which was active when they were defined, executing the main chunk again
+        // defines the script functions of the instance without affecting the functions of the prototype. The main
+        // chunk is copied, setting the environment on the prototype's closure would change it for the prototype too
+        sol::load_result loadResult = prototype.m_solState.copyFunction(prototype.m_solFunction, name);
+        if (!loadResult.valid())
+        {
+            sol::error error = loadResult;
+            errorReporting.add(fmt::format("[{}] Error while instantiating script from '{}'. Lua stack trace:\n{}", name, prototype.getName(), error.what()), nullptr);
+            return nullptr;
+        }
+        sol::protected_function mainFunction = loadResult;
+        env.set_on(mainFunction);
+
+        sol::protected_function_result mainResult = mainFunction();
+        if (!mainResult.valid())
+        {
+            sol::error error = mainResult;
+            errorReporting.add(fmt::format("[{}] Error while instantiating script from '{}'. Lua stack trace:\n{}", name, prototype.getName(), error.what()), nullptr);
+            return nullptr;
+        }
 
+        sol::protected_function init = env["init"];
+        if (init.valid())
+        {
+            sol::protected_function_result initResult = init();
+            if (!initResult.valid())
+            {
+                sol::error error = initResult;
+                errorReporting.add(fmt::format("[{}] Error while initializing script. Lua stack trace:\n{}", name, error.what()), nullptr);
+                return nullptr;
+            }
+        }
+
+        return std::unique_ptr<LuaScriptImpl>(new LuaScriptImpl(prototype, std::move(memoryAccount), std::move(mainFunction), std::move(rootInput), std::move(rootOutput), name, id));
+    }
+
+    flatbuffers::Offset<rlogic_serialization::LuaScript> LuaScriptImpl::Serialize(const LuaScriptImpl& luaScript, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap, bool saveByteCode)
+    {
         std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>> userModules;
         userModules.reserve(luaScript.m_modules.size());
         for (const auto& module : luaScript.m_modules)
@@ -63,14 +156,33 @@ namespace rlogic::internal
             stdModules.push_back(static_cast<uint8_t>(stdModule));
         }
 
+        // Instances share the source with the first serialized script, which is loaded before them
+        const std::optional<uint64_t> sourceScriptId = serializationMap.resolveLuaScriptSource(*luaScript.m_source);
+        flatbuffers::Offset<flatbuffers::String> sourceCode = 0;
+        flatbuffers::Offset<flatbuffers::Vector<uint8_t>> byteCode = 0;
+        if (!sourceScriptId)
+        {
+            sourceCode = builder.CreateString(*luaScript.m_source);
+            if (saveByteCode)
+            {
+                const sol::bytecode dumpedByteCode = SolState::DumpByteCode(luaScript.m_solFunction);
+                byteCode = builder.CreateVector(reinterpret_cast<const uint8_t*>(dumpedByteCode.data()), dumpedByteCode.size());
+            }
+            serializationMap.storeLuaScriptSource(*luaScript.m_source, luaScript.getId());
+        }
+
         auto script = rlogic_serialization::CreateLuaScript(builder,
             builder.CreateString(luaScript.getName()),
             luaScript.getId(),
-            builder.CreateString(luaScript.m_source),
+            sourceCode,
             builder.CreateVector(userModules),
             builder.CreateVector(stdModules),
             PropertyImpl::Serialize(*luaScript.getInputs()->m_impl, builder, serializationMap),
-            PropertyImpl::Serialize(*luaScript.getOutputs()->m_impl, builder, serializationMap)
+            PropertyImpl::Serialize(*luaScript.getOutputs()->m_impl, builder, serializationMap),
+            luaScript.m_executionGroup,
+            sourceScriptId.value_or(0u),
+            byteCode,
+            luaScript.getMemoryLimit()
         );
         builder.Finish(script);
 
@@ -80,6 +192,7 @@ namespace rlogic::internal
     std::unique_ptr<LuaScriptImpl> LuaScriptImpl::Deserialize(
         SolState& solState,
         const rlogic_serialization::LuaScript& luaScript,
+        bool loadByteCode,
         ErrorReporting& errorReporting,
         DeserializationMap& deserializationMap)
     {
@@ -98,12 +211,22 @@ namespace rlogic::internal
 
         const std::string_view name = luaScript.name()->string_view();
 
-        if (!luaScript.luaSourceCode())
+        // Instances reference the script which holds their source code instead
+        const LuaScriptImpl* sourceScript = nullptr;
+        if (luaScript.sourceScriptId() != 0u)
+        {
+            sourceScript = deserializationMap.resolveLuaScript(luaScript.sourceScriptId());
+            if (sourceScript == nullptr || &sourceScript->m_solState != &solState)
+            {
+                errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data: invalid source script id {}!", name, luaScript.sourceScriptId()), nullptr);
+                return nullptr;
+            }
+        }
+        else if (!luaScript.luaSourceCode())
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: missing Lua source code!", nullptr);
             return nullptr;
         }
-        std::string sourceCode = luaScript.luaSourceCode()->str();
 
         if (!luaScript.rootInput())
         {
@@ -141,8 +264,29 @@ namespace rlogic::internal
             return nullptr;
         }
 
+        if (sourceScript != nullptr)
+        {
+            std::unique_ptr<LuaScriptImpl> instance = CreateInstance(*sourceScript, std::move(rootInput), std::move(rootOutput), name, luaScript.id(), errorReporting);
+            if (instance)
+            {
+                deserializationMap.storeLuaScript(luaScript.id(), *instance);
+            }
+            return instance;
+        }
+
+        std::string sourceCode = luaScript.luaSourceCode()->str();
+
+        std::string_view byteCode;
+        if (loadByteCode && luaScript.luaByteCode())
+        {
+            byteCode = std::string_view(reinterpret_cast<const char*>(luaScript.luaByteCode()->data()), luaScript.luaByteCode()->size());
+        }
+
+        LuaMemoryAccount memoryAccount = solState.createMemoryAccount(static_cast<size_t>(luaScript.memoryLimit()));
+        LuaMemoryScope memoryScope(memoryAccount);
+
         // TODO Violin we use 'name' here, and not 'chunkname' as in Create(). This is inconsistent! Investigate closer
-        sol::load_result load_result = solState.loadScript(sourceCode, name);
+        sol::load_result load_result = solState.loadByteCodeOrScript(sourceCode, byteCode, name);
         if (!load_result.valid())
         {
             sol::error error = load_result;
@@ -179,7 +323,12 @@ namespace rlogic::internal
             stdModules.push_back(static_cast<EStandardModule>(stdModule));
 
         sol::protected_function mainFunction = load_result;
-        sol::environment env = solState.createEnvironment(stdModules, userModules);
+        std::optional<sol::environment> maybeEnv = solState.createEnvironment(stdModules, userModules, errorReporting);
+        if (!maybeEnv)
+        {
+            return nullptr;
+        }
+        sol::environment& env = *maybeEnv;
 
         env.set_on(mainFunction);
 
@@ -206,7 +355,7 @@ namespace rlogic::internal
             }
         }
 
-        return std::make_unique<LuaScriptImpl>(
+        auto deserializedScript = std::make_unique<LuaScriptImpl>(
             LuaCompiledScript{
                 LuaSource{
                     std::move(sourceCode),
@@ -218,14 +367,28 @@ namespace rlogic::internal
                 std::make_unique<Property>(std::move(rootInput)),
                 std::make_unique<Property>(std::move(rootOutput))
             },
-            name, luaScript.id());
+            name, luaScript.id(), luaScript.executionGroup(), std::move(memoryAccount));
+        deserializationMap.storeLuaScript(luaScript.id(), *deserializedScript);
+        return deserializedScript;
     }
 
     std::optional<LogicNodeRuntimeError> LuaScriptImpl::update()
     {
-        sol::environment        env  = sol::get_environment(m_solFunction);
-        sol::protected_function runFunction = env["run"];
-        sol::protected_function_result result = runFunction();
+        // Garbage counts towards the limit until it's collected, which Lua does based on the memory of the whole state.
+        // After the script exceeded its limit, a full collection gives the next update the best chance to succeed. Collected
+        // outside of the memory scope of the script, the collector may allocate itself
+        if (m_memoryAccount.hasExceededMemoryLimit())
+            m_solState.collectGarbage();
+
+        LuaMemoryScope memoryScope(m_memoryAccount);
+        m_memoryAccount.resetExceededMemoryLimit();
+        if (isRunFunctionReplaced())
+            m_runFunction = m_environment.get<sol::protected_function>("run");
+        sol::protected_function_result result = m_runFunction();
+
+        // Also reported if the script caught the memory error
+        if (m_memoryAccount.hasExceededMemoryLimit())
+            return LogicNodeRuntimeError{ fmt::format("Script exceeded its memory limit of {} bytes", m_memoryAccount.getMemoryLimit()) };
 
         if (!result.valid())
         {
@@ -236,8 +399,46 @@ namespace rlogic::internal
         return std::nullopt;
     }
 
+    bool LuaScriptImpl::isRunFunctionReplaced() const
+    {
+        // Compares on the Lua stack, so that unchanged functions don't need a new reference every update
+        lua_State* L = m_environment.lua_state();
+        m_environment.push();
+        lua_getfield(L, -1, "run");
+        m_runFunction.push();
+        const bool isReplaced = (lua_rawequal(L, -1, -2) == 0);
+        lua_pop(L, 3);
+        return isReplaced;
+    }
+
+    bool LuaScriptImpl::supportsConcurrentUpdate() const
+    {
+        return true;
+    }
+
+    const void* LuaScriptImpl::getConcurrentUpdateKey() const
+    {
+        // Scripts of the same execution group share a Lua state which must not be used from two threads at once
+        return &m_solState;
+    }
+
     const ModuleMapping& LuaScriptImpl::getModules() const
     {
         return m_modules;
     }
+
+    uint32_t LuaScriptImpl::getExecutionGroup() const
+    {
+        return m_executionGroup;
+    }
+
+    const LuaMemoryStatistics& LuaScriptImpl::getLuaMemoryStatistics() const
+    {
+        return m_memoryAccount.getStatistics();
+    }
+
+    size_t LuaScriptImpl::getMemoryLimit() const
+    {
+        return m_memoryAccount.getMemoryLimit();
+    }
 }
@@ -15,6 +15,7 @@
 #include "internals/SerializationMap.h"
 #include "internals/DeserializationMap.h"
 #include "internals/WrappedLuaProperty.h"
+#include "internals/LuaAllocator.h"
 
 #include "ramses-logic/Property.h"
 #include "ramses-logic/LuaScript.h"
@@ -48,7 +49,15 @@ namespace rlogic::internal
     class LuaScriptImpl : public LogicNodeImpl
     {
     public:
-        explicit LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id);
+        // The memory account must be the one which was active while the script was compiled
+        LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id, uint32_t executionGroup, LuaMemoryAccount memoryAccount);
+        // Copy of the prototype which shares its source, but has its own copy of the compiled main chunk, Lua environment (GLOBAL table)
+        // and properties with default values. Neither the source is compiled, nor is interface() executed again
+        [[nodiscard]] static std::unique_ptr<LuaScriptImpl> CreateInstance(
+            const LuaScriptImpl& prototype,
+            std::string_view name,
+            uint64_t id,
+            ErrorReporting& errorReporting);
         ~LuaScriptImpl() noexcept override = default;
         LuaScriptImpl(const LuaScriptImpl & other) = delete;
         LuaScriptImpl& operator=(const LuaScriptImpl & other) = delete;
@@ -56,24 +65,61 @@ namespace rlogic::internal
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaScript> Serialize(
             const LuaScriptImpl& luaScript,
             flatbuffers::FlatBufferBuilder& builder,
-            SerializationMap& serializationMap);
+            SerializationMap& serializationMap,
+            bool saveByteCode);
 
         [[nodiscard]] static std::unique_ptr<LuaScriptImpl> Deserialize(
             SolState& solState,
             const rlogic_serialization::LuaScript& luaScript,
+            bool loadByteCode,
             ErrorReporting& errorReporting,
             DeserializationMap& deserializationMap);
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool supportsConcurrentUpdate() const override;
+        [[nodiscard]] const void* getConcurrentUpdateKey() const override;
 
         [[nodiscard]] const ModuleMapping& getModules() const;
+        [[nodiscard]] uint32_t getExecutionGroup() const;
+        [[nodiscard]] const LuaMemoryStatistics& getLuaMemoryStatistics() const;
+        [[nodiscard]] size_t getMemoryLimit() const;
 
     private:
-        std::string             m_source;
+        LuaScriptImpl(
+            const LuaScriptImpl& prototype,
+            LuaMemoryAccount memoryAccount,
+            sol::protected_function mainFunction,
+            std::unique_ptr<PropertyImpl> rootInput,
+            std::unique_ptr<PropertyImpl> rootOutput,
+            std::string_view name,
+            uint64_t id);
+
+        [[nodiscard]] static std::unique_ptr<LuaScriptImpl> CreateInstance(
+            const LuaScriptImpl& prototype,
+            std::unique_ptr<PropertyImpl> rootInput,
+            std::unique_ptr<PropertyImpl> rootOutput,
+            std::string_view name,
+            uint64_t id,
+            ErrorReporting& errorReporting);
+
+        [[nodiscard]] bool isRunFunctionReplaced() const;
+
+        // Declared first, so that the Lua objects below are released while the account still exists
+        LuaMemoryAccount        m_memoryAccount;
+        // Shared by the instances of the script
+        std::shared_ptr<const std::string> m_source;
         WrappedLuaProperty      m_wrappedRootInput;
         WrappedLuaProperty      m_wrappedRootOutput;
+        // The main chunk of the script, instances use a copy of the prototype's main chunk. Executing it with an
+        // environment defines the script functions in that environment
         sol::protected_function m_solFunction;
+        // The environment of this instance, which holds the run() function and GLOBAL table
+        sol::environment        m_environment;
+        // Cached from m_environment, resolved again only if the script assigned a new function to 'run'
+        sol::protected_function m_runFunction;
         ModuleMapping           m_modules;
         StandardModules         m_stdModules;
+        SolState&               m_solState;
+        uint32_t                m_executionGroup;
     };
 }
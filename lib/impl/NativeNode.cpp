@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/NativeNode.h"
+#include "impl/NativeNodeImpl.h"
+
+namespace rlogic
+{
+    NativeNode::NativeNode(std::unique_ptr<internal::NativeNodeImpl> impl) noexcept
+        : LogicNode(std::move(impl))
+        /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast) */
+        , m_nativeNodeImpl{ static_cast<internal::NativeNodeImpl&>(LogicNode::m_impl) }
+    {
+    }
+
+    NativeNode::~NativeNode() noexcept = default;
+
+    std::string_view NativeNode::getTypeName() const
+    {
+        return m_nativeNodeImpl.getTypeName();
+    }
+
+    NativeNodeUpdateContext::NativeNodeUpdateContext(internal::NativeNodeImpl& impl) noexcept
+        : m_impl(impl)
+    {
+    }
+
+    const Property& NativeNodeUpdateContext::getInputs() const
+    {
+        return *m_impl.getInputs();
+    }
+
+    const Property& NativeNodeUpdateContext::getOutputs() const
+    {
+        return *m_impl.getOutputs();
+    }
+
+    void NativeNodeUpdateContext::reportError(std::string_view message)
+    {
+        m_impl.reportUpdateError(message);
+    }
+
+    template <typename T>
+    bool NativeNodeUpdateContext::setOutputInternal(size_t index, T value)
+    {
+        return m_impl.setOutputValue<T>(index, std::move(value));
+    }
+
+    template <typename T>
+    bool NativeNodeUpdateContext::setOutputArrayInternal(size_t index, const T* values, size_t count)
+    {
+        return m_impl.setOutputArray<T>(index, values, count);
+    }
+
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<float>(size_t, float);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<vec2f>(size_t, vec2f);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<vec3f>(size_t, vec3f);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<vec4f>(size_t, vec4f);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<int32_t>(size_t, int32_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<int64_t>(size_t, int64_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<vec2i>(size_t, vec2i);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<vec3i>(size_t, vec3i);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<vec4i>(size_t, vec4i);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<std::string>(size_t, std::string);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputInternal<bool>(size_t, bool);
+
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<float>(size_t, const float*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<vec2f>(size_t, const vec2f*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<vec3f>(size_t, const vec3f*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<vec4f>(size_t, const vec4f*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<int32_t>(size_t, const int32_t*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<int64_t>(size_t, const int64_t*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<vec2i>(size_t, const vec2i*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<vec3i>(size_t, const vec3i*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<vec4i>(size_t, const vec4i*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<std::string>(size_t, const std::string*, size_t);
+    template RLOGIC_API bool NativeNodeUpdateContext::setOutputArrayInternal<bool>(size_t, const bool*, size_t);
+}
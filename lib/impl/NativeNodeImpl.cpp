@@ -0,0 +1,215 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/NativeNodeImpl.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/Property.h"
+#include "impl/PropertyImpl.h"
+#include "impl/LoggerImpl.h"
+#include "internals/ErrorReporting.h"
+#include "internals/TypeUtils.h"
+#include "generated/NativeNodeGen.h"
+#include "flatbuffers/flatbuffers.h"
+#include "fmt/format.h"
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // Checks that deserialized properties have the interface which is declared by the registered type
+        bool MatchesType(const Property& property, const HierarchicalTypeData& type)
+        {
+            if (property.getType() != type.typeData.type || property.getChildCount() != type.children.size())
+                return false;
+
+            for (size_t i = 0; i < type.children.size(); ++i)
+            {
+                const Property& child = *property.getChild(i);
+                if (child.getName() != type.children[i].typeData.name || !MatchesType(child, type.children[i]))
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    NativeNodeImpl::NativeNodeImpl(std::shared_ptr<const NativeNodeType> type, std::string_view name, uint64_t id) noexcept
+        : LogicNodeImpl(name, id)
+        , m_type(std::move(type))
+    {
+        auto inputsImpl = std::make_unique<PropertyImpl>(m_type->inputs, EPropertySemantics::ScriptInput);
+        auto outputsImpl = std::make_unique<PropertyImpl>(m_type->outputs, EPropertySemantics::ScriptOutput);
+
+        setRootProperties(std::make_unique<Property>(std::move(inputsImpl)), std::make_unique<Property>(std::move(outputsImpl)));
+    }
+
+    std::optional<LogicNodeRuntimeError> NativeNodeImpl::update()
+    {
+        m_updateError.reset();
+
+        NativeNodeUpdateContext context(*this);
+        m_type->updateFunction(context);
+
+        if (m_updateError)
+            return LogicNodeRuntimeError{ fmt::format("NativeNode '{}' (type '{}') failed to update: {}", getName(), m_type->name, *m_updateError) };
+
+        return std::nullopt;
+    }
+
+    std::string_view NativeNodeImpl::getTypeName() const
+    {
+        return m_type->name;
+    }
+
+    PropertyImpl* NativeNodeImpl::getOutputForWriting(size_t index, EPropertyType type)
+    {
+        Property* outputs = getOutputs();
+        if (index >= outputs->getChildCount())
+        {
+            LOG_ERROR("NativeNode '{}' has no output with index {} (it has {} outputs)", getName(), index, outputs->getChildCount());
+            return nullptr;
+        }
+
+        PropertyImpl& output = *outputs->getChild(index)->m_impl;
+        if (output.getType() != type)
+        {
+            LOG_ERROR("Invalid type when setting output '{}' of NativeNode '{}', correct type is '{}'", output.getName(), getName(), GetLuaPrimitiveTypeName(output.getType()));
+            return nullptr;
+        }
+
+        return &output;
+    }
+
+    template <typename T>
+    bool NativeNodeImpl::setOutputValue(size_t index, T value)
+    {
+        PropertyImpl* output = getOutputForWriting(index, PropertyTypeToEnum<T>::TYPE);
+        if (output == nullptr)
+            return false;
+
+        output->setValueAs<T>(std::move(value));
+        return true;
+    }
+
+    template <typename T>
+    bool NativeNodeImpl::setOutputArray(size_t index, const T* values, size_t count)
+    {
+        PropertyImpl* output = getOutputForWriting(index, EPropertyType::Array);
+        if (output == nullptr)
+            return false;
+
+        if (output->getChildCount() != count)
+        {
+            LOG_ERROR("Element count mismatch when setting array output '{}' of NativeNode '{}', expected {} values but got {}", output->getName(), getName(), output->getChildCount(), count);
+            return false;
+        }
+
+        // Arrays have at least one element, all elements have the same type
+        if (output->getChild(0u)->getType() != PropertyTypeToEnum<T>::TYPE)
+        {
+            LOG_ERROR("Invalid type when setting array output '{}' of NativeNode '{}', correct element type is '{}'", output->getName(), getName(), GetLuaPrimitiveTypeName(output->getChild(0u)->getType()));
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) values are passed as pointer and size
+            output->getChild(i)->m_impl->setValueAs<T>(values[i]);
+        }
+        return true;
+    }
+
+    void NativeNodeImpl::reportUpdateError(std::string_view message)
+    {
+        // Keeps the first error, later errors are often a consequence of it
+        if (!m_updateError)
+            m_updateError = std::string(message);
+    }
+
+    flatbuffers::Offset<rlogic_serialization::NativeNode> NativeNodeImpl::Serialize(
+        const NativeNodeImpl& nativeNode,
+        flatbuffers::FlatBufferBuilder& builder,
+        SerializationMap& serializationMap)
+    {
+        return rlogic_serialization::CreateNativeNode(
+            builder,
+            builder.CreateString(nativeNode.getName()),
+            nativeNode.getId(),
+            builder.CreateString(nativeNode.getTypeName()),
+            PropertyImpl::Serialize(*nativeNode.getInputs()->m_impl, builder, serializationMap),
+            PropertyImpl::Serialize(*nativeNode.getOutputs()->m_impl, builder, serializationMap)
+        );
+    }
+
+    std::unique_ptr<NativeNodeImpl> NativeNodeImpl::Deserialize(
+        const rlogic_serialization::NativeNode& nativeNodeFB,
+        const NativeNodeTypeRegistry& nativeNodeTypes,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        if (!nativeNodeFB.name() || nativeNodeFB.id() == 0u || !nativeNodeFB.typeName() || !nativeNodeFB.rootInput() || !nativeNodeFB.rootOutput())
+        {
+            errorReporting.add("Fatal error during loading of NativeNode from serialized data: missing name, id, type name or in/out property data!", nullptr);
+            return nullptr;
+        }
+
+        const auto name = nativeNodeFB.name()->string_view();
+        const auto typeName = nativeNodeFB.typeName()->string_view();
+
+        const auto typeIter = nativeNodeTypes.find(std::string(typeName));
+        if (typeIter == nativeNodeTypes.cend())
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of NativeNode '{}': type '{}' is not registered! Register all native node types before loading.", name, typeName), nullptr);
+            return nullptr;
+        }
+        const std::shared_ptr<const NativeNodeType>& type = typeIter->second;
+
+        auto deserialized = std::make_unique<NativeNodeImpl>(type, name, nativeNodeFB.id());
+
+        // deserialize and overwrite constructor generated properties, they must match the interface of the registered type
+        auto rootInProperty = PropertyImpl::Deserialize(*nativeNodeFB.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
+        auto rootOutProperty = PropertyImpl::Deserialize(*nativeNodeFB.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
+        if (!rootInProperty || !rootOutProperty)
+            return nullptr;
+
+        auto rootInput = std::make_unique<Property>(std::move(rootInProperty));
+        auto rootOutput = std::make_unique<Property>(std::move(rootOutProperty));
+        if (!MatchesType(*rootInput, type->inputs) || !MatchesType(*rootOutput, type->outputs))
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of NativeNode '{}': properties don't match the interface of the registered type '{}'!", name, typeName), nullptr);
+            return nullptr;
+        }
+        deserialized->setRootProperties(std::move(rootInput), std::move(rootOutput));
+
+        return deserialized;
+    }
+
+    template bool NativeNodeImpl::setOutputValue<float>(size_t, float);
+    template bool NativeNodeImpl::setOutputValue<vec2f>(size_t, vec2f);
+    template bool NativeNodeImpl::setOutputValue<vec3f>(size_t, vec3f);
+    template bool NativeNodeImpl::setOutputValue<vec4f>(size_t, vec4f);
+    template bool NativeNodeImpl::setOutputValue<int32_t>(size_t, int32_t);
+    template bool NativeNodeImpl::setOutputValue<int64_t>(size_t, int64_t);
+    template bool NativeNodeImpl::setOutputValue<vec2i>(size_t, vec2i);
+    template bool NativeNodeImpl::setOutputValue<vec3i>(size_t, vec3i);
+    template bool NativeNodeImpl::setOutputValue<vec4i>(size_t, vec4i);
+    template bool NativeNodeImpl::setOutputValue<std::string>(size_t, std::string);
+    template bool NativeNodeImpl::setOutputValue<bool>(size_t, bool);
+
+    template bool NativeNodeImpl::setOutputArray<float>(size_t, const float*, size_t);
+    template bool NativeNodeImpl::setOutputArray<vec2f>(size_t, const vec2f*, size_t);
+    template bool NativeNodeImpl::setOutputArray<vec3f>(size_t, const vec3f*, size_t);
+    template bool NativeNodeImpl::setOutputArray<vec4f>(size_t, const vec4f*, size_t);
+    template bool NativeNodeImpl::setOutputArray<int32_t>(size_t, const int32_t*, size_t);
+    template bool NativeNodeImpl::setOutputArray<int64_t>(size_t, const int64_t*, size_t);
+    template bool NativeNodeImpl::setOutputArray<vec2i>(size_t, const vec2i*, size_t);
+    template bool NativeNodeImpl::setOutputArray<vec3i>(size_t, const vec3i*, size_t);
+    template bool NativeNodeImpl::setOutputArray<vec4i>(size_t, const vec4i*, size_t);
+    template bool NativeNodeImpl::setOutputArray<std::string>(size_t, const std::string*, size_t);
+    template bool NativeNodeImpl::setOutputArray<bool>(size_t, const bool*, size_t);
+}
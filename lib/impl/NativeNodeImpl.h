@@ -0,0 +1,67 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/NativeNodeType.h"
+#include <string>
+#include <optional>
+#include <memory>
+
+namespace rlogic_serialization
+{
+    struct NativeNode;
+}
+
+namespace flatbuffers
+{
+    template<typename T> struct Offset;
+    class FlatBufferBuilder;
+}
+
+namespace rlogic::internal
+{
+    class SerializationMap;
+    class DeserializationMap;
+    class ErrorReporting;
+
+    class NativeNodeImpl : public LogicNodeImpl
+    {
+    public:
+        NativeNodeImpl(std::shared_ptr<const NativeNodeType> type, std::string_view name, uint64_t id) noexcept;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+
+        [[nodiscard]] std::string_view getTypeName() const;
+
+        // Used by NativeNodeUpdateContext, logs errors like the public Property API
+        template <typename T>
+        [[nodiscard]] bool setOutputValue(size_t index, T value);
+        template <typename T>
+        [[nodiscard]] bool setOutputArray(size_t index, const T* values, size_t count);
+        void reportUpdateError(std::string_view message);
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::NativeNode> Serialize(
+            const NativeNodeImpl& nativeNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+        [[nodiscard]] static std::unique_ptr<NativeNodeImpl> Deserialize(
+            const rlogic_serialization::NativeNode& nativeNodeFB,
+            const NativeNodeTypeRegistry& nativeNodeTypes,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+    private:
+        [[nodiscard]] PropertyImpl* getOutputForWriting(size_t index, EPropertyType type);
+
+        std::shared_ptr<const NativeNodeType> m_type;
+        // Set by the update function through the update context
+        std::optional<std::string> m_updateError;
+    };
+}
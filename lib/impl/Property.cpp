@@ -69,6 +69,18 @@ namespace rlogic
         return m_impl->setValue_PublicApi(std::move(value));
     }
 
+    template <typename T>
+    bool Property::setArrayInternal(const T* values, size_t count)
+    {
+        return m_impl->setArray_PublicApi(values, count);
+    }
+
+    template <typename T>
+    bool Property::getArrayInternal(T* values, size_t count) const
+    {
+        return m_impl->getArray_PublicApi(values, count);
+    }
+
     // Lua works with int. The logic engine API uses int32_t. To ensure that the runtime has no side effects
     // we assert the two types are equivalent on the platform/compiler
     static_assert(std::is_same<int32_t, int>::value, "int32_t must be the same type as int");
@@ -97,6 +109,30 @@ namespace rlogic
     template RLOGIC_API bool Property::setInternal<std::string>(std::string /*value*/);
     template RLOGIC_API bool Property::setInternal<bool>(bool /*value*/);
 
+    template RLOGIC_API bool Property::setArrayInternal<float>(const float* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<vec2f>(const vec2f* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<vec3f>(const vec3f* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<vec4f>(const vec4f* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<int32_t>(const int32_t* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<int64_t>(const int64_t* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<vec2i>(const vec2i* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<vec3i>(const vec3i* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<vec4i>(const vec4i* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<std::string>(const std::string* /*values*/, size_t /*count*/);
+    template RLOGIC_API bool Property::setArrayInternal<bool>(const bool* /*values*/, size_t /*count*/);
+
+    template RLOGIC_API bool Property::getArrayInternal<float>(float* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<vec2f>(vec2f* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<vec3f>(vec3f* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<vec4f>(vec4f* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<int32_t>(int32_t* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<int64_t>(int64_t* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<vec2i>(vec2i* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<vec3i>(vec3i* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<vec4i>(vec4i* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<std::string>(std::string* /*values*/, size_t /*count*/) const;
+    template RLOGIC_API bool Property::getArrayInternal<bool>(bool* /*values*/, size_t /*count*/) const;
+
 
     bool Property::isLinked() const
     {
@@ -15,76 +15,113 @@
 #include "internals/SerializationHelper.h"
 #include "internals/TypeUtils.h"
 #include "internals/ErrorReporting.h"
+#include "internals/PropertyTypeRegistry.h"
 #include "internals/TypeUtils.h"
 
 #include "generated/PropertyGen.h"
 
 #include <cassert>
 #include <algorithm>
+#include <utility>
+#include <iterator>
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        bool IsInt64ValueInLuaRange(int64_t value)
+        {
+            // Lua uses (by default) double for internal storage of numerical values.
+            // IEEE 754 64-bit double can represent higher integers than this (DBL_MAX) but this is the maximum
+            // for which double can represent this value and all values below correctly
+            static constexpr auto maxIntegerAsDouble = static_cast<int64_t>(1LLU << 53u);
+            return value <= maxIntegerAsDouble && value >= -maxIntegerAsDouble;
+        }
+    }
+
     PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics)
-        : m_typeData(std::move(type.typeData))
+        : m_typeDescriptor(PropertyTypeDescriptor::Create(type))
+        , m_ownedValueStore(std::make_unique<PropertyValueStore>())
+        , m_valueStore(m_ownedValueStore.get())
         , m_semantics(semantics)
     {
-        if (TypeUtils::IsPrimitiveType(m_typeData.type))
+        initializeValueOrChildren();
+    }
+
+    PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics, PropertyValue initialValue)
+        : PropertyImpl(std::move(type), semantics)
+    {
+        assert(TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()) && "Don't use this constructor with non-primitive types!");
+        assert(GetPropertyValueType(initialValue) == m_typeDescriptor->getType());
+        m_valueStore->setValue(m_valueIndex, std::move(initialValue));
+    }
+
+    PropertyImpl::PropertyImpl(SharedPropertyTypeDescriptor type, EPropertySemantics semantics)
+        : m_typeDescriptor(std::move(type))
+        , m_ownedValueStore(std::make_unique<PropertyValueStore>())
+        , m_valueStore(m_ownedValueStore.get())
+        , m_semantics(semantics)
+    {
+        initializeValueOrChildren();
+    }
+
+    PropertyImpl::PropertyImpl(SharedPropertyTypeDescriptor type, EPropertySemantics semantics, PropertyValueStore& valueStore)
+        : m_typeDescriptor(std::move(type))
+        , m_valueStore(&valueStore)
+        , m_semantics(semantics)
+    {
+        initializeValueOrChildren();
+    }
+
+    void PropertyImpl::initializeValueOrChildren()
+    {
+        if (TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()))
         {
-            switch (m_typeData.type)
-            {
-            case EPropertyType::Float:
-                m_value = PropertyEnumToType<EPropertyType::Float>::TYPE{ 0.0f };
-                break;
-            case EPropertyType::Vec2f:
-                m_value = PropertyEnumToType<EPropertyType::Vec2f>::TYPE{ 0.0f, 0.0f };
-                break;
-            case EPropertyType::Vec3f:
-                m_value = PropertyEnumToType<EPropertyType::Vec3f>::TYPE{ 0.0f, 0.0f, 0.0f };
-                break;
-            case EPropertyType::Vec4f:
-                m_value = PropertyEnumToType<EPropertyType::Vec4f>::TYPE{ 0.0f, 0.0f, 0.0f, 0.0f };
-                break;
-            case EPropertyType::Int32:
-                m_value = PropertyEnumToType<EPropertyType::Int32>::TYPE{ 0 };
-                break;
-            case EPropertyType::Int64:
-                m_value = PropertyEnumToType<EPropertyType::Int64>::TYPE{ 0 };
-                break;
-            case EPropertyType::Vec2i:
-                m_value = PropertyEnumToType<EPropertyType::Vec2i>::TYPE{ 0, 0 };
-                break;
-            case EPropertyType::Vec3i:
-                m_value = PropertyEnumToType<EPropertyType::Vec3i>::TYPE{ 0, 0, 0 };
-                break;
-            case EPropertyType::Vec4i:
-                m_value = PropertyEnumToType<EPropertyType::Vec4i>::TYPE{ 0, 0, 0, 0 };
-                break;
-            case EPropertyType::String:
-                m_value = PropertyEnumToType<EPropertyType::String>::TYPE{};
-                break;
-            case EPropertyType::Bool:
-                m_value = PropertyEnumToType<EPropertyType::Bool>::TYPE{ false };
-                break;
-            case EPropertyType::Array:
-            case EPropertyType::Struct:
-                assert(false);
-                break;
-            }
+            m_valueIndex = m_valueStore->add(m_typeDescriptor->getType());
         }
         else
         {
-            for (const auto& childType : type.children)
+            const size_t childCount = m_typeDescriptor->getChildCount();
+            m_children.reserve(childCount);
+            for (size_t i = 0; i < childCount; ++i)
             {
-                m_children.emplace_back(std::make_unique<Property>(std::make_unique<PropertyImpl>(childType, semantics)));
+                m_children.emplace_back(std::make_unique<Property>(std::unique_ptr<PropertyImpl>(new PropertyImpl(m_typeDescriptor->getChild(i), m_semantics, *m_valueStore))));
             }
         }
     }
 
-    PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics, PropertyValue initialValue)
-        : PropertyImpl(std::move(type), semantics)
+    PropertyImpl::PropertyImpl(PropertyImpl&& other) noexcept
+        : m_typeDescriptor(std::move(other.m_typeDescriptor))
+        , m_ownedValueStore(std::move(other.m_ownedValueStore))
+        , m_children(std::move(other.m_children))
+        , m_valueStore(std::exchange(other.m_valueStore, nullptr))
+        , m_valueIndex(other.m_valueIndex)
+        , m_incomingLinkedProperty(other.m_incomingLinkedProperty)
+        , m_outgoingLinkedProperties(std::move(other.m_outgoingLinkedProperties))
+        , m_logicNode(other.m_logicNode)
+        , m_bindingInputHasNewValue(other.m_bindingInputHasNewValue)
+        , m_semantics(other.m_semantics)
     {
-        assert(TypeUtils::IsPrimitiveType(m_typeData.type) && "Don't use this constructor with non-primitive types!");
-        m_value = std::move(initialValue);
+    }
+
+    PropertyImpl& PropertyImpl::operator=(PropertyImpl&& other) noexcept
+    {
+        if (this != &other)
+        {
+            releaseValue();
+            // The previous children release their values before the store they may use is replaced
+            m_children = std::move(other.m_children);
+            m_typeDescriptor = std::move(other.m_typeDescriptor);
+            m_ownedValueStore = std::move(other.m_ownedValueStore);
+            m_valueStore = std::exchange(other.m_valueStore, nullptr);
+            m_valueIndex = other.m_valueIndex;
+            m_incomingLinkedProperty = other.m_incomingLinkedProperty;
+            m_outgoingLinkedProperties = std::move(other.m_outgoingLinkedProperties);
+            m_logicNode = other.m_logicNode;
+            m_bindingInputHasNewValue = other.m_bindingInputHasNewValue;
+            m_semantics = other.m_semantics;
+        }
+        return *this;
     }
 
     PropertyImpl::~PropertyImpl() noexcept
@@ -100,6 +137,76 @@ namespace rlogic::internal
             assert(outgoingLink->m_incomingLinkedProperty == this);
             outgoingLink->m_incomingLinkedProperty = nullptr;
         }
+
+        releaseValue();
+    }
+
+    void PropertyImpl::releaseValue()
+    {
+        // Moved-from properties have no store
+        if (m_valueStore != nullptr && TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()))
+        {
+            m_valueStore->release(m_typeDescriptor->getType(), m_valueIndex);
+        }
+        m_valueStore = nullptr;
+    }
+
+    void PropertyImpl::moveValuesToStore(PropertyValueStore& valueStore)
+    {
+        if (m_valueStore == &valueStore)
+        {
+            return;
+        }
+
+        if (TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()))
+        {
+            m_valueIndex = valueStore.moveFrom(*m_valueStore, m_typeDescriptor->getType(), m_valueIndex);
+        }
+        m_valueStore = &valueStore;
+
+        for (auto& child : m_children)
+        {
+            child->m_impl->moveValuesToStore(valueStore);
+        }
+
+        // All values of the tree are moved, the store of the tree is not needed anymore
+        m_ownedValueStore.reset();
+    }
+
+    void PropertyImpl::shareTypeDescriptor(PropertyTypeRegistry& typeRegistry)
+    {
+        SharedPropertyTypeDescriptor sharedType = typeRegistry.getOrRegister(m_typeDescriptor);
+        if (sharedType != m_typeDescriptor)
+        {
+            setTypeDescriptor(std::move(sharedType));
+        }
+    }
+
+    void PropertyImpl::setTypeDescriptor(SharedPropertyTypeDescriptor type)
+    {
+        assert(*type == *m_typeDescriptor);
+        m_typeDescriptor = std::move(type);
+        for (size_t i = 0; i < m_children.size(); ++i)
+        {
+            m_children[i]->m_impl->setTypeDescriptor(m_typeDescriptor->getChild(i));
+        }
+    }
+
+    const SharedPropertyTypeDescriptor& PropertyImpl::getTypeDescriptor() const
+    {
+        return m_typeDescriptor;
+    }
+
+    size_t PropertyImpl::getAllocatedMemory() const
+    {
+        size_t memory = sizeof(Property) + sizeof(PropertyImpl) +
+            m_children.capacity() * sizeof(PropertyList::value_type) +
+            m_outgoingLinkedProperties.capacity() * sizeof(PropertyImpl*);
+        for (const auto& child : m_children)
+        {
+            memory += child->m_impl->getAllocatedMemory();
+        }
+        return memory;
     }
 
     flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::Serialize(const PropertyImpl& prop, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
@@ -121,12 +228,12 @@ namespace rlogic::internal
             return SerializeRecursive(*child->m_impl, builder, serializationMap);
             });
 
-        // Assume primitive property, override only for structs/arrays based on m_typeData.type
+        // Assume primitive property, override only for structs/arrays based on m_typeDescriptor->getType()
         rlogic_serialization::EPropertyRootType propertyRootType = rlogic_serialization::EPropertyRootType::Primitive;
         rlogic_serialization::PropertyValue valueType = rlogic_serialization::PropertyValue::NONE;
         flatbuffers::Offset<void> valueOffset;
 
-        switch (prop.m_typeData.type)
+        switch (prop.m_typeDescriptor->getType())
         {
         case EPropertyType::Bool:
         {
@@ -219,7 +326,7 @@ namespace rlogic::internal
         }
 
         auto propertyFB = rlogic_serialization::CreateProperty(builder,
-            builder.CreateString(prop.m_typeData.name),
+            builder.CreateString(prop.m_typeDescriptor->getName()),
             propertyRootType,
             builder.CreateVector(child_vector),
             valueType,
@@ -236,6 +343,22 @@ namespace rlogic::internal
         EPropertySemantics semantics,
         ErrorReporting& errorReporting,
         DeserializationMap& deserializationMap)
+    {
+        auto valueStore = std::make_unique<PropertyValueStore>();
+        std::unique_ptr<PropertyImpl> impl = DeserializeRecursive(prop, semantics, errorReporting, deserializationMap, *valueStore);
+        if (impl)
+        {
+            impl->m_ownedValueStore = std::move(valueStore);
+        }
+        return impl;
+    }
+
+    std::unique_ptr<PropertyImpl> PropertyImpl::DeserializeRecursive(
+        const rlogic_serialization::Property& prop,
+        EPropertySemantics semantics,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap,
+        PropertyValueStore& valueStore)
     {
         // TODO Violin we can make name optional - e.g. array fields don't need a name, no need to serialize empty strings
         if (!prop.name())
@@ -252,7 +375,7 @@ namespace rlogic::internal
             return nullptr;
         }
 
-        std::unique_ptr<PropertyImpl> impl(new PropertyImpl(MakeType(std::string(prop.name()->string_view()), *convertedType), semantics));
+        std::unique_ptr<PropertyImpl> impl(new PropertyImpl(PropertyTypeDescriptor::Create(MakeType(std::string(prop.name()->string_view()), *convertedType)), semantics, valueStore));
 
         // If primitive: set value; otherwise load children
         if (prop.rootType() == rlogic_serialization::EPropertyRootType::Primitive)
@@ -267,7 +390,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value = prop.value_as_float_s()->v();
+                impl->m_valueStore->setValue(impl->m_valueIndex, prop.value_as_float_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::vec2f_s:
             {
@@ -277,7 +400,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value         = vec2f{vec2fValue->x(), vec2fValue->y()};
+                impl->m_valueStore->setValue(impl->m_valueIndex, vec2f{vec2fValue->x(), vec2fValue->y()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec3f_s:
@@ -288,7 +411,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value         = vec3f{vec3fValue->x(), vec3fValue->y(), vec3fValue->z()};
+                impl->m_valueStore->setValue(impl->m_valueIndex, vec3f{vec3fValue->x(), vec3fValue->y(), vec3fValue->z()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec4f_s:
@@ -299,7 +422,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value         = vec4f{vec4fValue->x(), vec4fValue->y(), vec4fValue->z(), vec4fValue->w()};
+                impl->m_valueStore->setValue(impl->m_valueIndex, vec4f{vec4fValue->x(), vec4fValue->y(), vec4fValue->z(), vec4fValue->w()});
                 break;
             }
             case rlogic_serialization::PropertyValue::int32_s:
@@ -308,7 +431,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value = prop.value_as_int32_s()->v();
+                impl->m_valueStore->setValue(impl->m_valueIndex, prop.value_as_int32_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::int64_s:
                 if (!prop.value_as_int64_s())
@@ -316,7 +439,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value = prop.value_as_int64_s()->v();
+                impl->m_valueStore->setValue(impl->m_valueIndex, prop.value_as_int64_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::vec2i_s:
             {
@@ -326,7 +449,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value         = vec2i{vec2iValue->x(), vec2iValue->y()};
+                impl->m_valueStore->setValue(impl->m_valueIndex, vec2i{vec2iValue->x(), vec2iValue->y()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec3i_s:
@@ -337,7 +460,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value         = vec3i{vec3iValue->x(), vec3iValue->y(), vec3iValue->z()};
+                impl->m_valueStore->setValue(impl->m_valueIndex, vec3i{vec3iValue->x(), vec3iValue->y(), vec3iValue->z()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec4i_s:
@@ -348,7 +471,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value         = vec4i{vec4iValue->x(), vec4iValue->y(), vec4iValue->z(), vec4iValue->w()};
+                impl->m_valueStore->setValue(impl->m_valueIndex, vec4i{vec4iValue->x(), vec4iValue->y(), vec4iValue->z(), vec4iValue->w()});
                 break;
             }
             case rlogic_serialization::PropertyValue::string_s:
@@ -357,7 +480,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value = prop.value_as_string_s()->v()->str();
+                impl->m_valueStore->setValue(impl->m_valueIndex, prop.value_as_string_s()->v()->str());
                 break;
             case rlogic_serialization::PropertyValue::bool_s:
                 if (!prop.value_as_bool_s())
@@ -365,7 +488,7 @@ namespace rlogic::internal
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr);
                     return nullptr;
                 }
-                impl->m_value = prop.value_as_bool_s()->v();
+                impl->m_valueStore->setValue(impl->m_valueIndex, prop.value_as_bool_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::NONE:
             default:
@@ -393,7 +516,7 @@ namespace rlogic::internal
                     return nullptr;
                 }
 
-                std::unique_ptr<PropertyImpl> deserializedChild = PropertyImpl::Deserialize(*child, semantics, errorReporting, deserializationMap);
+                std::unique_ptr<PropertyImpl> deserializedChild = PropertyImpl::DeserializeRecursive(*child, semantics, errorReporting, deserializationMap, valueStore);
 
                 if (!deserializedChild)
                 {
@@ -402,6 +525,21 @@ namespace rlogic::internal
 
                 impl->m_children.emplace_back(std::make_unique<Property>(std::move(deserializedChild)));
             }
+
+            // The layout of the children is known only after loading them. Equal consecutive children (e.g. array elements)
+            // share their descriptor, same as in PropertyTypeDescriptor::Create()
+            std::vector<SharedPropertyTypeDescriptor> childTypes;
+            childTypes.reserve(impl->m_children.size());
+            for (const auto& child : impl->m_children)
+            {
+                PropertyImpl& childImpl = *child->m_impl;
+                if (!childTypes.empty() && *childTypes.back() == *childImpl.m_typeDescriptor)
+                {
+                    childImpl.setTypeDescriptor(childTypes.back());
+                }
+                childTypes.push_back(childImpl.m_typeDescriptor);
+            }
+            impl->m_typeDescriptor = std::make_shared<const PropertyTypeDescriptor>(TypeData(impl->m_typeDescriptor->getName(), *convertedType), std::move(childTypes));
         }
 
         deserializationMap.storePropertyImpl(prop, *impl);
@@ -416,12 +554,12 @@ namespace rlogic::internal
 
     EPropertyType PropertyImpl::getType() const
     {
-        return m_typeData.type;
+        return m_typeDescriptor->getType();
     }
 
     std::string_view PropertyImpl::getName() const
     {
-        return m_typeData.name;
+        return m_typeDescriptor->getName();
     }
 
     Property* PropertyImpl::getChild(size_t index)
@@ -431,7 +569,7 @@ namespace rlogic::internal
             return m_children[index].get();
         }
 
-        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_typeData.name);
+        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_typeDescriptor->getName());
         return nullptr;
     }
 
@@ -442,7 +580,7 @@ namespace rlogic::internal
             return m_children[index].get();
         }
 
-        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_typeData.name);
+        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_typeDescriptor->getName());
         return nullptr;
     }
 
@@ -454,33 +592,47 @@ namespace rlogic::internal
 
     const Property* PropertyImpl::getChild(std::string_view name) const
     {
-        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
-            return property->getName() == name;
-        });
-        if (it != m_children.end())
+        const std::optional<size_t> childIndex = findChildIndex(name);
+        if (childIndex)
         {
-            return it->get();
+            return m_children[*childIndex].get();
         }
-        LOG_ERROR("No child property with name '{}' found in '{}'", name, m_typeData.name);
+        LOG_ERROR("No child property with name '{}' found in '{}'", name, m_typeDescriptor->getName());
         return nullptr;
     }
 
     bool PropertyImpl::hasChild(std::string_view name) const
     {
-        return m_children.end() != std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
+        return findChildIndex(name).has_value();
+    }
+
+    std::optional<size_t> PropertyImpl::findChildIndex(std::string_view name) const
+    {
+        if (m_typeDescriptor->getType() == EPropertyType::Struct)
+        {
+            return m_typeDescriptor->findStructChildIndex(name);
+        }
+
+        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
             return property->getName() == name;
-            });
+        });
+        if (it != m_children.end())
+        {
+            return static_cast<size_t>(std::distance(m_children.begin(), it));
+        }
+        return std::nullopt;
     }
 
     template <typename T> std::optional<T> PropertyImpl::getValue_PublicApi() const
     {
-        if (PropertyTypeToEnum<T>::TYPE == m_typeData.type)
+        waitForAsyncUpdate();
+
+        if (PropertyTypeToEnum<T>::TYPE == m_typeDescriptor->getType())
         {
-            assert(std::holds_alternative<T>(m_value));
-            return std::get<T>(m_value);
+            return getValueAs<T>();
         }
         LOG_ERROR("Invalid type '{}' when accessing property '{}', correct type is '{}'",
-            GetLuaPrimitiveTypeName(PropertyTypeToEnum<T>::TYPE), m_typeData.name, GetLuaPrimitiveTypeName(m_typeData.type));
+            GetLuaPrimitiveTypeName(PropertyTypeToEnum<T>::TYPE), m_typeDescriptor->getName(), GetLuaPrimitiveTypeName(m_typeDescriptor->getType()));
         return std::nullopt;
     }
 
@@ -496,49 +648,47 @@ namespace rlogic::internal
     template std::optional<std::string> PropertyImpl::getValue_PublicApi<std::string>() const;
     template std::optional<bool>        PropertyImpl::getValue_PublicApi<bool>() const;
 
-    bool PropertyImpl::setValue_PublicApi(PropertyValue value)
+    template <typename T>
+    bool PropertyImpl::setValue_PublicApi(T value)
     {
+        waitForAsyncUpdate();
+
         if (m_semantics == EPropertySemantics::ScriptOutput)
         {
-            LOG_ERROR(fmt::format("Cannot set property '{}' which is an output.", m_typeData.name));
+            LOG_ERROR(fmt::format("Cannot set property '{}' which is an output.", m_typeDescriptor->getName()));
             return false;
         }
 
         if (m_incomingLinkedProperty != nullptr)
         {
-            LOG_ERROR(fmt::format("Property '{}' is currently linked (to property '{}'). Unlink it first before setting its value!", m_typeData.name, m_incomingLinkedProperty->getName()));
+            LOG_ERROR(fmt::format("Property '{}' is currently linked (to property '{}'). Unlink it first before setting its value!", m_typeDescriptor->getName(), m_incomingLinkedProperty->getName()));
             return false;
         }
 
-        if (!TypeUtils::IsPrimitiveType(m_typeData.type))
+        if (!TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()))
         {
-            LOG_ERROR(fmt::format("Property '{}' is not a primitive type, can't set its value directly!", m_typeData.name));
+            LOG_ERROR(fmt::format("Property '{}' is not a primitive type, can't set its value directly!", m_typeDescriptor->getName()));
             return false;
         }
 
-        if (value.index() != m_value.index())
+        if (PropertyTypeToEnum<T>::TYPE != m_typeDescriptor->getType())
         {
-            LOG_ERROR("Invalid type when setting property '{}', correct type is '{}'", m_typeData.name, GetLuaPrimitiveTypeName(m_typeData.type));
+            LOG_ERROR("Invalid type when setting property '{}', correct type is '{}'", m_typeDescriptor->getName(), GetLuaPrimitiveTypeName(m_typeDescriptor->getType()));
             return false;
         }
 
-        if (std::holds_alternative<int64_t>(value))
+        if constexpr (std::is_same_v<T, int64_t>)
         {
-            // Lua uses (by default) double for internal storage of numerical values.
-            // IEEE 754 64-bit double can represent higher integers than this (DBL_MAX) but this is the maximum
-            // for which double can represent this value and all values below correctly
-            static constexpr auto maxIntegerAsDouble = static_cast<int64_t>(1LLU << 53u);
-            const auto int64Value = std::get<int64_t>(value);
-            if (int64Value > maxIntegerAsDouble || int64Value < -maxIntegerAsDouble)
+            if (!IsInt64ValueInLuaRange(value))
             {
                 LOG_ERROR("Invalid value when setting property '{}', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
-                    m_typeData.name, int64Value);
+                    m_typeDescriptor->getName(), value);
                 return false;
             }
         }
 
         // Marks corresponding node dirty if value changed
-        const bool valueChanged = setValue(std::move(value));
+        const bool valueChanged = setValueAs<T>(std::move(value));
         if (valueChanged || m_semantics == EPropertySemantics::AnimationInput || m_semantics == EPropertySemantics::BindingInput)
         {
             m_logicNode->setDirty(true);
@@ -547,6 +697,150 @@ namespace rlogic::internal
         return true;
     }
 
+    template bool PropertyImpl::setValue_PublicApi<float>(float);
+    template bool PropertyImpl::setValue_PublicApi<vec2f>(vec2f);
+    template bool PropertyImpl::setValue_PublicApi<vec3f>(vec3f);
+    template bool PropertyImpl::setValue_PublicApi<vec4f>(vec4f);
+    template bool PropertyImpl::setValue_PublicApi<int32_t>(int32_t);
+    template bool PropertyImpl::setValue_PublicApi<int64_t>(int64_t);
+    template bool PropertyImpl::setValue_PublicApi<vec2i>(vec2i);
+    template bool PropertyImpl::setValue_PublicApi<vec3i>(vec3i);
+    template bool PropertyImpl::setValue_PublicApi<vec4i>(vec4i);
+    template bool PropertyImpl::setValue_PublicApi<std::string>(std::string);
+    template bool PropertyImpl::setValue_PublicApi<bool>(bool);
+
+    template <typename T>
+    bool PropertyImpl::setArray_PublicApi(const T* values, size_t count)
+    {
+        waitForAsyncUpdate();
+
+        if (m_semantics == EPropertySemantics::ScriptOutput)
+        {
+            LOG_ERROR("Cannot set property '{}' which is an output.", m_typeDescriptor->getName());
+            return false;
+        }
+
+        if (!checkArrayAccess(PropertyTypeToEnum<T>::TYPE, count))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const PropertyImpl& element = *m_children[i]->m_impl;
+            if (element.m_incomingLinkedProperty != nullptr)
+            {
+                LOG_ERROR("Element {} of array '{}' is currently linked (to property '{}'). Unlink it first before setting the array!", i, m_typeDescriptor->getName(), element.m_incomingLinkedProperty->getName());
+                return false;
+            }
+
+            if constexpr (std::is_same_v<T, int64_t>)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) values are passed as pointer and size
+                if (!IsInt64ValueInLuaRange(values[i]))
+                {
+                    LOG_ERROR("Invalid value when setting element {} of array '{}', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
+                        i, m_typeDescriptor->getName(), values[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    return false;
+                }
+            }
+        }
+
+        // All elements are checked before the first one is written, so that a failed call doesn't change the array partially
+        bool valueChanged = false;
+        for (size_t i = 0; i < count; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) values are passed as pointer and size
+            valueChanged = m_children[i]->m_impl->setValueAs<T>(values[i]) || valueChanged;
+        }
+
+        // Marks corresponding node dirty once for the whole array
+        if (valueChanged || m_semantics == EPropertySemantics::AnimationInput || m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_logicNode->setDirty(true);
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool PropertyImpl::getArray_PublicApi(T* values, size_t count) const
+    {
+        waitForAsyncUpdate();
+
+        if (!checkArrayAccess(PropertyTypeToEnum<T>::TYPE, count))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) values are passed as pointer and size
+            values[i] = m_children[i]->m_impl->getValueAs<T>();
+        }
+
+        return true;
+    }
+
+    bool PropertyImpl::checkArrayAccess(EPropertyType elementType, size_t count) const
+    {
+        if (m_typeDescriptor->getType() != EPropertyType::Array)
+        {
+            LOG_ERROR("Property '{}' is not an array, can't access its elements as array!", m_typeDescriptor->getName());
+            return false;
+        }
+
+        // Arrays are never empty and have elements of the same type
+        assert(!m_children.empty());
+        const EPropertyType arrayElementType = m_children.front()->m_impl->getType();
+        if (elementType != arrayElementType)
+        {
+            LOG_ERROR("Invalid element type '{}' when accessing array '{}', correct type is '{}'",
+                GetLuaPrimitiveTypeName(elementType), m_typeDescriptor->getName(), GetLuaPrimitiveTypeName(arrayElementType));
+            return false;
+        }
+
+        if (count != m_children.size())
+        {
+            LOG_ERROR("Invalid element count {} when accessing array '{}', the array has {} elements", count, m_typeDescriptor->getName(), m_children.size());
+            return false;
+        }
+
+        return true;
+    }
+
+    template bool PropertyImpl::setArray_PublicApi<float>(const float*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec2f>(const vec2f*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec3f>(const vec3f*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec4f>(const vec4f*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<int32_t>(const int32_t*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<int64_t>(const int64_t*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec2i>(const vec2i*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec3i>(const vec3i*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec4i>(const vec4i*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<std::string>(const std::string*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<bool>(const bool*, size_t);
+
+    template bool PropertyImpl::getArray_PublicApi<float>(float*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec2f>(vec2f*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec3f>(vec3f*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec4f>(vec4f*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<int32_t>(int32_t*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<int64_t>(int64_t*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec2i>(vec2i*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec3i>(vec3i*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec4i>(vec4i*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<std::string>(std::string*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<bool>(bool*, size_t) const;
+
+    void PropertyImpl::waitForAsyncUpdate() const
+    {
+        if (m_logicNode != nullptr)
+        {
+            m_logicNode->waitForAsyncUpdate();
+        }
+    }
+
     bool PropertyImpl::bindingInputHasNewValue() const
     {
         // TODO Violin can we make this assert the bindings semantics?
@@ -561,21 +855,48 @@ namespace rlogic::internal
         return newValue;
     }
 
+    void PropertyImpl::restoreBindingInputNewValue()
+    {
+        assert(m_semantics == EPropertySemantics::BindingInput);
+        m_bindingInputHasNewValue = true;
+    }
+
     bool PropertyImpl::setValue(PropertyValue value)
     {
-        assert(m_value.index() == value.index());
-        assert(TypeUtils::IsPrimitiveType(m_typeData.type));
+        assert(GetPropertyValueType(value) == m_typeDescriptor->getType());
+        assert(TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()));
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_bindingInputHasNewValue = true;
+        }
+
+        return m_valueStore->setValue(m_valueIndex, std::move(value));
+    }
+
+    bool PropertyImpl::setStringValue(std::string_view value)
+    {
+        assert(m_typeDescriptor->getType() == EPropertyType::String);
 
         if (m_semantics == EPropertySemantics::BindingInput)
         {
             m_bindingInputHasNewValue = true;
         }
 
-        const bool valueChanged = (m_value != value);
+        return m_valueStore->setString(m_valueIndex, value);
+    }
 
-        m_value = std::move(value);
+    bool PropertyImpl::copyValue(const PropertyImpl& source)
+    {
+        assert(source.m_typeDescriptor->getType() == m_typeDescriptor->getType());
+        assert(TypeUtils::IsPrimitiveType(m_typeDescriptor->getType()));
 
-        return valueChanged;
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_bindingInputHasNewValue = true;
+        }
+
+        return m_valueStore->copyValue(m_typeDescriptor->getType(), m_valueIndex, *source.m_valueStore, source.m_valueIndex);
     }
 
     void PropertyImpl::setLogicNode(LogicNodeImpl& logicNode)
@@ -615,9 +936,9 @@ namespace rlogic::internal
         return m_semantics;
     }
 
-    const PropertyValue& PropertyImpl::getValue() const
+    PropertyValue PropertyImpl::getValue() const
     {
-        return m_value;
+        return m_valueStore->getValue(m_typeDescriptor->getType(), m_valueIndex);
     }
 
     bool PropertyImpl::isLinked() const
@@ -631,6 +952,12 @@ namespace rlogic::internal
         return m_incomingLinkedProperty;
     }
 
+    PropertyImpl* PropertyImpl::getLinkedIncomingProperty()
+    {
+        assert(isInput());
+        return m_incomingLinkedProperty;
+    }
+
     std::vector<PropertyImpl*>& PropertyImpl::getLinkedOutgoingProperties()
     {
         assert(isOutput());
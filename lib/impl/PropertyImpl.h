@@ -13,14 +13,17 @@
 #include "internals/SerializationMap.h"
 #include "internals/DeserializationMap.h"
 #include "internals/TypeData.h"
+#include "internals/PropertyTypeDescriptor.h"
+#include "internals/PropertyValueStore.h"
 
 #include <cassert>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include <optional>
-#include <variant>
 #include <memory>
+#include <string_view>
+#include <utility>
 
 namespace rlogic
 {
@@ -41,8 +44,8 @@ namespace rlogic::internal
 {
     class LogicNodeImpl;
     class ErrorReporting;
+    class PropertyTypeRegistry;
 
-    using PropertyValue = std::variant<int32_t, int64_t, float, bool, std::string, vec2f, vec3f, vec4f, vec2i, vec3i, vec4i>;
     using PropertyList = std::vector<std::unique_ptr<Property>>;
 
     class PropertyImpl
@@ -50,6 +53,8 @@ namespace rlogic::internal
     public:
         PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics);
         PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics, PropertyValue initialValue);
+        // Property tree with default values for an existing type, e.g. the interface of a script instance
+        PropertyImpl(SharedPropertyTypeDescriptor type, EPropertySemantics semantics);
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> Serialize(
             const PropertyImpl& prop,
@@ -65,8 +70,8 @@ namespace rlogic::internal
 
         // Move-able (noexcept); Not copy-able
         ~PropertyImpl() noexcept;
-        PropertyImpl& operator=(PropertyImpl&& other) noexcept = default;
-        PropertyImpl(PropertyImpl&& other) noexcept = default;
+        PropertyImpl& operator=(PropertyImpl&& other) noexcept;
+        PropertyImpl(PropertyImpl&& other) noexcept;
         PropertyImpl& operator=(const PropertyImpl& other) = delete;
         PropertyImpl(const PropertyImpl& other) = delete;
 
@@ -76,6 +81,8 @@ namespace rlogic::internal
 
         [[nodiscard]] bool bindingInputHasNewValue() const;
         [[nodiscard]] bool checkForBindingInputNewValueAndReset();
+        // The value could not be applied to Ramses, the binding applies it again in its next update
+        void restoreBindingInputNewValue();
 
         [[nodiscard]] const Property* getChild(size_t index) const;
 
@@ -89,32 +96,67 @@ namespace rlogic::internal
         [[nodiscard]] Property* getChild(std::string_view name);
         [[nodiscard]] const Property* getChild(std::string_view name) const;
         [[nodiscard]] bool hasChild(std::string_view name) const;
+        // Doesn't log when there is no child with that name, use for internal lookups
+        [[nodiscard]] std::optional<size_t> findChildIndex(std::string_view name) const;
 
         // Public API access - only ever called by user, full error check and logs
         template <typename T>
         [[nodiscard]] std::optional<T> getValue_PublicApi() const;
-        [[nodiscard]] bool setValue_PublicApi(PropertyValue value);
+        template <typename T>
+        [[nodiscard]] bool setValue_PublicApi(T value);
+        // Access all elements of an array of primitives, count must match the array size
+        template <typename T>
+        [[nodiscard]] bool setArray_PublicApi(const T* values, size_t count);
+        template <typename T>
+        [[nodiscard]] bool getArray_PublicApi(T* values, size_t count) const;
 
         // Generic setter. Can optionally skip dirty-check
         bool setValue(PropertyValue value);
+        // Typed setter for use in template code, same as setValue() without conversion to PropertyValue
+        template <typename T>
+        bool setValueAs(T value)
+        {
+            assert(PropertyTypeToEnum<T>::TYPE == m_typeDescriptor->getType());
+
+            if (m_semantics == EPropertySemantics::BindingInput)
+            {
+                m_bindingInputHasNewValue = true;
+            }
+
+            return m_valueStore->set<T>(m_valueIndex, std::move(value));
+        }
+        // String setter which doesn't need a std::string, e.g. for strings from Lua
+        bool setStringValue(std::string_view value);
+        // Same as setValue(source.getValue()), but without conversion to PropertyValue
+        bool copyValue(const PropertyImpl& source);
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
 
         // Generic getter for use in other non-template code
-        [[nodiscard]] const PropertyValue& getValue() const;
-        // std::get wrapper for use in template code
+        [[nodiscard]] PropertyValue getValue() const;
+        // Typed getter for use in template code
         template <typename T>
         [[nodiscard]] const T& getValueAs() const
         {
-            return std::get<T>(m_value);
+            assert(PropertyTypeToEnum<T>::TYPE == m_typeDescriptor->getType());
+            return m_valueStore->get<T>(m_valueIndex);
         }
 
+        // Moves the values of this property and all its children to the store, e.g. of the logic engine which owns the logic node
+        void moveValuesToStore(PropertyValueStore& valueStore);
+        // Replaces the type descriptor of the tree with an equal one which is shared with other property trees
+        void shareTypeDescriptor(PropertyTypeRegistry& typeRegistry);
+        [[nodiscard]] const SharedPropertyTypeDescriptor& getTypeDescriptor() const;
+        // Memory of the property objects of the tree, without values and type descriptors
+        [[nodiscard]] size_t getAllocatedMemory() const;
+
         void setLogicNode(LogicNodeImpl& logicNode);
         [[nodiscard]] LogicNodeImpl& getLogicNode();
         [[nodiscard]] const LogicNodeImpl& getLogicNode() const;
 
         // Link handling
         [[nodiscard]] const PropertyImpl* getLinkedIncomingProperty() const;
+        [[nodiscard]] PropertyImpl* getLinkedIncomingProperty();
         [[nodiscard]] std::vector<PropertyImpl*>& getLinkedOutgoingProperties();
         [[nodiscard]] const std::vector<PropertyImpl*>& getLinkedOutgoingProperties() const;
 
@@ -122,10 +164,23 @@ namespace rlogic::internal
         void unsetLinkedOutput();
 
     private:
-        TypeData        m_typeData;
+        PropertyImpl(SharedPropertyTypeDescriptor type, EPropertySemantics semantics, PropertyValueStore& valueStore);
+
+        void initializeValueOrChildren();
+        void setTypeDescriptor(SharedPropertyTypeDescriptor type);
+        void releaseValue();
+        [[nodiscard]] bool checkArrayAccess(EPropertyType elementType, size_t count) const;
+        // The public API accesses values only after an asynchronous update of the logic engine has finished
+        void waitForAsyncUpdate() const;
+
+        // Name, type and layout of the children, shared with other properties of the same type
+        SharedPropertyTypeDescriptor m_typeDescriptor;
+        // Only set for the root of a property tree which doesn't use the value store of a logic engine. Declared
+        // before the children, so that it is destroyed after them
+        std::unique_ptr<PropertyValueStore> m_ownedValueStore;
         PropertyList    m_children;
-        PropertyValue   m_value;
-
+        PropertyValueStore* m_valueStore = nullptr;
+        PropertyValueStore::Index m_valueIndex = 0u;
 
         PropertyImpl* m_incomingLinkedProperty = nullptr;
         std::vector<PropertyImpl*> m_outgoingLinkedProperties;
@@ -138,5 +193,12 @@ namespace rlogic::internal
             const PropertyImpl& prop,
             flatbuffers::FlatBufferBuilder& builder,
             SerializationMap& serializationMap);
+
+        [[nodiscard]] static std::unique_ptr<PropertyImpl> DeserializeRecursive(
+            const rlogic_serialization::Property& prop,
+            EPropertySemantics semantics,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap,
+            PropertyValueStore& valueStore);
     };
 }
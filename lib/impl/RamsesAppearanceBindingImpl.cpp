@@ -199,68 +199,45 @@ namespace rlogic::internal
         const size_t childCount = getInputs()->getChildCount();
         for (size_t i = 0; i < childCount; ++i)
         {
-            setInputValueToUniform(i);
+            std::optional<LogicNodeRuntimeError> error = setInputValueToUniform(i);
+            if (error)
+            {
+                return error;
+            }
         }
 
         return std::nullopt;
     }
 
-    void RamsesAppearanceBindingImpl::setInputValueToUniform(size_t inputIndex)
+    std::optional<LogicNodeRuntimeError> RamsesAppearanceBindingImpl::setInputValueToUniform(size_t inputIndex)
     {
         PropertyImpl& inputProperty = *getInputs()->getChild(inputIndex)->m_impl;
         const EPropertyType propertyType = inputProperty.getType();
+        ramses::Appearance& appearance = m_ramsesAppearance.get();
+        const uint32_t uniformIndex = m_uniformIndices[inputIndex];
 
         if (TypeUtils::IsPrimitiveType(propertyType))
         {
             if (inputProperty.checkForBindingInputNewValueAndReset())
             {
-                ramses::UniformInput uniform;
-                m_ramsesAppearance.get().getEffect().getUniformInput(m_uniformIndices[inputIndex], uniform);
-
                 switch (propertyType)
                 {
                 case EPropertyType::Float:
-                    m_ramsesAppearance.get().setInputValueFloat(uniform, inputProperty.getValueAs<float>());
-                    break;
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, &inputProperty.getValueAs<float>(), 1u);
                 case EPropertyType::Int32:
-                    m_ramsesAppearance.get().setInputValueInt32(uniform, inputProperty.getValueAs<int32_t>());
-                    break;
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, &inputProperty.getValueAs<int32_t>(), 1u);
                 case EPropertyType::Vec2f:
-                {
-                    const auto vec = inputProperty.getValueAs<vec2f>();
-                    m_ramsesAppearance.get().setInputValueVector2f(uniform, vec[0], vec[1]);
-                    break;
-                }
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, inputProperty.getValueAs<vec2f>().data(), 1u);
                 case EPropertyType::Vec2i:
-                {
-                    const auto vec = inputProperty.getValueAs<vec2i>();
-                    m_ramsesAppearance.get().setInputValueVector2i(uniform, vec[0], vec[1]);
-                    break;
-                }
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, inputProperty.getValueAs<vec2i>().data(), 1u);
                 case EPropertyType::Vec3f:
-                {
-                    const auto vec = inputProperty.getValueAs<vec3f>();
-                    m_ramsesAppearance.get().setInputValueVector3f(uniform, vec[0], vec[1], vec[2]);
-                    break;
-                }
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, inputProperty.getValueAs<vec3f>().data(), 1u);
                 case EPropertyType::Vec3i:
-                {
-                    const auto vec = inputProperty.getValueAs<vec3i>();
-                    m_ramsesAppearance.get().setInputValueVector3i(uniform, vec[0], vec[1], vec[2]);
-                    break;
-                }
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, inputProperty.getValueAs<vec3i>().data(), 1u);
                 case EPropertyType::Vec4f:
-                {
-                    const auto vec = inputProperty.getValueAs<vec4f>();
-                    m_ramsesAppearance.get().setInputValueVector4f(uniform, vec[0], vec[1], vec[2], vec[3]);
-                    break;
-                }
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, inputProperty.getValueAs<vec4f>().data(), 1u);
                 case EPropertyType::Vec4i:
-                {
-                    const auto vec = inputProperty.getValueAs<vec4i>();
-                    m_ramsesAppearance.get().setInputValueVector4i(uniform, vec[0], vec[1], vec[2], vec[3]);
-                    break;
-                }
+                    return submitUniform(inputProperty, appearance, uniformIndex, propertyType, inputProperty.getValueAs<vec4i>().data(), 1u);
                 case EPropertyType::String:
                 case EPropertyType::Array:
                 case EPropertyType::Struct:
@@ -289,36 +266,26 @@ namespace rlogic::internal
 
             if (anyArrayElementWasSet)
             {
-                ramses::UniformInput uniform;
-                m_ramsesAppearance.get().getEffect().getUniformInput(m_uniformIndices[inputIndex], uniform);
-
                 const EPropertyType arrayElementType = inputProperty.getChild(0)->getType();
+                const auto elementCount = static_cast<uint32_t>(arraySize);
                 switch (arrayElementType)
                 {
                 case EPropertyType::Float:
-                    m_ramsesAppearance.get().setInputValueFloat(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<float, float>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<float, float>(inputProperty).data(), elementCount);
                 case EPropertyType::Int32:
-                    m_ramsesAppearance.get().setInputValueInt32(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<int32_t, int32_t>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<int32_t, int32_t>(inputProperty).data(), elementCount);
                 case EPropertyType::Vec2f:
-                    m_ramsesAppearance.get().setInputValueVector2f(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<float, vec2f>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<float, vec2f>(inputProperty).data(), elementCount);
                 case EPropertyType::Vec2i:
-                    m_ramsesAppearance.get().setInputValueVector2i(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<int32_t, vec2i>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<int32_t, vec2i>(inputProperty).data(), elementCount);
                 case EPropertyType::Vec3f:
-                    m_ramsesAppearance.get().setInputValueVector3f(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<float, vec3f>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<float, vec3f>(inputProperty).data(), elementCount);
                 case EPropertyType::Vec3i:
-                    m_ramsesAppearance.get().setInputValueVector3i(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<int32_t, vec3i>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<int32_t, vec3i>(inputProperty).data(), elementCount);
                 case EPropertyType::Vec4f:
-                    m_ramsesAppearance.get().setInputValueVector4f(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<float, vec4f>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<float, vec4f>(inputProperty).data(), elementCount);
                 case EPropertyType::Vec4i:
-                    m_ramsesAppearance.get().setInputValueVector4i(uniform, static_cast<uint32_t>(arraySize), TypeUtils::FlattenArrayData<int32_t, vec4i>(inputProperty).data());
-                    break;
+                    return submitUniform(*inputProperty.getChild(0)->m_impl, appearance, uniformIndex, arrayElementType, TypeUtils::FlattenArrayData<int32_t, vec4i>(inputProperty).data(), elementCount);
                 case EPropertyType::String:
                 case EPropertyType::Array:
                 case EPropertyType::Struct:
@@ -329,6 +296,8 @@ namespace rlogic::internal
                 }
             }
         }
+
+        return std::nullopt;
     }
 
     ramses::Appearance& RamsesAppearanceBindingImpl::getRamsesAppearance() const
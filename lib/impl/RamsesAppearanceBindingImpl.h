@@ -67,7 +67,7 @@ namespace rlogic::internal
         std::reference_wrapper<ramses::Appearance> m_ramsesAppearance;
         std::vector<uint32_t> m_uniformIndices;
 
-        void setInputValueToUniform(size_t inputIndex);
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> setInputValueToUniform(size_t inputIndex);
 
         static std::optional<EPropertyType> GetPropertyTypeForUniform(const ramses::UniformInput& uniform);
     };
@@ -19,6 +19,26 @@ namespace rlogic::internal
     {
     }
 
+    bool RamsesBindingImpl::updatesAtomicallyWithSources() const
+    {
+        return true;
+    }
+
+    void RamsesBindingImpl::setRamsesCommandBuffer(RamsesCommandBuffer* commandBuffer)
+    {
+        m_ramsesCommandBuffer = commandBuffer;
+    }
+
+    std::optional<LogicNodeRuntimeError> RamsesBindingImpl::submitRamsesCommand(PropertyImpl& input, const RamsesCommand& command)
+    {
+        if (m_ramsesCommandBuffer == nullptr)
+        {
+            RamsesCommandBuffer immediateCommands;
+            return immediateCommands.submit(*this, input, command);
+        }
+        return m_ramsesCommandBuffer->submit(*this, input, command);
+    }
+
     flatbuffers::Offset<rlogic_serialization::RamsesReference> RamsesBindingImpl::SerializeRamsesReference(const ramses::SceneObject& object, flatbuffers::FlatBufferBuilder& builder)
     {
         const ramses::sceneObjectId_t ramsesObjectId = object.getSceneObjectId();
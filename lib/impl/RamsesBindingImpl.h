@@ -9,6 +9,7 @@
 #pragma once
 
 #include "impl/LogicNodeImpl.h"
+#include "internals/RamsesCommandBuffer.h"
 
 namespace ramses
 {
@@ -33,8 +34,31 @@ namespace rlogic::internal
     public:
         explicit RamsesBindingImpl(std::string_view name, uint64_t id) noexcept;
 
+        // Ramses objects must not be updated with a mix of old and new values
+        [[nodiscard]] bool updatesAtomicallyWithSources() const override;
+
+        // Writes to Ramses objects go through this buffer (set when the binding is added to the LogicEngine), without
+        // buffer they are applied right away
+        void setRamsesCommandBuffer(RamsesCommandBuffer* commandBuffer);
+
     protected:
+        // The input is flagged to have a new value again if the command fails (see RamsesCommandBuffer::submit)
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> submitRamsesCommand(PropertyImpl& input, const RamsesCommand& command);
+        template <typename T>
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> submitUniform(PropertyImpl& input, ramses::Appearance& appearance, uint32_t uniformIndex, EPropertyType elementType, const T* values, uint32_t elementCount)
+        {
+            if (m_ramsesCommandBuffer == nullptr)
+            {
+                RamsesCommandBuffer immediateCommands;
+                return immediateCommands.submitUniform(*this, input, appearance, uniformIndex, elementType, values, elementCount);
+            }
+            return m_ramsesCommandBuffer->submitUniform(*this, input, appearance, uniformIndex, elementType, values, elementCount);
+        }
+
         // Used by subclasses to handle serialization
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::RamsesReference> SerializeRamsesReference(const ramses::SceneObject& object, flatbuffers::FlatBufferBuilder& builder);
+
+    private:
+        RamsesCommandBuffer* m_ramsesCommandBuffer = nullptr;
     };
 }
@@ -177,7 +177,7 @@ namespace rlogic::internal
 
     std::optional<LogicNodeRuntimeError> RamsesCameraBindingImpl::update()
     {
-        ramses::status_t status = ramses::StatusOK;
+        std::optional<LogicNodeRuntimeError> error;
         PropertyImpl& vpProperties = *getInputs()->getChild(static_cast<size_t>(ECameraPropertyStructStaticIndex::Viewport))->m_impl;
 
         PropertyImpl& vpOffsetX = *vpProperties.getChild(static_cast<size_t>(ECameraViewportPropertyStaticIndex::ViewPortOffsetX))->m_impl;
@@ -199,11 +199,10 @@ namespace rlogic::internal
                 return LogicNodeRuntimeError{ fmt::format("Camera viewport size must be positive! (width: {}; height: {})", vpW, vpH) };
             }
 
-            status = m_ramsesCamera.get().setViewport(vpX, vpY, vpW, vpH);
-
-            if (status != ramses::StatusOK)
+            error = submitRamsesCommand(vpOffsetX, CameraViewportCommand{ &m_ramsesCamera.get(), vpX, vpY, vpW, vpH });
+            if (error)
             {
-                return LogicNodeRuntimeError{m_ramsesCamera.get().getStatusMessage(status)};
+                return error;
             }
         }
 
@@ -224,11 +223,10 @@ namespace rlogic::internal
                 || aR.checkForBindingInputNewValueAndReset())
             {
                 auto* perspectiveCam = ramses::RamsesUtils::TryConvert<ramses::PerspectiveCamera>(m_ramsesCamera.get());
-                status = perspectiveCam->setFrustum(fov.getValueAs<float>(), aR.getValueAs<float>(), nearPlane.getValueAs<float>(), farPlane.getValueAs<float>());
-
-                if (status != ramses::StatusOK)
+                error = submitRamsesCommand(nearPlane, PerspectiveFrustumCommand{ perspectiveCam, fov.getValueAs<float>(), aR.getValueAs<float>(), nearPlane.getValueAs<float>(), farPlane.getValueAs<float>() });
+                if (error)
                 {
-                    return LogicNodeRuntimeError{ m_ramsesCamera.get().getStatusMessage(status) };
+                    return error;
                 }
             }
         }
@@ -246,17 +244,17 @@ namespace rlogic::internal
                 || bottomPlane.checkForBindingInputNewValueAndReset()
                 || topPlane.checkForBindingInputNewValueAndReset())
             {
-                status = m_ramsesCamera.get().setFrustum(
+                error = submitRamsesCommand(nearPlane, OrthographicFrustumCommand{
+                    &m_ramsesCamera.get(),
                     leftPlane.getValueAs<float>(),
                     rightPlane.getValueAs<float>(),
                     bottomPlane.getValueAs<float>(),
                     topPlane.getValueAs<float>(),
                     nearPlane.getValueAs<float>(),
-                    farPlane.getValueAs<float>());
-
-                if (status != ramses::StatusOK)
+                    farPlane.getValueAs<float>() });
+                if (error)
                 {
-                    return LogicNodeRuntimeError{ m_ramsesCamera.get().getStatusMessage(status) };
+                    return error;
                 }
             }
         }
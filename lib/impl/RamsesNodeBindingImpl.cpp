@@ -147,23 +147,14 @@ namespace rlogic::internal
 
     std::optional<LogicNodeRuntimeError> RamsesNodeBindingImpl::update()
     {
-        ramses::status_t status = ramses::StatusOK;
+        std::optional<LogicNodeRuntimeError> error;
         PropertyImpl& visibility = *getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Visibility))->m_impl;
         if (visibility.checkForBindingInputNewValueAndReset())
         {
-            // TODO Violin what about 'Off' state? Worth discussing!
-            if (visibility.getValueAs<bool>())
+            error = submitRamsesCommand(visibility, NodeVisibilityCommand{ &m_ramsesNode.get(), visibility.getValueAs<bool>() });
+            if (error)
             {
-                status = m_ramsesNode.get().setVisibility(ramses::EVisibilityMode::Visible);
-            }
-            else
-            {
-                status = m_ramsesNode.get().setVisibility(ramses::EVisibilityMode::Invisible);
-            }
-
-            if (status != ramses::StatusOK)
-            {
-                return LogicNodeRuntimeError{m_ramsesNode.get().getStatusMessage(status)};
+                return error;
             }
         }
 
@@ -174,41 +165,37 @@ namespace rlogic::internal
             {
                 const auto& valuesQuat = rotation.getValueAs<vec4f>();
                 const vec3f eulerXYZ = RotationUtils::QuaternionToEulerXYZDegrees(valuesQuat);
-                status = m_ramsesNode.get().setRotation(eulerXYZ[0], eulerXYZ[1], eulerXYZ[2], ramses::ERotationConvention::ZYX);
+                error = submitRamsesCommand(rotation, NodeRotationCommand{ &m_ramsesNode.get(), eulerXYZ, ramses::ERotationConvention::ZYX });
             }
             else
             {
                 const auto& valuesEuler = rotation.getValueAs<vec3f>();
-                status = m_ramsesNode.get().setRotation(valuesEuler[0], valuesEuler[1], valuesEuler[2], *RotationUtils::RotationTypeToRamsesRotationConvention(m_rotationType));
+                error = submitRamsesCommand(rotation, NodeRotationCommand{ &m_ramsesNode.get(), valuesEuler, *RotationUtils::RotationTypeToRamsesRotationConvention(m_rotationType) });
             }
 
-            if (status != ramses::StatusOK)
+            if (error)
             {
-                return LogicNodeRuntimeError{m_ramsesNode.get().getStatusMessage(status)};
+                return error;
             }
         }
 
         PropertyImpl& translation = *getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Translation))->m_impl;
         if (translation.checkForBindingInputNewValueAndReset())
         {
-            const auto& value = translation.getValueAs<vec3f>();
-            status = m_ramsesNode.get().setTranslation(value[0], value[1], value[2]);
-
-            if (status != ramses::StatusOK)
+            error = submitRamsesCommand(translation, NodeTranslationCommand{ &m_ramsesNode.get(), translation.getValueAs<vec3f>() });
+            if (error)
             {
-                return LogicNodeRuntimeError{ m_ramsesNode.get().getStatusMessage(status) };
+                return error;
             }
         }
 
         PropertyImpl& scaling = *getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Scaling))->m_impl;
         if (scaling.checkForBindingInputNewValueAndReset())
         {
-            const auto& value = scaling.getValueAs<vec3f>();
-            status = m_ramsesNode.get().setScaling(value[0], value[1], value[2]);
-
-            if (status != ramses::StatusOK)
+            error = submitRamsesCommand(scaling, NodeScalingCommand{ &m_ramsesNode.get(), scaling.getValueAs<vec3f>() });
+            if (error)
             {
-                return LogicNodeRuntimeError{ m_ramsesNode.get().getStatusMessage(status) };
+                return error;
             }
         }
 
@@ -0,0 +1,22 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/SaveFileConfigImpl.h"
+
+namespace rlogic::internal
+{
+    void SaveFileConfigImpl::setLuaByteCodeEnabled(bool enabled)
+    {
+        m_luaByteCodeEnabled = enabled;
+    }
+
+    bool SaveFileConfigImpl::getLuaByteCodeEnabled() const
+    {
+        return m_luaByteCodeEnabled;
+    }
+}
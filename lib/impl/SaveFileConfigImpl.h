@@ -0,0 +1,23 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+namespace rlogic::internal
+{
+    class SaveFileConfigImpl
+    {
+    public:
+        void setLuaByteCodeEnabled(bool enabled);
+
+        [[nodiscard]] bool getLuaByteCodeEnabled() const;
+
+    private:
+        bool m_luaByteCodeEnabled = false;
+    };
+}
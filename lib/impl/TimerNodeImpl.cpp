@@ -33,9 +33,15 @@ namespace rlogic::internal
         setRootProperties(std::make_unique<Property>(std::move(inputsImpl)), std::make_unique<Property>(std::move(outputsImpl)));
     }
 
+    bool TimerNodeImpl::supportsConcurrentUpdate() const
+    {
+        // Reads only its own inputs and the system clock, writes only its own outputs
+        return true;
+    }
+
     std::optional<LogicNodeRuntimeError> TimerNodeImpl::update()
     {
-        const int64_t ticker = *getInputs()->getChild(0u)->get<int64_t>();
+        const int64_t ticker = getInputs()->getChild(0u)->m_impl->getValueAs<int64_t>();
         if (ticker < 0)
             return LogicNodeRuntimeError{ fmt::format("TimerNode '{}' failed to update - cannot use negative ticker ({})", getName(), ticker) };
 
@@ -36,6 +36,7 @@ namespace rlogic::internal
         TimerNodeImpl(std::string_view name, uint64_t id) noexcept;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool supportsConcurrentUpdate() const override;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::TimerNode> Serialize(
             const TimerNodeImpl& timerNode,
@@ -13,6 +13,7 @@
 
 #include "ramses-logic/LogicObject.h"
 #include "ramses-logic/LogicNode.h"
+#include "ramses-logic/Property.h"
 #include "ramses-logic/LuaScript.h"
 #include "ramses-logic/LuaModule.h"
 #include "ramses-logic/RamsesNodeBinding.h"
@@ -22,6 +23,8 @@
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/TimerNode.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/ExpressionNode.h"
 
 #include "impl/PropertyImpl.h"
 #include "impl/LuaScriptImpl.h"
@@ -32,6 +35,8 @@
 #include "impl/DataArrayImpl.h"
 #include "impl/AnimationNodeImpl.h"
 #include "impl/TimerNodeImpl.h"
+#include "impl/NativeNodeImpl.h"
+#include "impl/ExpressionNodeImpl.h"
 
 #include "ramses-client-api/Node.h"
 #include "ramses-client-api/Appearance.h"
@@ -46,12 +51,34 @@
 #include "generated/DataArrayGen.h"
 #include "generated/AnimationNodeGen.h"
 #include "generated/TimerNodeGen.h"
+#include "generated/NativeNodeGen.h"
+#include "generated/ExpressionNodeGen.h"
 
 #include "fmt/format.h"
 #include "TypeUtils.h"
 
+#include <unordered_set>
+
 namespace rlogic::internal
 {
+    namespace
+    {
+        void CollectPropertyTypeStatistics(const PropertyImpl& property, MemoryStatistics& statistics, std::unordered_set<const PropertyTypeDescriptor*>& distinctTypes)
+        {
+            ++statistics.propertyCount;
+            const PropertyTypeDescriptor& type = *property.getTypeDescriptor();
+            statistics.propertyTypesUnsharedSize += type.getOwnAllocatedMemory();
+            if (distinctTypes.insert(&type).second)
+            {
+                statistics.propertyTypesSize += type.getOwnAllocatedMemory();
+            }
+            for (size_t i = 0; i < property.getChildCount(); ++i)
+            {
+                CollectPropertyTypeStatistics(*property.getChild(i)->m_impl, statistics, distinctTypes);
+            }
+        }
+    }
+
     ApiObjects::ApiObjects() = default;
     ApiObjects::~ApiObjects() noexcept = default;
 
@@ -70,6 +97,21 @@ namespace rlogic::internal
         return true;
     }
 
+    SolState& ApiObjects::getSolState(uint32_t executionGroup)
+    {
+        if (executionGroup == 0u)
+        {
+            return *m_solState;
+        }
+
+        std::unique_ptr<SolState>& solState = m_executionGroupSolStates[executionGroup];
+        if (!solState)
+        {
+            solState = std::make_unique<SolState>();
+        }
+        return *solState;
+    }
+
     LuaScript* ApiObjects::createLuaScript(
         std::string_view source,
         const LuaConfigImpl& config,
@@ -80,18 +122,46 @@ namespace rlogic::internal
         if (!checkLuaModules(modules, errorReporting))
             return nullptr;
 
-        std::optional<LuaCompiledScript> compiledScript = LuaCompilationUtils::CompileScript(
-            *m_solState,
-            modules,
-            config.getStandardModules(),
-            std::string{ source },
-            scriptName,
-            errorReporting);
+        SolState& solState = getSolState(config.getExecutionGroup());
+        LuaMemoryAccount memoryAccount = solState.createMemoryAccount(config.getMemoryLimit());
+        std::optional<LuaCompiledScript> compiledScript;
+        {
+            LuaMemoryScope memoryScope(memoryAccount);
+            compiledScript = LuaCompilationUtils::CompileScript(
+                solState,
+                modules,
+                config.getStandardModules(),
+                std::string{ source },
+                scriptName,
+                errorReporting);
+        }
 
         if (!compiledScript)
             return nullptr;
 
-        std::unique_ptr<LuaScript> up     = std::make_unique<LuaScript>(std::make_unique<LuaScriptImpl>(std::move(*compiledScript), scriptName, getNextLogicObjectId()));
+        std::unique_ptr<LuaScript> up     = std::make_unique<LuaScript>(std::make_unique<LuaScriptImpl>(std::move(*compiledScript), scriptName, getNextLogicObjectId(), config.getExecutionGroup(), std::move(memoryAccount)));
+        LuaScript*                 script = up.get();
+        m_scripts.push_back(script);
+        registerLogicObject(std::move(up));
+        return script;
+    }
+
+    LuaScript* ApiObjects::createLuaScriptInstance(
+        const LuaScript& prototype,
+        std::string_view scriptName,
+        ErrorReporting& errorReporting)
+    {
+        if (m_scripts.cend() == std::find(m_scripts.cbegin(), m_scripts.cend(), &prototype))
+        {
+            errorReporting.add(fmt::format("Failed to create instance of LuaScript '{}'! It was created on a different instance of LogicEngine.", prototype.getName()), &prototype);
+            return nullptr;
+        }
+
+        std::unique_ptr<LuaScriptImpl> scriptImpl = LuaScriptImpl::CreateInstance(prototype.m_script, scriptName, getNextLogicObjectId(), errorReporting);
+        if (!scriptImpl)
+            return nullptr;
+
+        std::unique_ptr<LuaScript> up     = std::make_unique<LuaScript>(std::move(scriptImpl));
         LuaScript*                 script = up.get();
         m_scripts.push_back(script);
         registerLogicObject(std::move(up));
@@ -108,18 +178,23 @@ namespace rlogic::internal
         if (!checkLuaModules(modules, errorReporting))
             return nullptr;
 
-        std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModule(
-            *m_solState,
-            modules,
-            config.getStandardModules(),
-            std::string{source},
-            moduleName,
-            errorReporting);
+        LuaMemoryAccount memoryAccount = m_solState->createMemoryAccount();
+        std::optional<LuaCompiledModule> compiledModule;
+        {
+            LuaMemoryScope memoryScope(memoryAccount);
+            compiledModule = LuaCompilationUtils::CompileModule(
+                *m_solState,
+                modules,
+                config.getStandardModules(),
+                std::string{source},
+                moduleName,
+                errorReporting);
+        }
 
         if (!compiledModule)
             return nullptr;
 
-        std::unique_ptr<LuaModule> up        = std::make_unique<LuaModule>(std::make_unique<LuaModuleImpl>(std::move(*compiledModule), moduleName, getNextLogicObjectId()));
+        std::unique_ptr<LuaModule> up        = std::make_unique<LuaModule>(std::make_unique<LuaModuleImpl>(std::move(*compiledModule), moduleName, getNextLogicObjectId(), std::move(memoryAccount)));
         LuaModule*                 luaModule = up.get();
         m_luaModules.push_back(luaModule);
         registerLogicObject(std::move(up));
@@ -185,10 +260,46 @@ namespace rlogic::internal
         return timer;
     }
 
+    NativeNode* ApiObjects::createNativeNode(std::shared_ptr<const NativeNodeType> type, std::string_view name)
+    {
+        std::unique_ptr<NativeNode> up = std::make_unique<NativeNode>(std::make_unique<NativeNodeImpl>(std::move(type), name, getNextLogicObjectId()));
+        NativeNode* nativeNode = up.get();
+        m_nativeNodes.push_back(nativeNode);
+        registerLogicObject(std::move(up));
+        return nativeNode;
+    }
+
+    ExpressionNode* ApiObjects::createExpressionNode(std::string_view expression, ExpressionProgram program, std::string_view name)
+    {
+        std::unique_ptr<ExpressionNode> up = std::make_unique<ExpressionNode>(std::make_unique<ExpressionNodeImpl>(expression, std::move(program), name, getNextLogicObjectId()));
+        ExpressionNode* expressionNode = up.get();
+        m_expressionNodes.push_back(expressionNode);
+        registerLogicObject(std::move(up));
+        return expressionNode;
+    }
+
     void ApiObjects::registerLogicNode(LogicNode& logicNode)
     {
         m_reverseImplMapping.emplace(std::make_pair(&logicNode.m_impl, &logicNode));
         m_logicNodeDependencies.addNode(logicNode.m_impl);
+        logicNode.m_impl.setAsyncUpdateThread(m_asyncUpdateThread);
+
+        // Values of all nodes are kept together, instead of a separate store per property tree. Nodes with the same
+        // interface (e.g. scripts from the same source) share the type descriptors of their properties
+        if (Property* inputs = logicNode.m_impl.getInputs())
+        {
+            inputs->m_impl->moveValuesToStore(m_propertyValueStore);
+            inputs->m_impl->shareTypeDescriptor(m_propertyTypeRegistry);
+        }
+        if (Property* outputs = logicNode.m_impl.getOutputs())
+        {
+            outputs->m_impl->moveValuesToStore(m_propertyValueStore);
+            outputs->m_impl->shareTypeDescriptor(m_propertyTypeRegistry);
+        }
+
+        auto* binding = dynamic_cast<RamsesBindingImpl*>(&logicNode.m_impl);
+        if (binding)
+            binding->setRamsesCommandBuffer(&m_ramsesCommandBuffer);
     }
 
     void ApiObjects::unregisterLogicNode(LogicNode& logicNode)
@@ -199,6 +310,23 @@ namespace rlogic::internal
         m_reverseImplMapping.erase(implIter);
 
         m_logicNodeDependencies.removeNode(logicNodeImpl);
+        logicNodeImpl.setAsyncUpdateThread(nullptr);
+
+        auto* binding = dynamic_cast<RamsesBindingImpl*>(&logicNodeImpl);
+        if (binding)
+        {
+            m_ramsesCommandBuffer.discardCommands(*binding);
+            binding->setRamsesCommandBuffer(nullptr);
+        }
+    }
+
+    void ApiObjects::setAsyncUpdateThread(const AsyncUpdateThread* asyncUpdateThread)
+    {
+        m_asyncUpdateThread = asyncUpdateThread;
+        for (const auto& implMapping : m_reverseImplMapping)
+        {
+            implMapping.first->setAsyncUpdateThread(asyncUpdateThread);
+        }
     }
 
     bool ApiObjects::destroy(LogicObject& object, ErrorReporting& errorReporting)
@@ -235,6 +363,14 @@ namespace rlogic::internal
         if (timer)
             return destroyInternal(*timer, errorReporting);
 
+        auto nativeNode = dynamic_cast<NativeNode*>(&object);
+        if (nativeNode)
+            return destroyInternal(*nativeNode, errorReporting);
+
+        auto expressionNode = dynamic_cast<ExpressionNode*>(&object);
+        if (expressionNode)
+            return destroyInternal(*expressionNode, errorReporting);
+
         errorReporting.add(fmt::format("Tried to destroy object '{}' with unknown type", object.getName()), &object);
 
         return false;
@@ -403,6 +539,42 @@ namespace rlogic::internal
         return true;
     }
 
+    bool ApiObjects::destroyInternal(NativeNode& node, ErrorReporting& errorReporting)
+    {
+        auto nodeIt = find_if(m_nativeNodes.begin(), m_nativeNodes.end(), [&](const auto& n) {
+            return n == &node;
+        });
+
+        if (nodeIt == m_nativeNodes.end())
+        {
+            errorReporting.add("Can't find NativeNode in logic engine!", &node);
+            return false;
+        }
+
+        unregisterLogicObject(node);
+        m_nativeNodes.erase(nodeIt);
+
+        return true;
+    }
+
+    bool ApiObjects::destroyInternal(ExpressionNode& node, ErrorReporting& errorReporting)
+    {
+        auto nodeIt = find_if(m_expressionNodes.begin(), m_expressionNodes.end(), [&](const auto& n) {
+            return n == &node;
+        });
+
+        if (nodeIt == m_expressionNodes.end())
+        {
+            errorReporting.add("Can't find ExpressionNode in logic engine!", &node);
+            return false;
+        }
+
+        unregisterLogicObject(node);
+        m_expressionNodes.erase(nodeIt);
+
+        return true;
+    }
+
     void ApiObjects::registerLogicObject(std::unique_ptr<LogicObject> obj)
     {
         m_logicObjects.push_back(obj.get());
@@ -412,6 +584,8 @@ namespace rlogic::internal
             registerLogicNode(*logicNode);
         }
         m_logicObjectIdMapping.emplace(obj->getId(), obj.get());
+        // Objects created after loading a file get ids which are not used by the loaded objects
+        m_lastObjectId = std::max(m_lastObjectId, obj->getId());
         m_objectsOwningContainer.push_back(move(obj));
     }
 
@@ -531,6 +705,14 @@ namespace rlogic::internal
         {
             return m_timerNodes;
         }
+        else if constexpr (std::is_same_v<T, NativeNode>)
+        {
+            return m_nativeNodes;
+        }
+        else if constexpr (std::is_same_v<T, ExpressionNode>)
+        {
+            return m_expressionNodes;
+        }
     }
 
     template <typename T>
@@ -550,6 +732,61 @@ namespace rlogic::internal
         return m_logicNodeDependencies;
     }
 
+    RamsesCommandBuffer& ApiObjects::getRamsesCommandBuffer()
+    {
+        return m_ramsesCommandBuffer;
+    }
+
+    const PropertyValueStore& ApiObjects::getPropertyValueStore() const
+    {
+        return m_propertyValueStore;
+    }
+
+    const PropertyTypeRegistry& ApiObjects::getPropertyTypeRegistry() const
+    {
+        return m_propertyTypeRegistry;
+    }
+
+    MemoryStatistics ApiObjects::getMemoryStatistics() const
+    {
+        MemoryStatistics statistics;
+        statistics.propertyValuesSize = m_propertyValueStore.getAllocatedMemory();
+
+        std::unordered_set<const PropertyTypeDescriptor*> distinctTypes;
+        for (const auto& logicNodeEntry : m_reverseImplMapping)
+        {
+            const LogicNodeImpl* logicNodeImpl = logicNodeEntry.first;
+            for (const Property* rootProperty : { logicNodeImpl->getInputs(), logicNodeImpl->getOutputs() })
+            {
+                if (rootProperty != nullptr)
+                {
+                    statistics.propertyObjectsSize += rootProperty->m_impl->getAllocatedMemory();
+                    CollectPropertyTypeStatistics(*rootProperty->m_impl, statistics, distinctTypes);
+                }
+            }
+        }
+        statistics.propertyTypeCount = distinctTypes.size();
+
+        statistics.luaMemory = getLuaMemoryStatistics();
+        statistics.luaPoolsSize = m_solState->getAllocator().getPoolsSize();
+        for (const auto& solState : m_executionGroupSolStates)
+        {
+            statistics.luaPoolsSize += solState.second->getAllocator().getPoolsSize();
+        }
+
+        return statistics;
+    }
+
+    LuaMemoryStatistics ApiObjects::getLuaMemoryStatistics() const
+    {
+        LuaMemoryStatistics statistics = m_solState->getAllocator().getTotalStatistics();
+        for (const auto& solState : m_executionGroupSolStates)
+        {
+            AddLuaMemoryStatistics(statistics, solState.second->getAllocator().getTotalStatistics());
+        }
+        return statistics;
+    }
+
     const LogicNodeDependencies& ApiObjects::getLogicNodeDependencies() const
     {
         return m_logicNodeDependencies;
@@ -578,7 +815,7 @@ namespace rlogic::internal
         return m_reverseImplMapping;
     }
 
-    flatbuffers::Offset<rlogic_serialization::ApiObjects> ApiObjects::Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder)
+    flatbuffers::Offset<rlogic_serialization::ApiObjects> ApiObjects::Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder, bool saveLuaByteCode)
     {
         SerializationMap serializationMap;
 
@@ -586,15 +823,15 @@ namespace rlogic::internal
         luaModules.reserve(apiObjects.m_luaModules.size());
         for (const auto& luaModule : apiObjects.m_luaModules)
         {
-            luaModules.push_back(LuaModuleImpl::Serialize(luaModule->m_impl, builder, serializationMap));
+            luaModules.push_back(LuaModuleImpl::Serialize(luaModule->m_impl, builder, serializationMap, saveLuaByteCode));
             serializationMap.storeLuaModule(*luaModule, luaModules.back());
         }
 
         std::vector<flatbuffers::Offset<rlogic_serialization::LuaScript>> luascripts;
         luascripts.reserve(apiObjects.m_scripts.size());
         std::transform(apiObjects.m_scripts.begin(), apiObjects.m_scripts.end(), std::back_inserter(luascripts),
-            [&builder, &serializationMap](const std::vector<LuaScript*>::value_type& it) {
-                return LuaScriptImpl::Serialize(it->m_script, builder, serializationMap);
+            [&builder, &serializationMap, saveLuaByteCode](const std::vector<LuaScript*>::value_type& it) {
+                return LuaScriptImpl::Serialize(it->m_script, builder, serializationMap, saveLuaByteCode);
             });
 
         std::vector<flatbuffers::Offset<rlogic_serialization::RamsesNodeBinding>> ramsesnodebindings;
@@ -643,6 +880,16 @@ namespace rlogic::internal
         for (const auto& timerNode : apiObjects.m_timerNodes)
             timerNodes.push_back(TimerNodeImpl::Serialize(timerNode->m_timerNodeImpl, builder, serializationMap));
 
+        std::vector<flatbuffers::Offset<rlogic_serialization::NativeNode>> nativeNodes;
+        nativeNodes.reserve(apiObjects.m_nativeNodes.size());
+        for (const auto& nativeNode : apiObjects.m_nativeNodes)
+            nativeNodes.push_back(NativeNodeImpl::Serialize(nativeNode->m_nativeNodeImpl, builder, serializationMap));
+
+        std::vector<flatbuffers::Offset<rlogic_serialization::ExpressionNode>> expressionNodes;
+        expressionNodes.reserve(apiObjects.m_expressionNodes.size());
+        for (const auto& expressionNode : apiObjects.m_expressionNodes)
+            expressionNodes.push_back(ExpressionNodeImpl::Serialize(expressionNode->m_expressionNodeImpl, builder, serializationMap));
+
         // links must go last due to dependency on serialized properties
         std::vector<flatbuffers::Offset<rlogic_serialization::Link>> links;
 
@@ -685,7 +932,9 @@ namespace rlogic::internal
             builder.CreateVector(dataArrays),
             builder.CreateVector(animationNodes),
             builder.CreateVector(timerNodes),
-            builder.CreateVector(links)
+            builder.CreateVector(links),
+            builder.CreateVector(nativeNodes),
+            builder.CreateVector(expressionNodes)
         );
 
         builder.Finish(logicEngine);
@@ -697,6 +946,8 @@ namespace rlogic::internal
         const rlogic_serialization::ApiObjects& apiObjects,
         const IRamsesObjectResolver& ramsesResolver,
         const std::string& dataSourceDescription,
+        const NativeNodeTypeRegistry& nativeNodeTypes,
+        bool loadLuaByteCode,
         ErrorReporting& errorReporting)
     {
         // Collect data here, only return if no error occurred
@@ -767,7 +1018,9 @@ namespace rlogic::internal
             static_cast<size_t>(apiObjects.cameraBindings()->size()) +
             static_cast<size_t>(apiObjects.dataArrays()->size()) +
             static_cast<size_t>(apiObjects.animationNodes()->size()) +
-            static_cast<size_t>(apiObjects.timerNodes()->size());
+            static_cast<size_t>(apiObjects.timerNodes()->size()) +
+            static_cast<size_t>(apiObjects.nativeNodes() ? apiObjects.nativeNodes()->size() : 0u) +
+            static_cast<size_t>(apiObjects.expressionNodes() ? apiObjects.expressionNodes()->size() : 0u);
 
         deserialized->m_objectsOwningContainer.reserve(logicObjectsTotalSize);
         deserialized->m_logicObjects.reserve(logicObjectsTotalSize);
@@ -776,7 +1029,7 @@ namespace rlogic::internal
         deserialized->m_luaModules.reserve(luaModules.size());
         for (const auto* module : luaModules)
         {
-            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*deserialized->m_solState, *module, errorReporting, deserializationMap);
+            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*deserialized->m_solState, *module, loadLuaByteCode, errorReporting, deserializationMap);
             if (!deserializedModule)
                 return nullptr;
 
@@ -794,7 +1047,7 @@ namespace rlogic::internal
             // TODO Violin find ways to unit-test this case - also for other container types
             // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
             assert (script);
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*deserialized->m_solState, *script, errorReporting, deserializationMap);
+            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(deserialized->getSolState(script->executionGroup()), *script, loadLuaByteCode, errorReporting, deserializationMap);
 
             if (deserializedScript)
             {
@@ -915,6 +1168,42 @@ namespace rlogic::internal
             deserialized->registerLogicObject(std::move(up));
         }
 
+        // native nodes are optional, files which were saved before they were added don't have the container
+        if (apiObjects.nativeNodes())
+        {
+            const auto& nativeNodes = *apiObjects.nativeNodes();
+            deserialized->m_nativeNodes.reserve(nativeNodes.size());
+            for (const auto* fbData : nativeNodes)
+            {
+                assert(fbData);
+                auto deserializedNativeNode = NativeNodeImpl::Deserialize(*fbData, nativeNodeTypes, errorReporting, deserializationMap);
+                if (!deserializedNativeNode)
+                    return nullptr;
+
+                auto up = std::make_unique<NativeNode>(std::move(deserializedNativeNode));
+                deserialized->m_nativeNodes.push_back(up.get());
+                deserialized->registerLogicObject(std::move(up));
+            }
+        }
+
+        // expression nodes are optional for the same reason
+        if (apiObjects.expressionNodes())
+        {
+            const auto& expressionNodes = *apiObjects.expressionNodes();
+            deserialized->m_expressionNodes.reserve(expressionNodes.size());
+            for (const auto* fbData : expressionNodes)
+            {
+                assert(fbData);
+                auto deserializedExpressionNode = ExpressionNodeImpl::Deserialize(*fbData, errorReporting, deserializationMap);
+                if (!deserializedExpressionNode)
+                    return nullptr;
+
+                auto up = std::make_unique<ExpressionNode>(std::move(deserializedExpressionNode));
+                deserialized->m_expressionNodes.push_back(up.get());
+                deserialized->registerLogicObject(std::move(up));
+            }
+        }
+
         // links must go last due to dependency on deserialized properties
         const auto& links = *apiObjects.links();
         // TODO Violin move this code (serialization parts too) to LogicNodeDependencies
@@ -964,6 +1253,8 @@ namespace rlogic::internal
         // TODO Violin improve internal management of logic nodes so that we don't have to loop over three
         // different containers below which all call a method on LogicNode
         return std::any_of(m_scripts.cbegin(), m_scripts.cend(), [](const auto& s) { return s->m_impl.isDirty(); })
+            || std::any_of(m_nativeNodes.cbegin(), m_nativeNodes.cend(), [](const auto& n) { return n->m_impl.isDirty(); })
+            || std::any_of(m_expressionNodes.cbegin(), m_expressionNodes.cend(), [](const auto& n) { return n->m_impl.isDirty(); })
             || bindingsDirty();
     }
 
@@ -998,6 +1289,8 @@ namespace rlogic::internal
     template ApiObjectContainer<DataArray>&               ApiObjects::getApiObjectContainer<DataArray>();
     template ApiObjectContainer<AnimationNode>&           ApiObjects::getApiObjectContainer<AnimationNode>();
     template ApiObjectContainer<TimerNode>&               ApiObjects::getApiObjectContainer<TimerNode>();
+    template ApiObjectContainer<NativeNode>&              ApiObjects::getApiObjectContainer<NativeNode>();
+    template ApiObjectContainer<ExpressionNode>&          ApiObjects::getApiObjectContainer<ExpressionNode>();
 
     template const ApiObjectContainer<LogicObject>&             ApiObjects::getApiObjectContainer<LogicObject>() const;
     template const ApiObjectContainer<LuaScript>&               ApiObjects::getApiObjectContainer<LuaScript>() const;
@@ -1008,4 +1301,6 @@ namespace rlogic::internal
     template const ApiObjectContainer<DataArray>&               ApiObjects::getApiObjectContainer<DataArray>() const;
     template const ApiObjectContainer<AnimationNode>&           ApiObjects::getApiObjectContainer<AnimationNode>() const;
     template const ApiObjectContainer<TimerNode>&               ApiObjects::getApiObjectContainer<TimerNode>() const;
+    template const ApiObjectContainer<NativeNode>&              ApiObjects::getApiObjectContainer<NativeNode>() const;
+    template const ApiObjectContainer<ExpressionNode>&          ApiObjects::getApiObjectContainer<ExpressionNode>() const;
 }
@@ -11,16 +11,24 @@
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/ERotationType.h"
 #include "ramses-logic/AnimationTypes.h"
+#include "ramses-logic/MemoryStatistics.h"
 
 #include "impl/LuaConfigImpl.h"
 
 #include "internals/LuaCompilationUtils.h"
 #include "internals/SolState.h"
 #include "internals/LogicNodeDependencies.h"
+#include "internals/RamsesCommandBuffer.h"
+#include "internals/PropertyValueStore.h"
+#include "internals/PropertyTypeRegistry.h"
+#include "internals/NativeNodeType.h"
+#include "internals/ExpressionProgram.h"
+#include "internals/AsyncUpdateThread.h"
 
 #include <vector>
 #include <memory>
 #include <string_view>
+#include <unordered_map>
 
 namespace ramses
 {
@@ -53,6 +61,8 @@ namespace rlogic
     class DataArray;
     class AnimationNode;
     class TimerNode;
+    class NativeNode;
+    class ExpressionNode;
 }
 
 namespace rlogic::internal
@@ -80,11 +90,14 @@ namespace rlogic::internal
         ApiObjects& operator=(const ApiObjects& other) = delete;
 
         // Serialization/Deserialization
-        static flatbuffers::Offset<rlogic_serialization::ApiObjects> Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder);
+        // Lua byte code is only saved and loaded if requested, Lua can't verify that byte code from a file is valid
+        static flatbuffers::Offset<rlogic_serialization::ApiObjects> Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder, bool saveLuaByteCode);
         static std::unique_ptr<ApiObjects> Deserialize(
             const rlogic_serialization::ApiObjects& apiObjects,
             const IRamsesObjectResolver& ramsesResolver,
             const std::string& dataSourceDescription,
+            const NativeNodeTypeRegistry& nativeNodeTypes,
+            bool loadLuaByteCode,
             ErrorReporting& errorReporting);
 
         // Create/destroy API objects
@@ -93,6 +106,10 @@ namespace rlogic::internal
             const LuaConfigImpl& config,
             std::string_view scriptName,
             ErrorReporting& errorReporting);
+        LuaScript* createLuaScriptInstance(
+            const LuaScript& prototype,
+            std::string_view scriptName,
+            ErrorReporting& errorReporting);
         LuaModule* createLuaModule(
             std::string_view source,
             const LuaConfigImpl& config,
@@ -105,8 +122,13 @@ namespace rlogic::internal
         DataArray* createDataArray(const std::vector<T>& data, std::string_view name);
         AnimationNode* createAnimationNode(const AnimationChannels& channels, std::string_view name);
         TimerNode* createTimerNode(std::string_view name);
+        NativeNode* createNativeNode(std::shared_ptr<const NativeNodeType> type, std::string_view name);
+        ExpressionNode* createExpressionNode(std::string_view expression, ExpressionProgram program, std::string_view name);
         bool destroy(LogicObject& object, ErrorReporting& errorReporting);
 
+        // The logic nodes wait for this thread when their properties are accessed through the public API, set by the logic engine
+        void setAsyncUpdateThread(const AsyncUpdateThread* asyncUpdateThread);
+
         // Invariance checks
         [[nodiscard]] bool checkBindingsReferToSameRamsesScene(ErrorReporting& errorReporting) const;
 
@@ -118,6 +140,12 @@ namespace rlogic::internal
         [[nodiscard]] const ApiObjectOwningContainer& getApiObjectOwningContainer() const;
         [[nodiscard]] const LogicNodeDependencies& getLogicNodeDependencies() const;
         [[nodiscard]] LogicNodeDependencies& getLogicNodeDependencies();
+        [[nodiscard]] RamsesCommandBuffer& getRamsesCommandBuffer();
+        [[nodiscard]] const PropertyValueStore& getPropertyValueStore() const;
+        [[nodiscard]] const PropertyTypeRegistry& getPropertyTypeRegistry() const;
+        [[nodiscard]] MemoryStatistics getMemoryStatistics() const;
+        // Sum over all Lua states
+        [[nodiscard]] LuaMemoryStatistics getLuaMemoryStatistics() const;
 
         [[nodiscard]] LogicNode* getApiObject(LogicNodeImpl& impl) const;
         [[nodiscard]] LogicObject* getApiObjectById(uint64_t id) const;
@@ -137,6 +165,9 @@ namespace rlogic::internal
         void registerLogicObject(std::unique_ptr<LogicObject> obj);
         void unregisterLogicObject(LogicObject& objToDelete);
 
+        // Group 0 uses the main Lua state, other groups get their own state on first use
+        [[nodiscard]] SolState& getSolState(uint32_t executionGroup);
+
         bool checkLuaModules(
             const ModuleMapping& moduleMapping,
             ErrorReporting& errorReporting);
@@ -150,8 +181,16 @@ namespace rlogic::internal
         [[nodiscard]] bool destroyInternal(AnimationNode& node, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(DataArray& dataArray, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(TimerNode& node, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(NativeNode& node, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(ExpressionNode& node, ErrorReporting& errorReporting);
 
         std::unique_ptr<SolState> m_solState {std::make_unique<SolState>()};
+        std::unordered_map<uint32_t, std::unique_ptr<SolState>> m_executionGroupSolStates;
+
+        // Holds the property values of all logic nodes, declared before the objects so that it outlives their properties
+        PropertyValueStore                          m_propertyValueStore;
+        // Deduplicates the type descriptors of the properties of all logic nodes
+        PropertyTypeRegistry                        m_propertyTypeRegistry;
 
         ApiObjectContainer<LuaScript>               m_scripts;
         ApiObjectContainer<LuaModule>               m_luaModules;
@@ -161,10 +200,14 @@ namespace rlogic::internal
         ApiObjectContainer<DataArray>               m_dataArrays;
         ApiObjectContainer<AnimationNode>           m_animationNodes;
         ApiObjectContainer<TimerNode>               m_timerNodes;
+        ApiObjectContainer<NativeNode>              m_nativeNodes;
+        ApiObjectContainer<ExpressionNode>          m_expressionNodes;
         ApiObjectContainer<LogicObject>             m_logicObjects;
         ApiObjectOwningContainer                    m_objectsOwningContainer;
 
         LogicNodeDependencies                       m_logicNodeDependencies;
+        RamsesCommandBuffer                         m_ramsesCommandBuffer;
+        const AsyncUpdateThread*                    m_asyncUpdateThread = nullptr;
         uint64_t                                    m_lastObjectId = 0;
 
         std::unordered_map<LogicNodeImpl*, LogicNode*> m_reverseImplMapping;
@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+
+#include "internals/AsyncUpdateThread.h"
+
+#include <cassert>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // Update thread of the logic engine whose update is executed by the calling thread
+        thread_local const AsyncUpdateThread* CurrentUpdateThread = nullptr;
+    }
+
+    AsyncUpdateThread::~AsyncUpdateThread() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_updateStarted.notify_one();
+
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    std::shared_future<bool> AsyncUpdateThread::start(Update update)
+    {
+        assert(!m_lastResult.valid() || m_lastResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+
+        std::promise<bool> result;
+        m_lastResult = result.get_future().share();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_update = std::move(update);
+            m_result = std::move(result);
+
+            // The thread is started with the first update
+            if (!m_thread.joinable())
+            {
+                m_thread = std::thread([this]() { threadLoop(); });
+            }
+        }
+        m_updateStarted.notify_one();
+
+        return m_lastResult;
+    }
+
+    void AsyncUpdateThread::wait() const
+    {
+        if (m_lastResult.valid() && CurrentUpdateThread != this)
+        {
+            m_lastResult.wait();
+        }
+    }
+
+    void AsyncUpdateThread::threadLoop()
+    {
+        while (true)
+        {
+            Update update;
+            std::promise<bool> result;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                // A started update is executed also if the thread is shut down meanwhile
+                m_updateStarted.wait(lock, [this]() { return m_shutdown || m_update; });
+                if (!m_update)
+                {
+                    return;
+                }
+                update = std::move(m_update);
+                m_update = nullptr;
+                result = std::move(m_result);
+            }
+
+            try
+            {
+                UpdateScope updateScope(*this);
+                result.set_value(update());
+            }
+            catch (...)
+            {
+                result.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    AsyncUpdateThread::UpdateScope::UpdateScope(const AsyncUpdateThread& updateThread)
+        : m_previousUpdateThread(CurrentUpdateThread)
+    {
+        CurrentUpdateThread = &updateThread;
+    }
+
+    AsyncUpdateThread::UpdateScope::~UpdateScope() noexcept
+    {
+        CurrentUpdateThread = m_previousUpdateThread;
+    }
+}
@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+
+namespace rlogic::internal
+{
+    // Executes the updates started with LogicEngine::updateAsync() one after another on the same thread. The thread is
+    // started with the first update and kept until the logic engine is destroyed, so that updating asynchronously in
+    // every frame doesn't start a new thread every time.
+    class AsyncUpdateThread
+    {
+    public:
+        using Update = std::function<bool()>;
+
+        AsyncUpdateThread() = default;
+        ~AsyncUpdateThread() noexcept;
+        AsyncUpdateThread(AsyncUpdateThread&& other) = delete;
+        AsyncUpdateThread& operator=(AsyncUpdateThread&& other) = delete;
+        AsyncUpdateThread(const AsyncUpdateThread& other) = delete;
+        AsyncUpdateThread& operator=(const AsyncUpdateThread& other) = delete;
+
+        // The previous update must have finished (see wait()). Exceptions of the update are passed to the future
+        [[nodiscard]] std::shared_future<bool> start(Update update);
+        // Returns when the last started update has finished, right away if it finished already. Also returns right away
+        // when called by a thread which executes an update of this thread's logic engine (see UpdateScope), e.g. by a
+        // native node which reads its inputs - the update can't wait for itself
+        void wait() const;
+
+        // Marks the calling thread as executing an update of the logic engine which owns the update thread. Set by the
+        // update thread itself and by the workers which update nodes concurrently, also in synchronous updates
+        class UpdateScope
+        {
+        public:
+            explicit UpdateScope(const AsyncUpdateThread& updateThread);
+            ~UpdateScope() noexcept;
+            UpdateScope(UpdateScope&& other) = delete;
+            UpdateScope& operator=(UpdateScope&& other) = delete;
+            UpdateScope(const UpdateScope& other) = delete;
+            UpdateScope& operator=(const UpdateScope& other) = delete;
+
+        private:
+            const AsyncUpdateThread* m_previousUpdateThread;
+        };
+
+    private:
+        void threadLoop();
+
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_updateStarted;
+        Update m_update;
+        std::promise<bool> m_result;
+        bool m_shutdown = false;
+
+        // Kept after the update finished, waiting for a finished update returns right away
+        std::shared_future<bool> m_lastResult;
+    };
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <cstdint>
 
 namespace rlogic_serialization
 {
@@ -26,6 +27,7 @@ namespace rlogic
 namespace rlogic::internal
 {
     class PropertyImpl;
+    class LuaScriptImpl;
 
     // Remembers flatbuffers pointers to deserialized objects temporarily during deserialization
     class DeserializationMap
@@ -70,10 +72,24 @@ namespace rlogic::internal
             return *it->second;
         }
 
+        void storeLuaScript(uint64_t id, const LuaScriptImpl& luaScript)
+        {
+            assert(m_luaScripts.count(id) == 0 && "one time store only");
+            m_luaScripts.insert({ id, &luaScript });
+        }
+
+        // Returns nullptr if no script with that id was loaded (yet)
+        const LuaScriptImpl* resolveLuaScript(uint64_t id) const
+        {
+            const auto it = m_luaScripts.find(id);
+            return (it != m_luaScripts.cend()) ? it->second : nullptr;
+        }
+
     private:
         std::unordered_map<const rlogic_serialization::Property*, PropertyImpl*> m_properties;
         std::unordered_map<const rlogic_serialization::DataArray*, const DataArray*> m_dataArrays;
         std::unordered_map<const rlogic_serialization::LuaModule*, const LuaModule*> m_luaModules;
+        std::unordered_map<uint64_t, const LuaScriptImpl*> m_luaScripts;
     };
 
 }
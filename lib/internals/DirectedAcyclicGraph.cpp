@@ -8,241 +8,485 @@
 
 #include "internals/DirectedAcyclicGraph.h"
 
+#include "impl/LogicNodeImpl.h"
+
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
 #include <numeric>
 #include <iterator>
+#include <limits>
 
 namespace rlogic::internal
 {
     void DirectedAcyclicGraph::addNode(Node& node)
     {
         assert(!containsNode(node));
-        m_nodeOutgoingEdges.insert({ &node, std::vector<Edge>() });
+
+        NodeIndex nodeIndex = 0u;
+        if (m_freeNodeIndices.empty())
+        {
+            nodeIndex = static_cast<NodeIndex>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+        else
+        {
+            nodeIndex = m_freeNodeIndices.back();
+            m_freeNodeIndices.pop_back();
+        }
+        node.setGraphIndex(nodeIndex);
+        ++m_nodeCount;
+
+        // New nodes have no edges yet, so they can go anywhere in the order - the end is cheapest
+        NodeData& nodeData = m_nodes[nodeIndex];
+        nodeData.node = &node;
+        nodeData.rank = m_order.size();
+        m_order.push_back(nodeIndex);
     }
 
     void DirectedAcyclicGraph::removeNode(Node& nodeToRemove)
     {
-        // First, remove all 'incoming edges' of the node by going through all outgoing edges
-        // and filtering those out which have targetNode == nodeToRemove
-        for (auto& nodeEntry : m_nodeOutgoingEdges)
+        const NodeIndex nodeIndex = getNodeIndex(nodeToRemove);
+        NodeData& nodeData = m_nodes[nodeIndex];
+
+        // Remove the edges from the edge lists of the nodes on the other side
+        for (const Edge& incomingEdge : nodeData.incomingEdges)
         {
-            // skip nodeToRemove, it can not have edges to itself
-            if (nodeEntry.first != &nodeToRemove)
-            {
-                EdgeList& otherNodeOutgoingEdges = nodeEntry.second;
+            RemoveEdge(m_nodes[incomingEdge.nodeIndex].outgoingEdges, nodeIndex);
+        }
+        for (const Edge& outgoingEdge : nodeData.outgoingEdges)
+        {
+            RemoveEdge(m_nodes[outgoingEdge.nodeIndex].incomingEdges, nodeIndex);
+        }
+
+        // Removing a node never invalidates the order of the other nodes, leave a gap
+        assert(m_order[nodeData.rank] == nodeIndex);
+        m_order[nodeData.rank] = NoNode;
+        ++m_orderGaps;
+
+        // Keep the capacity of the edge lists for the next node which gets this index
+        nodeData.node = nullptr;
+        nodeData.outgoingEdges.clear();
+        nodeData.incomingEdges.clear();
+        m_freeNodeIndices.push_back(nodeIndex);
+        --m_nodeCount;
+        nodeToRemove.setGraphIndex(InvalidNodeIndex);
 
-                otherNodeOutgoingEdges.erase(std::remove_if(otherNodeOutgoingEdges.begin(), otherNodeOutgoingEdges.end(), [&nodeToRemove](const Edge& edge)
-                    {
-                        return (edge.target == &nodeToRemove);
-                    }), otherNodeOutgoingEdges.end());
+        m_rerankedNodes.erase(std::remove(m_rerankedNodes.begin(), m_rerankedNodes.end(), &nodeToRemove), m_rerankedNodes.end());
+
+        if (m_orderValid && m_orderGaps > 64u && m_orderGaps > m_order.size() / 2)
+        {
+            compactOrder();
+        }
+    }
+
+    bool DirectedAcyclicGraph::updateTopologicalOrder()
+    {
+        if (!m_orderValid)
+        {
+            std::optional<std::vector<NodeIndex>> sortedNodes = computeTopologicalOrder();
+            if (!sortedNodes)
+            {
+                return false;
             }
+
+            assignRanks(std::move(*sortedNodes));
+            m_orderValid = true;
         }
 
-        // Remove outgoing edges by simply removing the node from m_nodeOutgoingEdges
-        assert(m_nodeOutgoingEdges.find(&nodeToRemove) != m_nodeOutgoingEdges.end());
-        m_nodeOutgoingEdges.erase(&nodeToRemove);
+        return true;
     }
 
-    // This is a slightly exotic sorting algorithm for DAGs
-    // It works based on these general principles:
-    // - Traverse the DAG starting from the root nodes
-    // - Keep the nodes in a sparsely sorted queue (with more slots than actual nodes, and some empty slots)
-    // - Any time a new 'edge' is traversed, moves the 'target' node of the edge to the last position of the queue
-    // - If number of iterations exceeds N^2, there was a loop in the graph -> abort
-    // This is supposed to work fast, because the queue is never re-allocated or re-sorted, only grows incrementally, and
-    // we only need to run a second time and remove the 'empty slots' to get the final order.
-    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes() const
+    bool DirectedAcyclicGraph::isTopologicalOrderValid() const
     {
-        const size_t totalNodeCount = m_nodeOutgoingEdges.size();
+        return m_orderValid;
+    }
 
-        // This remembers temporarily the position of node N in 'nodeQueue' (see below)
-        // This index can change in different loops of the code below
-        std::unordered_map<const Node*, size_t> nodeIndexIntoQueue;
-        nodeIndexIntoQueue.reserve(totalNodeCount);
+    size_t DirectedAcyclicGraph::getTopologicalRank(const Node& node) const
+    {
+        return m_nodes[getNodeIndex(node)].rank;
+    }
 
-        // This is a queue of nodes which is:
-        // - partially sorted (at any given time during the loops, the first X entries are sorted, while the rest is not sorted yet)
-        // - sparse (some entries can be nullptr) - of nodes which were moved during the algorithm, see below
-        // - sorted at the end of the loop (by their topological rank)
-        // - starts with the root nodes (they are always at the beginning)
-        NodeVector sparseNodeQueue = collectRootNodes();
+    NodeVector DirectedAcyclicGraph::takeRerankedNodes()
+    {
+        NodeVector rerankedNodes;
+        rerankedNodes.swap(m_rerankedNodes);
+        return rerankedNodes;
+    }
 
-        // Cycle condition - can't find root nodes among a non-empty set of nodes
-        if (sparseNodeQueue.empty() && !m_nodeOutgoingEdges.empty())
+    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes()
+    {
+        if (!updateTopologicalOrder())
         {
             return std::nullopt;
         }
 
-        // sparseNodeQueue grows here all the time
-        // TODO Violin rework algorithm to not grow and loop over the same container
-        for (size_t i = 0; i < sparseNodeQueue.size(); ++i)
+        NodeVector sortedNodes;
+        sortedNodes.reserve(m_nodeCount);
+        for (NodeIndex nodeIndex : m_order)
+        {
+            if (nodeIndex != NoNode)
+            {
+                sortedNodes.push_back(m_nodes[nodeIndex].node);
+            }
+        }
+        return sortedNodes;
+    }
+
+    // Kahn's algorithm, O(V+E). Starts with the root nodes in the order of their current rank, so that unrelated
+    // nodes keep their relative order. Nodes of a cycle (and nodes only reachable over a cycle) never run out of
+    // incoming edges and are never sorted. Only needed to recover after a cycle, otherwise the order is maintained incrementally
+    std::optional<std::vector<DirectedAcyclicGraph::NodeIndex>> DirectedAcyclicGraph::computeTopologicalOrder() const
+    {
+        std::vector<size_t> remainingInDegree(m_nodes.size(), 0u);
+
+        std::vector<NodeIndex> sortedNodes;
+        sortedNodes.reserve(m_nodeCount);
+
+        for (NodeIndex nodeIndex : m_order)
         {
-            if (i > totalNodeCount * totalNodeCount)
+            if (nodeIndex == NoNode)
             {
-                // TODO Violin this is a primitive loop detection. Replace with a proper graph-based solution!
-                // The inner and the outer loop are bound by N(number of nodes), so exceeding that is a
-                // sufficient condition that there was a loop
-                return std::nullopt;
+                continue;
             }
 
-            // Get the next node in the queue and process based on its outgoing edges
-            Node* nextNode = sparseNodeQueue[i];
-            // sparseNodeQueue has nullptr holes - skip those
-            if (nextNode != nullptr)
+            remainingInDegree[nodeIndex] = m_nodes[nodeIndex].incomingEdges.size();
+            if (remainingInDegree[nodeIndex] == 0u)
             {
-                const EdgeList& nextNodeEdges = m_nodeOutgoingEdges.find(nextNode)->second;
+                sortedNodes.push_back(nodeIndex);
+            }
+        }
 
-                // For each edge, put the 'target' node to the end of the queue (this order may be temporarily wrong,
-                // because we don't know if those nodes have also edges between them which would affect this order)
-                // What happens if it's wrong? see the if() inside the loop
-                for (const auto& outgoingEdge : nextNodeEdges)
+        // sortedNodes is the queue of the algorithm at the same time
+        for (size_t i = 0; i < sortedNodes.size(); ++i)
+        {
+            for (const Edge& outgoingEdge : m_nodes[sortedNodes[i]].outgoingEdges)
+            {
+                if (--remainingInDegree[outgoingEdge.nodeIndex] == 0u)
                 {
-                    // Put the node at the end of the 'sparseNodeQueue' and remember the index
-                    Node* outgoingEdgeTarget = outgoingEdge.target;
-                    sparseNodeQueue.emplace_back(outgoingEdgeTarget);
-                    const size_t targetNodeIndex = sparseNodeQueue.size() - 1;
-
-                    const auto potentiallyAlreadyProcessedNode = nodeIndexIntoQueue.find(outgoingEdgeTarget);
-                    // target node not processed yet?
-                    if (potentiallyAlreadyProcessedNode == nodeIndexIntoQueue.end())
-                    {
-                        // => insert to processed queue, with current index from 'queue'
-                        nodeIndexIntoQueue.insert({ outgoingEdgeTarget, targetNodeIndex });
-                    }
-                    // target node processed already?
-                    else
-                    {
-                        // => move the node from its last computed index to the current one
-                        // (and set to nullptr on its last position so that it does not occur twice in the queue)
-                        // Why do we do this? Because it makes sure that any time there is a 'new edge' to a node,
-                        // it is moved to the last position in the queue, unless it has no 'incoming edges' (root node)
-                        // or it has exactly one incoming edge (and never needs to be re-sorted)
-                        sparseNodeQueue[potentiallyAlreadyProcessedNode->second] = nullptr;
-                        potentiallyAlreadyProcessedNode->second = targetNodeIndex;
-                    }
+                    sortedNodes.push_back(outgoingEdge.nodeIndex);
                 }
             }
         }
 
-        NodeVector topologicallySortedNodes;
-        topologicallySortedNodes.reserve(totalNodeCount);
-        for (auto sortedNode : sparseNodeQueue)
+        if (sortedNodes.size() != m_nodeCount)
         {
-            // Some nodes are nullptr because of the special 'bubble sort' sorting method
-            if (sortedNode != nullptr)
+            return std::nullopt;
+        }
+
+        return sortedNodes;
+    }
+
+    // Iterative DFS, remembers the parent of each visited node to reconstruct the path. While the order is valid,
+    // only nodes with rank between the ranks of 'from' and 'to' can be on the path
+    NodeVector DirectedAcyclicGraph::findPath(const Node& from, const Node& to)
+    {
+        const NodeIndex fromIndex = getNodeIndex(from);
+        const NodeIndex toIndex = getNodeIndex(to);
+        const size_t targetRank = m_nodes[toIndex].rank;
+        if (m_orderValid && m_nodes[fromIndex].rank > targetRank)
+        {
+            return {};
+        }
+        const size_t rankBound = m_orderValid ? targetRank : std::numeric_limits<size_t>::max();
+
+        ++m_visitEpoch;
+        m_nodeStack.clear();
+        m_nodeStack.push_back(fromIndex);
+        m_nodes[fromIndex].visitEpoch = m_visitEpoch;
+        m_nodes[fromIndex].visitParent = NoNode;
+
+        while (!m_nodeStack.empty())
+        {
+            const NodeIndex nodeIndex = m_nodeStack.back();
+            m_nodeStack.pop_back();
+
+            if (nodeIndex == toIndex)
             {
-                topologicallySortedNodes.emplace_back(sortedNode);
+                NodeVector path;
+                for (NodeIndex pathNode = nodeIndex; pathNode != NoNode; pathNode = m_nodes[pathNode].visitParent)
+                {
+                    path.push_back(m_nodes[pathNode].node);
+                }
+                std::reverse(path.begin(), path.end());
+                return path;
+            }
+
+            for (const Edge& edge : m_nodes[nodeIndex].outgoingEdges)
+            {
+                NodeData& targetData = m_nodes[edge.nodeIndex];
+                if (targetData.visitEpoch != m_visitEpoch && targetData.rank <= rankBound)
+                {
+                    targetData.visitEpoch = m_visitEpoch;
+                    targetData.visitParent = nodeIndex;
+                    m_nodeStack.push_back(edge.nodeIndex);
+                }
             }
         }
 
-        return topologicallySortedNodes;
+        return {};
+    }
+
+    std::optional<NodeVector> DirectedAcyclicGraph::collectUpstreamNodes(const Node& target)
+    {
+        if (!updateTopologicalOrder())
+        {
+            return std::nullopt;
+        }
+
+        const NodeIndex targetIndex = getNodeIndex(target);
+        ++m_visitEpoch;
+        m_nodeStack.clear();
+        m_nodeStack.push_back(targetIndex);
+        m_nodes[targetIndex].visitEpoch = m_visitEpoch;
+
+        std::vector<NodeIndex> upstreamNodes;
+        while (!m_nodeStack.empty())
+        {
+            const NodeIndex nodeIndex = m_nodeStack.back();
+            m_nodeStack.pop_back();
+            upstreamNodes.push_back(nodeIndex);
+
+            for (const Edge& edge : m_nodes[nodeIndex].incomingEdges)
+            {
+                NodeData& sourceData = m_nodes[edge.nodeIndex];
+                if (sourceData.visitEpoch != m_visitEpoch)
+                {
+                    sourceData.visitEpoch = m_visitEpoch;
+                    m_nodeStack.push_back(edge.nodeIndex);
+                }
+            }
+        }
+
+        std::sort(upstreamNodes.begin(), upstreamNodes.end(), [this](NodeIndex lhs, NodeIndex rhs) { return m_nodes[lhs].rank < m_nodes[rhs].rank; });
+
+        NodeVector sortedNodes;
+        sortedNodes.reserve(upstreamNodes.size());
+        for (NodeIndex nodeIndex : upstreamNodes)
+        {
+            sortedNodes.push_back(m_nodes[nodeIndex].node);
+        }
+        return sortedNodes;
+    }
+
+    const DirectedAcyclicGraph::EdgeList& DirectedAcyclicGraph::getOutgoingEdges(const Node& node) const
+    {
+        return m_nodes[getNodeIndex(node)].outgoingEdges;
+    }
+
+    const DirectedAcyclicGraph::EdgeList& DirectedAcyclicGraph::getIncomingEdges(const Node& node) const
+    {
+        return m_nodes[getNodeIndex(node)].incomingEdges;
     }
 
     bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
     {
-        auto nodeEdges = m_nodeOutgoingEdges.find(&source);
-        assert (nodeEdges != m_nodeOutgoingEdges.end());
+        const NodeIndex sourceIndex = getNodeIndex(source);
+        const NodeIndex targetIndex = getNodeIndex(target);
+        EdgeList& sourceEdges = m_nodes[sourceIndex].outgoingEdges;
+        EdgeList& targetEdges = m_nodes[targetIndex].incomingEdges;
 
-        auto outgoingEdgeIter = std::find_if(nodeEdges->second.begin(), nodeEdges->second.end(), [&target](const Edge& edge) {
-            return &target == edge.target;
+        auto outgoingEdgeIter = std::find_if(sourceEdges.begin(), sourceEdges.end(), [targetIndex](const Edge& edge) {
+            return edge.nodeIndex == targetIndex;
         });
 
-        // Did not find outgoing edge to target node? Create one, with weight 0 (will be increased to one in next step)
-        bool isNewEdge = false;
-        if (outgoingEdgeIter == nodeEdges->second.end())
+        // Did not find outgoing edge to target node? Create one, with weight 1
+        if (outgoingEdgeIter == sourceEdges.end())
         {
-            nodeEdges->second.push_back({ &target, 0 });
-            outgoingEdgeIter = std::prev(nodeEdges->second.end());
-            isNewEdge = true;
+            sourceEdges.push_back({ &target, targetIndex, 1u });
+            targetEdges.push_back({ &source, sourceIndex, 1u });
+
+            // Only edges which point "backwards" in the current order require reordering
+            if (m_orderValid && m_nodes[sourceIndex].rank > m_nodes[targetIndex].rank && !reorderForNewEdge(sourceIndex, targetIndex))
+            {
+                m_orderValid = false;
+            }
+            return true;
         }
 
         // Increase weight (we have one more link between these two nodes)
+        auto incomingEdgeIter = std::find_if(targetEdges.begin(), targetEdges.end(), [sourceIndex](const Edge& edge) {
+            return edge.nodeIndex == sourceIndex;
+        });
+        assert(incomingEdgeIter != targetEdges.end());
         outgoingEdgeIter->multiplicity++;
-        return isNewEdge;
+        incomingEdgeIter->multiplicity++;
+        return false;
     }
 
-    void DirectedAcyclicGraph::removeEdge(Node& source, const Node& target)
+    bool DirectedAcyclicGraph::removeEdge(Node& source, const Node& target)
     {
-        const auto srcNodeEdges = m_nodeOutgoingEdges.find(&source);
-        assert (srcNodeEdges != m_nodeOutgoingEdges.end());
-        const auto outgoingEdge = std::find_if(srcNodeEdges->second.begin(), srcNodeEdges->second.end(), [&target](const Edge& edge) {
-            return &target == edge.target;
+        const NodeIndex sourceIndex = getNodeIndex(source);
+        const NodeIndex targetIndex = getNodeIndex(target);
+        EdgeList& sourceEdges = m_nodes[sourceIndex].outgoingEdges;
+        EdgeList& targetEdges = m_nodes[targetIndex].incomingEdges;
+
+        const auto outgoingEdge = std::find_if(sourceEdges.begin(), sourceEdges.end(), [targetIndex](const Edge& edge) {
+            return edge.nodeIndex == targetIndex;
+        });
+        const auto incomingEdge = std::find_if(targetEdges.begin(), targetEdges.end(), [sourceIndex](const Edge& edge) {
+            return edge.nodeIndex == sourceIndex;
         });
 
-        assert (outgoingEdge != srcNodeEdges->second.end());
+        assert(outgoingEdge != sourceEdges.end());
+        assert(incomingEdge != targetEdges.end());
         assert(outgoingEdge->multiplicity > 0);
         outgoingEdge->multiplicity--;
-        if (outgoingEdge->multiplicity == 0)
+        incomingEdge->multiplicity--;
+        if (outgoingEdge->multiplicity > 0)
         {
-            srcNodeEdges->second.erase(outgoingEdge);
+            return false;
         }
-    }
 
-    size_t DirectedAcyclicGraph::getInDegree(Node& node) const
-    {
-        // "reduces" (sums up in arbitrary order) outgoing edges of node
-        // TODO Violin This can be done much simpler with a standard adjacency matrix, if we redesign the class a bit more
-        return std::accumulate(m_nodeOutgoingEdges.begin(), m_nodeOutgoingEdges.end(), size_t(0u),
-            [&node](size_t sum, const std::pair<Node*, EdgeList>& edgeList)
-            {
-                auto potentialLinkToNode = std::find_if(edgeList.second.begin(), edgeList.second.end(), [&node](const Edge& edge){return edge.target == &node;});
-                if (potentialLinkToNode != edgeList.second.end())
-                {
-                    sum += potentialLinkToNode->multiplicity;
-                }
+        sourceEdges.erase(outgoingEdge);
+        targetEdges.erase(incomingEdge);
 
-                return sum;
-            });
+        // Removing edges never invalidates a valid order. An invalid order is recomputed on demand, it's not
+        // known here if the removed edge was part of the cycle
+        return true;
     }
 
-    size_t DirectedAcyclicGraph::getOutDegree(Node& node) const
+    // Pearce-Kelly reordering after adding the edge source -> target with rank(target) < rank(source):
+    // - collect the nodes reachable from target with rank < rank(source) (forward set)
+    // - collect the nodes which reach source with rank > rank(target) (backward set)
+    // - reassign the ranks occupied by both sets, backward set first, keeping the relative order inside each set
+    // All other nodes keep their rank. Returns false if the edge closes a cycle (source is reachable from target)
+    bool DirectedAcyclicGraph::reorderForNewEdge(NodeIndex source, NodeIndex target)
     {
-        const auto nodeOutgoingEdges = m_nodeOutgoingEdges.find(&node);
-        assert(nodeOutgoingEdges != m_nodeOutgoingEdges.end());
-        // sums up outgoing edge count to other nodes
-        return std::accumulate(nodeOutgoingEdges->second.begin(), nodeOutgoingEdges->second.end(), size_t(0u),
-            [](size_t sum, const Edge& edge)
-            {
-                return sum + edge.multiplicity;
-            });
-    }
+        const size_t lowerBound = m_nodes[target].rank;
+        const size_t upperBound = m_nodes[source].rank;
 
-    NodeVector DirectedAcyclicGraph::collectRootNodes() const
-    {
-        // Outgoing edges has size == number of nodes in the graph
-        const size_t nodeCount = m_nodeOutgoingEdges.size();
+        ++m_visitEpoch;
+        collectReachableNodes(target, upperBound, true, m_forwardNodes);
+        if (m_nodes[source].visitEpoch == m_visitEpoch)
+        {
+            return false;
+        }
+        collectReachableNodes(source, lowerBound, false, m_backwardNodes);
 
-        NodeVector rootNodes;
-        rootNodes.reserve(nodeCount);
+        const auto hasLowerRank = [this](NodeIndex lhs, NodeIndex rhs) { return m_nodes[lhs].rank < m_nodes[rhs].rank; };
+        std::sort(m_forwardNodes.begin(), m_forwardNodes.end(), hasLowerRank);
+        std::sort(m_backwardNodes.begin(), m_backwardNodes.end(), hasLowerRank);
 
-        std::unordered_set<Node*> nodesWithIncomingEdges;
-        nodesWithIncomingEdges.reserve(nodeCount);
+        m_freeRanks.clear();
+        for (NodeIndex nodeIndex : m_backwardNodes)
+        {
+            m_freeRanks.push_back(m_nodes[nodeIndex].rank);
+        }
+        for (NodeIndex nodeIndex : m_forwardNodes)
+        {
+            m_freeRanks.push_back(m_nodes[nodeIndex].rank);
+        }
+        std::inplace_merge(m_freeRanks.begin(), m_freeRanks.begin() + static_cast<std::ptrdiff_t>(m_backwardNodes.size()), m_freeRanks.end());
 
-        for (auto& outgoingEdgesOfNode : m_nodeOutgoingEdges)
+        size_t freeRankIndex = 0u;
+        for (const std::vector<NodeIndex>* reorderedNodes : {&m_backwardNodes, &m_forwardNodes})
         {
-            for (auto& outgoineEdge : outgoingEdgesOfNode.second)
+            for (NodeIndex nodeIndex : *reorderedNodes)
             {
-                nodesWithIncomingEdges.insert(outgoineEdge.target);
+                const size_t rank = m_freeRanks[freeRankIndex++];
+                m_nodes[nodeIndex].rank = rank;
+                m_order[rank] = nodeIndex;
+                m_rerankedNodes.push_back(m_nodes[nodeIndex].node);
             }
         }
 
-        for (auto& nodeEntry : m_nodeOutgoingEdges)
+        return true;
+    }
+
+    // Iterative DFS, marks visited nodes with the current visit epoch. Forward search follows outgoing edges to nodes
+    // with rank <= rankBound (stops early if it reaches the node with rankBound), backward search follows incoming
+    // edges to nodes with rank > rankBound
+    void DirectedAcyclicGraph::collectReachableNodes(NodeIndex start, size_t rankBound, bool forward, std::vector<NodeIndex>& reachableNodes)
+    {
+        reachableNodes.clear();
+        m_nodeStack.clear();
+        m_nodeStack.push_back(start);
+        m_nodes[start].visitEpoch = m_visitEpoch;
+
+        while (!m_nodeStack.empty())
         {
-            Node* node = nodeEntry.first;
-            if (nodesWithIncomingEdges.end() == nodesWithIncomingEdges.find(node))
+            const NodeIndex nodeIndex = m_nodeStack.back();
+            m_nodeStack.pop_back();
+            reachableNodes.push_back(nodeIndex);
+
+            const NodeData& nodeData = m_nodes[nodeIndex];
+            if (forward && nodeData.rank == rankBound)
             {
-                rootNodes.emplace_back(node);
+                // Reached the source of the new edge -> cycle, no need to search further
+                return;
+            }
+
+            for (const Edge& edge : (forward ? nodeData.outgoingEdges : nodeData.incomingEdges))
+            {
+                NodeData& otherNodeData = m_nodes[edge.nodeIndex];
+                const bool inBounds = forward ? (otherNodeData.rank <= rankBound) : (otherNodeData.rank > rankBound);
+                if (otherNodeData.visitEpoch != m_visitEpoch && inBounds)
+                {
+                    otherNodeData.visitEpoch = m_visitEpoch;
+                    m_nodeStack.push_back(edge.nodeIndex);
+                }
             }
         }
+    }
+
+    void DirectedAcyclicGraph::assignRanks(std::vector<NodeIndex> sortedNodes)
+    {
+        m_order = std::move(sortedNodes);
+        m_orderGaps = 0u;
+        for (size_t i = 0; i < m_order.size(); ++i)
+        {
+            NodeData& nodeData = m_nodes[m_order[i]];
+            nodeData.rank = i;
+            m_rerankedNodes.push_back(nodeData.node);
+        }
+    }
+
+    void DirectedAcyclicGraph::compactOrder()
+    {
+        std::vector<NodeIndex> compactedOrder;
+        compactedOrder.reserve(m_nodeCount);
+        std::copy_if(m_order.begin(), m_order.end(), std::back_inserter(compactedOrder), [](NodeIndex nodeIndex) { return nodeIndex != NoNode; });
+        assignRanks(std::move(compactedOrder));
+    }
 
-        return rootNodes;
+    void DirectedAcyclicGraph::RemoveEdge(EdgeList& edges, NodeIndex nodeIndex)
+    {
+        const auto edge = std::find_if(edges.begin(), edges.end(), [nodeIndex](const Edge& e) { return e.nodeIndex == nodeIndex; });
+        assert(edge != edges.end());
+        edges.erase(edge);
+    }
+
+    size_t DirectedAcyclicGraph::getInDegree(const Node& node) const
+    {
+        const EdgeList& incomingEdges = m_nodes[getNodeIndex(node)].incomingEdges;
+        // sums up incoming edge count from other nodes
+        return std::accumulate(incomingEdges.begin(), incomingEdges.end(), size_t(0u),
+            [](size_t sum, const Edge& edge)
+            {
+                return sum + edge.multiplicity;
+            });
+    }
+
+    size_t DirectedAcyclicGraph::getOutDegree(const Node& node) const
+    {
+        const EdgeList& outgoingEdges = m_nodes[getNodeIndex(node)].outgoingEdges;
+        // sums up outgoing edge count to other nodes
+        return std::accumulate(outgoingEdges.begin(), outgoingEdges.end(), size_t(0u),
+            [](size_t sum, const Edge& edge)
+            {
+                return sum + edge.multiplicity;
+            });
     }
 
-    bool DirectedAcyclicGraph::containsNode(Node& node) const
+    bool DirectedAcyclicGraph::containsNode(const Node& node) const
     {
-        return m_nodeOutgoingEdges.find(&node) != m_nodeOutgoingEdges.end();
+        const size_t nodeIndex = node.getGraphIndex();
+        return nodeIndex < m_nodes.size() && m_nodes[nodeIndex].node == &node;
     }
 
+    DirectedAcyclicGraph::NodeIndex DirectedAcyclicGraph::getNodeIndex(const Node& node) const
+    {
+        assert(containsNode(node));
+        return static_cast<NodeIndex>(node.getGraphIndex());
+    }
 }
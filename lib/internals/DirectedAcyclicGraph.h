@@ -10,13 +10,13 @@
 
 #include <vector>
 #include <optional>
-#include <unordered_map>
 #include <cstdint>
+#include <limits>
 
 namespace rlogic::internal
 {
-    // We don't depend on any functionality of LogicNodeImpl here, just using the
-    // pointer as a unique identifier of the node
+    // The graph only uses the graph index of LogicNodeImpl (see LogicNodeImpl::getGraphIndex()) to find
+    // the data of a node, and the pointer as a unique identifier of the node
     class LogicNodeImpl;
 
     // TODO narrow down the scope of this typedef
@@ -30,42 +30,100 @@ namespace rlogic::internal
     // number of total links of node properties to other nodes' properties, i.e. if two nodes A and B have three connected
     // properties, and node A and C have two connected properties, then addEdge(A, B) will have been called 3 times,
     // addEdge(A, C) two times, and A will have outDegree=5.
-    // Topological sort result is cached because it's sensitive for performance (and is only
-    // executed once before update()
+    // Nodes get a dense index when they are added, indices of removed nodes are recycled. All node data (edges in both
+    // directions, rank) is stored in a vector by that index, so that no lookup needs hashing and removing a node costs
+    // only as much as it has edges.
+    // The topological order is maintained incrementally (Pearce-Kelly): every node has a rank, and adding an edge
+    // which contradicts the ranks only reorders the nodes between source and target rank which are reachable from
+    // the target or reach the source, instead of sorting the whole graph again. If an edge creates a cycle, the order
+    // is invalidated and recomputed from scratch once the cycle is resolved (see updateTopologicalOrder())
     class DirectedAcyclicGraph
     {
     private:
         // Mask the LogicNodeImpl type as Node for easier readability inside the class
         using Node = LogicNodeImpl;
+        using NodeIndex = uint32_t;
     public:
+        struct Edge
+        {
+            // The node on the other end of the edge (target of outgoing edges, source of incoming edges)
+            Node* node;
+            NodeIndex nodeIndex;
+            // A "ref count" which remembers how many times addEdge() was called on a pair of nodes
+            uint32_t multiplicity;
+        };
+
+        using EdgeList = std::vector<Edge>;
+
         void addNode(Node& node);
         void removeNode(Node& node);
-        [[nodiscard]] bool containsNode(Node& node) const;
+        [[nodiscard]] bool containsNode(const Node& node) const;
 
+        // Returns true if this is the first edge between the two nodes
         bool addEdge(Node& source, Node& target);
-        void removeEdge(Node& source, const Node& target);
+        // Returns true if this was the last edge between the two nodes
+        bool removeEdge(Node& source, const Node& target);
 
-        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        // Recomputes the order if it was invalidated by a cycle, returns false if the graph still has a cycle
+        [[nodiscard]] bool updateTopologicalOrder();
+        [[nodiscard]] bool isTopologicalOrderValid() const;
+        // Rank of the node in the topological order, only valid if updateTopologicalOrder() succeeded.
+        // Ranks are not dense, removed nodes leave gaps
+        [[nodiscard]] size_t getTopologicalRank(const Node& node) const;
+        // Nodes whose rank changed since the last call (can contain duplicates)
+        [[nodiscard]] NodeVector takeRerankedNodes();
+
+        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes();
+        // Nodes of a path of edges from 'from' to 'to' (both included), empty if 'to' is not reachable from 'from'
+        [[nodiscard]] NodeVector findPath(const Node& from, const Node& to);
+        // The node and all nodes it is reachable from, in topological order. std::nullopt if the graph has a cycle
+        [[nodiscard]] std::optional<NodeVector> collectUpstreamNodes(const Node& target);
+        [[nodiscard]] const EdgeList& getOutgoingEdges(const Node& node) const;
+        [[nodiscard]] const EdgeList& getIncomingEdges(const Node& node) const;
 
         // For testing only
-        size_t getInDegree(Node& node) const;
-        size_t getOutDegree(Node& node) const;
+        size_t getInDegree(const Node& node) const;
+        size_t getOutDegree(const Node& node) const;
 
     private:
-        struct Edge
+        static constexpr NodeIndex NoNode = std::numeric_limits<NodeIndex>::max();
+
+        struct NodeData
         {
-            Node* target;
-            // A "ref count" which remembers how many times addEdge() was called on a pair of nodes
-            size_t multiplicity;
+            // nullptr for unused slots (in the free list)
+            Node* node = nullptr;
+            EdgeList outgoingEdges;
+            // Mirrors the outgoing edges of the source nodes, including their multiplicity
+            EdgeList incomingEdges;
+            size_t rank = 0u;
+            size_t visitEpoch = 0u;
+            NodeIndex visitParent = NoNode;
         };
 
-        using EdgeList = std::vector<Edge>;
+        [[nodiscard]] NodeIndex getNodeIndex(const Node& node) const;
+        [[nodiscard]] bool reorderForNewEdge(NodeIndex source, NodeIndex target);
+        void collectReachableNodes(NodeIndex start, size_t rankBound, bool forward, std::vector<NodeIndex>& reachableNodes);
+        [[nodiscard]] std::optional<std::vector<NodeIndex>> computeTopologicalOrder() const;
+        void assignRanks(std::vector<NodeIndex> sortedNodes);
+        void compactOrder();
+        static void RemoveEdge(EdgeList& edges, NodeIndex nodeIndex);
+
+        std::vector<NodeData> m_nodes;
+        std::vector<NodeIndex> m_freeNodeIndices;
+        size_t m_nodeCount = 0u;
 
-        std::vector<Node*> collectRootNodes() const;
+        // Node indices by rank, removed nodes leave NoNode gaps which are compacted when they accumulate
+        std::vector<NodeIndex> m_order;
+        size_t m_orderGaps = 0u;
+        // False after an edge closed a cycle, until the order is recomputed successfully
+        bool m_orderValid = true;
 
-        // Stores both nodes and their edges in one hashmap
-        // If a node has no outgoing links, the 'EdgeList' is empty
-        // Each entry in 'EdgeList' represents an edge to another node
-        std::unordered_map<Node*, EdgeList> m_nodeOutgoingEdges;
+        NodeVector m_rerankedNodes;
+        size_t m_visitEpoch = 0u;
+        // Scratch containers of reorderForNewEdge(), kept to avoid allocations
+        std::vector<NodeIndex> m_forwardNodes;
+        std::vector<NodeIndex> m_backwardNodes;
+        std::vector<NodeIndex> m_nodeStack;
+        std::vector<size_t> m_freeRanks;
     };
 }
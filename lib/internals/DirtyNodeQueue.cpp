@@ -0,0 +1,154 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/DirtyNodeQueue.h"
+
+#include "impl/LogicNodeImpl.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // std heap algorithms build a max-heap, invert the comparison to get the lowest level (and rank within the level) on top
+        bool HasHigherRank(const LogicNodeImpl* lhs, const LogicNodeImpl* rhs)
+        {
+            if (lhs->getTopologicalLevel() != rhs->getTopologicalLevel())
+            {
+                return lhs->getTopologicalLevel() > rhs->getTopologicalLevel();
+            }
+            return lhs->getTopologicalRank() > rhs->getTopologicalRank();
+        }
+    }
+
+    void DirtyNodeQueue::push(LogicNodeImpl& node)
+    {
+        // Every node is queued at most once
+        if (node.getDirtyNodeQueuePosition() != InvalidNodeIndex)
+        {
+            return;
+        }
+
+        m_heap.push_back(&node);
+        node.setDirtyNodeQueuePosition(m_heap.size() - 1);
+        siftUp(m_heap.size() - 1);
+    }
+
+    void DirtyNodeQueue::pop()
+    {
+        assert(!m_heap.empty());
+        removeAt(0u);
+    }
+
+    LogicNodeImpl& DirtyNodeQueue::top() const
+    {
+        assert(!m_heap.empty());
+        return *m_heap.front();
+    }
+
+    bool DirtyNodeQueue::empty() const
+    {
+        return m_heap.empty();
+    }
+
+    size_t DirtyNodeQueue::size() const
+    {
+        return m_heap.size();
+    }
+
+    void DirtyNodeQueue::remove(LogicNodeImpl& node)
+    {
+        const size_t position = node.getDirtyNodeQueuePosition();
+        if (position != InvalidNodeIndex)
+        {
+            assert(m_heap[position] == &node);
+            removeAt(position);
+        }
+    }
+
+    void DirtyNodeQueue::reorder()
+    {
+        std::make_heap(m_heap.begin(), m_heap.end(), HasHigherRank);
+        for (size_t i = 0; i < m_heap.size(); ++i)
+        {
+            m_heap[i]->setDirtyNodeQueuePosition(i);
+        }
+    }
+
+    void DirtyNodeQueue::clear()
+    {
+        for (LogicNodeImpl* node : m_heap)
+        {
+            node->setDirtyNodeQueuePosition(InvalidNodeIndex);
+        }
+        m_heap.clear();
+    }
+
+    void DirtyNodeQueue::removeAt(size_t position)
+    {
+        m_heap[position]->setDirtyNodeQueuePosition(InvalidNodeIndex);
+
+        // Fill the gap with the last node and move it to its place in the heap
+        LogicNodeImpl* lastNode = m_heap.back();
+        m_heap.pop_back();
+        if (position < m_heap.size())
+        {
+            m_heap[position] = lastNode;
+            lastNode->setDirtyNodeQueuePosition(position);
+            siftDown(siftUp(position));
+        }
+    }
+
+    size_t DirtyNodeQueue::siftUp(size_t position)
+    {
+        while (position > 0u)
+        {
+            const size_t parent = (position - 1u) / 2u;
+            if (!HasHigherRank(m_heap[parent], m_heap[position]))
+            {
+                break;
+            }
+            swapNodes(parent, position);
+            position = parent;
+        }
+        return position;
+    }
+
+    void DirtyNodeQueue::siftDown(size_t position)
+    {
+        while (true)
+        {
+            const size_t left = 2u * position + 1u;
+            const size_t right = left + 1u;
+            size_t lowest = position;
+            if (left < m_heap.size() && HasHigherRank(m_heap[lowest], m_heap[left]))
+            {
+                lowest = left;
+            }
+            if (right < m_heap.size() && HasHigherRank(m_heap[lowest], m_heap[right]))
+            {
+                lowest = right;
+            }
+            if (lowest == position)
+            {
+                return;
+            }
+            swapNodes(position, lowest);
+            position = lowest;
+        }
+    }
+
+    void DirtyNodeQueue::swapNodes(size_t lhs, size_t rhs)
+    {
+        std::swap(m_heap[lhs], m_heap[rhs]);
+        m_heap[lhs]->setDirtyNodeQueuePosition(lhs);
+        m_heap[rhs]->setDirtyNodeQueuePosition(rhs);
+    }
+}
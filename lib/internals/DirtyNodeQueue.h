@@ -0,0 +1,49 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    class LogicNodeImpl;
+
+    // Priority queue of dirty logic nodes, ordered by their topological level and rank (lowest first). Grouping by
+    // level keeps the order valid (links always point to a higher level) and puts nodes which can't depend on each
+    // other next to each other.
+    // Nodes push themselves when they become dirty, so that update() only has to visit the nodes
+    // which actually need execution instead of checking every node of the graph.
+    // Each node is queued at most once and knows its position in the heap, so that removing a node costs O(log N).
+    // The queue can contain stale entries (nodes which were cleaned by other means) - users are expected to skip
+    // nodes which are not dirty any more when popping them.
+    class DirtyNodeQueue
+    {
+    public:
+        void push(LogicNodeImpl& node);
+        void pop();
+        [[nodiscard]] LogicNodeImpl& top() const;
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] size_t size() const;
+
+        // Removes the node if it's queued, e.g. when it is destroyed
+        void remove(LogicNodeImpl& node);
+        // Must be called when the topological rank or level of nodes changed
+        void reorder();
+        void clear();
+
+    private:
+        void removeAt(size_t position);
+        size_t siftUp(size_t position);
+        void siftDown(size_t position);
+        void swapNodes(size_t lhs, size_t rhs);
+
+        std::vector<LogicNodeImpl*> m_heap;
+    };
+}
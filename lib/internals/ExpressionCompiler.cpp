@@ -0,0 +1,950 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ExpressionCompiler.h"
+#include "internals/ErrorReporting.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        enum class ETokenType
+        {
+            Identifier,
+            Integer,
+            Number,
+            Symbol,
+            End
+        };
+
+        struct Token
+        {
+            ETokenType type;
+            std::string text;
+            size_t line;
+        };
+
+        // Thrown by the tokenizer and the parser, reported as error by ExpressionCompiler::Compile()
+        class ExpressionError : public std::runtime_error
+        {
+        public:
+            ExpressionError(const std::string& message, size_t line)
+                : std::runtime_error(message)
+                , m_line(line)
+            {
+            }
+
+            [[nodiscard]] size_t getLine() const
+            {
+                return m_line;
+            }
+
+        private:
+            size_t m_line;
+        };
+
+        bool IsIdentifierStart(char c)
+        {
+            return std::isalpha(static_cast<unsigned char>(c)) != 0 || c == '_';
+        }
+
+        bool IsIdentifierChar(char c)
+        {
+            return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+        }
+
+        bool IsDigit(char c)
+        {
+            return std::isdigit(static_cast<unsigned char>(c)) != 0;
+        }
+
+        size_t SkipDigits(std::string_view source, size_t pos)
+        {
+            while (pos < source.size() && IsDigit(source[pos]))
+                ++pos;
+            return pos;
+        }
+
+        std::vector<Token> Tokenize(std::string_view source)
+        {
+            std::vector<Token> tokens;
+            size_t line = 1u;
+            size_t pos = 0u;
+
+            while (pos < source.size())
+            {
+                const char c = source[pos];
+
+                if (c == '\n')
+                {
+                    ++line;
+                    ++pos;
+                }
+                else if (std::isspace(static_cast<unsigned char>(c)) != 0)
+                {
+                    ++pos;
+                }
+                else if (source.substr(pos, 2) == "--")
+                {
+                    pos = std::min(source.find('\n', pos), source.size());
+                }
+                else if (IsIdentifierStart(c))
+                {
+                    const size_t start = pos;
+                    while (pos < source.size() && IsIdentifierChar(source[pos]))
+                        ++pos;
+                    tokens.push_back({ETokenType::Identifier, std::string(source.substr(start, pos - start)), line});
+                }
+                else if (IsDigit(c) || (c == '.' && pos + 1 < source.size() && IsDigit(source[pos + 1])))
+                {
+                    const size_t start = pos;
+                    bool isInteger = true;
+                    pos = SkipDigits(source, pos);
+                    if (pos < source.size() && source[pos] == '.')
+                    {
+                        isInteger = false;
+                        pos = SkipDigits(source, pos + 1);
+                    }
+                    if (pos < source.size() && (source[pos] == 'e' || source[pos] == 'E'))
+                    {
+                        isInteger = false;
+                        ++pos;
+                        if (pos < source.size() && (source[pos] == '+' || source[pos] == '-'))
+                            ++pos;
+                        if (pos == source.size() || !IsDigit(source[pos]))
+                            throw ExpressionError(fmt::format("malformed number near '{}'", source.substr(start, pos - start)), line);
+                        pos = SkipDigits(source, pos);
+                    }
+                    if (pos < source.size() && (IsIdentifierChar(source[pos]) || source[pos] == '.'))
+                        throw ExpressionError(fmt::format("malformed number near '{}'", source.substr(start, pos + 1 - start)), line);
+
+                    tokens.push_back({isInteger ? ETokenType::Integer : ETokenType::Number, std::string(source.substr(start, pos - start)), line});
+                }
+                else
+                {
+                    const std::string_view twoChars = source.substr(pos, 2);
+                    if (twoChars == "==" || twoChars == "~=" || twoChars == "<=" || twoChars == ">=")
+                    {
+                        tokens.push_back({ETokenType::Symbol, std::string(twoChars), line});
+                        pos += 2;
+                    }
+                    else if (std::string_view("+-*/(),.;=<>").find(c) != std::string_view::npos)
+                    {
+                        tokens.push_back({ETokenType::Symbol, std::string(1u, c), line});
+                        ++pos;
+                    }
+                    else
+                    {
+                        throw ExpressionError(fmt::format("unexpected symbol '{}'", c), line);
+                    }
+                }
+            }
+
+            tokens.push_back({ETokenType::End, "<eof>", line});
+            return tokens;
+        }
+
+        // Number of float components, 0 for types which are not float or vector
+        size_t FloatWidth(EPropertyType type)
+        {
+            switch (type)
+            {
+            case EPropertyType::Float:
+                return 1u;
+            case EPropertyType::Vec2f:
+                return 2u;
+            case EPropertyType::Vec3f:
+                return 3u;
+            case EPropertyType::Vec4f:
+                return 4u;
+            case EPropertyType::Int32:
+            case EPropertyType::Int64:
+            case EPropertyType::Vec2i:
+            case EPropertyType::Vec3i:
+            case EPropertyType::Vec4i:
+            case EPropertyType::Struct:
+            case EPropertyType::String:
+            case EPropertyType::Bool:
+            case EPropertyType::Array:
+                return 0u;
+            }
+            return 0u;
+        }
+
+        EPropertyType FloatTypeWithWidth(size_t width)
+        {
+            assert(width >= 1u && width <= 4u);
+            constexpr std::array<EPropertyType, 4> types = { EPropertyType::Float, EPropertyType::Vec2f, EPropertyType::Vec3f, EPropertyType::Vec4f };
+            return types[width - 1u];
+        }
+
+        // Result of an expression: the register which holds the value and its type
+        struct Value
+        {
+            uint16_t reg;
+            EPropertyType type;
+        };
+
+        class ExpressionParser
+        {
+        public:
+            ExpressionParser(std::vector<Token> tokens, ExpressionProgram& program)
+                : m_tokens(std::move(tokens))
+                , m_program(program)
+            {
+                for (size_t i = 0; i < m_program.inputs.size(); ++i)
+                    m_inputIndices.emplace(m_program.inputs[i].name, i);
+            }
+
+            void parseProgram()
+            {
+                if (peek().type == ETokenType::End)
+                    fail("expression must assign at least one output, e.g. 'OUT.x = IN.a'");
+
+                std::unordered_set<std::string> outputNames;
+                while (peek().type != ETokenType::End)
+                {
+                    if (!acceptKeyword("OUT"))
+                        fail(fmt::format("expected assignment to an output ('OUT.name = ...'), got '{}'", peek().text));
+                    expectSymbol(".", "after 'OUT'");
+                    std::string outputName = expectIdentifier("as output name after 'OUT.'");
+                    if (!outputNames.insert(outputName).second)
+                        fail(fmt::format("output '{}' is assigned more than once", outputName));
+                    expectSymbol("=", fmt::format("after 'OUT.{}'", outputName));
+
+                    const Value value = parseOr();
+                    m_program.outputs.emplace_back(std::move(outputName), value.type);
+                    m_program.outputRegisters.push_back(value.reg);
+
+                    while (acceptSymbol(";"))
+                    {
+                    }
+                }
+            }
+
+        private:
+            // Parsing, operators in order of increasing precedence (same as in Lua)
+
+            Value parseOr()
+            {
+                Value lhs = parseAnd();
+                while (acceptKeyword("or"))
+                    lhs = logical(EExpressionOpCode::Or, "or", lhs, parseAnd());
+                return lhs;
+            }
+
+            Value parseAnd()
+            {
+                Value lhs = parseComparison();
+                while (acceptKeyword("and"))
+                    lhs = logical(EExpressionOpCode::And, "and", lhs, parseComparison());
+                return lhs;
+            }
+
+            Value parseComparison()
+            {
+                Value lhs = parseAdditive();
+                while (peekSymbol("<") || peekSymbol("<=") || peekSymbol(">") || peekSymbol(">=") || peekSymbol("==") || peekSymbol("~="))
+                {
+                    const std::string op = next().text;
+                    lhs = compare(op, lhs, parseAdditive());
+                }
+                return lhs;
+            }
+
+            Value parseAdditive()
+            {
+                Value lhs = parseMultiplicative();
+                while (peekSymbol("+") || peekSymbol("-"))
+                {
+                    const std::string op = next().text;
+                    lhs = arithmetic(op, lhs, parseMultiplicative());
+                }
+                return lhs;
+            }
+
+            Value parseMultiplicative()
+            {
+                Value lhs = parseUnary();
+                while (peekSymbol("*") || peekSymbol("/"))
+                {
+                    const std::string op = next().text;
+                    lhs = arithmetic(op, lhs, parseUnary());
+                }
+                return lhs;
+            }
+
+            Value parseUnary()
+            {
+                if (acceptSymbol("-"))
+                {
+                    // Negative literals are constants, not negated at runtime
+                    if (peek().type == ETokenType::Integer)
+                        return constantInt(parseInteger(next(), true));
+                    if (peek().type == ETokenType::Number)
+                        return constantFloat(-parseNumber(next()));
+                    return negate(parseUnary());
+                }
+                if (acceptKeyword("not"))
+                    return logicalNot(parseUnary());
+                return parsePostfix();
+            }
+
+            Value parsePostfix()
+            {
+                Value value = parsePrimary();
+                while (acceptSymbol("."))
+                    value = getComponent(value, expectIdentifier("as vector component after '.'"));
+                return value;
+            }
+
+            Value parsePrimary()
+            {
+                const Token& token = next();
+                switch (token.type)
+                {
+                case ETokenType::Integer:
+                    return constantInt(parseInteger(token, false));
+                case ETokenType::Number:
+                    return constantFloat(parseNumber(token));
+                case ETokenType::Symbol:
+                    if (token.text == "(")
+                    {
+                        const Value value = parseOr();
+                        expectSymbol(")", "to close '('");
+                        return value;
+                    }
+                    throw ExpressionError(fmt::format("unexpected symbol '{}'", token.text), token.line);
+                case ETokenType::End:
+                    throw ExpressionError("unexpected end of expression", token.line);
+                case ETokenType::Identifier:
+                    break;
+                }
+
+                if (token.text == "true" || token.text == "false")
+                {
+                    ExpressionRegister value;
+                    value.i = (token.text == "true") ? 1 : 0;
+                    return constant(EPropertyType::Bool, value);
+                }
+                if (token.text == "IN")
+                {
+                    expectSymbol(".", "after 'IN'");
+                    const std::string inputName = expectIdentifier("as input name after 'IN.'");
+                    const auto inputIter = m_inputIndices.find(inputName);
+                    if (inputIter == m_inputIndices.cend())
+                        fail(fmt::format("unknown input '{}'", inputName));
+                    return Value{static_cast<uint16_t>(inputIter->second), m_program.inputs[inputIter->second].type};
+                }
+                if (token.text == "OUT")
+                    throw ExpressionError("outputs can't be used in expressions, only assigned", token.line);
+                if (token.text == "and" || token.text == "or" || token.text == "not")
+                    throw ExpressionError(fmt::format("unexpected '{}'", token.text), token.line);
+                if (acceptSymbol("("))
+                    return parseCall(token.text);
+
+                throw ExpressionError(fmt::format("unknown identifier '{}' (inputs are accessed with 'IN.{}')", token.text, token.text), token.line);
+            }
+
+            Value parseCall(const std::string& function)
+            {
+                std::vector<Value> args;
+                if (!acceptSymbol(")"))
+                {
+                    do
+                    {
+                        args.push_back(parseOr());
+                    } while (acceptSymbol(","));
+                    expectSymbol(")", fmt::format("to close the arguments of '{}'", function));
+                }
+                return call(function, args);
+            }
+
+            int32_t parseInteger(const Token& token, bool negative) const
+            {
+                int64_t value = 0;
+                const char* end = token.text.data() + token.text.size();
+                const auto result = std::from_chars(token.text.data(), end, value);
+                if (negative)
+                    value = -value;
+                if (result.ec != std::errc() || result.ptr != end || value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max())
+                    throw ExpressionError(fmt::format("integer literal '{}{}' is out of the range of INT32", negative ? "-" : "", token.text), token.line);
+                return static_cast<int32_t>(value);
+            }
+
+            static float parseNumber(const Token& token)
+            {
+                return std::strtof(token.text.c_str(), nullptr);
+            }
+
+            // Code generation and type checking
+
+            Value arithmetic(const std::string& op, Value lhs, Value rhs)
+            {
+                const std::string context = fmt::format("operator '{}'", op);
+                if (op == "/")
+                {
+                    // Division of integers results in a float, like in Lua
+                    lhs = toFloat(lhs, context);
+                    rhs = toFloat(rhs, context);
+                }
+
+                const auto [a, b] = unifyNumeric(lhs, rhs, context);
+                if (a.type == EPropertyType::Int32)
+                {
+                    const EExpressionOpCode opCode = (op == "+") ? EExpressionOpCode::AddI : ((op == "-") ? EExpressionOpCode::SubI : EExpressionOpCode::MulI);
+                    return emit(opCode, EPropertyType::Int32, 1u, a.reg, b.reg);
+                }
+
+                EExpressionOpCode opCode = EExpressionOpCode::DivF;
+                if (op == "+")
+                    opCode = EExpressionOpCode::AddF;
+                else if (op == "-")
+                    opCode = EExpressionOpCode::SubF;
+                else if (op == "*")
+                    opCode = EExpressionOpCode::MulF;
+                return emit(opCode, a.type, FloatWidth(a.type), a.reg, b.reg);
+            }
+
+            Value compare(const std::string& op, Value lhs, Value rhs)
+            {
+                const std::string context = fmt::format("operator '{}'", op);
+
+                if (op == "==" || op == "~=")
+                {
+                    Value equal{};
+                    if (lhs.type == EPropertyType::Bool || rhs.type == EPropertyType::Bool)
+                    {
+                        if (lhs.type != rhs.type)
+                            fail(fmt::format("{} can't compare {} and {}", context, GetLuaPrimitiveTypeName(lhs.type), GetLuaPrimitiveTypeName(rhs.type)));
+                        equal = emit(EExpressionOpCode::EqualI, EPropertyType::Bool, 1u, lhs.reg, rhs.reg);
+                    }
+                    else if (lhs.type == EPropertyType::Int32 && rhs.type == EPropertyType::Int32)
+                    {
+                        equal = emit(EExpressionOpCode::EqualI, EPropertyType::Bool, 1u, lhs.reg, rhs.reg);
+                    }
+                    else
+                    {
+                        lhs = toFloat(lhs, context);
+                        rhs = toFloat(rhs, context);
+                        if (lhs.type != rhs.type)
+                            fail(fmt::format("{} can't compare {} and {}", context, GetLuaPrimitiveTypeName(lhs.type), GetLuaPrimitiveTypeName(rhs.type)));
+                        equal = emit(EExpressionOpCode::EqualF, EPropertyType::Bool, FloatWidth(lhs.type), lhs.reg, rhs.reg);
+                    }
+                    return (op == "~=") ? emit(EExpressionOpCode::Not, EPropertyType::Bool, 1u, equal.reg) : equal;
+                }
+
+                for (const Value& operand : {lhs, rhs})
+                {
+                    if (operand.type != EPropertyType::Int32 && operand.type != EPropertyType::Float)
+                        fail(fmt::format("{} expects numbers, got {}", context, GetLuaPrimitiveTypeName(operand.type)));
+                }
+
+                // a > b is evaluated as b < a
+                const bool swapOperands = (op == ">" || op == ">=");
+                const bool orEqual = (op == "<=" || op == ">=");
+                if (swapOperands)
+                    std::swap(lhs, rhs);
+
+                if (lhs.type == EPropertyType::Int32 && rhs.type == EPropertyType::Int32)
+                    return emit(orEqual ? EExpressionOpCode::LessEqualI : EExpressionOpCode::LessI, EPropertyType::Bool, 1u, lhs.reg, rhs.reg);
+
+                lhs = toFloat(lhs, context);
+                rhs = toFloat(rhs, context);
+                return emit(orEqual ? EExpressionOpCode::LessEqualF : EExpressionOpCode::LessF, EPropertyType::Bool, 1u, lhs.reg, rhs.reg);
+            }
+
+            Value logical(EExpressionOpCode opCode, std::string_view op, Value lhs, Value rhs)
+            {
+                for (const Value& operand : {lhs, rhs})
+                {
+                    if (operand.type != EPropertyType::Bool)
+                        fail(fmt::format("operator '{}' expects BOOL values, got {}", op, GetLuaPrimitiveTypeName(operand.type)));
+                }
+                return emit(opCode, EPropertyType::Bool, 1u, lhs.reg, rhs.reg);
+            }
+
+            Value logicalNot(Value value)
+            {
+                if (value.type != EPropertyType::Bool)
+                    fail(fmt::format("operator 'not' expects a BOOL value, got {}", GetLuaPrimitiveTypeName(value.type)));
+                return emit(EExpressionOpCode::Not, EPropertyType::Bool, 1u, value.reg);
+            }
+
+            Value negate(Value value)
+            {
+                requireNumber(value, "unary operator '-'");
+                if (value.type == EPropertyType::Int32)
+                    return emit(EExpressionOpCode::NegI, EPropertyType::Int32, 1u, value.reg);
+                return emit(EExpressionOpCode::NegF, value.type, FloatWidth(value.type), value.reg);
+            }
+
+            Value getComponent(Value value, std::string_view component)
+            {
+                const size_t width = FloatWidth(value.type);
+                if (width < 2u)
+                    fail(fmt::format("can't access component '{}' of {} value", component, GetLuaPrimitiveTypeName(value.type)));
+
+                constexpr std::string_view componentNames = "xyzw";
+                const size_t index = component.size() == 1u ? componentNames.find(component[0]) : std::string_view::npos;
+                if (index >= width)
+                    fail(fmt::format("{} value has no component '{}'", GetLuaPrimitiveTypeName(value.type), component));
+
+                return emit(EExpressionOpCode::GetComponentF, EPropertyType::Float, 1u, value.reg, static_cast<uint16_t>(index));
+            }
+
+            Value call(const std::string& function, const std::vector<Value>& args)
+            {
+                const std::string context = fmt::format("function '{}'", function);
+
+                if (function == "vec2" || function == "vec3" || function == "vec4")
+                {
+                    const size_t width = static_cast<size_t>(function[3] - '0');
+                    checkArgumentCount(function, args, width);
+
+                    std::vector<Value> components;
+                    for (const Value& arg : args)
+                    {
+                        components.push_back(toFloat(arg, context));
+                        if (components.back().type != EPropertyType::Float)
+                            fail(fmt::format("{} expects numbers as arguments, got {}", context, GetLuaPrimitiveTypeName(arg.type)));
+                    }
+
+                    // Vectors of literals are constants, e.g. vec3(0, 0, 1)
+                    if (std::all_of(components.cbegin(), components.cend(), [this](const Value& c) { return findConstant(c.reg) != nullptr; }))
+                    {
+                        ExpressionRegister vector;
+                        for (size_t k = 0; k < width; ++k)
+                            vector.f[k] = findConstant(components[k].reg)->value.f[0];
+                        return constant(FloatTypeWithWidth(width), vector);
+                    }
+
+                    const uint16_t dst = allocateRegister();
+                    for (size_t k = 0; k < width; ++k)
+                        m_program.instructions.push_back({EExpressionOpCode::SetComponentF, 1u, dst, components[k].reg, static_cast<uint16_t>(k), 0u});
+                    return Value{dst, FloatTypeWithWidth(width)};
+                }
+                if (function == "min" || function == "max")
+                {
+                    checkArgumentCount(function, args, 2u);
+                    const auto [a, b] = unifyNumeric(args[0], args[1], context);
+                    if (a.type == EPropertyType::Int32)
+                        return emit(function == "min" ? EExpressionOpCode::MinI : EExpressionOpCode::MaxI, a.type, 1u, a.reg, b.reg);
+                    return emit(function == "min" ? EExpressionOpCode::MinF : EExpressionOpCode::MaxF, a.type, FloatWidth(a.type), a.reg, b.reg);
+                }
+                if (function == "clamp")
+                {
+                    checkArgumentCount(function, args, 3u);
+                    if (args[0].type == EPropertyType::Int32 && args[1].type == EPropertyType::Int32 && args[2].type == EPropertyType::Int32)
+                        return emit(EExpressionOpCode::ClampI, EPropertyType::Int32, 1u, args[0].reg, args[1].reg, args[2].reg);
+
+                    std::array<Value, 3> operands = {toFloat(args[0], context), toFloat(args[1], context), toFloat(args[2], context)};
+                    const size_t width = std::max({FloatWidth(operands[0].type), FloatWidth(operands[1].type), FloatWidth(operands[2].type)});
+                    for (Value& operand : operands)
+                    {
+                        if (FloatWidth(operand.type) == 1u && width > 1u)
+                            operand = splat(operand, width);
+                        else if (FloatWidth(operand.type) != width)
+                            fail(fmt::format("{} can't combine {} and {}", context, GetLuaPrimitiveTypeName(operand.type), GetLuaPrimitiveTypeName(FloatTypeWithWidth(width))));
+                    }
+                    return emit(EExpressionOpCode::ClampF, FloatTypeWithWidth(width), width, operands[0].reg, operands[1].reg, operands[2].reg);
+                }
+                if (function == "abs")
+                {
+                    checkArgumentCount(function, args, 1u);
+                    requireNumber(args[0], context);
+                    if (args[0].type == EPropertyType::Int32)
+                        return emit(EExpressionOpCode::AbsI, EPropertyType::Int32, 1u, args[0].reg);
+                    return emit(EExpressionOpCode::AbsF, args[0].type, FloatWidth(args[0].type), args[0].reg);
+                }
+                if (function == "floor" || function == "ceil" || function == "sqrt")
+                {
+                    checkArgumentCount(function, args, 1u);
+                    const Value value = toFloat(args[0], context);
+                    EExpressionOpCode opCode = EExpressionOpCode::SqrtF;
+                    if (function == "floor")
+                        opCode = EExpressionOpCode::FloorF;
+                    else if (function == "ceil")
+                        opCode = EExpressionOpCode::CeilF;
+                    return emit(opCode, value.type, FloatWidth(value.type), value.reg);
+                }
+                if (function == "lerp")
+                {
+                    checkArgumentCount(function, args, 3u);
+                    const auto [from, to] = unifyNumeric(toFloat(args[0], context), toFloat(args[1], context), context);
+                    const Value t = toFloat(args[2], context);
+                    if (t.type != EPropertyType::Float)
+                        fail(fmt::format("{} expects a number as third argument, got {}", context, GetLuaPrimitiveTypeName(t.type)));
+                    return emit(EExpressionOpCode::LerpF, from.type, FloatWidth(from.type), from.reg, to.reg, t.reg);
+                }
+                if (function == "dot")
+                {
+                    checkArgumentCount(function, args, 2u);
+                    const size_t width = FloatWidth(args[0].type);
+                    if (width < 2u || args[0].type != args[1].type)
+                        fail(fmt::format("{} expects two vectors of the same size, got {} and {}", context, GetLuaPrimitiveTypeName(args[0].type), GetLuaPrimitiveTypeName(args[1].type)));
+                    return emit(EExpressionOpCode::DotF, EPropertyType::Float, width, args[0].reg, args[1].reg);
+                }
+                if (function == "length")
+                {
+                    checkArgumentCount(function, args, 1u);
+                    const size_t width = FloatWidth(args[0].type);
+                    if (width < 2u)
+                        fail(fmt::format("{} expects a vector, got {}", context, GetLuaPrimitiveTypeName(args[0].type)));
+                    return emit(EExpressionOpCode::LengthF, EPropertyType::Float, width, args[0].reg);
+                }
+                if (function == "select")
+                {
+                    checkArgumentCount(function, args, 3u);
+                    if (args[0].type != EPropertyType::Bool)
+                        fail(fmt::format("{} expects a BOOL condition as first argument, got {}", context, GetLuaPrimitiveTypeName(args[0].type)));
+
+                    Value a = args[1];
+                    Value b = args[2];
+                    if (a.type != b.type)
+                    {
+                        if (a.type == EPropertyType::Bool || b.type == EPropertyType::Bool)
+                            fail(fmt::format("{} can't choose between {} and {}", context, GetLuaPrimitiveTypeName(a.type), GetLuaPrimitiveTypeName(b.type)));
+                        std::tie(a, b) = unifyNumeric(a, b, context);
+                    }
+                    return emit(EExpressionOpCode::Select, a.type, 1u, args[0].reg, a.reg, b.reg);
+                }
+
+                fail(fmt::format("unknown function '{}'", function));
+            }
+
+            void checkArgumentCount(const std::string& function, const std::vector<Value>& args, size_t expectedCount) const
+            {
+                if (args.size() != expectedCount)
+                    fail(fmt::format("function '{}' expects {} arguments, got {}", function, expectedCount, args.size()));
+            }
+
+            void requireNumber(Value value, std::string_view context) const
+            {
+                if (value.type != EPropertyType::Int32 && FloatWidth(value.type) == 0u)
+                    fail(fmt::format("{} expects numbers or vectors, got {}", context, GetLuaPrimitiveTypeName(value.type)));
+            }
+
+            // Converts Int32 values to Float, keeps float and vector values
+            Value toFloat(Value value, std::string_view context)
+            {
+                requireNumber(value, context);
+                if (value.type != EPropertyType::Int32)
+                    return value;
+
+                if (const ExpressionConstant* constantValue = findConstant(value.reg))
+                    return constantFloat(static_cast<float>(constantValue->value.i));
+                return emit(EExpressionOpCode::IntToFloat, EPropertyType::Float, 1u, value.reg);
+            }
+
+            Value splat(Value value, size_t width)
+            {
+                assert(value.type == EPropertyType::Float);
+                if (const ExpressionConstant* constantValue = findConstant(value.reg))
+                {
+                    ExpressionRegister vector;
+                    vector.f.fill(constantValue->value.f[0]);
+                    return constant(FloatTypeWithWidth(width), vector);
+                }
+                return emit(EExpressionOpCode::SplatF, FloatTypeWithWidth(width), width, value.reg);
+            }
+
+            // Both Int32, or both converted to floats/vectors of the same size (numbers are repeated in each component)
+            std::pair<Value, Value> unifyNumeric(Value lhs, Value rhs, std::string_view context)
+            {
+                requireNumber(lhs, context);
+                requireNumber(rhs, context);
+                if (lhs.type == EPropertyType::Int32 && rhs.type == EPropertyType::Int32)
+                    return {lhs, rhs};
+
+                lhs = toFloat(lhs, context);
+                rhs = toFloat(rhs, context);
+                const size_t lhsWidth = FloatWidth(lhs.type);
+                const size_t rhsWidth = FloatWidth(rhs.type);
+                if (lhsWidth == rhsWidth)
+                    return {lhs, rhs};
+                if (lhsWidth == 1u)
+                    return {splat(lhs, rhsWidth), rhs};
+                if (rhsWidth == 1u)
+                    return {lhs, splat(rhs, lhsWidth)};
+
+                fail(fmt::format("{} can't combine {} and {}", context, GetLuaPrimitiveTypeName(lhs.type), GetLuaPrimitiveTypeName(rhs.type)));
+            }
+
+            uint16_t allocateRegister()
+            {
+                if (m_program.registerCount >= MaxExpressionRegisters)
+                    fail("expression is too complex");
+                return static_cast<uint16_t>(m_program.registerCount++);
+            }
+
+            Value emit(EExpressionOpCode opCode, EPropertyType resultType, size_t width, uint16_t a, uint16_t b = 0u, uint16_t c = 0u)
+            {
+                const uint16_t dst = allocateRegister();
+                m_program.instructions.push_back({opCode, static_cast<uint8_t>(width), dst, a, b, c});
+                return Value{dst, resultType};
+            }
+
+            Value constant(EPropertyType type, const ExpressionRegister& value)
+            {
+                const uint16_t reg = allocateRegister();
+                m_program.constants.push_back({reg, value});
+                return Value{reg, type};
+            }
+
+            Value constantInt(int32_t value)
+            {
+                ExpressionRegister reg;
+                reg.i = value;
+                return constant(EPropertyType::Int32, reg);
+            }
+
+            Value constantFloat(float value)
+            {
+                ExpressionRegister reg;
+                reg.f[0] = value;
+                return constant(EPropertyType::Float, reg);
+            }
+
+            [[nodiscard]] const ExpressionConstant* findConstant(uint16_t reg) const
+            {
+                const auto it = std::find_if(m_program.constants.cbegin(), m_program.constants.cend(), [reg](const ExpressionConstant& c) { return c.reg == reg; });
+                return it != m_program.constants.cend() ? &*it : nullptr;
+            }
+
+            // Tokens
+
+            [[nodiscard]] const Token& peek() const
+            {
+                return m_tokens[m_position];
+            }
+
+            const Token& next()
+            {
+                const Token& token = m_tokens[m_position];
+                if (token.type != ETokenType::End)
+                    ++m_position;
+                return token;
+            }
+
+            [[nodiscard]] bool peekSymbol(std::string_view symbol) const
+            {
+                return peek().type == ETokenType::Symbol && peek().text == symbol;
+            }
+
+            bool acceptSymbol(std::string_view symbol)
+            {
+                if (!peekSymbol(symbol))
+                    return false;
+                ++m_position;
+                return true;
+            }
+
+            bool acceptKeyword(std::string_view keyword)
+            {
+                if (peek().type != ETokenType::Identifier || peek().text != keyword)
+                    return false;
+                ++m_position;
+                return true;
+            }
+
+            void expectSymbol(std::string_view symbol, std::string_view context)
+            {
+                if (!acceptSymbol(symbol))
+                    fail(fmt::format("expected '{}' {}, got '{}'", symbol, context, peek().text));
+            }
+
+            std::string expectIdentifier(std::string_view context)
+            {
+                if (peek().type != ETokenType::Identifier)
+                    fail(fmt::format("expected identifier {}, got '{}'", context, peek().text));
+                return next().text;
+            }
+
+            [[noreturn]] void fail(const std::string& message) const
+            {
+                throw ExpressionError(message, peek().line);
+            }
+
+            std::vector<Token> m_tokens;
+            size_t m_position = 0u;
+            ExpressionProgram& m_program;
+            std::unordered_map<std::string, size_t> m_inputIndices;
+        };
+
+        bool ReadsRegisterB(EExpressionOpCode op)
+        {
+            switch (op)
+            {
+            case EExpressionOpCode::NegF:
+            case EExpressionOpCode::AbsF:
+            case EExpressionOpCode::FloorF:
+            case EExpressionOpCode::CeilF:
+            case EExpressionOpCode::SqrtF:
+            case EExpressionOpCode::LengthF:
+            case EExpressionOpCode::SplatF:
+            case EExpressionOpCode::GetComponentF:
+            case EExpressionOpCode::SetComponentF:
+            case EExpressionOpCode::IntToFloat:
+            case EExpressionOpCode::NegI:
+            case EExpressionOpCode::AbsI:
+            case EExpressionOpCode::Not:
+            case EExpressionOpCode::Count:
+                return false;
+            case EExpressionOpCode::AddF:
+            case EExpressionOpCode::SubF:
+            case EExpressionOpCode::MulF:
+            case EExpressionOpCode::DivF:
+            case EExpressionOpCode::MinF:
+            case EExpressionOpCode::MaxF:
+            case EExpressionOpCode::ClampF:
+            case EExpressionOpCode::LerpF:
+            case EExpressionOpCode::DotF:
+            case EExpressionOpCode::AddI:
+            case EExpressionOpCode::SubI:
+            case EExpressionOpCode::MulI:
+            case EExpressionOpCode::MinI:
+            case EExpressionOpCode::MaxI:
+            case EExpressionOpCode::ClampI:
+            case EExpressionOpCode::LessF:
+            case EExpressionOpCode::LessEqualF:
+            case EExpressionOpCode::EqualF:
+            case EExpressionOpCode::LessI:
+            case EExpressionOpCode::LessEqualI:
+            case EExpressionOpCode::EqualI:
+            case EExpressionOpCode::And:
+            case EExpressionOpCode::Or:
+            case EExpressionOpCode::Select:
+                return true;
+            }
+            return false;
+        }
+
+        bool ReadsRegisterC(EExpressionOpCode op)
+        {
+            return op == EExpressionOpCode::ClampF || op == EExpressionOpCode::LerpF || op == EExpressionOpCode::ClampI || op == EExpressionOpCode::Select;
+        }
+
+        // Constant folding leaves constants behind which no instruction reads (e.g. the operands of '-1' or 'vec2(1, 2)'),
+        // drops them and numbers the remaining registers without gaps. Inputs keep their registers
+        void RemoveUnusedRegisters(ExpressionProgram& program)
+        {
+            std::vector<bool> isUsed(program.registerCount, false);
+            std::fill_n(isUsed.begin(), program.inputs.size(), true);
+            for (const uint16_t reg : program.outputRegisters)
+                isUsed[reg] = true;
+            for (const auto& instr : program.instructions)
+            {
+                isUsed[instr.dst] = true;
+                isUsed[instr.a] = true;
+                if (ReadsRegisterB(instr.op))
+                    isUsed[instr.b] = true;
+                if (ReadsRegisterC(instr.op))
+                    isUsed[instr.c] = true;
+            }
+
+            std::vector<uint16_t> newIndex(program.registerCount, 0u);
+            uint16_t registerCount = 0u;
+            for (size_t i = 0; i < isUsed.size(); ++i)
+            {
+                if (isUsed[i])
+                    newIndex[i] = registerCount++;
+            }
+
+            program.constants.erase(
+                std::remove_if(program.constants.begin(), program.constants.end(), [&isUsed](const ExpressionConstant& c) { return !isUsed[c.reg]; }),
+                program.constants.end());
+            for (auto& constant : program.constants)
+                constant.reg = newIndex[constant.reg];
+            for (auto& reg : program.outputRegisters)
+                reg = newIndex[reg];
+            for (auto& instr : program.instructions)
+            {
+                instr.dst = newIndex[instr.dst];
+                instr.a = newIndex[instr.a];
+                // b of the component instructions is a component index, other unused operands are 0
+                if (ReadsRegisterB(instr.op))
+                    instr.b = newIndex[instr.b];
+                if (ReadsRegisterC(instr.op))
+                    instr.c = newIndex[instr.c];
+            }
+            program.registerCount = registerCount;
+        }
+    }
+
+    std::optional<ExpressionProgram> ExpressionCompiler::Compile(
+        std::string_view expression,
+        const std::vector<TypeData>& inputs,
+        std::string_view name,
+        ErrorReporting& errorReporting)
+    {
+        if (inputs.size() >= MaxExpressionRegisters)
+        {
+            errorReporting.add(fmt::format("[{}] Too many inputs!", name), nullptr);
+            return std::nullopt;
+        }
+
+        std::unordered_set<std::string_view> inputNames;
+        for (const auto& input : inputs)
+        {
+            if (!IsValidIdentifier(input.name))
+            {
+                errorReporting.add(fmt::format("[{}] Invalid input name '{}'! Names must consist of letters, digits and '_' and must not start with a digit", name, input.name), nullptr);
+                return std::nullopt;
+            }
+            if (!inputNames.insert(input.name).second)
+            {
+                errorReporting.add(fmt::format("[{}] Input '{}' is declared more than once!", name, input.name), nullptr);
+                return std::nullopt;
+            }
+            if (!ExpressionProgram::IsSupportedType(input.type))
+            {
+                errorReporting.add(fmt::format("[{}] Input '{}' has unsupported type '{}'! Expressions support FLOAT, VEC2F, VEC3F, VEC4F, INT32 and BOOL", name, input.name, GetLuaPrimitiveTypeName(input.type)), nullptr);
+                return std::nullopt;
+            }
+        }
+
+        ExpressionProgram program;
+        program.inputs = inputs;
+        program.registerCount = inputs.size();
+
+        try
+        {
+            ExpressionParser parser(Tokenize(expression), program);
+            parser.parseProgram();
+        }
+        catch (const ExpressionError& error)
+        {
+            errorReporting.add(fmt::format("[{}] Error in expression at line {}: {}", name, error.getLine(), error.what()), nullptr);
+            return std::nullopt;
+        }
+
+        RemoveUnusedRegisters(program);
+
+        assert(program.isValid());
+        return program;
+    }
+
+    bool ExpressionCompiler::IsValidIdentifier(std::string_view name)
+    {
+        return !name.empty() && IsIdentifierStart(name[0]) && std::all_of(name.cbegin(), name.cend(), IsIdentifierChar);
+    }
+}
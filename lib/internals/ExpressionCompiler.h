@@ -0,0 +1,35 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/ExpressionProgram.h"
+
+#include <optional>
+#include <string_view>
+
+namespace rlogic::internal
+{
+    class ErrorReporting;
+
+    // Compiles the expression of an ExpressionNode (see the docs of rlogic::ExpressionNode for the syntax) into an
+    // ExpressionProgram. Parsing and type checking happen in a single pass which directly emits the instructions,
+    // each intermediate result gets its own register
+    class ExpressionCompiler
+    {
+    public:
+        [[nodiscard]] static std::optional<ExpressionProgram> Compile(
+            std::string_view expression,
+            const std::vector<TypeData>& inputs,
+            std::string_view name,
+            ErrorReporting& errorReporting);
+
+        // Names of inputs and outputs must be usable after 'IN.' and 'OUT.'
+        [[nodiscard]] static bool IsValidIdentifier(std::string_view name);
+    };
+}
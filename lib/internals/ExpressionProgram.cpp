@@ -0,0 +1,262 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ExpressionProgram.h"
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        template <typename Op>
+        void ComponentWise(ExpressionRegister& dst, const ExpressionRegister& a, const ExpressionRegister& b, size_t width, Op op)
+        {
+            for (size_t k = 0; k < width; ++k)
+                dst.f[k] = op(a.f[k], b.f[k]);
+        }
+
+        template <typename Op>
+        void ComponentWise(ExpressionRegister& dst, const ExpressionRegister& a, size_t width, Op op)
+        {
+            for (size_t k = 0; k < width; ++k)
+                dst.f[k] = op(a.f[k]);
+        }
+
+        // Signed overflow is undefined in C++, integer arithmetic wraps around like in Lua instead
+        int32_t WrapAround(uint32_t value)
+        {
+            return static_cast<int32_t>(value);
+        }
+    }
+
+    std::vector<ExpressionRegister> ExpressionProgram::createRegisters() const
+    {
+        std::vector<ExpressionRegister> registers(registerCount);
+        for (const auto& constant : constants)
+            registers[constant.reg] = constant.value;
+        return registers;
+    }
+
+    void ExpressionProgram::execute(std::vector<ExpressionRegister>& registers) const
+    {
+        assert(registers.size() == registerCount);
+
+        for (const ExpressionInstruction& instr : instructions)
+        {
+            ExpressionRegister& dst = registers[instr.dst];
+            const ExpressionRegister& a = registers[instr.a];
+            const size_t width = instr.width;
+
+            switch (instr.op)
+            {
+            case EExpressionOpCode::AddF:
+                ComponentWise(dst, a, registers[instr.b], width, [](float x, float y) { return x + y; });
+                break;
+            case EExpressionOpCode::SubF:
+                ComponentWise(dst, a, registers[instr.b], width, [](float x, float y) { return x - y; });
+                break;
+            case EExpressionOpCode::MulF:
+                ComponentWise(dst, a, registers[instr.b], width, [](float x, float y) { return x * y; });
+                break;
+            case EExpressionOpCode::DivF:
+                ComponentWise(dst, a, registers[instr.b], width, [](float x, float y) { return x / y; });
+                break;
+            case EExpressionOpCode::MinF:
+                ComponentWise(dst, a, registers[instr.b], width, [](float x, float y) { return std::min(x, y); });
+                break;
+            case EExpressionOpCode::MaxF:
+                ComponentWise(dst, a, registers[instr.b], width, [](float x, float y) { return std::max(x, y); });
+                break;
+            case EExpressionOpCode::NegF:
+                ComponentWise(dst, a, width, [](float x) { return -x; });
+                break;
+            case EExpressionOpCode::AbsF:
+                ComponentWise(dst, a, width, [](float x) { return std::abs(x); });
+                break;
+            case EExpressionOpCode::FloorF:
+                ComponentWise(dst, a, width, [](float x) { return std::floor(x); });
+                break;
+            case EExpressionOpCode::CeilF:
+                ComponentWise(dst, a, width, [](float x) { return std::ceil(x); });
+                break;
+            case EExpressionOpCode::SqrtF:
+                ComponentWise(dst, a, width, [](float x) { return std::sqrt(x); });
+                break;
+            case EExpressionOpCode::ClampF:
+            {
+                const ExpressionRegister& lo = registers[instr.b];
+                const ExpressionRegister& hi = registers[instr.c];
+                // Same as min(max(x, lo), hi), doesn't require lo <= hi unlike std::clamp
+                for (size_t k = 0; k < width; ++k)
+                    dst.f[k] = std::min(std::max(a.f[k], lo.f[k]), hi.f[k]);
+                break;
+            }
+            case EExpressionOpCode::LerpF:
+            {
+                const ExpressionRegister& to = registers[instr.b];
+                const float t = registers[instr.c].f[0];
+                for (size_t k = 0; k < width; ++k)
+                    dst.f[k] = a.f[k] + (to.f[k] - a.f[k]) * t;
+                break;
+            }
+            case EExpressionOpCode::DotF:
+            {
+                const ExpressionRegister& b = registers[instr.b];
+                float result = 0.f;
+                for (size_t k = 0; k < width; ++k)
+                    result += a.f[k] * b.f[k];
+                dst.f[0] = result;
+                break;
+            }
+            case EExpressionOpCode::LengthF:
+            {
+                float squaredLength = 0.f;
+                for (size_t k = 0; k < width; ++k)
+                    squaredLength += a.f[k] * a.f[k];
+                dst.f[0] = std::sqrt(squaredLength);
+                break;
+            }
+            case EExpressionOpCode::SplatF:
+            {
+                const float value = a.f[0];
+                for (size_t k = 0; k < width; ++k)
+                    dst.f[k] = value;
+                break;
+            }
+            case EExpressionOpCode::GetComponentF:
+                dst.f[0] = a.f[instr.b];
+                break;
+            case EExpressionOpCode::SetComponentF:
+                dst.f[instr.b] = a.f[0];
+                break;
+            case EExpressionOpCode::IntToFloat:
+                dst.f[0] = static_cast<float>(a.i);
+                break;
+
+            case EExpressionOpCode::AddI:
+                dst.i = WrapAround(static_cast<uint32_t>(a.i) + static_cast<uint32_t>(registers[instr.b].i));
+                break;
+            case EExpressionOpCode::SubI:
+                dst.i = WrapAround(static_cast<uint32_t>(a.i) - static_cast<uint32_t>(registers[instr.b].i));
+                break;
+            case EExpressionOpCode::MulI:
+                dst.i = WrapAround(static_cast<uint32_t>(a.i) * static_cast<uint32_t>(registers[instr.b].i));
+                break;
+            case EExpressionOpCode::MinI:
+                dst.i = std::min(a.i, registers[instr.b].i);
+                break;
+            case EExpressionOpCode::MaxI:
+                dst.i = std::max(a.i, registers[instr.b].i);
+                break;
+            case EExpressionOpCode::NegI:
+                dst.i = WrapAround(0u - static_cast<uint32_t>(a.i));
+                break;
+            case EExpressionOpCode::AbsI:
+                dst.i = a.i < 0 ? WrapAround(0u - static_cast<uint32_t>(a.i)) : a.i;
+                break;
+            case EExpressionOpCode::ClampI:
+                dst.i = std::min(std::max(a.i, registers[instr.b].i), registers[instr.c].i);
+                break;
+
+            case EExpressionOpCode::LessF:
+                dst.i = a.f[0] < registers[instr.b].f[0] ? 1 : 0;
+                break;
+            case EExpressionOpCode::LessEqualF:
+                dst.i = a.f[0] <= registers[instr.b].f[0] ? 1 : 0;
+                break;
+            case EExpressionOpCode::EqualF:
+            {
+                const ExpressionRegister& b = registers[instr.b];
+                bool equal = true;
+                for (size_t k = 0; k < width; ++k)
+                    equal = equal && (a.f[k] == b.f[k]);
+                dst.i = equal ? 1 : 0;
+                break;
+            }
+            case EExpressionOpCode::LessI:
+                dst.i = a.i < registers[instr.b].i ? 1 : 0;
+                break;
+            case EExpressionOpCode::LessEqualI:
+                dst.i = a.i <= registers[instr.b].i ? 1 : 0;
+                break;
+            case EExpressionOpCode::EqualI:
+                dst.i = a.i == registers[instr.b].i ? 1 : 0;
+                break;
+
+            case EExpressionOpCode::And:
+                dst.i = (a.i != 0 && registers[instr.b].i != 0) ? 1 : 0;
+                break;
+            case EExpressionOpCode::Or:
+                dst.i = (a.i != 0 || registers[instr.b].i != 0) ? 1 : 0;
+                break;
+            case EExpressionOpCode::Not:
+                dst.i = a.i == 0 ? 1 : 0;
+                break;
+
+            case EExpressionOpCode::Select:
+                dst = a.i != 0 ? registers[instr.b] : registers[instr.c];
+                break;
+
+            case EExpressionOpCode::Count:
+                assert(false && "Invalid op code");
+                break;
+            }
+        }
+    }
+
+    bool ExpressionProgram::isValid() const
+    {
+        if (registerCount > MaxExpressionRegisters || inputs.size() > registerCount || outputs.size() != outputRegisters.size())
+            return false;
+
+        const auto isSupported = [](const TypeData& typeData) { return IsSupportedType(typeData.type); };
+        if (!std::all_of(inputs.cbegin(), inputs.cend(), isSupported) || !std::all_of(outputs.cbegin(), outputs.cend(), isSupported))
+            return false;
+
+        const auto isRegister = [this](size_t index) { return index < registerCount; };
+        if (!std::all_of(outputRegisters.cbegin(), outputRegisters.cend(), isRegister))
+            return false;
+        if (!std::all_of(constants.cbegin(), constants.cend(), [&](const ExpressionConstant& constant) { return isRegister(constant.reg); }))
+            return false;
+
+        return std::all_of(instructions.cbegin(), instructions.cend(), [&](const ExpressionInstruction& instr) {
+            if (instr.op >= EExpressionOpCode::Count || instr.width < 1u || instr.width > 4u)
+                return false;
+            // The component instructions use b as index of a component
+            const bool isComponentOp = (instr.op == EExpressionOpCode::GetComponentF || instr.op == EExpressionOpCode::SetComponentF);
+            const bool bIsValid = isComponentOp ? (instr.b < 4u) : isRegister(instr.b);
+            return isRegister(instr.dst) && isRegister(instr.a) && bIsValid && isRegister(instr.c);
+        });
+    }
+
+    bool ExpressionProgram::IsSupportedType(EPropertyType type)
+    {
+        switch (type)
+        {
+        case EPropertyType::Float:
+        case EPropertyType::Vec2f:
+        case EPropertyType::Vec3f:
+        case EPropertyType::Vec4f:
+        case EPropertyType::Int32:
+        case EPropertyType::Bool:
+            return true;
+        case EPropertyType::Int64:
+        case EPropertyType::Vec2i:
+        case EPropertyType::Vec3i:
+        case EPropertyType::Vec4i:
+        case EPropertyType::String:
+        case EPropertyType::Struct:
+        case EPropertyType::Array:
+            return false;
+        }
+        return false;
+    }
+}
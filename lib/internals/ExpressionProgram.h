@@ -0,0 +1,134 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/TypeData.h"
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Register indices in instructions are 16 bit
+    constexpr size_t MaxExpressionRegisters = 0x10000u;
+
+    // All registers have the same layout, so that no instruction can access memory outside of a register,
+    // whatever the instruction sequence is (e.g. when loaded from a corrupted file)
+    struct ExpressionRegister
+    {
+        // Float and vector values
+        std::array<float, 4> f{};
+        // Int32 and bool (0 or 1) values
+        int32_t i = 0;
+    };
+
+    // Instructions of the ExpressionNode register machine. Float instructions operate on the first 'width' components,
+    // comparisons and bool instructions write 0 or 1 to the int register
+    enum class EExpressionOpCode : uint8_t
+    {
+        // dst = a op b, component-wise
+        AddF,
+        SubF,
+        MulF,
+        DivF,
+        MinF,
+        MaxF,
+        // dst = -a, component-wise
+        NegF,
+        AbsF,
+        FloorF,
+        CeilF,
+        SqrtF,
+        // dst = clamp(a, b, c), component-wise
+        ClampF,
+        // dst = a + (b - a) * c.f[0], component-wise
+        LerpF,
+        // dst.f[0] = dot(a, b), length(a)
+        DotF,
+        LengthF,
+        // dst = a.f[0] in all components
+        SplatF,
+        // dst.f[0] = a.f[b], b is a component index (not a register)
+        GetComponentF,
+        // dst.f[b] = a.f[0], b is a component index (not a register). Used to construct vectors in a temporary register
+        SetComponentF,
+        // dst.f[0] = float(a.i)
+        IntToFloat,
+
+        // dst.i = a.i op b.i, with wrap-around on overflow like Lua integers
+        AddI,
+        SubI,
+        MulI,
+        MinI,
+        MaxI,
+        NegI,
+        AbsI,
+        ClampI,
+
+        // dst.i = a op b
+        LessF,
+        LessEqualF,
+        // all 'width' components equal
+        EqualF,
+        LessI,
+        LessEqualI,
+        EqualI,
+
+        // dst.i = a.i op b.i, on bools
+        And,
+        Or,
+        Not,
+
+        // dst = a.i ? b : c (whole register)
+        Select,
+
+        // Number of op codes, not an instruction
+        Count
+    };
+
+    struct ExpressionInstruction
+    {
+        EExpressionOpCode op = EExpressionOpCode::AddF;
+        // Number of float components, 1 to 4
+        uint8_t width = 1u;
+        uint16_t dst = 0u;
+        uint16_t a = 0u;
+        uint16_t b = 0u;
+        uint16_t c = 0u;
+    };
+
+    struct ExpressionConstant
+    {
+        uint16_t reg = 0u;
+        ExpressionRegister value;
+    };
+
+    // Compiled form of an expression (see ExpressionCompiler). The first registers hold the inputs (in the order of the
+    // inputs), followed by constants and temporary values. Each output is read from one register after execution
+    struct ExpressionProgram
+    {
+        std::vector<TypeData> inputs;
+        std::vector<TypeData> outputs;
+        std::vector<uint16_t> outputRegisters;
+        std::vector<ExpressionConstant> constants;
+        std::vector<ExpressionInstruction> instructions;
+        size_t registerCount = 0u;
+
+        // Registers with initialized constants
+        [[nodiscard]] std::vector<ExpressionRegister> createRegisters() const;
+        // Executes all instructions, the registers must have been created with createRegisters() and have the values of the inputs
+        void execute(std::vector<ExpressionRegister>& registers) const;
+        // Checks that all indices are within bounds and all types are supported, e.g. after loading from a file
+        [[nodiscard]] bool isValid() const;
+
+        // Types which can be used for inputs and outputs of expressions
+        [[nodiscard]] static bool IsSupportedType(EPropertyType type);
+    };
+}
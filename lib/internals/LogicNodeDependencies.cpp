@@ -17,6 +17,7 @@
 #include "internals/TypeUtils.h"
 
 #include <cassert>
+#include <algorithm>
 #include "fmt/format.h"
 
 namespace rlogic::internal
@@ -27,21 +28,46 @@ namespace rlogic::internal
         assert(!m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.addNode(node);
         m_nodeTopologyChanged = true;
+        node.setTopologicalRank(m_logicNodeDAG.getTopologicalRank(node));
+        node.setTopologicalLevel(0u);
+
+        node.setDirtyNodeQueue(&m_dirtyNodes);
+        if (node.isDirty())
+        {
+            m_dirtyNodes.push(node);
+        }
     }
 
     void LogicNodeDependencies::removeNode(LogicNodeImpl& node)
     {
         assert(m_logicNodeDAG.containsNode(node));
+        NodeVector targetNodes;
+        for (const auto& edge : m_logicNodeDAG.getOutgoingEdges(node))
+        {
+            targetNodes.push_back(edge.node);
+        }
         m_logicNodeDAG.removeNode(node);
+        m_nodeTopologyChanged = true;
+        m_cachedUpstreamNodes.clear();
+
+        m_dirtyNodes.remove(node);
+        node.setDirtyNodeQueue(nullptr);
 
-        // Remove the node from the cache without reordering the rest (unless there is no cache yet)
-        // Removing nodes does not require topology update (we don't guarantee specific ordering when
-        // nodes are not related, we only guarantee relative ordering when nodes are linked)
-        if (m_cachedTopologicallySortedNodes)
+        // Links to the inputs of the removed node are destroyed with it - the nodes on the other side
+        // of those links have to recompile their link programs
+        Property* inputs = node.getInputs();
+        if (inputs != nullptr)
         {
-            NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
-            cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
+            InvalidateIncomingLinkProgramsRecursive(*inputs->m_impl);
         }
+
+        // The targets lost a source, their level can decrease
+        updateRanksAndLevels(targetNodes);
+    }
+
+    bool LogicNodeDependencies::containsNode(const LogicNodeImpl& node) const
+    {
+        return m_logicNodeDAG.containsNode(node);
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -86,17 +112,162 @@ namespace rlogic::internal
         return false;
     }
 
+    void LogicNodeDependencies::InvalidateIncomingLinkProgramsRecursive(PropertyImpl& input)
+    {
+        const auto inputCount = input.getChildCount();
+        for (size_t i = 0; i < inputCount; ++i)
+        {
+            PropertyImpl& child = *input.getChild(i)->m_impl;
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                InvalidateIncomingLinkProgramsRecursive(child);
+            }
+            else
+            {
+                PropertyImpl* linkedOutput = child.getLinkedIncomingProperty();
+                if (linkedOutput != nullptr)
+                {
+                    linkedOutput->getLogicNode().invalidateLinkProgram();
+                }
+            }
+        }
+    }
+
+    bool LogicNodeDependencies::updateTopologicalOrder()
+    {
+        if (!m_logicNodeDAG.updateTopologicalOrder())
+        {
+            return false;
+        }
+
+        if (m_levelsOutdated)
+        {
+            updateRanksAndLevels({});
+        }
+
+        return true;
+    }
+
     const std::optional<NodeVector>& LogicNodeDependencies::getTopologicallySortedNodes()
     {
         if (m_nodeTopologyChanged)
         {
-            m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
+            m_cachedTopologicallySortedNodes = updateTopologicalOrder() ? m_logicNodeDAG.getTopologicallySortedNodes() : std::nullopt;
             m_nodeTopologyChanged = false;
         }
 
         return m_cachedTopologicallySortedNodes;
     }
 
+    void LogicNodeDependencies::updateRanksAndLevels(const NodeVector& nodesWithChangedInputs)
+    {
+        if (!m_logicNodeDAG.isTopologicalOrderValid())
+        {
+            // Levels are recomputed from scratch once the cycle is resolved
+            m_levelsOutdated = true;
+            return;
+        }
+
+        for (LogicNodeImpl* node : m_logicNodeDAG.takeRerankedNodes())
+        {
+            node->setTopologicalRank(m_logicNodeDAG.getTopologicalRank(*node));
+        }
+
+        if (m_levelsOutdated)
+        {
+            const std::optional<NodeVector> sortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
+            assert(sortedNodes);
+            assignTopologicalLevels(*sortedNodes);
+            m_levelsOutdated = false;
+        }
+        else
+        {
+            for (LogicNodeImpl* node : nodesWithChangedInputs)
+            {
+                updateTopologicalLevels(*node);
+            }
+        }
+
+        m_dirtyNodes.reorder();
+    }
+
+    // Recomputes the level of the node from its sources and propagates changes downstream. Nodes are processed
+    // by rank, so that each node is recomputed only once, after all of its sources are final
+    void LogicNodeDependencies::updateTopologicalLevels(LogicNodeImpl& node)
+    {
+        const auto hasHigherRank = [](const LogicNodeImpl* lhs, const LogicNodeImpl* rhs) { return lhs->getTopologicalRank() > rhs->getTopologicalRank(); };
+
+        m_levelUpdateQueue.clear();
+        m_levelUpdateQueue.push_back(&node);
+        const LogicNodeImpl* lastUpdatedNode = nullptr;
+        while (!m_levelUpdateQueue.empty())
+        {
+            std::pop_heap(m_levelUpdateQueue.begin(), m_levelUpdateQueue.end(), hasHigherRank);
+            LogicNodeImpl* nextNode = m_levelUpdateQueue.back();
+            m_levelUpdateQueue.pop_back();
+
+            // Nodes with several changed sources are queued several times, the entries are adjacent
+            if (nextNode == lastUpdatedNode)
+            {
+                continue;
+            }
+            lastUpdatedNode = nextNode;
+
+            size_t level = 0u;
+            for (const auto& edge : m_logicNodeDAG.getIncomingEdges(*nextNode))
+            {
+                level = std::max(level, edge.node->getTopologicalLevel() + 1u);
+            }
+
+            if (level != nextNode->getTopologicalLevel())
+            {
+                nextNode->setTopologicalLevel(level);
+                for (const auto& edge : m_logicNodeDAG.getOutgoingEdges(*nextNode))
+                {
+                    m_levelUpdateQueue.push_back(edge.node);
+                    std::push_heap(m_levelUpdateQueue.begin(), m_levelUpdateQueue.end(), hasHigherRank);
+                }
+            }
+        }
+    }
+
+    void LogicNodeDependencies::assignTopologicalLevels(const NodeVector& sortedNodes) const
+    {
+        for (LogicNodeImpl* node : sortedNodes)
+        {
+            node->setTopologicalLevel(0u);
+        }
+
+        // Sources are visited before their targets, so their level is final when it is propagated
+        for (LogicNodeImpl* node : sortedNodes)
+        {
+            const size_t targetLevel = node->getTopologicalLevel() + 1u;
+            for (const auto& edge : m_logicNodeDAG.getOutgoingEdges(*node))
+            {
+                edge.node->setTopologicalLevel(std::max(edge.node->getTopologicalLevel(), targetLevel));
+            }
+        }
+    }
+
+    DirtyNodeQueue& LogicNodeDependencies::getDirtyNodes()
+    {
+        return m_dirtyNodes;
+    }
+
+    const NodeVector& LogicNodeDependencies::getUpstreamNodes(const LogicNodeImpl& node)
+    {
+        assert(m_logicNodeDAG.containsNode(node));
+        auto cachedNodes = m_cachedUpstreamNodes.find(&node);
+        if (cachedNodes == m_cachedUpstreamNodes.end())
+        {
+            std::optional<NodeVector> upstreamNodes = m_logicNodeDAG.collectUpstreamNodes(node);
+            assert(upstreamNodes);
+            cachedNodes = m_cachedUpstreamNodes.emplace(&node, std::move(*upstreamNodes)).first;
+        }
+
+        return cachedNodes->second;
+    }
+
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting)
     {
         if (!m_logicNodeDAG.containsNode(output.getLogicNode()))
@@ -154,12 +325,29 @@ namespace rlogic::internal
             return false;
         }
 
+        // The new link closes a loop if the source node is already reachable from the target node
+        const NodeVector loopPath = m_logicNodeDAG.findPath(input.getLogicNode(), output.getLogicNode());
+        if (!loopPath.empty())
+        {
+            errorReporting.add(fmt::format("Failed to link output property '{}' of LogicNode '{}' to input property '{}' of LogicNode '{}', the link would create a loop: {}",
+                output.getName(),
+                output.getLogicNode().getName(),
+                input.getName(),
+                input.getLogicNode().getName(),
+                DescribeLinkLoop(loopPath, output, input)
+            ), nullptr);
+            return false;
+        }
+
         input.setLinkedOutput(output);
+        output.getLogicNode().invalidateLinkProgram();
 
         const bool isNewEdge = m_logicNodeDAG.addEdge(output.getLogicNode(), input.getLogicNode());
         if (isNewEdge)
         {
             m_nodeTopologyChanged = true;
+            m_cachedUpstreamNodes.clear();
+            updateRanksAndLevels({ &input.getLogicNode() });
         }
         // TODO Violin don't set anything dirty here, handle dirtiness purely in update()
         input.getLogicNode().setDirty(true);
@@ -168,6 +356,28 @@ namespace rlogic::internal
         return true;
     }
 
+    std::string LogicNodeDependencies::DescribeLinkLoop(const NodeVector& loopPath, const PropertyImpl& output, const PropertyImpl& input)
+    {
+        const auto describeLink = [](const PropertyImpl& linkSource, const PropertyImpl& linkTarget) {
+            return fmt::format("'{}.{}' -> '{}.{}'", linkSource.getLogicNode().getName(), linkSource.getName(), linkTarget.getLogicNode().getName(), linkTarget.getName());
+        };
+
+        // One of the property links between each pair of subsequent nodes, closed by the new link
+        std::string description;
+        for (size_t i = 0; i + 1 < loopPath.size(); ++i)
+        {
+            const LinkProgram& linkProgram = loopPath[i]->getLinkProgram();
+            const auto link = std::find_if(linkProgram.begin(), linkProgram.end(), [nextNode = loopPath[i + 1]](const LinkInstruction& instruction) {
+                return &instruction.target->getLogicNode() == nextNode;
+            });
+            assert(link != linkProgram.end());
+            description += describeLink(*link->source, *link->target) + ", ";
+        }
+        description += describeLink(output, input);
+
+        return description;
+    }
+
     bool LogicNodeDependencies::unlink(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting)
     {
         if (TypeUtils::CanHaveChildren(input.getType()))
@@ -192,8 +402,15 @@ namespace rlogic::internal
         auto& node = output.getLogicNode();
         auto& targetNode = input.getLogicNode();
         input.unsetLinkedOutput();
+        node.invalidateLinkProgram();
 
-        m_logicNodeDAG.removeEdge(node, targetNode);
+        const bool isRemovedEdge = m_logicNodeDAG.removeEdge(node, targetNode);
+        if (isRemovedEdge)
+        {
+            m_nodeTopologyChanged = true;
+            m_cachedUpstreamNodes.clear();
+            updateRanksAndLevels({ &targetNode });
+        }
 
         return true;
     }
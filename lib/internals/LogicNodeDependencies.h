@@ -9,8 +9,11 @@
 #pragma once
 
 #include "internals/DirectedAcyclicGraph.h"
+#include "internals/DirtyNodeQueue.h"
 
 #include <unordered_set>
+#include <unordered_map>
+#include <string>
 
 namespace rlogic::internal
 {
@@ -25,12 +28,25 @@ namespace rlogic::internal
     class LogicNodeDependencies
     {
     public:
-        // The primary purpose of this class
+        // Ranks and levels of the nodes are kept up to date while links are added and removed. Only after a link
+        // cycle was resolved they have to be recomputed here. Returns false if the links still form a cycle
+        [[nodiscard]] bool updateTopologicalOrder();
+
+        // All nodes in topological order, for the cases which have to visit every node
         [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
 
+        // Dirty nodes ordered by their topological level and rank (only valid after updateTopologicalOrder())
+        // See LogicNodeImpl::getTopologicalLevel()
+        [[nodiscard]] DirtyNodeQueue& getDirtyNodes();
+
+        // The node and all nodes which it depends on over links, in topological order (only valid after updateTopologicalOrder()).
+        // Cached per node until the links change
+        [[nodiscard]] const NodeVector& getUpstreamNodes(const LogicNodeImpl& node);
+
         // Nodes management
         void addNode(LogicNodeImpl& node);
         void removeNode(LogicNodeImpl& node);
+        [[nodiscard]] bool containsNode(const LogicNodeImpl& node) const;
 
         // Link management
         bool link(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting);
@@ -39,11 +55,22 @@ namespace rlogic::internal
 
     private:
         DirectedAcyclicGraph                m_logicNodeDAG;
+        DirtyNodeQueue                      m_dirtyNodes;
 
         [[nodiscard]] bool isLinked(PropertyImpl& input) const;
+        static void InvalidateIncomingLinkProgramsRecursive(PropertyImpl& input);
+        [[nodiscard]] static std::string DescribeLinkLoop(const NodeVector& loopPath, const PropertyImpl& output, const PropertyImpl& input);
+        void updateRanksAndLevels(const NodeVector& nodesWithChangedInputs);
+        void updateTopologicalLevels(LogicNodeImpl& node);
+        void assignTopologicalLevels(const NodeVector& sortedNodes) const;
 
         // Initial state: no nodes and no need to re-compute node topology
         std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
         bool m_nodeTopologyChanged = false;
+        // Set while the links form a cycle, levels are only defined for acyclic graphs
+        bool m_levelsOutdated = false;
+        std::unordered_map<const LogicNodeImpl*, NodeVector> m_cachedUpstreamNodes;
+        // Heap of nodes whose level has to be recomputed, ordered by rank (kept to avoid allocations)
+        NodeVector m_levelUpdateQueue;
     };
 }
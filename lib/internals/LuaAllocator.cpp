@@ -0,0 +1,334 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // Same as LUAI_USER_ALIGNMENT_T of Lua 5.1, the alignment which Lua expects from its allocator
+        union LuaMaxAlign
+        {
+            double number;
+            void* pointer;
+            long integer;
+        };
+
+        // Each block starts with the id of its account, the header keeps the memory after it aligned for Lua
+        constexpr size_t HeaderSize = alignof(LuaMaxAlign);
+        static_assert(HeaderSize >= sizeof(LuaMemoryAccountId));
+    }
+
+    LuaAllocator::LuaAllocator()
+    {
+        static_assert(SizeClassGranularity % HeaderSize == 0u, "Pooled blocks must keep the alignment of the header");
+        static_assert(PoolChunkSize % MaxPooledBlockSize == 0u);
+
+        // StateAccount
+        m_accounts.emplace_back();
+    }
+
+    // The Lua state frees all its blocks when it's closed, before its allocator is destroyed
+    LuaAllocator::~LuaAllocator() noexcept = default;
+
+    void* LuaAllocator::Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize) noexcept
+    {
+        return static_cast<LuaAllocator*>(userData)->reallocate(ptr, oldSize, newSize);
+    }
+
+    void* LuaAllocator::reallocate(void* ptr, size_t oldSize, size_t newSize) noexcept
+    {
+        std::byte* oldBlock = (ptr != nullptr) ? static_cast<std::byte*>(ptr) - HeaderSize : nullptr;
+        if (oldBlock == nullptr)
+            oldSize = 0u;
+
+        if (newSize == 0u)
+        {
+            if (oldBlock != nullptr)
+            {
+                removeAllocation(GetOwner(oldBlock), oldSize);
+                freeBlock(oldBlock, GetBlockSize(oldSize));
+            }
+            return nullptr;
+        }
+
+        const LuaMemoryAccountId oldOwner = (oldBlock != nullptr) ? GetOwner(oldBlock) : m_currentAccount;
+
+        // Only growing allocations can exceed the limit, Lua doesn't expect that shrinking a block fails
+        Account& account = m_accounts[m_currentAccount];
+        if (account.memoryLimit != 0u && newSize > oldSize)
+        {
+            const size_t releasedSize = (oldOwner == m_currentAccount) ? oldSize : 0u;
+            if (account.statistics.allocatedBytes - releasedSize + newSize > account.memoryLimit)
+            {
+                account.hasExceededMemoryLimit = true;
+                return nullptr;
+            }
+        }
+
+        const size_t oldBlockSize = (oldBlock != nullptr) ? GetBlockSize(oldSize) : 0u;
+        const size_t newBlockSize = GetBlockSize(newSize);
+        std::byte* newBlock = nullptr;
+        if (oldBlockSize == newBlockSize)
+        {
+            // Same size class
+            newBlock = oldBlock;
+        }
+        else if (oldBlockSize > MaxPooledBlockSize && newBlockSize > MaxPooledBlockSize)
+        {
+            newBlock = static_cast<std::byte*>(std::realloc(oldBlock, newBlockSize)); // NOLINT(cppcoreguidelines-no-malloc)
+            if (newBlock == nullptr)
+                return nullptr;
+        }
+        else
+        {
+            newBlock = allocateBlock(newBlockSize);
+            if (newBlock == nullptr)
+                return nullptr;
+            if (oldBlock != nullptr)
+            {
+                std::memcpy(newBlock + HeaderSize, oldBlock + HeaderSize, std::min(oldSize, newSize));
+                freeBlock(oldBlock, oldBlockSize);
+            }
+        }
+
+        // Resized blocks move to the current account, like new ones
+        if (oldBlock != nullptr)
+            removeAllocation(oldOwner, oldSize);
+        addAllocation(m_currentAccount, newSize);
+        SetOwner(newBlock, m_currentAccount);
+
+        return newBlock + HeaderSize;
+    }
+
+    std::byte* LuaAllocator::allocateBlock(size_t blockSize) noexcept
+    {
+        // Like the default allocator of Lua, which uses realloc and free
+        if (blockSize > MaxPooledBlockSize)
+            return static_cast<std::byte*>(std::malloc(blockSize)); // NOLINT(cppcoreguidelines-no-malloc)
+
+        const size_t sizeClass = blockSize / SizeClassGranularity - 1u;
+        if (m_freeBlocks[sizeClass] == nullptr && !allocateChunk(sizeClass))
+            return nullptr;
+
+        FreeBlock* block = m_freeBlocks[sizeClass];
+        m_freeBlocks[sizeClass] = block->next;
+        return reinterpret_cast<std::byte*>(block); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    void LuaAllocator::freeBlock(std::byte* block, size_t blockSize) noexcept
+    {
+        if (blockSize > MaxPooledBlockSize)
+        {
+            std::free(block); // NOLINT(cppcoreguidelines-no-malloc)
+            return;
+        }
+
+        const size_t sizeClass = blockSize / SizeClassGranularity - 1u;
+        m_freeBlocks[sizeClass] = new (block) FreeBlock{ m_freeBlocks[sizeClass] };
+    }
+
+    bool LuaAllocator::allocateChunk(size_t sizeClass) noexcept
+    {
+        try
+        {
+            m_chunks.emplace_back(PoolChunkSize);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return false;
+        }
+
+        // Blocks in ascending order, so that blocks which are allocated one after another are close to each other
+        const size_t blockSize = (sizeClass + 1u) * SizeClassGranularity;
+        std::byte* chunk = m_chunks.back().data();
+        for (size_t offset = PoolChunkSize - PoolChunkSize % blockSize; offset >= blockSize; offset -= blockSize)
+        {
+            m_freeBlocks[sizeClass] = new (chunk + offset - blockSize) FreeBlock{ m_freeBlocks[sizeClass] };
+        }
+        return true;
+    }
+
+    void LuaAllocator::addAllocation(LuaMemoryAccountId account, size_t size)
+    {
+        for (LuaMemoryStatistics* statistics : { &m_accounts[account].statistics, &m_totalStatistics })
+        {
+            statistics->allocatedBytes += size;
+            statistics->peakAllocatedBytes = std::max(statistics->peakAllocatedBytes, statistics->allocatedBytes);
+            ++statistics->allocationCount;
+        }
+    }
+
+    void LuaAllocator::removeAllocation(LuaMemoryAccountId account, size_t size)
+    {
+        Account& owner = m_accounts[account];
+        assert(owner.statistics.allocatedBytes >= size);
+        owner.statistics.allocatedBytes -= size;
+        m_totalStatistics.allocatedBytes -= size;
+
+        if (owner.isReleased && owner.statistics.allocatedBytes == 0u)
+            m_freeAccounts.push_back(account);
+    }
+
+    size_t LuaAllocator::GetBlockSize(size_t size)
+    {
+        const size_t blockSize = HeaderSize + size;
+        if (blockSize > MaxPooledBlockSize)
+            return blockSize;
+        return (blockSize + SizeClassGranularity - 1u) / SizeClassGranularity * SizeClassGranularity;
+    }
+
+    LuaMemoryAccountId LuaAllocator::GetOwner(const std::byte* block)
+    {
+        LuaMemoryAccountId account = StateAccount;
+        std::memcpy(&account, block, sizeof(account));
+        return account;
+    }
+
+    void LuaAllocator::SetOwner(std::byte* block, LuaMemoryAccountId account)
+    {
+        std::memcpy(block, &account, sizeof(account));
+    }
+
+    LuaMemoryAccountId LuaAllocator::createAccount(size_t memoryLimit)
+    {
+        LuaMemoryAccountId account = StateAccount;
+        if (m_freeAccounts.empty())
+        {
+            account = static_cast<LuaMemoryAccountId>(m_accounts.size());
+            m_accounts.emplace_back();
+        }
+        else
+        {
+            account = m_freeAccounts.back();
+            m_freeAccounts.pop_back();
+            m_accounts[account] = Account{};
+        }
+
+        m_accounts[account].memoryLimit = memoryLimit;
+        return account;
+    }
+
+    void LuaAllocator::releaseAccount(LuaMemoryAccountId account)
+    {
+        assert(account != StateAccount && account != m_currentAccount);
+        Account& released = m_accounts[account];
+        assert(!released.isReleased);
+        released.isReleased = true;
+        released.memoryLimit = 0u;
+
+        if (released.statistics.allocatedBytes == 0u)
+            m_freeAccounts.push_back(account);
+    }
+
+    const LuaMemoryStatistics& LuaAllocator::getStatistics(LuaMemoryAccountId account) const
+    {
+        return m_accounts[account].statistics;
+    }
+
+    size_t LuaAllocator::getMemoryLimit(LuaMemoryAccountId account) const
+    {
+        return m_accounts[account].memoryLimit;
+    }
+
+    bool LuaAllocator::hasExceededMemoryLimit(LuaMemoryAccountId account) const
+    {
+        return m_accounts[account].hasExceededMemoryLimit;
+    }
+
+    void LuaAllocator::resetExceededMemoryLimit(LuaMemoryAccountId account)
+    {
+        m_accounts[account].hasExceededMemoryLimit = false;
+    }
+
+    LuaMemoryAccountId LuaAllocator::getCurrentAccount() const
+    {
+        return m_currentAccount;
+    }
+
+    void LuaAllocator::setCurrentAccount(LuaMemoryAccountId account)
+    {
+        assert(!m_accounts[account].isReleased);
+        m_currentAccount = account;
+    }
+
+    const LuaMemoryStatistics& LuaAllocator::getTotalStatistics() const
+    {
+        return m_totalStatistics;
+    }
+
+    size_t LuaAllocator::getPoolsSize() const
+    {
+        return m_chunks.size() * PoolChunkSize;
+    }
+
+    LuaMemoryAccount::LuaMemoryAccount(LuaAllocator& allocator, size_t memoryLimit)
+        : m_allocator(&allocator)
+        , m_id(allocator.createAccount(memoryLimit))
+    {
+    }
+
+    LuaMemoryAccount::~LuaMemoryAccount() noexcept
+    {
+        if (m_allocator != nullptr)
+            m_allocator->releaseAccount(m_id);
+    }
+
+    LuaMemoryAccount::LuaMemoryAccount(LuaMemoryAccount&& other) noexcept
+        : m_allocator(other.m_allocator)
+        , m_id(other.m_id)
+    {
+        other.m_allocator = nullptr;
+    }
+
+    const LuaMemoryStatistics& LuaMemoryAccount::getStatistics() const
+    {
+        return m_allocator->getStatistics(m_id);
+    }
+
+    size_t LuaMemoryAccount::getMemoryLimit() const
+    {
+        return m_allocator->getMemoryLimit(m_id);
+    }
+
+    bool LuaMemoryAccount::hasExceededMemoryLimit() const
+    {
+        return m_allocator->hasExceededMemoryLimit(m_id);
+    }
+
+    void LuaMemoryAccount::resetExceededMemoryLimit()
+    {
+        m_allocator->resetExceededMemoryLimit(m_id);
+    }
+
+    LuaMemoryScope::LuaMemoryScope(const LuaMemoryAccount& account)
+        : m_allocator(*account.m_allocator)
+        , m_previousAccount(m_allocator.getCurrentAccount())
+    {
+        m_allocator.setCurrentAccount(account.m_id);
+    }
+
+    LuaMemoryScope::~LuaMemoryScope() noexcept
+    {
+        m_allocator.setCurrentAccount(m_previousAccount);
+    }
+
+    void AddLuaMemoryStatistics(LuaMemoryStatistics& sum, const LuaMemoryStatistics& statistics)
+    {
+        sum.allocatedBytes += statistics.allocatedBytes;
+        sum.peakAllocatedBytes = std::max(sum.peakAllocatedBytes, statistics.peakAllocatedBytes);
+        sum.allocationCount += statistics.allocationCount;
+    }
+}
@@ -0,0 +1,142 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LuaMemoryStatistics.h"
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    using LuaMemoryAccountId = uint32_t;
+
+    // Allocator of a Lua state (see lua_Alloc). Small blocks are taken from pools of fixed size classes, which avoids
+    // a heap allocation for most strings, tables and closures Lua creates. Larger blocks are allocated on the heap.
+    // Each block is attributed to the account which was active (see LuaMemoryScope) when it was allocated or last resized.
+    // A Lua state is only used by one thread at a time, so is its allocator
+    class LuaAllocator
+    {
+    public:
+        // Allocations outside of any scope, e.g. of the standard libraries
+        static constexpr LuaMemoryAccountId StateAccount = 0u;
+
+        LuaAllocator();
+        ~LuaAllocator() noexcept;
+        // Lua keeps a pointer to the allocator
+        LuaAllocator(const LuaAllocator& other) = delete;
+        LuaAllocator& operator=(const LuaAllocator& other) = delete;
+        LuaAllocator(LuaAllocator&& other) = delete;
+        LuaAllocator& operator=(LuaAllocator&& other) = delete;
+
+        // The lua_Alloc function, userData is the LuaAllocator
+        static void* Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize) noexcept;
+
+        // A memoryLimit of 0 means no limit. Allocations which would exceed the limit fail with a Lua memory error
+        [[nodiscard]] LuaMemoryAccountId createAccount(size_t memoryLimit);
+        // Blocks of a released account stay attributed to it until Lua frees them, the id is reused afterwards
+        void releaseAccount(LuaMemoryAccountId account);
+
+        [[nodiscard]] const LuaMemoryStatistics& getStatistics(LuaMemoryAccountId account) const;
+        [[nodiscard]] size_t getMemoryLimit(LuaMemoryAccountId account) const;
+        // True if an allocation failed because of the limit since the last reset
+        [[nodiscard]] bool hasExceededMemoryLimit(LuaMemoryAccountId account) const;
+        void resetExceededMemoryLimit(LuaMemoryAccountId account);
+
+        [[nodiscard]] LuaMemoryAccountId getCurrentAccount() const;
+        void setCurrentAccount(LuaMemoryAccountId account);
+
+        // All accounts together
+        [[nodiscard]] const LuaMemoryStatistics& getTotalStatistics() const;
+        // Memory reserved by the pools, including free blocks. Pools keep their memory until the allocator is destroyed
+        [[nodiscard]] size_t getPoolsSize() const;
+
+    private:
+        struct Account
+        {
+            LuaMemoryStatistics statistics;
+            size_t memoryLimit = 0u;
+            bool hasExceededMemoryLimit = false;
+            bool isReleased = false;
+        };
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        static constexpr size_t SizeClassGranularity = 16u;
+        static constexpr size_t SizeClassCount = 16u;
+        static constexpr size_t MaxPooledBlockSize = SizeClassGranularity * SizeClassCount;
+        static constexpr size_t PoolChunkSize = 8192u;
+
+        void* reallocate(void* ptr, size_t oldSize, size_t newSize) noexcept;
+        [[nodiscard]] std::byte* allocateBlock(size_t blockSize) noexcept;
+        void freeBlock(std::byte* block, size_t blockSize) noexcept;
+        [[nodiscard]] bool allocateChunk(size_t sizeClass) noexcept;
+
+        void addAllocation(LuaMemoryAccountId account, size_t size);
+        void removeAllocation(LuaMemoryAccountId account, size_t size);
+
+        [[nodiscard]] static size_t GetBlockSize(size_t size);
+        [[nodiscard]] static LuaMemoryAccountId GetOwner(const std::byte* block);
+        static void SetOwner(std::byte* block, LuaMemoryAccountId account);
+
+        std::vector<Account> m_accounts;
+        std::vector<LuaMemoryAccountId> m_freeAccounts;
+        LuaMemoryAccountId m_currentAccount = StateAccount;
+        LuaMemoryStatistics m_totalStatistics;
+
+        std::array<FreeBlock*, SizeClassCount> m_freeBlocks{};
+        std::vector<std::vector<std::byte>> m_chunks;
+    };
+
+    // Account of a script or module in the allocator of a Lua state, released when destroyed
+    class LuaMemoryAccount
+    {
+    public:
+        LuaMemoryAccount(LuaAllocator& allocator, size_t memoryLimit);
+        ~LuaMemoryAccount() noexcept;
+        LuaMemoryAccount(LuaMemoryAccount&& other) noexcept;
+        LuaMemoryAccount& operator=(LuaMemoryAccount&& other) = delete;
+        LuaMemoryAccount(const LuaMemoryAccount& other) = delete;
+        LuaMemoryAccount& operator=(const LuaMemoryAccount& other) = delete;
+
+        [[nodiscard]] const LuaMemoryStatistics& getStatistics() const;
+        [[nodiscard]] size_t getMemoryLimit() const;
+        [[nodiscard]] bool hasExceededMemoryLimit() const;
+        void resetExceededMemoryLimit();
+
+    private:
+        friend class LuaMemoryScope;
+
+        LuaAllocator* m_allocator;
+        LuaMemoryAccountId m_id;
+    };
+
+    // Attributes the allocations of a Lua state to the account while the scope exists, restores the previous account afterwards
+    class LuaMemoryScope
+    {
+    public:
+        explicit LuaMemoryScope(const LuaMemoryAccount& account);
+        ~LuaMemoryScope() noexcept;
+        LuaMemoryScope(const LuaMemoryScope& other) = delete;
+        LuaMemoryScope& operator=(const LuaMemoryScope& other) = delete;
+        LuaMemoryScope(LuaMemoryScope&& other) = delete;
+        LuaMemoryScope& operator=(LuaMemoryScope&& other) = delete;
+
+    private:
+        LuaAllocator& m_allocator;
+        LuaMemoryAccountId m_previousAccount;
+    };
+
+    void AddLuaMemoryStatistics(LuaMemoryStatistics& sum, const LuaMemoryStatistics& statistics);
+}
@@ -0,0 +1,396 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaArrayMath.h"
+#include "internals/SolHelper.h"
+#include "internals/LuaTypeConversions.h"
+#include "internals/LuaVector.h"
+#include "internals/WrappedLuaProperty.h"
+#include "internals/TypeUtils.h"
+
+#include "ramses-logic/Property.h"
+#include "impl/PropertyImpl.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Scratch buffers for the components of array elements, reused by all calls of a thread (scripts of different
+    // execution groups may run concurrently)
+    static thread_local std::vector<float> scratchBuffer1;
+    static thread_local std::vector<float> scratchBuffer2;
+
+    static PropertyImpl& GetElement(const PropertyImpl& array, size_t index)
+    {
+        return *array.getChild(index)->m_impl;
+    }
+
+    static EPropertyType GetElementType(const PropertyImpl& array)
+    {
+        // Arrays have at least one element
+        return GetElement(array, 0).getType();
+    }
+
+    static std::string GetArrayTypeName(const PropertyImpl& array)
+    {
+        return fmt::format("ARRAY({}, {})", array.getChildCount(), GetLuaPrimitiveTypeName(GetElementType(array)));
+    }
+
+    // Number of floats of an element, 0 if the element type has no float components
+    static size_t GetComponentCount(EPropertyType elementType)
+    {
+        switch (elementType)
+        {
+        case EPropertyType::Float:
+            return 1u;
+        case EPropertyType::Vec2f:
+            return 2u;
+        case EPropertyType::Vec3f:
+            return 3u;
+        case EPropertyType::Vec4f:
+            return 4u;
+        default:
+            return 0u;
+        }
+    }
+
+    static PropertyImpl& GetArray(std::string_view functionName, size_t argumentIndex, const sol::object& object)
+    {
+        if (!object.is<WrappedLuaProperty>() || object.as<WrappedLuaProperty>().getWrappedProperty().getType() != EPropertyType::Array)
+        {
+            sol_helper::throwSolException("arraymath.{}: expected an array property as argument #{}, but got {}!",
+                functionName, argumentIndex, LuaVectors::GetTypeName(object));
+        }
+
+        return object.as<WrappedLuaProperty>().getWrappedProperty();
+    }
+
+    static PropertyImpl& GetTargetArray(std::string_view functionName, const sol::object& object)
+    {
+        PropertyImpl& target = GetArray(functionName, 1u, object);
+        if (target.getPropertySemantics() != EPropertySemantics::ScriptOutput)
+        {
+            sol_helper::throwSolException("arraymath.{}: can't write to array '{}', only outputs can be written!", functionName, target.getName());
+        }
+        return target;
+    }
+
+    static PropertyImpl& GetFloatArray(std::string_view functionName, size_t argumentIndex, const sol::object& object)
+    {
+        PropertyImpl& array = GetArray(functionName, argumentIndex, object);
+        if (GetComponentCount(GetElementType(array)) == 0u)
+        {
+            sol_helper::throwSolException("arraymath.{}: expected an array of FLOAT, VEC2F, VEC3F or VEC4F elements as argument #{}, but got {}!",
+                functionName, argumentIndex, GetArrayTypeName(array));
+        }
+        return array;
+    }
+
+    static void CheckSameLayout(std::string_view functionName, const PropertyImpl& target, const PropertyImpl& source)
+    {
+        if (target.getChildCount() != source.getChildCount() || GetElementType(target) != GetElementType(source))
+        {
+            sol_helper::throwSolException("arraymath.{}: array '{}' ({}) doesn't match array '{}' ({})!",
+                functionName, source.getName(), GetArrayTypeName(source), target.getName(), GetArrayTypeName(target));
+        }
+    }
+
+    template <typename T>
+    static void GatherElements(const PropertyImpl& array, std::vector<float>& buffer)
+    {
+        constexpr size_t componentCount = sizeof(T) / sizeof(float);
+        const size_t elementCount = array.getChildCount();
+        buffer.resize(elementCount * componentCount);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            std::memcpy(&buffer[i * componentCount], &GetElement(array, i).getValueAs<T>(), sizeof(T));
+        }
+    }
+
+    template <typename T>
+    static void ScatterElements(const std::vector<float>& buffer, PropertyImpl& array)
+    {
+        constexpr size_t componentCount = sizeof(T) / sizeof(float);
+        const size_t elementCount = array.getChildCount();
+        assert(buffer.size() == elementCount * componentCount);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            T value{};
+            std::memcpy(&value, &buffer[i * componentCount], sizeof(T));
+            GetElement(array, i).setValueAs(value);
+        }
+    }
+
+    // Copies the float components of all elements to the buffer, one element after the other
+    static void Gather(const PropertyImpl& array, std::vector<float>& buffer)
+    {
+        switch (GetElementType(array))
+        {
+        case EPropertyType::Float:
+            GatherElements<float>(array, buffer);
+            break;
+        case EPropertyType::Vec2f:
+            GatherElements<vec2f>(array, buffer);
+            break;
+        case EPropertyType::Vec3f:
+            GatherElements<vec3f>(array, buffer);
+            break;
+        case EPropertyType::Vec4f:
+            GatherElements<vec4f>(array, buffer);
+            break;
+        default:
+            assert(false && "Only float arrays can be gathered");
+        }
+    }
+
+    static void Scatter(const std::vector<float>& buffer, PropertyImpl& array)
+    {
+        switch (GetElementType(array))
+        {
+        case EPropertyType::Float:
+            ScatterElements<float>(buffer, array);
+            break;
+        case EPropertyType::Vec2f:
+            ScatterElements<vec2f>(buffer, array);
+            break;
+        case EPropertyType::Vec3f:
+            ScatterElements<vec3f>(buffer, array);
+            break;
+        case EPropertyType::Vec4f:
+            ScatterElements<vec4f>(buffer, array);
+            break;
+        default:
+            assert(false && "Only float arrays can be scattered");
+        }
+    }
+
+    static std::array<float, 16> ExtractMatrix(const sol::object& matrix)
+    {
+        if (matrix.get_type() == sol::type::table)
+        {
+            const DataOrError<std::array<float, 16>> tableData = LuaTypeConversions::ExtractArray<float, 16>(matrix);
+            if (tableData.hasError())
+            {
+                sol_helper::throwSolException("arraymath.transform: can't convert table to a 4x4 matrix! {}", tableData.getError());
+            }
+            return tableData.getData();
+        }
+
+        const PropertyImpl& array = GetArray("transform", 3u, matrix);
+        if (array.getChildCount() != 16u || GetElementType(array) != EPropertyType::Float)
+        {
+            sol_helper::throwSolException("arraymath.transform: expected a table with 16 numbers or an ARRAY(16, FLOAT) as matrix, but got {}!", GetArrayTypeName(array));
+        }
+
+        std::array<float, 16> result{};
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] = GetElement(array, i).getValueAs<float>();
+        }
+        return result;
+    }
+
+    template <size_t N>
+    static void TransformKernel(const std::array<float, 16>& matrix, const std::vector<float>& source, std::vector<float>& target)
+    {
+        static_assert(N == 3 || N == 4, "Only points and homogeneous vectors can be transformed");
+        target.resize(source.size());
+        for (size_t offset = 0; offset < source.size(); offset += N)
+        {
+            for (size_t row = 0; row < N; ++row)
+            {
+                // Points (N == 3) have an implicit w = 1, i.e. the translation column is added
+                float value = (N == 3) ? matrix[12 + row] : 0.f;
+                for (size_t column = 0; column < N; ++column)
+                {
+                    value += matrix[column * 4 + row] * source[offset + column];
+                }
+                target[offset + row] = value;
+            }
+        }
+    }
+
+    template <size_t N>
+    static sol::object SumKernel(sol::this_state solState, const std::vector<float>& source)
+    {
+        std::array<float, N> sum{};
+        for (size_t offset = 0; offset < source.size(); offset += N)
+        {
+            for (size_t component = 0; component < N; ++component)
+            {
+                sum[component] += source[offset + component];
+            }
+        }
+
+        if constexpr (N == 1)
+        {
+            return sol::make_object(solState, sum[0]);
+        }
+        else
+        {
+            return sol::make_object(solState, LuaVector<N>(sum));
+        }
+    }
+
+    sol::table LuaArrayMath::CreateModule(sol::state& state)
+    {
+        sol::table module = state.create_table();
+        module["copy"] = &LuaArrayMath::Copy;
+        module["scale"] = &LuaArrayMath::Scale;
+        module["add"] = &LuaArrayMath::Add;
+        module["lerp"] = &LuaArrayMath::Lerp;
+        module["transform"] = &LuaArrayMath::Transform;
+        module["clamp"] = &LuaArrayMath::Clamp;
+        module["sum"] = &LuaArrayMath::Sum;
+        return module;
+    }
+
+    void LuaArrayMath::Copy(const sol::object& target, const sol::object& source)
+    {
+        PropertyImpl& targetArray = GetTargetArray("copy", target);
+        const PropertyImpl& sourceArray = GetArray("copy", 2u, source);
+        CheckSameLayout("copy", targetArray, sourceArray);
+
+        if (!TypeUtils::IsPrimitiveType(GetElementType(sourceArray)))
+        {
+            sol_helper::throwSolException("arraymath.copy: expected an array of primitive elements, but got {}!", GetArrayTypeName(sourceArray));
+        }
+
+        for (size_t i = 0; i < targetArray.getChildCount(); ++i)
+        {
+            GetElement(targetArray, i).copyValue(GetElement(sourceArray, i));
+        }
+    }
+
+    void LuaArrayMath::Scale(const sol::object& target, const sol::object& source, float factor)
+    {
+        PropertyImpl& targetArray = GetTargetArray("scale", target);
+        const PropertyImpl& sourceArray = GetFloatArray("scale", 2u, source);
+        CheckSameLayout("scale", targetArray, sourceArray);
+
+        std::vector<float>& values = scratchBuffer1;
+        Gather(sourceArray, values);
+        for (float& value : values)
+        {
+            value *= factor;
+        }
+        Scatter(values, targetArray);
+    }
+
+    void LuaArrayMath::Add(const sol::object& target, const sol::object& lhs, const sol::object& rhs)
+    {
+        PropertyImpl& targetArray = GetTargetArray("add", target);
+        const PropertyImpl& lhsArray = GetFloatArray("add", 2u, lhs);
+        const PropertyImpl& rhsArray = GetFloatArray("add", 3u, rhs);
+        CheckSameLayout("add", targetArray, lhsArray);
+        CheckSameLayout("add", targetArray, rhsArray);
+
+        std::vector<float>& values = scratchBuffer1;
+        std::vector<float>& rhsValues = scratchBuffer2;
+        Gather(lhsArray, values);
+        Gather(rhsArray, rhsValues);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] += rhsValues[i];
+        }
+        Scatter(values, targetArray);
+    }
+
+    void LuaArrayMath::Lerp(const sol::object& target, const sol::object& from, const sol::object& to, float t)
+    {
+        PropertyImpl& targetArray = GetTargetArray("lerp", target);
+        const PropertyImpl& fromArray = GetFloatArray("lerp", 2u, from);
+        const PropertyImpl& toArray = GetFloatArray("lerp", 3u, to);
+        CheckSameLayout("lerp", targetArray, fromArray);
+        CheckSameLayout("lerp", targetArray, toArray);
+
+        std::vector<float>& values = scratchBuffer1;
+        std::vector<float>& toValues = scratchBuffer2;
+        Gather(fromArray, values);
+        Gather(toArray, toValues);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] += (toValues[i] - values[i]) * t;
+        }
+        Scatter(values, targetArray);
+    }
+
+    void LuaArrayMath::Transform(const sol::object& target, const sol::object& source, const sol::object& matrix)
+    {
+        PropertyImpl& targetArray = GetTargetArray("transform", target);
+        const PropertyImpl& sourceArray = GetArray("transform", 2u, source);
+        CheckSameLayout("transform", targetArray, sourceArray);
+        const std::array<float, 16> matrixValues = ExtractMatrix(matrix);
+
+        const EPropertyType elementType = GetElementType(sourceArray);
+        if (elementType != EPropertyType::Vec3f && elementType != EPropertyType::Vec4f)
+        {
+            sol_helper::throwSolException("arraymath.transform: expected an array of VEC3F or VEC4F elements, but got {}!", GetArrayTypeName(sourceArray));
+        }
+
+        std::vector<float>& sourceValues = scratchBuffer1;
+        std::vector<float>& values = scratchBuffer2;
+        Gather(sourceArray, sourceValues);
+        if (elementType == EPropertyType::Vec3f)
+        {
+            TransformKernel<3>(matrixValues, sourceValues, values);
+        }
+        else
+        {
+            TransformKernel<4>(matrixValues, sourceValues, values);
+        }
+        Scatter(values, targetArray);
+    }
+
+    void LuaArrayMath::Clamp(const sol::object& target, const sol::object& source, float min, float max)
+    {
+        PropertyImpl& targetArray = GetTargetArray("clamp", target);
+        const PropertyImpl& sourceArray = GetFloatArray("clamp", 2u, source);
+        CheckSameLayout("clamp", targetArray, sourceArray);
+
+        if (min > max)
+        {
+            sol_helper::throwSolException("arraymath.clamp: min ({}) must not be greater than max ({})!", min, max);
+        }
+
+        std::vector<float>& values = scratchBuffer1;
+        Gather(sourceArray, values);
+        for (float& value : values)
+        {
+            value = std::min(std::max(value, min), max);
+        }
+        Scatter(values, targetArray);
+    }
+
+    sol::object LuaArrayMath::Sum(sol::this_state solState, const sol::object& source)
+    {
+        const PropertyImpl& sourceArray = GetFloatArray("sum", 1u, source);
+
+        std::vector<float>& values = scratchBuffer1;
+        Gather(sourceArray, values);
+        switch (GetComponentCount(GetElementType(sourceArray)))
+        {
+        case 1u:
+            return SumKernel<1>(solState, values);
+        case 2u:
+            return SumKernel<2>(solState, values);
+        case 3u:
+            return SumKernel<3>(solState, values);
+        case 4u:
+            return SumKernel<4>(solState, values);
+        default:
+            break;
+        }
+
+        assert(false && "Unreachable code!");
+        return sol::lua_nil;
+    }
+}
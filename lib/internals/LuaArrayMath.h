@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/SolWrapper.h"
+
+namespace rlogic::internal
+{
+    // Functions of the 'arraymath' standard module (see EStandardModule::ArrayMath), which process all elements
+    // of array properties with a single call instead of indexing each element from Lua.
+    // The float components of the elements are gathered into contiguous buffers, so that the compiler can vectorize
+    // the arithmetic loops, and then written to the target array at once
+    class LuaArrayMath
+    {
+    public:
+        // Creates the module table in the global Lua state, environments which use the module get a copy of it
+        [[nodiscard]] static sol::table CreateModule(sol::state& state);
+
+    private:
+        // target[i] = source[i], for arrays of any primitive type
+        static void Copy(const sol::object& target, const sol::object& source);
+        // target[i] = source[i] * factor
+        static void Scale(const sol::object& target, const sol::object& source, float factor);
+        // target[i] = lhs[i] + rhs[i]
+        static void Add(const sol::object& target, const sol::object& lhs, const sol::object& rhs);
+        // target[i] = from[i] + (to[i] - from[i]) * t
+        static void Lerp(const sol::object& target, const sol::object& from, const sol::object& to, float t);
+        // target[i] = matrix * source[i], with a column-major 4x4 matrix; VEC3F elements are transformed as points (w = 1)
+        static void Transform(const sol::object& target, const sol::object& source, const sol::object& matrix);
+        // Clamps each component of source[i] to [min, max]
+        static void Clamp(const sol::object& target, const sol::object& source, float min, float max);
+        // Sum of all elements, a number for FLOAT arrays or a vecN value for VECNF arrays
+        [[nodiscard]] static sol::object Sum(sol::this_state solState, const sol::object& source);
+    };
+}
@@ -44,7 +44,10 @@ namespace rlogic::internal
             return std::nullopt;
 
         // TODO Violin use separate environment for script loading, don't reuse it as a runtime environment
-        sol::environment env = solState.createEnvironment(stdModules, userModules);
+        std::optional<sol::environment> maybeEnv = solState.createEnvironment(stdModules, userModules, errorReporting);
+        if (!maybeEnv)
+            return std::nullopt;
+        sol::environment& env = *maybeEnv;
 
         env["GLOBAL"] = solState.createTable();
 
@@ -93,7 +96,10 @@ namespace rlogic::internal
         PropertyTypeExtractor inputsExtractor("IN", EPropertyType::Struct);
         PropertyTypeExtractor outputsExtractor("OUT", EPropertyType::Struct);
 
-        sol::environment interfaceEnvironment = solState.createEnvironment(stdModules, userModules);
+        std::optional<sol::environment> maybeInterfaceEnvironment = solState.createEnvironment(stdModules, userModules, errorReporting);
+        if (!maybeInterfaceEnvironment)
+            return std::nullopt;
+        sol::environment& interfaceEnvironment = *maybeInterfaceEnvironment;
 
         interfaceEnvironment["IN"] = std::ref(inputsExtractor);
         interfaceEnvironment["OUT"] = std::ref(outputsExtractor);
@@ -133,11 +139,12 @@ namespace rlogic::internal
         const StandardModules& stdModules,
         std::string source,
         std::string_view name,
-        ErrorReporting& errorReporting)
+        ErrorReporting& errorReporting,
+        std::string_view byteCode)
     {
         const std::string chunkname = BuildChunkName(name);
 
-        sol::load_result load_result = solState.loadScript(source, chunkname);
+        sol::load_result load_result = solState.loadByteCodeOrScript(source, byteCode, chunkname);
         if (!load_result.valid())
         {
             sol::error error = load_result;
@@ -145,13 +152,16 @@ namespace rlogic::internal
             return std::nullopt;
         }
 
-        if (!CrossCheckDeclaredAndProvidedModules(source, userModules, chunkname, errorReporting))
+        // Modules with byte code are loaded from a file, their dependencies were checked when they were created
+        if (byteCode.empty() && !CrossCheckDeclaredAndProvidedModules(source, userModules, chunkname, errorReporting))
             return std::nullopt;
 
-        sol::environment env = solState.createEnvironment(stdModules, userModules);
+        std::optional<sol::environment> env = solState.createEnvironment(stdModules, userModules, errorReporting);
+        if (!env)
+            return std::nullopt;
 
         sol::protected_function mainFunction = load_result;
-        env.set_on(mainFunction);
+        env->set_on(mainFunction);
 
         sol::protected_function_result main_result = mainFunction();
         if (!main_result.valid())
@@ -178,7 +188,8 @@ namespace rlogic::internal
                 stdModules,
                 userModules
             },
-            LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable)
+            LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable),
+            std::move(mainFunction)
         };
     }
 
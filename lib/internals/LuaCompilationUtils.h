@@ -51,6 +51,8 @@ namespace rlogic::internal
     {
         LuaSource source;
         sol::table moduleTable;
+        // Kept to serialize the compiled module as byte code
+        sol::protected_function mainFunction;
     };
 
     class LuaCompilationUtils
@@ -64,13 +66,15 @@ namespace rlogic::internal
             std::string_view name,
             ErrorReporting& errorReporting);
 
+        // byteCode is the precompiled source (e.g. from a file), see SolState::loadByteCodeOrScript()
         [[nodiscard]] static std::optional<LuaCompiledModule> CompileModule(
             SolState& solState,
             const ModuleMapping& userModules,
             const StandardModules& stdModules,
             std::string source,
             std::string_view name,
-            ErrorReporting& errorReporting);
+            ErrorReporting& errorReporting,
+            std::string_view byteCode = {});
 
         [[nodiscard]] static bool CheckModuleName(std::string_view name);
 
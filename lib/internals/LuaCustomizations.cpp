@@ -12,6 +12,7 @@
 
 #include "internals/SolHelper.h"
 #include "internals/WrappedLuaProperty.h"
+#include "internals/LuaVector.h"
 #include "internals/PropertyTypeExtractor.h"
 #include "internals/LuaTypeConversions.h"
 #include "internals/TypeUtils.h"
@@ -55,6 +56,12 @@ namespace rlogic::internal
             {
                 return obj.as<PropertyTypeExtractor>().getNestedExtractors().size();
             }
+
+            const size_t vectorSize = LuaVectors::GetVectorSize(obj);
+            if (vectorSize != 0u)
+            {
+                return vectorSize;
+            }
         }
 
         // Other type (unsupported) -> report usage error
@@ -242,4 +242,5 @@ namespace rlogic::internal
     template DataOrError<std::array<float, 2>> LuaTypeConversions::ExtractArray<float, 2>(const sol::object& solObject);
     template DataOrError<std::array<float, 3>> LuaTypeConversions::ExtractArray<float, 3>(const sol::object& solObject);
     template DataOrError<std::array<float, 4>> LuaTypeConversions::ExtractArray<float, 4>(const sol::object& solObject);
+    template DataOrError<std::array<float, 16>> LuaTypeConversions::ExtractArray<float, 16>(const sol::object& solObject);
 }
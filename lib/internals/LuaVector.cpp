@@ -0,0 +1,468 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaVector.h"
+#include "internals/SolHelper.h"
+#include "internals/LuaTypeConversions.h"
+#include "internals/WrappedLuaProperty.h"
+
+#include "impl/PropertyImpl.h"
+
+#include <cmath>
+#include <functional>
+
+namespace rlogic::internal
+{
+    template <size_t N>
+    static constexpr std::string_view VectorConstructorName()
+    {
+        static_assert(N >= 2 && N <= 4, "Only vec2, vec3 and vec4 are supported");
+        if constexpr (N == 2)
+        {
+            return "vec2";
+        }
+        else if constexpr (N == 3)
+        {
+            return "vec3";
+        }
+        else
+        {
+            return "vec4";
+        }
+    }
+
+    template <size_t N>
+    LuaVector<N>::LuaVector(const std::array<float, N>& components)
+        : m_components(components)
+    {
+    }
+
+    template <size_t N>
+    const std::array<float, N>& LuaVector<N>::getComponents() const
+    {
+        return m_components;
+    }
+
+    template <size_t N>
+    sol::object LuaVector<N>::index(sol::this_state solState, const sol::object& index) const
+    {
+        if (index.get_type() == sol::type::number)
+        {
+            const DataOrError<size_t> potentiallyIndex = LuaTypeConversions::ExtractSpecificType<size_t>(index);
+            if (potentiallyIndex.hasError())
+            {
+                sol_helper::throwSolException("Only non-negative integers supported as vector index type! {}", potentiallyIndex.getError());
+            }
+            const size_t indexAsInt = potentiallyIndex.getData();
+            if (indexAsInt == 0 || indexAsInt > N)
+            {
+                sol_helper::throwSolException("Bad index '{}', expected 1 <= i <= {}!", indexAsInt, N);
+            }
+            return sol::make_object(solState, m_components[indexAsInt - 1]);
+        }
+
+        if (index.get_type() == sol::type::string)
+        {
+            const std::string_view componentName = index.as<std::string_view>();
+            constexpr std::string_view componentNames = "xyzw";
+            const size_t componentIndex = componentName.size() == 1 ? componentNames.find(componentName[0]) : std::string_view::npos;
+            if (componentIndex < N)
+            {
+                return sol::make_object(solState, m_components[componentIndex]);
+            }
+            sol_helper::throwSolException("Tried to access undefined field '{}' of {} value!", componentName, VectorConstructorName<N>());
+        }
+
+        sol_helper::throwSolException("Bad access to {} value with index of type {}!", VectorConstructorName<N>(), sol_helper::GetSolTypeName(index.get_type()));
+        return sol::lua_nil;
+    }
+
+    template <size_t N>
+    void LuaVector<N>::newIndex(const sol::object& /*index*/, const sol::object& /*rhs*/)
+    {
+        sol_helper::throwSolException("Can't assign individual components of {0} values, must create a new value (e.g. with {0}())!", VectorConstructorName<N>());
+    }
+
+    template <size_t N>
+    bool LuaVector<N>::equals(const LuaVector& other) const
+    {
+        return m_components == other.m_components;
+    }
+
+    template <size_t N>
+    std::string LuaVector<N>::toString() const
+    {
+        return fmt::format("{}({})", VectorConstructorName<N>(), fmt::join(m_components, ", "));
+    }
+
+    template <size_t N>
+    float LuaVector<N>::dot(const sol::object& other) const
+    {
+        const std::array<float, N> otherComponents = ExtractComponents(other);
+        float result = 0.f;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result += m_components[i] * otherComponents[i];
+        }
+        return result;
+    }
+
+    template <size_t N>
+    float LuaVector<N>::length() const
+    {
+        float squaredLength = 0.f;
+        for (float component : m_components)
+        {
+            squaredLength += component * component;
+        }
+        return std::sqrt(squaredLength);
+    }
+
+    template <size_t N>
+    LuaVector<N> LuaVector<N>::normalize() const
+    {
+        const float vectorLength = length();
+        if (vectorLength == 0.f)
+        {
+            return *this;
+        }
+
+        std::array<float, N> result = m_components;
+        for (float& component : result)
+        {
+            component /= vectorLength;
+        }
+        return LuaVector(result);
+    }
+
+    template <size_t N>
+    LuaVector<N> LuaVector<N>::lerp(const sol::object& other, float t) const
+    {
+        const std::array<float, N> otherComponents = ExtractComponents(other);
+        std::array<float, N> result = m_components;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result[i] += (otherComponents[i] - m_components[i]) * t;
+        }
+        return LuaVector(result);
+    }
+
+    template <size_t N>
+    std::array<float, N> LuaVector<N>::ExtractComponents(const sol::object& object)
+    {
+        if (object.get_type() == sol::type::userdata)
+        {
+            if (object.is<LuaVector<N>>())
+            {
+                return object.as<LuaVector<N>>().m_components;
+            }
+
+            if (object.is<WrappedLuaProperty>())
+            {
+                const PropertyImpl& property = object.as<WrappedLuaProperty>().getWrappedProperty();
+                if (property.getType() == PropertyTypeToEnum<std::array<float, N>>::TYPE)
+                {
+                    return property.getValueAs<std::array<float, N>>();
+                }
+            }
+        }
+        else if (object.get_type() == sol::type::table)
+        {
+            const DataOrError<std::array<float, N>> tableData = LuaTypeConversions::ExtractArray<float, N>(object);
+            if (tableData.hasError())
+            {
+                sol_helper::throwSolException("Can't convert table to {}! {}", VectorConstructorName<N>(), tableData.getError());
+            }
+            return tableData.getData();
+        }
+
+        sol_helper::throwSolException("Expected {0} value, VEC{1}F property or table with {1} numbers, but got {2}!",
+            VectorConstructorName<N>(), N, LuaVectors::GetTypeName(object));
+        return {};
+    }
+
+    // Scalars are applied to all components, e.g. 2 * vec3(1, 2, 3) == vec3(2, 4, 6)
+    template <size_t N, typename Operation>
+    static LuaVector<N> ApplyComponentWise(const sol::object& lhs, const sol::object& rhs, Operation operation)
+    {
+        std::array<float, N> result{};
+        if (lhs.get_type() == sol::type::number)
+        {
+            const auto scalar = lhs.as<float>();
+            const std::array<float, N> rhsComponents = LuaVector<N>::ExtractComponents(rhs);
+            for (size_t i = 0; i < N; ++i)
+            {
+                result[i] = operation(scalar, rhsComponents[i]);
+            }
+        }
+        else if (rhs.get_type() == sol::type::number)
+        {
+            const std::array<float, N> lhsComponents = LuaVector<N>::ExtractComponents(lhs);
+            const auto scalar = rhs.as<float>();
+            for (size_t i = 0; i < N; ++i)
+            {
+                result[i] = operation(lhsComponents[i], scalar);
+            }
+        }
+        else
+        {
+            const std::array<float, N> lhsComponents = LuaVector<N>::ExtractComponents(lhs);
+            const std::array<float, N> rhsComponents = LuaVector<N>::ExtractComponents(rhs);
+            for (size_t i = 0; i < N; ++i)
+            {
+                result[i] = operation(lhsComponents[i], rhsComponents[i]);
+            }
+        }
+        return LuaVector<N>(result);
+    }
+
+    // Metamethods of vecN values, at least one of the operands is a vecN value
+    template <size_t N>
+    static LuaVector<N> AddVectors(const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyComponentWise<N>(lhs, rhs, std::plus<float>());
+    }
+
+    template <size_t N>
+    static LuaVector<N> SubtractVectors(const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyComponentWise<N>(lhs, rhs, std::minus<float>());
+    }
+
+    template <size_t N>
+    static LuaVector<N> MultiplyVectors(const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyComponentWise<N>(lhs, rhs, std::multiplies<float>());
+    }
+
+    template <size_t N>
+    static LuaVector<N> DivideVectors(const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyComponentWise<N>(lhs, rhs, std::divides<float>());
+    }
+
+    template <size_t N>
+    static LuaVector<N> NegateVector(const LuaVector<N>& operand, const sol::object& /*sameOperand*/)
+    {
+        std::array<float, N> result = operand.getComponents();
+        for (float& component : result)
+        {
+            component = -component;
+        }
+        return LuaVector<N>(result);
+    }
+
+    static LuaVector<3> CrossVectors(const LuaVector<3>& lhs, const sol::object& rhs)
+    {
+        const std::array<float, 3>& a = lhs.getComponents();
+        const std::array<float, 3> b = LuaVector<3>::ExtractComponents(rhs);
+        return LuaVector<3>({
+            a[1] * b[2] - a[2] * b[1],
+            a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]
+        });
+    }
+
+    // Accepts N numbers, a single number which is used for all components, or a single object accepted by ExtractComponents()
+    template <size_t N>
+    static LuaVector<N> CreateVector(sol::variadic_args args)
+    {
+        const auto argCount = static_cast<size_t>(args.size());
+        if (argCount == 1u)
+        {
+            const auto arg = args[0].get<sol::object>();
+            if (arg.get_type() == sol::type::number)
+            {
+                std::array<float, N> components{};
+                components.fill(arg.as<float>());
+                return LuaVector<N>(components);
+            }
+            return LuaVector<N>(LuaVector<N>::ExtractComponents(arg));
+        }
+
+        if (argCount != N)
+        {
+            sol_helper::throwSolException("{}() expects {} numbers or a single argument, but received {} arguments!", VectorConstructorName<N>(), N, argCount);
+        }
+
+        std::array<float, N> components{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            const DataOrError<float> component = LuaTypeConversions::ExtractSpecificType<float>(args[i].get<sol::object>());
+            if (component.hasError())
+            {
+                sol_helper::throwSolException("Bad argument #{} to {}()! {}", i + 1, VectorConstructorName<N>(), component.getError());
+            }
+            components[i] = component.getData();
+        }
+        return LuaVector<N>(components);
+    }
+
+    template <size_t N>
+    static sol::usertype<LuaVector<N>> RegisterVectorType(sol::state& state)
+    {
+        state[VectorConstructorName<N>()] = &CreateVector<N>;
+
+        return state.new_usertype<LuaVector<N>>(fmt::format("LuaVector{}", N),
+            sol::no_constructor,
+            "dot", &LuaVector<N>::dot,
+            "length", &LuaVector<N>::length,
+            "normalize", &LuaVector<N>::normalize,
+            "lerp", &LuaVector<N>::lerp,
+            // Only called for keys which are not one of the methods above
+            sol::meta_method::index, &LuaVector<N>::index,
+            sol::meta_method::new_index, &LuaVector<N>::newIndex,
+            sol::meta_method::length, [](const LuaVector<N>& /*vector*/) { return N; },
+            sol::meta_method::equal_to, &LuaVector<N>::equals,
+            sol::meta_method::to_string, &LuaVector<N>::toString,
+            sol::meta_method::addition, &AddVectors<N>,
+            sol::meta_method::subtraction, &SubtractVectors<N>,
+            sol::meta_method::multiplication, &MultiplyVectors<N>,
+            sol::meta_method::division, &DivideVectors<N>,
+            sol::meta_method::unary_minus, &NegateVector<N>);
+    }
+
+    void LuaVectors::RegisterTypes(sol::state& state)
+    {
+        RegisterVectorType<2>(state);
+        sol::usertype<LuaVector<3>> vec3Type = RegisterVectorType<3>(state);
+        vec3Type["cross"] = &CrossVectors;
+        RegisterVectorType<4>(state);
+    }
+
+    void LuaVectors::MapToEnvironment(sol::state& state, sol::environment& env)
+    {
+        env["vec2"] = state["vec2"];
+        env["vec3"] = state["vec3"];
+        env["vec4"] = state["vec4"];
+    }
+
+    template <typename Operation>
+    static sol::object ApplyToProperty(sol::this_state solState, const sol::object& lhs, const sol::object& rhs, Operation operation, std::string_view operatorName)
+    {
+        // Properties only support float vectors, other types have no vector size
+        size_t vectorSize = LuaVectors::GetVectorSize(lhs);
+        if (vectorSize == 0u)
+        {
+            vectorSize = LuaVectors::GetVectorSize(rhs);
+        }
+
+        switch (vectorSize)
+        {
+        case 2u:
+            return sol::make_object(solState, ApplyComponentWise<2>(lhs, rhs, operation));
+        case 3u:
+            return sol::make_object(solState, ApplyComponentWise<3>(lhs, rhs, operation));
+        case 4u:
+            return sol::make_object(solState, ApplyComponentWise<4>(lhs, rhs, operation));
+        default:
+            break;
+        }
+
+        sol_helper::throwSolException("Can't apply operator '{}' to {} and {}! Arithmetic operators are only supported for VEC2F, VEC3F and VEC4F properties and vec2, vec3 and vec4 values",
+            operatorName, LuaVectors::GetTypeName(lhs), LuaVectors::GetTypeName(rhs));
+        return sol::lua_nil;
+    }
+
+    sol::object LuaVectors::Add(sol::this_state solState, const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyToProperty(solState, lhs, rhs, std::plus<float>(), "+");
+    }
+
+    sol::object LuaVectors::Subtract(sol::this_state solState, const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyToProperty(solState, lhs, rhs, std::minus<float>(), "-");
+    }
+
+    sol::object LuaVectors::Multiply(sol::this_state solState, const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyToProperty(solState, lhs, rhs, std::multiplies<float>(), "*");
+    }
+
+    sol::object LuaVectors::Divide(sol::this_state solState, const sol::object& lhs, const sol::object& rhs)
+    {
+        return ApplyToProperty(solState, lhs, rhs, std::divides<float>(), "/");
+    }
+
+    sol::object LuaVectors::Negate(sol::this_state solState, const sol::object& operand, const sol::object& sameOperand)
+    {
+        if (GetVectorSize(operand) == 0u)
+        {
+            sol_helper::throwSolException("Can't apply unary operator '-' to {}! Arithmetic operators are only supported for VEC2F, VEC3F and VEC4F properties and vec2, vec3 and vec4 values",
+                GetTypeName(operand));
+        }
+        return ApplyToProperty(solState, operand, sameOperand, [](float component, float /*sameComponent*/) { return -component; }, "-");
+    }
+
+    size_t LuaVectors::GetVectorSize(const sol::object& object)
+    {
+        if (object.get_type() != sol::type::userdata)
+        {
+            return 0u;
+        }
+
+        if (object.is<LuaVector<3>>())
+        {
+            return 3u;
+        }
+        if (object.is<LuaVector<4>>())
+        {
+            return 4u;
+        }
+        if (object.is<LuaVector<2>>())
+        {
+            return 2u;
+        }
+
+        if (object.is<WrappedLuaProperty>())
+        {
+            switch (object.as<WrappedLuaProperty>().getWrappedProperty().getType())
+            {
+            case EPropertyType::Vec2f:
+                return 2u;
+            case EPropertyType::Vec3f:
+                return 3u;
+            case EPropertyType::Vec4f:
+                return 4u;
+            default:
+                break;
+            }
+        }
+
+        return 0u;
+    }
+
+    std::string LuaVectors::GetTypeName(const sol::object& object)
+    {
+        if (object.get_type() == sol::type::userdata)
+        {
+            if (object.is<LuaVector<2>>())
+            {
+                return std::string(VectorConstructorName<2>());
+            }
+            if (object.is<LuaVector<3>>())
+            {
+                return std::string(VectorConstructorName<3>());
+            }
+            if (object.is<LuaVector<4>>())
+            {
+                return std::string(VectorConstructorName<4>());
+            }
+            if (object.is<WrappedLuaProperty>())
+            {
+                return fmt::format("{} property", GetLuaPrimitiveTypeName(object.as<WrappedLuaProperty>().getWrappedProperty().getType()));
+            }
+        }
+
+        return std::string(sol_helper::GetSolTypeName(object.get_type()));
+    }
+
+    template class LuaVector<2>;
+    template class LuaVector<3>;
+    template class LuaVector<4>;
+}
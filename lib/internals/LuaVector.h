@@ -0,0 +1,69 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/SolWrapper.h"
+
+#include <array>
+#include <string>
+
+namespace rlogic::internal
+{
+    // Immutable vector of floats, created with vec2(), vec3() and vec4() in Lua scripts and modules.
+    // Supports arithmetic operators and basic vector math, and can be assigned to VECNF outputs
+    // directly, without conversion from a Lua table
+    template <size_t N>
+    class LuaVector
+    {
+    public:
+        explicit LuaVector(const std::array<float, N>& components);
+
+        [[nodiscard]] const std::array<float, N>& getComponents() const;
+
+        // Interface metamethods used by Lua
+        // Called on 'X = obj.x' or 'X = obj[1]'
+        [[nodiscard]] sol::object index(sol::this_state solState, const sol::object& index) const;
+        // Called on 'obj.x = rhs', always fails because vectors are values and can't be modified
+        void newIndex(const sol::object& index, const sol::object& rhs);
+        [[nodiscard]] bool equals(const LuaVector& other) const;
+        [[nodiscard]] std::string toString() const;
+
+        // Vector math, the other operand can be anything accepted by ExtractComponents()
+        [[nodiscard]] float dot(const sol::object& other) const;
+        [[nodiscard]] float length() const;
+        // Zero vectors stay zero
+        [[nodiscard]] LuaVector normalize() const;
+        [[nodiscard]] LuaVector lerp(const sol::object& other, float t) const;
+
+        // Accepts a vecN value, a VECNF property or a Lua table with N numbers, raises a Lua error otherwise
+        [[nodiscard]] static std::array<float, N> ExtractComponents(const sol::object& object);
+
+    private:
+        std::array<float, N> m_components;
+    };
+
+    class LuaVectors
+    {
+    public:
+        static void RegisterTypes(sol::state& state);
+        static void MapToEnvironment(sol::state& state, sol::environment& env);
+
+        // Arithmetic metamethods of VECNF properties, the result is a vecN value
+        [[nodiscard]] static sol::object Add(sol::this_state solState, const sol::object& lhs, const sol::object& rhs);
+        [[nodiscard]] static sol::object Subtract(sol::this_state solState, const sol::object& lhs, const sol::object& rhs);
+        [[nodiscard]] static sol::object Multiply(sol::this_state solState, const sol::object& lhs, const sol::object& rhs);
+        [[nodiscard]] static sol::object Divide(sol::this_state solState, const sol::object& lhs, const sol::object& rhs);
+        // Lua 5.1 passes the operand of unary minus twice
+        [[nodiscard]] static sol::object Negate(sol::this_state solState, const sol::object& operand, const sol::object& sameOperand);
+
+        // Returns N for vecN values and VECNF properties, 0 for anything else
+        [[nodiscard]] static size_t GetVectorSize(const sol::object& object);
+        [[nodiscard]] static std::string GetTypeName(const sol::object& object);
+    };
+}
@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/NativeNodeTypes.h"
+#include "internals/TypeData.h"
+
+#include <string>
+#include <memory>
+#include <unordered_map>
+
+namespace rlogic::internal
+{
+    // A native node type registered with LogicEngine::registerNativeNodeType(). Shared by all nodes of the type,
+    // the registry of a logic engine is kept when a file is loaded so that the nodes from the file can be re-created
+    struct NativeNodeType
+    {
+        std::string name;
+        HierarchicalTypeData inputs;
+        HierarchicalTypeData outputs;
+        NativeNodeUpdateFunction updateFunction;
+    };
+
+    using NativeNodeTypeRegistry = std::unordered_map<std::string, std::shared_ptr<const NativeNodeType>>;
+}
@@ -0,0 +1,135 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/PropertyTypeDescriptor.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        size_t CombineHash(size_t seed, size_t value)
+        {
+            return seed ^ (value + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+        }
+    }
+
+    PropertyTypeDescriptor::PropertyTypeDescriptor(TypeData typeData, std::vector<SharedPropertyTypeDescriptor> children)
+        : m_typeData(std::move(typeData))
+        , m_children(std::move(children))
+    {
+        m_hash = CombineHash(std::hash<std::string>()(m_typeData.name), static_cast<size_t>(m_typeData.type));
+        for (const auto& child : m_children)
+        {
+            assert(child);
+            m_hash = CombineHash(m_hash, child->getHash());
+        }
+
+        // Array elements have no names, they are accessed by index
+        if (m_typeData.type == EPropertyType::Struct)
+        {
+            m_childNameIndex.reserve(m_children.size());
+            for (size_t i = 0; i < m_children.size(); ++i)
+            {
+                m_childNameIndex.emplace_back(m_children[i]->getName(), i);
+            }
+            // Sorted by index as second key, so that the first child wins if names are not unique (same as a linear search)
+            std::sort(m_childNameIndex.begin(), m_childNameIndex.end());
+        }
+    }
+
+    SharedPropertyTypeDescriptor PropertyTypeDescriptor::Create(const HierarchicalTypeData& type)
+    {
+        std::vector<SharedPropertyTypeDescriptor> children;
+        children.reserve(type.children.size());
+        for (size_t i = 0; i < type.children.size(); ++i)
+        {
+            if (i > 0u && type.children[i] == type.children[i - 1])
+            {
+                children.push_back(children.back());
+            }
+            else
+            {
+                children.push_back(Create(type.children[i]));
+            }
+        }
+        return std::make_shared<const PropertyTypeDescriptor>(type.typeData, std::move(children));
+    }
+
+    const std::string& PropertyTypeDescriptor::getName() const
+    {
+        return m_typeData.name;
+    }
+
+    EPropertyType PropertyTypeDescriptor::getType() const
+    {
+        return m_typeData.type;
+    }
+
+    size_t PropertyTypeDescriptor::getChildCount() const
+    {
+        return m_children.size();
+    }
+
+    const SharedPropertyTypeDescriptor& PropertyTypeDescriptor::getChild(size_t index) const
+    {
+        assert(index < m_children.size());
+        return m_children[index];
+    }
+
+    std::optional<size_t> PropertyTypeDescriptor::findStructChildIndex(std::string_view name) const
+    {
+        assert(m_typeData.type == EPropertyType::Struct);
+        const auto it = std::lower_bound(m_childNameIndex.cbegin(), m_childNameIndex.cend(), name, [](const std::pair<std::string_view, size_t>& entry, std::string_view searchedName) {
+            return entry.first < searchedName;
+        });
+        if (it != m_childNameIndex.cend() && it->first == name)
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    size_t PropertyTypeDescriptor::getHash() const
+    {
+        return m_hash;
+    }
+
+    bool PropertyTypeDescriptor::operator==(const PropertyTypeDescriptor& other) const
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+        if (m_hash != other.m_hash || m_typeData != other.m_typeData || m_children.size() != other.m_children.size())
+        {
+            return false;
+        }
+        return std::equal(m_children.cbegin(), m_children.cend(), other.m_children.cbegin(), [](const SharedPropertyTypeDescriptor& lhs, const SharedPropertyTypeDescriptor& rhs) {
+            return *lhs == *rhs;
+        });
+    }
+
+    bool PropertyTypeDescriptor::operator!=(const PropertyTypeDescriptor& other) const
+    {
+        return !operator==(other);
+    }
+
+    size_t PropertyTypeDescriptor::getOwnAllocatedMemory() const
+    {
+        // Names which fit into the small string buffer are part of sizeof(std::string)
+        const size_t nameMemory = (m_typeData.name.capacity() > std::string().capacity()) ? m_typeData.name.capacity() + 1u : 0u;
+        return sizeof(PropertyTypeDescriptor) +
+            nameMemory +
+            m_children.capacity() * sizeof(SharedPropertyTypeDescriptor) +
+            m_childNameIndex.capacity() * sizeof(std::pair<std::string_view, size_t>);
+    }
+}
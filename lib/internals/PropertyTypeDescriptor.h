@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/TypeData.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class PropertyTypeDescriptor;
+    using SharedPropertyTypeDescriptor = std::shared_ptr<const PropertyTypeDescriptor>;
+
+    // Immutable layout of a property: name, type and the layouts of its children. Properties with the same layout
+    // reference the same descriptor (e.g. the inputs of all scripts created from the same source), so that a property
+    // tree only has to keep values and links per instance.
+    class PropertyTypeDescriptor
+    {
+    public:
+        PropertyTypeDescriptor(TypeData typeData, std::vector<SharedPropertyTypeDescriptor> children);
+
+        // Creates the descriptor tree of the type. Equal consecutive children (e.g. array elements) share their descriptor
+        [[nodiscard]] static SharedPropertyTypeDescriptor Create(const HierarchicalTypeData& type);
+
+        [[nodiscard]] const std::string& getName() const;
+        [[nodiscard]] EPropertyType getType() const;
+        [[nodiscard]] size_t getChildCount() const;
+        [[nodiscard]] const SharedPropertyTypeDescriptor& getChild(size_t index) const;
+        // Index of the first child of a struct with that name, lookup in O(log(N))
+        [[nodiscard]] std::optional<size_t> findStructChildIndex(std::string_view name) const;
+
+        // Hash of the whole layout, equal layouts have the same hash
+        [[nodiscard]] size_t getHash() const;
+        // Compares the whole layout (shortcut for shared children)
+        [[nodiscard]] bool operator==(const PropertyTypeDescriptor& other) const;
+        [[nodiscard]] bool operator!=(const PropertyTypeDescriptor& other) const;
+
+        // Memory allocated for this descriptor, without its children
+        [[nodiscard]] size_t getOwnAllocatedMemory() const;
+
+    private:
+        TypeData m_typeData;
+        std::vector<SharedPropertyTypeDescriptor> m_children;
+        // Struct children sorted by name (pointing to the names of the child descriptors)
+        std::vector<std::pair<std::string_view, size_t>> m_childNameIndex;
+        size_t m_hash = 0u;
+    };
+}
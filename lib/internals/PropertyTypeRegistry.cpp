@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/PropertyTypeRegistry.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    SharedPropertyTypeDescriptor PropertyTypeRegistry::getOrRegister(const SharedPropertyTypeDescriptor& descriptor)
+    {
+        assert(descriptor);
+        const size_t hash = descriptor->getHash();
+
+        auto [begin, end] = m_descriptors.equal_range(hash);
+        auto it = begin;
+        while (it != end)
+        {
+            SharedPropertyTypeDescriptor registeredDescriptor = it->second.lock();
+            if (!registeredDescriptor)
+            {
+                // Drop descriptors of destroyed property trees on the way
+                it = m_descriptors.erase(it);
+                continue;
+            }
+            if (*registeredDescriptor == *descriptor)
+            {
+                return registeredDescriptor;
+            }
+            ++it;
+        }
+
+        // Descriptors of other hashes are released as well, e.g. when scripts with different interfaces are created and destroyed.
+        // An expired entry still keeps the memory of its descriptor, which was allocated together with the control block
+        if (m_descriptors.size() >= m_pruneThreshold)
+            pruneReleasedDescriptors();
+
+        m_descriptors.emplace(hash, descriptor);
+        return descriptor;
+    }
+
+    void PropertyTypeRegistry::pruneReleasedDescriptors()
+    {
+        for (auto it = m_descriptors.begin(); it != m_descriptors.end();)
+        {
+            if (it->second.expired())
+                it = m_descriptors.erase(it);
+            else
+                ++it;
+        }
+
+        // Amortized over the registrations until the next pruning
+        m_pruneThreshold = std::max(MinPruneThreshold, 2u * m_descriptors.size());
+    }
+
+    size_t PropertyTypeRegistry::getTypeCount() const
+    {
+        return static_cast<size_t>(std::count_if(m_descriptors.cbegin(), m_descriptors.cend(), [](const auto& entry) { return !entry.second.expired(); }));
+    }
+
+    size_t PropertyTypeRegistry::getEntryCount() const
+    {
+        return m_descriptors.size();
+    }
+}
@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/PropertyTypeDescriptor.h"
+
+#include <unordered_map>
+#include <memory>
+
+namespace rlogic::internal
+{
+    // Deduplicates the type descriptors of the property trees of a logic engine. Only keeps weak references, a
+    // descriptor is released when the last property tree which uses it is destroyed.
+    class PropertyTypeRegistry
+    {
+    public:
+        // Returns the registered descriptor which is equal to the given one, or registers the given one
+        [[nodiscard]] SharedPropertyTypeDescriptor getOrRegister(const SharedPropertyTypeDescriptor& descriptor);
+
+        // Number of registered descriptors which are still in use
+        [[nodiscard]] size_t getTypeCount() const;
+        // Number of entries, including those of released descriptors which were not pruned yet
+        [[nodiscard]] size_t getEntryCount() const;
+
+    private:
+        void pruneReleasedDescriptors();
+
+        // The entries of released descriptors are pruned when the registry has grown to this size, so that it never
+        // holds more than about twice the entries of the descriptors in use
+        static constexpr size_t MinPruneThreshold = 64u;
+
+        std::unordered_multimap<size_t, std::weak_ptr<const PropertyTypeDescriptor>> m_descriptors;
+        size_t m_pruneThreshold = MinPruneThreshold;
+    };
+}
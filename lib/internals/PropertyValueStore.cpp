@@ -0,0 +1,243 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/PropertyValueStore.h"
+
+#include <utility>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        template <typename T>
+        struct TypeTag
+        {
+            using type = T;
+        };
+
+        // Calls the visitor with the TypeTag of the C++ type which stores values of the given property type
+        template <typename Visitor>
+        decltype(auto) VisitValueType(EPropertyType type, Visitor&& visitor)
+        {
+            switch (type)
+            {
+            case EPropertyType::Float:
+                return visitor(TypeTag<float>{});
+            case EPropertyType::Vec2f:
+                return visitor(TypeTag<vec2f>{});
+            case EPropertyType::Vec3f:
+                return visitor(TypeTag<vec3f>{});
+            case EPropertyType::Vec4f:
+                return visitor(TypeTag<vec4f>{});
+            case EPropertyType::Int32:
+                return visitor(TypeTag<int32_t>{});
+            case EPropertyType::Int64:
+                return visitor(TypeTag<int64_t>{});
+            case EPropertyType::Vec2i:
+                return visitor(TypeTag<vec2i>{});
+            case EPropertyType::Vec3i:
+                return visitor(TypeTag<vec3i>{});
+            case EPropertyType::Vec4i:
+                return visitor(TypeTag<vec4i>{});
+            case EPropertyType::String:
+                return visitor(TypeTag<std::string>{});
+            case EPropertyType::Bool:
+                return visitor(TypeTag<bool>{});
+            case EPropertyType::Array:
+            case EPropertyType::Struct:
+                break;
+            }
+
+            assert(false && "Only primitive properties have a value");
+            return visitor(TypeTag<int32_t>{});
+        }
+    }
+
+    PropertyValueStore::PropertyValueStore()
+        : m_emptyString(std::make_shared<std::string>())
+    {
+    }
+
+    PropertyValueStore::Index PropertyValueStore::add(EPropertyType type)
+    {
+        return VisitValueType(type, [this](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                return addTyped<T>(m_emptyString);
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                return addTyped<T>(BoolValue{ false });
+            }
+            else
+            {
+                return addTyped<T>(T{});
+            }
+        });
+    }
+
+    PropertyValueStore::Index PropertyValueStore::add(PropertyValue value)
+    {
+        return std::visit([this](auto&& typedValue) {
+            using T = std::decay_t<decltype(typedValue)>;
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                return addTyped<T>(createString(std::forward<decltype(typedValue)>(typedValue)));
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                return addTyped<T>(BoolValue{ typedValue });
+            }
+            else
+            {
+                return addTyped<T>(std::forward<decltype(typedValue)>(typedValue));
+            }
+        }, std::move(value));
+    }
+
+    PropertyValueStore::Index PropertyValueStore::moveFrom(PropertyValueStore& source, EPropertyType type, Index sourceIndex)
+    {
+        return VisitValueType(type, [this, &source, sourceIndex](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            const Index index = addTyped<T>(std::move(source.getStored<T>(sourceIndex)));
+            source.releaseTyped<T>(sourceIndex);
+            return index;
+        });
+    }
+
+    void PropertyValueStore::release(EPropertyType type, Index index)
+    {
+        VisitValueType(type, [this, index](auto typeTag) {
+            releaseTyped<typename decltype(typeTag)::type>(index);
+        });
+    }
+
+    bool PropertyValueStore::setString(Index index, std::string_view value)
+    {
+        SharedString& storedString = getStored<std::string>(index);
+        if (*storedString == value)
+        {
+            return false;
+        }
+
+        // Only overwrite buffers which are not referenced by other values (the empty string is always shared)
+        if (storedString.use_count() == 1)
+        {
+            storedString->assign(value);
+        }
+        else
+        {
+            storedString = std::make_shared<std::string>(value);
+        }
+        return true;
+    }
+
+    PropertyValue PropertyValueStore::getValue(EPropertyType type, Index index) const
+    {
+        return VisitValueType(type, [this, index](auto typeTag) {
+            return PropertyValue{ get<typename decltype(typeTag)::type>(index) };
+        });
+    }
+
+    bool PropertyValueStore::setValue(Index index, PropertyValue value)
+    {
+        return std::visit([this, index](auto&& typedValue) {
+            using T = std::decay_t<decltype(typedValue)>;
+            return set<T>(index, std::forward<decltype(typedValue)>(typedValue));
+        }, std::move(value));
+    }
+
+    bool PropertyValueStore::copyValue(EPropertyType type, Index targetIndex, const PropertyValueStore& source, Index sourceIndex)
+    {
+        return VisitValueType(type, [this, targetIndex, &source, sourceIndex](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                const SharedString& sourceString = source.getStored<T>(sourceIndex);
+                SharedString& targetString = getStored<T>(targetIndex);
+                // Values which were propagated before share the buffer, no need to compare the content
+                if (targetString == sourceString)
+                {
+                    return false;
+                }
+                const bool valueChanged = (*targetString != *sourceString);
+                targetString = sourceString;
+                return valueChanged;
+            }
+            else
+            {
+                return set<T>(targetIndex, source.get<T>(sourceIndex));
+            }
+        });
+    }
+
+    bool PropertyValueStore::sharesStringBuffer(Index index, const PropertyValueStore& other, Index otherIndex) const
+    {
+        return getStored<std::string>(index) == other.getStored<std::string>(otherIndex);
+    }
+
+    size_t PropertyValueStore::getValueCount() const
+    {
+        return std::apply([](const auto&... valueArrays) {
+            return ((valueArrays.values.size() - valueArrays.freeIndices.size()) + ...);
+        }, m_valueArrays);
+    }
+
+    size_t PropertyValueStore::getAllocatedMemory() const
+    {
+        return std::apply([](const auto&... valueArrays) {
+            return ((valueArrays.values.capacity() * sizeof(typename std::decay_t<decltype(valueArrays.values)>::value_type) +
+                valueArrays.freeIndices.capacity() * sizeof(Index)) + ...);
+        }, m_valueArrays);
+    }
+
+    template <typename T>
+    PropertyValueStore::Index PropertyValueStore::addTyped(StoredType<T> value)
+    {
+        ValueArray<T>& valueArray = std::get<ValueArray<T>>(m_valueArrays);
+
+        Index index = 0u;
+        if (valueArray.freeIndices.empty())
+        {
+            index = static_cast<Index>(valueArray.values.size());
+            valueArray.values.emplace_back();
+        }
+        else
+        {
+            index = valueArray.freeIndices.back();
+            valueArray.freeIndices.pop_back();
+        }
+
+        valueArray.values[index] = std::move(value);
+        return index;
+    }
+
+    template <typename T>
+    void PropertyValueStore::releaseTyped(Index index)
+    {
+        ValueArray<T>& valueArray = std::get<ValueArray<T>>(m_valueArrays);
+        assert(index < valueArray.values.size());
+
+        // Don't keep the memory of released strings
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            valueArray.values[index] = m_emptyString;
+        }
+        valueArray.freeIndices.push_back(index);
+    }
+
+    PropertyValueStore::SharedString PropertyValueStore::createString(std::string value) const
+    {
+        if (value.empty())
+        {
+            return m_emptyString;
+        }
+        return std::make_shared<std::string>(std::move(value));
+    }
+}
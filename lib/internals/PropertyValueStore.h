@@ -0,0 +1,176 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EPropertyType.h"
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <tuple>
+#include <variant>
+#include <type_traits>
+#include <cstdint>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    using PropertyValue = std::variant<int32_t, int64_t, float, bool, std::string, vec2f, vec3f, vec4f, vec2i, vec3i, vec4i>;
+
+    inline EPropertyType GetPropertyValueType(const PropertyValue& value)
+    {
+        return std::visit([](const auto& typedValue) { return PropertyTypeToEnum<std::decay_t<decltype(typedValue)>>::TYPE; }, value);
+    }
+
+    // Keeps the values of primitive properties in one contiguous array per value type, properties only hold the index of their value.
+    // The properties of all logic nodes of a logic engine share the store of the engine. A property tree which doesn't belong to a
+    // logic engine (yet) has its own store, the values are moved to the engine's store when the logic node is registered.
+    // Indices of released values are reused by the next added value of the same type.
+    // Strings are kept in shared buffers: copying a string value (e.g. over a link) shares the buffer of the source, and a buffer
+    // which isn't shared is overwritten in place, so that changing strings doesn't allocate as long as the capacity suffices.
+    class PropertyValueStore
+    {
+    public:
+        using Index = uint32_t;
+
+        PropertyValueStore();
+
+        // Adds the default value of the type (zero, false or empty string)
+        [[nodiscard]] Index add(EPropertyType type);
+        [[nodiscard]] Index add(PropertyValue value);
+        // Moves the value from the source store and releases its index there
+        [[nodiscard]] Index moveFrom(PropertyValueStore& source, EPropertyType type, Index sourceIndex);
+        void release(EPropertyType type, Index index);
+
+        template <typename T>
+        [[nodiscard]] const T& get(Index index) const
+        {
+            const StoredType<T>& storedValue = getStored<T>(index);
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                return storedValue.value;
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                return *storedValue;
+            }
+            else
+            {
+                return storedValue;
+            }
+        }
+
+        // Typed setter, returns true if the value changed
+        template <typename T>
+        bool set(Index index, T value)
+        {
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                return setString(index, value);
+            }
+            else
+            {
+                StoredType<T>& storedEntry = getStored<T>(index);
+                T* storedValuePtr = nullptr;
+                if constexpr (std::is_same_v<T, bool>)
+                {
+                    storedValuePtr = &storedEntry.value;
+                }
+                else
+                {
+                    storedValuePtr = &storedEntry;
+                }
+                T& storedValue = *storedValuePtr;
+                if (storedValue == value)
+                {
+                    return false;
+                }
+                storedValue = std::move(value);
+                return true;
+            }
+        }
+
+        // Returns true if the value changed. Doesn't allocate if the string buffer of the property isn't shared and is big enough
+        bool setString(Index index, std::string_view value);
+
+        [[nodiscard]] PropertyValue getValue(EPropertyType type, Index index) const;
+        // Returns true if the value changed
+        bool setValue(Index index, PropertyValue value);
+        // Copies a value without conversion to PropertyValue (source may be this store), returns true if the value changed.
+        // Strings are not copied, the target shares the buffer of the source
+        bool copyValue(EPropertyType type, Index targetIndex, const PropertyValueStore& source, Index sourceIndex);
+
+        // True if both string values use the same buffer (e.g. after copyValue)
+        [[nodiscard]] bool sharesStringBuffer(Index index, const PropertyValueStore& other, Index otherIndex) const;
+
+        // Number of values which are in use
+        [[nodiscard]] size_t getValueCount() const;
+        // Allocated bytes of all value arrays, not including the heap memory of strings
+        [[nodiscard]] size_t getAllocatedMemory() const;
+
+    private:
+        // std::vector<bool> is a bitset, wrap bools so that they have an address (and can be written concurrently)
+        struct BoolValue
+        {
+            bool value;
+        };
+
+        using SharedString = std::shared_ptr<std::string>;
+
+        template <typename T>
+        using StoredType = std::conditional_t<std::is_same_v<T, bool>, BoolValue, std::conditional_t<std::is_same_v<T, std::string>, SharedString, T>>;
+
+        template <typename T>
+        struct ValueArray
+        {
+            std::vector<StoredType<T>> values;
+            std::vector<Index> freeIndices;
+        };
+
+        template <typename T>
+        [[nodiscard]] const StoredType<T>& getStored(Index index) const
+        {
+            const ValueArray<T>& valueArray = std::get<ValueArray<T>>(m_valueArrays);
+            assert(index < valueArray.values.size());
+            return valueArray.values[index];
+        }
+
+        template <typename T>
+        [[nodiscard]] StoredType<T>& getStored(Index index)
+        {
+            ValueArray<T>& valueArray = std::get<ValueArray<T>>(m_valueArrays);
+            assert(index < valueArray.values.size());
+            return valueArray.values[index];
+        }
+
+        template <typename T>
+        [[nodiscard]] Index addTyped(StoredType<T> value);
+        template <typename T>
+        void releaseTyped(Index index);
+
+        [[nodiscard]] SharedString createString(std::string value) const;
+
+        std::tuple<
+            ValueArray<int32_t>,
+            ValueArray<int64_t>,
+            ValueArray<float>,
+            ValueArray<bool>,
+            ValueArray<std::string>,
+            ValueArray<vec2f>,
+            ValueArray<vec3f>,
+            ValueArray<vec4f>,
+            ValueArray<vec2i>,
+            ValueArray<vec3i>,
+            ValueArray<vec4i>> m_valueArrays;
+
+        // Shared by all empty strings, so that properties with default value don't allocate
+        SharedString m_emptyString;
+    };
+}
@@ -0,0 +1,314 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/RamsesCommandBuffer.h"
+
+#include "ramses-client-api/Node.h"
+#include "ramses-client-api/Appearance.h"
+#include "ramses-client-api/Effect.h"
+#include "ramses-client-api/UniformInput.h"
+#include "ramses-client-api/Camera.h"
+#include "ramses-client-api/PerspectiveCamera.h"
+
+#include "impl/LogicNodeImpl.h"
+#include "impl/PropertyImpl.h"
+#include "internals/TypeUtils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        const ramses::RamsesObject* GetTargetObject(const NodeVisibilityCommand& command)
+        {
+            return command.node;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const NodeRotationCommand& command)
+        {
+            return command.node;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const NodeTranslationCommand& command)
+        {
+            return command.node;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const NodeScalingCommand& command)
+        {
+            return command.node;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const UniformCommand& command)
+        {
+            return command.appearance;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const CameraViewportCommand& command)
+        {
+            return command.camera;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const PerspectiveFrustumCommand& command)
+        {
+            return command.camera;
+        }
+
+        const ramses::RamsesObject* GetTargetObject(const OrthographicFrustumCommand& command)
+        {
+            return command.camera;
+        }
+    }
+
+    void RamsesCommandBuffer::setDeferred(bool deferred)
+    {
+        m_deferred = deferred;
+    }
+
+    bool RamsesCommandBuffer::isDeferred() const
+    {
+        return m_deferred;
+    }
+
+    std::optional<LogicNodeRuntimeError> RamsesCommandBuffer::submit(LogicNodeImpl& binding, PropertyImpl& input, const RamsesCommand& command)
+    {
+        assert(!std::holds_alternative<UniformCommand>(command) && "Use submitUniform() for uniform commands");
+        if (!m_deferred)
+        {
+            std::optional<LogicNodeRuntimeError> error = apply(command, nullptr, nullptr);
+            if (error)
+            {
+                input.restoreBindingInputNewValue();
+            }
+            return error;
+        }
+
+        record(binding, input, command);
+        return std::nullopt;
+    }
+
+    std::optional<LogicNodeRuntimeError> RamsesCommandBuffer::submitUniform(LogicNodeImpl& binding, PropertyImpl& input, ramses::Appearance& appearance, uint32_t uniformIndex, EPropertyType elementType, const float* values, uint32_t elementCount)
+    {
+        if (!m_deferred)
+        {
+            std::optional<LogicNodeRuntimeError> error = apply(UniformCommand{ &appearance, uniformIndex, elementType, elementCount, 0u }, values, nullptr);
+            if (error)
+            {
+                input.restoreBindingInputNewValue();
+            }
+            return error;
+        }
+
+        const size_t dataOffset = m_floatData.size();
+        m_floatData.insert(m_floatData.end(), values, values + elementCount * TypeUtils::ComponentsSizeForPropertyType(elementType));
+        record(binding, input, UniformCommand{ &appearance, uniformIndex, elementType, elementCount, dataOffset });
+        return std::nullopt;
+    }
+
+    std::optional<LogicNodeRuntimeError> RamsesCommandBuffer::submitUniform(LogicNodeImpl& binding, PropertyImpl& input, ramses::Appearance& appearance, uint32_t uniformIndex, EPropertyType elementType, const int32_t* values, uint32_t elementCount)
+    {
+        if (!m_deferred)
+        {
+            std::optional<LogicNodeRuntimeError> error = apply(UniformCommand{ &appearance, uniformIndex, elementType, elementCount, 0u }, nullptr, values);
+            if (error)
+            {
+                input.restoreBindingInputNewValue();
+            }
+            return error;
+        }
+
+        const size_t dataOffset = m_intData.size();
+        m_intData.insert(m_intData.end(), values, values + elementCount * TypeUtils::ComponentsSizeForPropertyType(elementType));
+        record(binding, input, UniformCommand{ &appearance, uniformIndex, elementType, elementCount, dataOffset });
+        return std::nullopt;
+    }
+
+    void RamsesCommandBuffer::record(LogicNodeImpl& binding, PropertyImpl& input, const RamsesCommand& command)
+    {
+        const ramses::RamsesObject* targetObject = std::visit([](const auto& typedCommand) { return GetTargetObject(typedCommand); }, command);
+        // Each command type sets a different property, except uniforms which are distinguished by their index
+        size_t targetProperty = command.index();
+        if (const auto* uniformCommand = std::get_if<UniformCommand>(&command))
+        {
+            targetProperty = std::variant_size_v<RamsesCommand> + uniformCommand->uniformIndex;
+        }
+
+        m_commands.push_back({ &binding, &input, targetObject, targetProperty, command });
+    }
+
+    std::vector<RamsesCommandBuffer::CommandError> RamsesCommandBuffer::applyRecordedCommands()
+    {
+        // Sort by target (the recording index keeps the order of commands to the same property), so that the commands
+        // to one Ramses object are applied together and a command can be skipped if the next one sets the same property
+        m_flushOrder.resize(m_commands.size());
+        std::iota(m_flushOrder.begin(), m_flushOrder.end(), size_t{ 0u });
+        std::sort(m_flushOrder.begin(), m_flushOrder.end(), [this](size_t lhs, size_t rhs) {
+            const RecordedCommand& lhsCommand = m_commands[lhs];
+            const RecordedCommand& rhsCommand = m_commands[rhs];
+            if (lhsCommand.targetObject != rhsCommand.targetObject)
+            {
+                return std::less<const ramses::RamsesObject*>()(lhsCommand.targetObject, rhsCommand.targetObject);
+            }
+            if (lhsCommand.targetProperty != rhsCommand.targetProperty)
+            {
+                return lhsCommand.targetProperty < rhsCommand.targetProperty;
+            }
+            return lhs < rhs;
+        });
+
+        m_lastFlushStatistics = {};
+        std::vector<CommandError> errors;
+        for (size_t i = 0; i < m_flushOrder.size(); ++i)
+        {
+            const RecordedCommand& recordedCommand = m_commands[m_flushOrder[i]];
+            if (i + 1 < m_flushOrder.size())
+            {
+                const RecordedCommand& nextCommand = m_commands[m_flushOrder[i + 1]];
+                if (nextCommand.targetObject == recordedCommand.targetObject && nextCommand.targetProperty == recordedCommand.targetProperty)
+                {
+                    ++m_lastFlushStatistics.elidedCommands;
+                    continue;
+                }
+            }
+
+            std::optional<LogicNodeRuntimeError> commandError = apply(recordedCommand.command, m_floatData.data(), m_intData.data());
+            ++m_lastFlushStatistics.appliedCommands;
+            if (commandError)
+            {
+                // Same as in a synchronous update, the value is applied again by the next update of the binding
+                recordedCommand.input->restoreBindingInputNewValue();
+                errors.push_back({ recordedCommand.binding, std::move(commandError->message) });
+            }
+        }
+
+        m_commands.clear();
+        m_flushOrder.clear();
+        m_floatData.clear();
+        m_intData.clear();
+        return errors;
+    }
+
+    void RamsesCommandBuffer::discardCommands(const LogicNodeImpl& binding)
+    {
+        // The uniform data of the discarded commands stays until the buffer is applied, it's not referenced anymore
+        m_commands.erase(
+            std::remove_if(m_commands.begin(), m_commands.end(), [&binding](const RecordedCommand& command) { return command.binding == &binding; }),
+            m_commands.end());
+    }
+
+    size_t RamsesCommandBuffer::getRecordedCommandCount() const
+    {
+        return m_commands.size();
+    }
+
+    const RamsesCommandBuffer::FlushStatistics& RamsesCommandBuffer::getLastFlushStatistics() const
+    {
+        return m_lastFlushStatistics;
+    }
+
+    std::optional<LogicNodeRuntimeError> RamsesCommandBuffer::apply(const RamsesCommand& command, const float* floatData, const int32_t* intData) const
+    {
+        ramses::status_t status = ramses::StatusOK;
+        const ramses::RamsesObject* object = nullptr;
+
+        if (const auto* visibility = std::get_if<NodeVisibilityCommand>(&command))
+        {
+            // TODO Violin what about 'Off' state? Worth discussing!
+            status = visibility->node->setVisibility(visibility->visible ? ramses::EVisibilityMode::Visible : ramses::EVisibilityMode::Invisible);
+            object = visibility->node;
+        }
+        else if (const auto* rotation = std::get_if<NodeRotationCommand>(&command))
+        {
+            status = rotation->node->setRotation(rotation->rotation[0], rotation->rotation[1], rotation->rotation[2], rotation->rotationConvention);
+            object = rotation->node;
+        }
+        else if (const auto* translation = std::get_if<NodeTranslationCommand>(&command))
+        {
+            status = translation->node->setTranslation(translation->translation[0], translation->translation[1], translation->translation[2]);
+            object = translation->node;
+        }
+        else if (const auto* scaling = std::get_if<NodeScalingCommand>(&command))
+        {
+            status = scaling->node->setScaling(scaling->scaling[0], scaling->scaling[1], scaling->scaling[2]);
+            object = scaling->node;
+        }
+        else if (const auto* uniformCommand = std::get_if<UniformCommand>(&command))
+        {
+            ramses::Appearance& appearance = *uniformCommand->appearance;
+            ramses::UniformInput uniform;
+            appearance.getEffect().getUniformInput(uniformCommand->uniformIndex, uniform);
+
+            const uint32_t count = uniformCommand->elementCount;
+            const float* floatValues = floatData + uniformCommand->dataOffset;
+            const int32_t* intValues = intData + uniformCommand->dataOffset;
+
+            switch (uniformCommand->elementType)
+            {
+            case EPropertyType::Float:
+                status = appearance.setInputValueFloat(uniform, count, floatValues);
+                break;
+            case EPropertyType::Int32:
+                status = appearance.setInputValueInt32(uniform, count, intValues);
+                break;
+            case EPropertyType::Vec2f:
+                status = appearance.setInputValueVector2f(uniform, count, floatValues);
+                break;
+            case EPropertyType::Vec2i:
+                status = appearance.setInputValueVector2i(uniform, count, intValues);
+                break;
+            case EPropertyType::Vec3f:
+                status = appearance.setInputValueVector3f(uniform, count, floatValues);
+                break;
+            case EPropertyType::Vec3i:
+                status = appearance.setInputValueVector3i(uniform, count, intValues);
+                break;
+            case EPropertyType::Vec4f:
+                status = appearance.setInputValueVector4f(uniform, count, floatValues);
+                break;
+            case EPropertyType::Vec4i:
+                status = appearance.setInputValueVector4i(uniform, count, intValues);
+                break;
+            case EPropertyType::String:
+            case EPropertyType::Array:
+            case EPropertyType::Struct:
+            case EPropertyType::Bool:
+            case EPropertyType::Int64:
+                assert(false && "This should never happen");
+                break;
+            }
+            object = &appearance;
+        }
+        else if (const auto* viewport = std::get_if<CameraViewportCommand>(&command))
+        {
+            status = viewport->camera->setViewport(viewport->offsetX, viewport->offsetY, static_cast<uint32_t>(viewport->width), static_cast<uint32_t>(viewport->height));
+            object = viewport->camera;
+        }
+        else if (const auto* perspectiveFrustum = std::get_if<PerspectiveFrustumCommand>(&command))
+        {
+            status = perspectiveFrustum->camera->setFrustum(perspectiveFrustum->fieldOfView, perspectiveFrustum->aspectRatio, perspectiveFrustum->nearPlane, perspectiveFrustum->farPlane);
+            object = perspectiveFrustum->camera;
+        }
+        else if (const auto* frustum = std::get_if<OrthographicFrustumCommand>(&command))
+        {
+            status = frustum->camera->setFrustum(frustum->leftPlane, frustum->rightPlane, frustum->bottomPlane, frustum->topPlane, frustum->nearPlane, frustum->farPlane);
+            object = frustum->camera;
+        }
+
+        if (status != ramses::StatusOK)
+        {
+            assert(object != nullptr);
+            return LogicNodeRuntimeError{ object->getStatusMessage(status) };
+        }
+
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,172 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EPropertyType.h"
+#include "ramses-client-api/ERotationConvention.h"
+
+#include <vector>
+#include <variant>
+#include <optional>
+#include <string>
+#include <cstdint>
+
+namespace ramses
+{
+    class Node;
+    class Appearance;
+    class Camera;
+    class PerspectiveCamera;
+    class RamsesObject;
+}
+
+namespace rlogic::internal
+{
+    class LogicNodeImpl;
+    class PropertyImpl;
+    struct LogicNodeRuntimeError;
+
+    struct NodeVisibilityCommand
+    {
+        ramses::Node* node;
+        bool visible;
+    };
+
+    struct NodeRotationCommand
+    {
+        ramses::Node* node;
+        vec3f rotation;
+        ramses::ERotationConvention rotationConvention;
+    };
+
+    struct NodeTranslationCommand
+    {
+        ramses::Node* node;
+        vec3f translation;
+    };
+
+    struct NodeScalingCommand
+    {
+        ramses::Node* node;
+        vec3f scaling;
+    };
+
+    // The values are stored in the float or int data of the command buffer, depending on the element type
+    struct UniformCommand
+    {
+        ramses::Appearance* appearance;
+        uint32_t uniformIndex;
+        EPropertyType elementType;
+        uint32_t elementCount;
+        size_t dataOffset;
+    };
+
+    struct CameraViewportCommand
+    {
+        ramses::Camera* camera;
+        int32_t offsetX;
+        int32_t offsetY;
+        int32_t width;
+        int32_t height;
+    };
+
+    struct PerspectiveFrustumCommand
+    {
+        ramses::PerspectiveCamera* camera;
+        float fieldOfView;
+        float aspectRatio;
+        float nearPlane;
+        float farPlane;
+    };
+
+    struct OrthographicFrustumCommand
+    {
+        ramses::Camera* camera;
+        float leftPlane;
+        float rightPlane;
+        float bottomPlane;
+        float topPlane;
+        float nearPlane;
+        float farPlane;
+    };
+
+    using RamsesCommand = std::variant<
+        NodeVisibilityCommand,
+        NodeRotationCommand,
+        NodeTranslationCommand,
+        NodeScalingCommand,
+        UniformCommand,
+        CameraViewportCommand,
+        PerspectiveFrustumCommand,
+        OrthographicFrustumCommand>;
+
+    // Collects the writes of bindings to Ramses objects. By default commands are applied right away. While deferred,
+    // they are recorded and only applied by applyRecordedCommands(). The logic engine defers the commands during update()
+    // to apply them in one batch at the end, and until commit() after updateAsync(), so that bindings can be updated on a
+    // thread which must not access the Ramses scene.
+    class RamsesCommandBuffer
+    {
+    public:
+        struct FlushStatistics
+        {
+            size_t appliedCommands = 0u;
+            // Commands which were overwritten by a later command to the same Ramses object property
+            size_t elidedCommands = 0u;
+        };
+
+        void setDeferred(bool deferred);
+        [[nodiscard]] bool isDeferred() const;
+
+        // The input is the binding input (or one of the inputs) whose value the command applies. If the command fails, the
+        // input is flagged to have a new value again, so that the binding submits the value again in its next update
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> submit(LogicNodeImpl& binding, PropertyImpl& input, const RamsesCommand& command);
+        // Uniform values are copied, elementCount > 1 for array uniforms
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> submitUniform(LogicNodeImpl& binding, PropertyImpl& input, ramses::Appearance& appearance, uint32_t uniformIndex, EPropertyType elementType, const float* values, uint32_t elementCount);
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> submitUniform(LogicNodeImpl& binding, PropertyImpl& input, ramses::Appearance& appearance, uint32_t uniformIndex, EPropertyType elementType, const int32_t* values, uint32_t elementCount);
+
+        // Applies the recorded commands grouped by Ramses object and clears them. Only the last recorded command is applied
+        // for each property of a Ramses object (e.g. translation of a node, a single uniform of an appearance), the order of
+        // commands to different properties is not defined. A failing command doesn't stop the remaining commands, the
+        // errors of all failed commands are returned
+        struct CommandError
+        {
+            LogicNodeImpl* binding;
+            std::string message;
+        };
+        [[nodiscard]] std::vector<CommandError> applyRecordedCommands();
+        // Drops the recorded commands of a binding (e.g. when it's destroyed)
+        void discardCommands(const LogicNodeImpl& binding);
+        [[nodiscard]] size_t getRecordedCommandCount() const;
+        [[nodiscard]] const FlushStatistics& getLastFlushStatistics() const;
+
+    private:
+        struct RecordedCommand
+        {
+            LogicNodeImpl* binding;
+            PropertyImpl* input;
+            // Commands with same target object and target property overwrite each other
+            const ramses::RamsesObject* targetObject;
+            size_t targetProperty;
+            RamsesCommand command;
+        };
+
+        void record(LogicNodeImpl& binding, PropertyImpl& input, const RamsesCommand& command);
+
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> apply(const RamsesCommand& command, const float* floatData, const int32_t* intData) const;
+
+        bool m_deferred = false;
+        std::vector<RecordedCommand> m_commands;
+        // Kept to avoid reallocation on every flush
+        std::vector<size_t> m_flushOrder;
+        FlushStatistics m_lastFlushStatistics;
+        // Uniform values of the recorded commands
+        std::vector<float> m_floatData;
+        std::vector<int32_t> m_intData;
+    };
+}
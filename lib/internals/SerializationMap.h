@@ -11,6 +11,8 @@
 #include "generated/PropertyGen.h"
 #include "generated/DataArrayGen.h"
 #include <unordered_map>
+#include <optional>
+#include <string>
 
 namespace rlogic_serialization
 {
@@ -72,10 +74,28 @@ namespace rlogic::internal
             return it->second;
         }
 
+        // Source code of scripts is shared by instances (same string object), it is serialized only with the first script
+        void storeLuaScriptSource(const std::string& source, uint64_t scriptId)
+        {
+            assert(m_luaScriptSources.count(&source) == 0 && "one time store only");
+            m_luaScriptSources.insert({ &source, scriptId });
+        }
+
+        std::optional<uint64_t> resolveLuaScriptSource(const std::string& source) const
+        {
+            const auto it = m_luaScriptSources.find(&source);
+            if (it == m_luaScriptSources.cend())
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
     private:
         std::unordered_map<const PropertyImpl*, flatbuffers::Offset<rlogic_serialization::Property>> m_properties;
         std::unordered_map<const DataArray*, flatbuffers::Offset<rlogic_serialization::DataArray>> m_dataArrays;
         std::unordered_map<const LuaModule*, flatbuffers::Offset<rlogic_serialization::LuaModule>> m_luaModules;
+        std::unordered_map<const std::string*, uint64_t> m_luaScriptSources;
     };
 
 }
@@ -11,10 +11,12 @@
 #include "ramses-logic/LuaModule.h"
 #include "impl/LuaModuleImpl.h"
 
+#include "internals/LuaArrayMath.h"
 #include "internals/LuaCustomizations.h"
+#include "internals/LuaVector.h"
 #include "internals/PropertyTypeExtractor.h"
 #include "internals/WrappedLuaProperty.h"
-
+#include "impl/LoggerImpl.h"
 
 #include <iostream>
 
@@ -31,6 +33,7 @@ namespace rlogic::internal
     }
 
     SolState::SolState()
+        : m_solState(sol::default_at_panic, &LuaAllocator::Allocate, &m_allocator)
     {
         m_safeBaselibSymbols = {
             "assert",
@@ -62,12 +65,23 @@ namespace rlogic::internal
             m_solState.open_libraries(solLib);
         }
 
+        // Mapped into environments like the tables of the Lua libraries above
+        m_solState[*GetStdModuleName(EStandardModule::ArrayMath)] = LuaArrayMath::CreateModule(m_solState);
+
         m_solState.set_exception_handler(&solExceptionHandler);
 
         // TODO Violin only register wrappers to runtime environments, not in the global environment
         WrappedLuaProperty::RegisterTypes(m_solState);
 
         LuaCustomizations::RegisterTypes(m_solState);
+
+        LuaVectors::RegisterTypes(m_solState);
+
+        // Size of the Lua 5.1 byte code header: signature (4), version, format, endianness, sizes of int, size_t,
+        // Instruction and lua_Number, and whether lua_Number is integral (1 each)
+        constexpr size_t byteCodeHeaderSize = 12u;
+        sol::protected_function emptyChunk = m_solState.load("");
+        m_byteCodeHeader = std::string(DumpByteCode(emptyChunk).as_string_view().substr(0, byteCodeHeaderSize));
     }
 
     sol::load_result SolState::loadScript(std::string_view source, std::string_view scriptName)
@@ -75,7 +89,45 @@ namespace rlogic::internal
         return m_solState.load(source, std::string(scriptName));
     }
 
-    sol::environment SolState::createEnvironment(const StandardModules& stdModules, const ModuleMapping& userModules)
+    sol::load_result SolState::loadByteCodeOrScript(std::string_view source, std::string_view byteCode, std::string_view scriptName)
+    {
+        if (isCompatibleByteCode(byteCode))
+        {
+            sol::load_result byteCodeResult = m_solState.load(byteCode, std::string(scriptName), sol::load_mode::binary);
+            if (byteCodeResult.valid())
+            {
+                return byteCodeResult;
+            }
+            sol::error error = byteCodeResult;
+            LOG_WARN("Failed to load byte code of '{}', compiling its source instead: {}", scriptName, error.what());
+        }
+        else if (!byteCode.empty())
+        {
+            LOG_DEBUG("Byte code of '{}' was compiled by a different Lua version or architecture, compiling its source instead", scriptName);
+        }
+
+        return loadScript(source, scriptName);
+    }
+
+    bool SolState::isCompatibleByteCode(std::string_view byteCode) const
+    {
+        return byteCode.size() > m_byteCodeHeader.size() && byteCode.substr(0, m_byteCodeHeader.size()) == m_byteCodeHeader;
+    }
+
+    sol::bytecode SolState::DumpByteCode(const sol::protected_function& function)
+    {
+        // Keeps debug information, so that errors report the same chunk names and line numbers as for the source
+        return function.dump();
+    }
+
+    sol::load_result SolState::copyFunction(const sol::protected_function& function, std::string_view chunkName)
+    {
+        // The byte code was just dumped by this Lua state, so unlike byte code from a file it needs no compatibility check
+        const sol::bytecode byteCode = DumpByteCode(function);
+        return m_solState.load(byteCode.as_string_view(), std::string(chunkName), sol::load_mode::binary);
+    }
+
+    std::optional<sol::environment> SolState::createEnvironment(const StandardModules& stdModules, const ModuleMapping& userModules, ErrorReporting& errorReporting)
     {
         sol::environment newEnv(m_solState, sol::create);
 
@@ -84,10 +136,18 @@ namespace rlogic::internal
 
         mapStandardModules(stdModules, newEnv);
 
+        // Mapped before user modules, so that existing modules named like the vector constructors still work
+        LuaVectors::MapToEnvironment(m_solState, newEnv);
+
         for (const auto& module : userModules)
         {
             assert(!SolState::IsReservedModuleName(module.first));
-            newEnv[module.first] = module.second->m_impl.getModule();
+            const sol::table* moduleTable = module.second->m_impl.getModule(*this, errorReporting);
+            if (moduleTable == nullptr)
+            {
+                return std::nullopt;
+            }
+            newEnv[module.first] = *moduleTable;
         }
 
         // Allow access to interface types in all environments
@@ -152,6 +212,8 @@ namespace rlogic::internal
             return "math";
         case EStandardModule::Debug:
             return "debug";
+        case EStandardModule::ArrayMath:
+            return "arraymath";
         case EStandardModule::All:
             return std::nullopt;
         }
@@ -177,4 +239,19 @@ namespace rlogic::internal
         return m_solState.create_table();
     }
 
+    LuaMemoryAccount SolState::createMemoryAccount(size_t memoryLimit)
+    {
+        return LuaMemoryAccount(m_allocator, memoryLimit);
+    }
+
+    const LuaAllocator& SolState::getAllocator() const
+    {
+        return m_allocator;
+    }
+
+    void SolState::collectGarbage()
+    {
+        m_solState.collect_garbage();
+    }
+
 }
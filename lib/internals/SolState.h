@@ -10,18 +10,23 @@
 
 #include "impl/LuaConfigImpl.h"
 #include "internals/SolWrapper.h"
+#include "internals/LuaAllocator.h"
 
+#include <optional>
 #include <string_view>
 #include <utility>
 
 namespace rlogic::internal
 {
-    constexpr std::array<rlogic::EStandardModule, 5> StdModules = {
+    class ErrorReporting;
+
+    constexpr std::array<rlogic::EStandardModule, 6> StdModules = {
         rlogic::EStandardModule::Base,
         rlogic::EStandardModule::String,
         rlogic::EStandardModule::Table,
         rlogic::EStandardModule::Math,
-        rlogic::EStandardModule::Debug
+        rlogic::EStandardModule::Debug,
+        rlogic::EStandardModule::ArrayMath
     };
     constexpr std::array<sol::lib, 5> SolLibs = {
         sol::lib::base,
@@ -31,7 +36,8 @@ namespace rlogic::internal
         sol::lib::debug
     };
 
-    static_assert(StdModules.size() == SolLibs.size());
+    // All standard modules except ArrayMath are Lua libraries, ArrayMath is implemented by the logic engine (see LuaArrayMath)
+    static_assert(StdModules.size() == SolLibs.size() + 1);
 
     class SolState
     {
@@ -50,15 +56,34 @@ namespace rlogic::internal
         SolState& operator=(const SolState& other) = delete;
 
         sol::load_result loadScript(std::string_view source, std::string_view scriptName);
-        sol::environment createEnvironment(const StandardModules& stdModules, const ModuleMapping& userModules);
+        // Loads the precompiled byte code of the source if it is compatible with this Lua state, otherwise compiles the source.
+        // Lua can't verify byte code, only pass byte code from a trusted source
+        sol::load_result loadByteCodeOrScript(std::string_view source, std::string_view byteCode, std::string_view scriptName);
+        [[nodiscard]] bool isCompatibleByteCode(std::string_view byteCode) const;
+        [[nodiscard]] static sol::bytecode DumpByteCode(const sol::protected_function& function);
+        // Loads a new closure of the function's code, so that its environment can be set without affecting the original function
+        sol::load_result copyFunction(const sol::protected_function& function, std::string_view chunkName);
+        // Fails if one of the user modules can't be loaded into this Lua state, see LuaModuleImpl::getModule
+        [[nodiscard]] std::optional<sol::environment> createEnvironment(const StandardModules& stdModules, const ModuleMapping& userModules, ErrorReporting& errorReporting);
         void copyTableIntoEnvironment(const sol::table& table, std::string_view name, sol::environment& env);
         sol::table createTable();
 
+        // Allocations of the state are attributed to the account while a LuaMemoryScope of it exists
+        [[nodiscard]] LuaMemoryAccount createMemoryAccount(size_t memoryLimit = 0u);
+        [[nodiscard]] const LuaAllocator& getAllocator() const;
+        // Full garbage collection cycle
+        void collectGarbage();
+
         [[nodiscard]] static bool IsReservedModuleName(std::string_view name);
     private:
+        // Declared before the Lua state, which frees its memory when it's closed
+        LuaAllocator m_allocator;
         sol::state m_solState;
         // Cached to avoid unnecessary heap allocations
         std::vector<std::string> m_safeBaselibSymbols;
+        // Header of byte code compiled by this Lua state, it encodes the Lua version, endianness and sizes of the
+        // numeric types. Byte code with a different header can't be loaded
+        std::string m_byteCodeHeader;
 
         void mapStandardModules(const StandardModules& stdModules, sol::environment& env);
         [[nodiscard]] static std::optional<std::string_view> GetStdModuleName(rlogic::EStandardModule m);
@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ThreadPool.h"
+
+#include <cassert>
+
+namespace rlogic::internal
+{
+    ThreadPool::ThreadPool(size_t threadCount)
+    {
+        assert(threadCount > 0u);
+        m_queues.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            m_queues.emplace_back(std::make_unique<TaskQueue>());
+        }
+
+        m_workers.reserve(threadCount - 1u);
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            m_workers.emplace_back([this, i]() { workerLoop(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_workAvailable.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadPool::getThreadCount() const
+    {
+        return m_queues.size();
+    }
+
+    void ThreadPool::execute(size_t taskCount, const Task& task)
+    {
+        if (taskCount == 0u)
+        {
+            return;
+        }
+
+        // Set the task before queueing, workers which are still busy stealing can pick up new tasks right away
+        m_pendingTasks = taskCount;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_currentTask = &task;
+            ++m_batchCounter;
+        }
+
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            TaskQueue& queue = *m_queues[i % m_queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.taskIndices.push_back(i);
+        }
+        m_workAvailable.notify_all();
+
+        while (runNextTask(0u))
+        {
+        }
+
+        // Other threads may still be executing stolen tasks
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_workFinished.wait(lock, [this]() { return m_pendingTasks == 0u; });
+        m_currentTask = nullptr;
+    }
+
+    void ThreadPool::workerLoop(size_t queueIndex)
+    {
+        size_t lastSeenBatch = 0u;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_workAvailable.wait(lock, [this, lastSeenBatch]() { return m_shutdown || m_batchCounter != lastSeenBatch; });
+                if (m_shutdown)
+                {
+                    return;
+                }
+                lastSeenBatch = m_batchCounter;
+            }
+
+            while (runNextTask(queueIndex))
+            {
+            }
+        }
+    }
+
+    bool ThreadPool::runNextTask(size_t queueIndex)
+    {
+        std::optional<size_t> taskIndex = popOwnTask(queueIndex);
+        if (!taskIndex)
+        {
+            taskIndex = stealTask(queueIndex);
+        }
+
+        if (!taskIndex)
+        {
+            return false;
+        }
+
+        // The task is valid as long as there are pending tasks (execute() waits for them)
+        (*m_currentTask)(*taskIndex);
+
+        if (m_pendingTasks.fetch_sub(1u) == 1u)
+        {
+            // Notify under lock, otherwise execute() could miss the notification between checking and waiting
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_workFinished.notify_all();
+        }
+
+        return true;
+    }
+
+    std::optional<size_t> ThreadPool::popOwnTask(size_t queueIndex)
+    {
+        TaskQueue& queue = *m_queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.taskIndices.empty())
+        {
+            return std::nullopt;
+        }
+
+        const size_t taskIndex = queue.taskIndices.front();
+        queue.taskIndices.pop_front();
+        return taskIndex;
+    }
+
+    std::optional<size_t> ThreadPool::stealTask(size_t thiefQueueIndex)
+    {
+        // Start with the neighbour queue, so that not all thieves compete for the same victim
+        for (size_t offset = 1; offset < m_queues.size(); ++offset)
+        {
+            TaskQueue& victim = *m_queues[(thiefQueueIndex + offset) % m_queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.taskIndices.empty())
+            {
+                const size_t taskIndex = victim.taskIndices.back();
+                victim.taskIndices.pop_back();
+                return taskIndex;
+            }
+        }
+
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <optional>
+
+namespace rlogic::internal
+{
+    // Minimal work-stealing thread pool for executing a batch of independent tasks.
+    // Each thread (the workers and the thread calling execute()) has its own task deque. Tasks are distributed
+    // round-robin over the deques, every thread takes tasks from the front of its own deque and steals from the
+    // back of the other deques when it runs out of work. This keeps the load balanced when tasks have different
+    // durations, without a single shared queue all threads compete for.
+    class ThreadPool
+    {
+    public:
+        using Task = std::function<void(size_t taskIndex)>;
+
+        // threadCount includes the thread which calls execute(), i.e. threadCount - 1 workers are started
+        explicit ThreadPool(size_t threadCount);
+        ~ThreadPool() noexcept;
+        ThreadPool(ThreadPool&& other) = delete;
+        ThreadPool& operator=(ThreadPool&& other) = delete;
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+
+        // Calls task(i) for every i in [0, taskCount) and returns after all calls finished.
+        // The calling thread takes part in the execution. Tasks must not throw and must not call execute()
+        void execute(size_t taskCount, const Task& task);
+
+        [[nodiscard]] size_t getThreadCount() const;
+
+    private:
+        struct TaskQueue
+        {
+            std::mutex mutex;
+            std::deque<size_t> taskIndices;
+        };
+
+        void workerLoop(size_t queueIndex);
+        bool runNextTask(size_t queueIndex);
+        [[nodiscard]] std::optional<size_t> popOwnTask(size_t queueIndex);
+        [[nodiscard]] std::optional<size_t> stealTask(size_t thiefQueueIndex);
+
+        // Queue 0 belongs to the thread calling execute(), queue N to worker N
+        std::vector<std::unique_ptr<TaskQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workFinished;
+        const Task* m_currentTask = nullptr;
+        size_t m_batchCounter = 0u;
+        bool m_shutdown = false;
+        std::atomic<size_t> m_pendingTasks{0u};
+    };
+}
@@ -99,6 +99,33 @@ namespace rlogic::internal
             return !IsPrimitiveType(type);
         }
 
+        // Number of float/int components of primitive types which can be passed to ramses
+        static size_t ComponentsSizeForPropertyType(EPropertyType propertyType)
+        {
+            switch (propertyType)
+            {
+            case EPropertyType::Float:
+            case EPropertyType::Int32:
+            case EPropertyType::Int64:
+                return 1u;
+            case EPropertyType::Vec2f:
+            case EPropertyType::Vec2i:
+                return 2u;
+            case EPropertyType::Vec3f:
+            case EPropertyType::Vec3i:
+                return 3u;
+            case EPropertyType::Vec4f:
+            case EPropertyType::Vec4i:
+                return 4u;
+            case EPropertyType::String:
+            case EPropertyType::Array:
+            case EPropertyType::Struct:
+            case EPropertyType::Bool:
+                assert(false && "This should never happen");
+            }
+            return 0u;
+        }
+
         // Makes {x, y, z, w...} out of {{x, y}, {z, w}, ...}
         // This is required so that array data can be passed to ramses arrays
         // RAMSESTYPE: float/uint32_t (base type used by all arrays in ramses)
@@ -139,31 +166,5 @@ namespace rlogic::internal
                 ramsesArray.emplace_back(logicElement[i]);
             }
         }
-
-        static size_t ComponentsSizeForPropertyType(EPropertyType propertyType)
-        {
-            switch (propertyType)
-            {
-            case EPropertyType::Float:
-            case EPropertyType::Int32:
-            case EPropertyType::Int64:
-                return 1u;
-            case EPropertyType::Vec2f:
-            case EPropertyType::Vec2i:
-                return 2u;
-            case EPropertyType::Vec3f:
-            case EPropertyType::Vec3i:
-                return 3u;
-            case EPropertyType::Vec4f:
-            case EPropertyType::Vec4i:
-                return 4u;
-            case EPropertyType::String:
-            case EPropertyType::Array:
-            case EPropertyType::Struct:
-            case EPropertyType::Bool:
-                assert(false && "This should never happen");
-            }
-            return 0u;
-        }
     };
 }
@@ -53,6 +53,10 @@ namespace rlogic::internal
         for (auto& s : m_sectionExecutionTime)
             s = ReportTimeUnits{ 0u };
         m_activatedLinks = 0u;
+        m_appliedRamsesCommands = 0u;
+        m_elidedRamsesCommands = 0u;
+        m_luaAllocations = 0u;
+        m_luaAllocatedBytesDelta = 0;
 
         // clear also internals in case update/measure was interrupted due to error
         m_nodeExecutionStarted.reset();
@@ -80,4 +84,24 @@ namespace rlogic::internal
         return m_activatedLinks;
     }
 
+    size_t UpdateReport::getAppliedRamsesCommands() const
+    {
+        return m_appliedRamsesCommands;
+    }
+
+    size_t UpdateReport::getElidedRamsesCommands() const
+    {
+        return m_elidedRamsesCommands;
+    }
+
+    size_t UpdateReport::getLuaAllocations() const
+    {
+        return m_luaAllocations;
+    }
+
+    int64_t UpdateReport::getLuaAllocatedBytesDelta() const
+    {
+        return m_luaAllocatedBytesDelta;
+    }
+
 }
@@ -12,6 +12,7 @@
 #include <chrono>
 #include <optional>
 #include <array>
+#include <cstdint>
 
 namespace rlogic
 {
@@ -27,6 +28,9 @@ namespace rlogic::internal
     class UpdateReport
     {
     public:
+        using Clock = std::chrono::steady_clock;
+        using TimePoint = std::chrono::time_point<Clock>;
+
         enum class ETimingSection
         {
             TotalUpdate = 0,
@@ -42,21 +46,36 @@ namespace rlogic::internal
         {
             m_activatedLinks += activatedLinks;
         }
+        inline void ramsesCommandsApplied(size_t appliedCommands, size_t elidedCommands)
+        {
+            m_appliedRamsesCommands += appliedCommands;
+            m_elidedRamsesCommands += elidedCommands;
+        }
+        inline void luaMemoryChanged(size_t allocations, int64_t allocatedBytesDelta)
+        {
+            m_luaAllocations += allocations;
+            m_luaAllocatedBytesDelta += allocatedBytesDelta;
+        }
         void clear();
 
         [[nodiscard]] const LogicNodesTimed& getNodesExecuted() const;
         [[nodiscard]] const LogicNodes& getNodesSkippedExecution() const;
         [[nodiscard]] ReportTimeUnits getSectionExecutionTime(ETimingSection section) const;
         [[nodiscard]] size_t getLinkActivations() const;
+        [[nodiscard]] size_t getAppliedRamsesCommands() const;
+        [[nodiscard]] size_t getElidedRamsesCommands() const;
+        [[nodiscard]] size_t getLuaAllocations() const;
+        [[nodiscard]] int64_t getLuaAllocatedBytesDelta() const;
 
     private:
-        using Clock = std::chrono::steady_clock;
-        using TimePoint = std::chrono::time_point<Clock>;
-
         LogicNodesTimed m_nodesExecuted;
         LogicNodes m_nodesSkippedExecution;
         std::array<ReportTimeUnits, 2u> m_sectionExecutionTime = { ReportTimeUnits{ 0 } };
         size_t m_activatedLinks {0u};
+        size_t m_appliedRamsesCommands {0u};
+        size_t m_elidedRamsesCommands {0u};
+        size_t m_luaAllocations {0u};
+        int64_t m_luaAllocatedBytesDelta {0};
 
         std::optional<TimePoint> m_nodeExecutionStarted;
         std::array<std::optional<TimePoint>, 2u> m_sectionStarted;
@@ -9,6 +9,7 @@
 #include "internals/WrappedLuaProperty.h"
 #include "internals/SolHelper.h"
 #include "internals/LuaTypeConversions.h"
+#include "internals/LuaVector.h"
 #include "internals/TypeUtils.h"
 
 #include "impl/PropertyImpl.h"
@@ -127,14 +128,20 @@ namespace rlogic::internal
 
         if (rhs.get_type() == sol::type::userdata)
         {
-            if (!rhs.is<WrappedLuaProperty>())
+            if (rhs.is<WrappedLuaProperty>())
+            {
+                childProperty.setComplex(rhs.as<WrappedLuaProperty>());
+            }
+            else if (LuaVectors::GetVectorSize(rhs) != 0u)
+            {
+                childProperty.setVectorValue(rhs);
+            }
+            else
             {
                 // If we ever add other user data objects, should modify this block
                 // For now, we check the type explicitly before converting for a better user message
                 sol_helper::throwSolException("Implementation error: Unexpected userdata");
             }
-
-            childProperty.setComplex(rhs.as<WrappedLuaProperty>());
         }
         else
         {
@@ -196,12 +203,11 @@ namespace rlogic::internal
                 sol_helper::throwSolException("Bad access to property '{}'! {}", m_wrappedProperty.get().getName(), structFieldName.getError());
             }
 
-            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            // Wrapped children have the same order as the children of the wrapped property
+            const std::optional<size_t> childIndex = m_wrappedProperty.get().findChildIndex(structFieldName.getData());
+            if (childIndex)
             {
-                if (m_wrappedChildProperties[i].m_wrappedProperty.get().getName() == structFieldName.getData())
-                {
-                    return i;
-                }
+                return *childIndex;
             }
 
             throw BadStructAccess(std::string(structFieldName.getData()), fmt::format("Tried to access undefined struct property '{}'", structFieldName.getData()));
@@ -233,7 +239,7 @@ namespace rlogic::internal
 
         if (TypeUtils::IsPrimitiveType(m_wrappedProperty.get().getType()))
         {
-            m_wrappedProperty.get().setValue(other.m_wrappedProperty.get().getValue());
+            m_wrappedProperty.get().copyValue(other.m_wrappedProperty.get());
         }
         else
         {
@@ -278,6 +284,42 @@ namespace rlogic::internal
         m_wrappedProperty.get().setValue(potentialArrayData.getData());
     }
 
+    void WrappedLuaProperty::setVectorValue(const sol::object& rhs)
+    {
+        PropertyImpl& property = m_wrappedProperty.get();
+        switch (property.getType())
+        {
+        case EPropertyType::Vec2f:
+            if (rhs.is<LuaVector<2>>())
+            {
+                property.setValueAs(rhs.as<LuaVector<2>>().getComponents());
+                return;
+            }
+            break;
+        case EPropertyType::Vec3f:
+            if (rhs.is<LuaVector<3>>())
+            {
+                property.setValueAs(rhs.as<LuaVector<3>>().getComponents());
+                return;
+            }
+            break;
+        case EPropertyType::Vec4f:
+            if (rhs.is<LuaVector<4>>())
+            {
+                property.setValueAs(rhs.as<LuaVector<4>>().getComponents());
+                return;
+            }
+            break;
+        default:
+            break;
+        }
+
+        sol_helper::throwSolException("Can't assign {} value to property '{}' (type {})!",
+            LuaVectors::GetTypeName(rhs),
+            property.getName(),
+            GetLuaPrimitiveTypeName(property.getType()));
+    }
+
     // Overrides the '#' operator in Lua (sol3 template substitution)
     size_t WrappedLuaProperty::size() const
     {
@@ -374,7 +416,7 @@ namespace rlogic::internal
             badTypeAssignment(rhs.get_type());
         }
 
-        m_wrappedProperty.get().setValue(rhs.as<std::string>());
+        m_wrappedProperty.get().setStringValue(rhs.as<std::string_view>());
     }
 
     void WrappedLuaProperty::setBool(const sol::object& rhs)
@@ -475,7 +517,13 @@ namespace rlogic::internal
     {
         state.new_usertype<WrappedLuaProperty>("WrappedLuaProperty",
             sol::meta_method::new_index, &WrappedLuaProperty::newIndex,
-            sol::meta_method::index, &WrappedLuaProperty::index);
+            sol::meta_method::index, &WrappedLuaProperty::index,
+            // Vector math on VEC2F, VEC3F and VEC4F properties, results are vec2, vec3 and vec4 values
+            sol::meta_method::addition, &LuaVectors::Add,
+            sol::meta_method::subtraction, &LuaVectors::Subtract,
+            sol::meta_method::multiplication, &LuaVectors::Multiply,
+            sol::meta_method::division, &LuaVectors::Divide,
+            sol::meta_method::unary_minus, &LuaVectors::Negate);
     }
 
     std::string WrappedLuaProperty::getChildDebugName(size_t childIndex) const
@@ -531,4 +579,9 @@ namespace rlogic::internal
         return m_wrappedProperty.get();
     }
 
+    PropertyImpl& WrappedLuaProperty::getWrappedProperty()
+    {
+        return m_wrappedProperty.get();
+    }
+
 }
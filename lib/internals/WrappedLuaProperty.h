@@ -44,6 +44,7 @@ namespace rlogic::internal
         [[nodiscard]] size_t resolvePropertyIndex(const sol::object& propertyIndex) const;
 
         [[nodiscard]] const PropertyImpl& getWrappedProperty() const;
+        [[nodiscard]] PropertyImpl& getWrappedProperty();
 
         // Register symbols for type extraction to sol state globally
         static void RegisterTypes(sol::state& state);
@@ -59,6 +60,8 @@ namespace rlogic::internal
 
         void setChildValue(size_t index, const sol::object& rhs);
         void setComplex(const WrappedLuaProperty& other);
+        // Assigns a vecN value (see LuaVector) without conversion to a Lua table
+        void setVectorValue(const sol::object& rhs);
 
         void setStruct(const sol::object& rhs);
         void setArray(const sol::object& rhs);
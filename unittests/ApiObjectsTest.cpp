@@ -47,6 +47,7 @@ namespace rlogic::internal
         flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
         SerializationTestUtils m_testUtils{ m_flatBufferBuilder };
         ::testing::StrictMock<RamsesObjectResolverMock> m_resolverMock;
+        NativeNodeTypeRegistry m_nativeNodeTypes;
 
         RamsesTestSetup m_ramses;
         ramses::Scene* m_scene = { m_ramses.createScene() };
@@ -150,6 +151,21 @@ namespace rlogic::internal
         EXPECT_TRUE(m_apiObjects.getApiObjectContainer<LogicObject>().empty());
     }
 
+    TEST_F(AnApiObjects, KeepsPropertyValuesOfLogicNodesInItsValueStore)
+    {
+        EXPECT_EQ(0u, m_apiObjects.getPropertyValueStore().getValueCount());
+
+        RamsesNodeBinding* ramsesNodeBinding = m_apiObjects.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "NodeBinding");
+        ASSERT_NE(nullptr, ramsesNodeBinding);
+        // visibility, rotation, translation, scaling
+        EXPECT_EQ(4u, m_apiObjects.getPropertyValueStore().getValueCount());
+        EXPECT_TRUE(ramsesNodeBinding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), *ramsesNodeBinding->getInputs()->getChild("translation")->get<vec3f>());
+
+        ASSERT_TRUE(m_apiObjects.destroy(*ramsesNodeBinding, m_errorReporting));
+        EXPECT_EQ(0u, m_apiObjects.getPropertyValueStore().getValueCount());
+    }
+
     TEST_F(AnApiObjects, ProducesErrorsWhenDestroyingRamsesNodeBindingFromAnotherClassInstance)
     {
         ApiObjects otherInstance;
@@ -692,7 +708,7 @@ namespace rlogic::internal
         flatbuffers::FlatBufferBuilder builder;
         {
             ApiObjects toSerialize;
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
@@ -721,7 +737,7 @@ namespace rlogic::internal
         {
             ApiObjects toSerialize;
             createScript(toSerialize, m_valid_empty_script);
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
@@ -733,7 +749,7 @@ namespace rlogic::internal
         EXPECT_EQ("script", serializedScript.name()->str());
         EXPECT_EQ(1u, serializedScript.id());
 
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "test", m_nativeNodeTypes, false, m_errorReporting);
         EXPECT_TRUE(deserialized);
     }
 
@@ -746,7 +762,7 @@ namespace rlogic::internal
             toSerialize.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "node");
             toSerialize.createRamsesAppearanceBinding(*m_appearance, "appearance");
             toSerialize.createRamsesCameraBinding(*m_camera, "camera");
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
@@ -794,7 +810,7 @@ namespace rlogic::internal
                 *script->getOutputs()->getChild("nested")->getChild("rotation")->m_impl,
                 *nodeBinding->getInputs()->getChild("rotation")->m_impl,
                 m_errorReporting));
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
@@ -824,7 +840,7 @@ namespace rlogic::internal
             toSerialize.createRamsesAppearanceBinding(*m_appearance, "appearance");
             toSerialize.createRamsesCameraBinding(*m_camera, "camera");
 
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
@@ -832,7 +848,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("node"), m_node->getSceneObjectId())).WillOnce(::testing::Return(m_node));
         EXPECT_CALL(m_resolverMock, findRamsesAppearanceInScene(::testing::Eq("appearance"), m_appearance->getSceneObjectId())).WillOnce(::testing::Return(m_appearance));
         EXPECT_CALL(m_resolverMock, findRamsesCameraInScene(::testing::Eq("camera"), m_camera->getSceneObjectId())).WillOnce(::testing::Return(m_camera));
-        std::unique_ptr<ApiObjects> apiObjectsOptional = ApiObjects::Deserialize(serialized, m_resolverMock, "", m_errorReporting);
+        std::unique_ptr<ApiObjects> apiObjectsOptional = ApiObjects::Deserialize(serialized, m_resolverMock, "", m_nativeNodeTypes, false, m_errorReporting);
 
         ASSERT_TRUE(apiObjectsOptional);
 
@@ -883,12 +899,12 @@ namespace rlogic::internal
                 *script2->getInputs()->getChild("integer")->m_impl,
                 m_errorReporting));
 
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
 
-        std::unique_ptr<ApiObjects> apiObjectsOptional = ApiObjects::Deserialize(serialized, m_resolverMock, "", m_errorReporting);
+        std::unique_ptr<ApiObjects> apiObjectsOptional = ApiObjects::Deserialize(serialized, m_resolverMock, "", m_nativeNodeTypes, false, m_errorReporting);
 
         ASSERT_TRUE(apiObjectsOptional);
 
@@ -930,7 +946,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -956,7 +972,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -982,7 +998,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1008,7 +1024,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1034,7 +1050,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1060,7 +1076,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1086,7 +1102,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1112,7 +1128,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1138,7 +1154,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1164,7 +1180,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1190,7 +1206,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "unit test", m_nativeNodeTypes, false, m_errorReporting);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -1212,7 +1228,7 @@ namespace rlogic::internal
             toSerialize.createAnimationNode({AnimationChannel{"channel", dataArray, dataArray, EInterpolationType::Linear}}, "animNode");
             toSerialize.createTimerNode("timerNode");
 
-            ApiObjects::Serialize(toSerialize, builder);
+            ApiObjects::Serialize(toSerialize, builder, false);
         }
 
         auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ApiObjects>(builder.GetBufferPointer());
@@ -1220,7 +1236,7 @@ namespace rlogic::internal
         EXPECT_CALL(m_resolverMock, findRamsesNodeInScene(::testing::Eq("node"), m_node->getSceneObjectId())).WillOnce(::testing::Return(m_node));
         EXPECT_CALL(m_resolverMock, findRamsesAppearanceInScene(::testing::Eq("appearance"), m_appearance->getSceneObjectId())).WillOnce(::testing::Return(m_appearance));
         EXPECT_CALL(m_resolverMock, findRamsesCameraInScene(::testing::Eq("camera"), m_camera->getSceneObjectId())).WillOnce(::testing::Return(m_camera));
-        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "", m_errorReporting);
+        std::unique_ptr<ApiObjects> deserialized = ApiObjects::Deserialize(serialized, m_resolverMock, "", m_nativeNodeTypes, false, m_errorReporting);
 
         ASSERT_TRUE(deserialized);
 
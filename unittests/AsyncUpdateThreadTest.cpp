@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+
+#include "gtest/gtest.h"
+
+#include "internals/AsyncUpdateThread.h"
+
+#include <stdexcept>
+
+namespace rlogic::internal
+{
+    TEST(AnAsyncUpdateThread, ExecutesAllUpdatesOnTheSameThread)
+    {
+        AsyncUpdateThread updateThread;
+        std::thread::id firstUpdateThread;
+        std::thread::id secondUpdateThread;
+
+        EXPECT_TRUE(updateThread.start([&firstUpdateThread]() { firstUpdateThread = std::this_thread::get_id(); return true; }).get());
+        EXPECT_FALSE(updateThread.start([&secondUpdateThread]() { secondUpdateThread = std::this_thread::get_id(); return false; }).get());
+
+        EXPECT_NE(std::this_thread::get_id(), firstUpdateThread);
+        EXPECT_EQ(firstUpdateThread, secondUpdateThread);
+    }
+
+    TEST(AnAsyncUpdateThread, WaitsForRunningUpdate)
+    {
+        AsyncUpdateThread updateThread;
+        // Returns right away without update
+        updateThread.wait();
+
+        std::shared_future<bool> result = updateThread.start([]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return true;
+        });
+        updateThread.wait();
+        EXPECT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        EXPECT_TRUE(result.get());
+    }
+
+    TEST(AnAsyncUpdateThread, DoesNotWaitWhenCalledByTheUpdate)
+    {
+        AsyncUpdateThread updateThread;
+        EXPECT_TRUE(updateThread.start([&updateThread]() { updateThread.wait(); return true; }).get());
+    }
+
+    TEST(AnAsyncUpdateThread, DoesNotWaitWhenCalledByOtherThreadWhichExecutesTheUpdate)
+    {
+        AsyncUpdateThread updateThread;
+        // Same as a worker of the thread pool which updates nodes concurrently, the update waits for the worker
+        EXPECT_TRUE(updateThread.start([&updateThread]() {
+            std::thread worker([&updateThread]() {
+                AsyncUpdateThread::UpdateScope updateScope(updateThread);
+                updateThread.wait();
+            });
+            worker.join();
+            return true;
+        }).get());
+    }
+
+    TEST(AnAsyncUpdateThread, WaitsWhenCalledByUpdateOfOtherThread)
+    {
+        AsyncUpdateThread updateThread;
+        AsyncUpdateThread otherUpdateThread;
+        std::shared_future<bool> result = updateThread.start([]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return true;
+        });
+
+        EXPECT_TRUE(otherUpdateThread.start([&updateThread, &result]() {
+            updateThread.wait();
+            return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }).get());
+    }
+
+    TEST(AnAsyncUpdateThread, PassesExceptionOfUpdateToFuture)
+    {
+        AsyncUpdateThread updateThread;
+        std::shared_future<bool> result = updateThread.start([]() -> bool { throw std::runtime_error("update failed"); });
+        EXPECT_THROW(result.get(), std::runtime_error);
+
+        // The thread keeps executing updates
+        EXPECT_TRUE(updateThread.start([]() { return true; }).get());
+    }
+
+    TEST(AnAsyncUpdateThread, ExecutesStartedUpdateBeforeItIsDestroyed)
+    {
+        bool executed = false;
+        {
+            AsyncUpdateThread updateThread;
+            (void)updateThread.start([&executed]() { executed = true; return true; });
+        }
+        EXPECT_TRUE(executed);
+    }
+}
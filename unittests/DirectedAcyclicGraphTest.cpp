@@ -269,6 +269,27 @@ namespace rlogic::internal
         EXPECT_THAT(getSortedTestNodes(), ::testing::UnorderedElementsAre(&N1, &N3));
     }
 
+    TEST_F(ADirectedAcyclicGraph, ReusesIndexOfRemovedNode)
+    {
+        addTestNodesToGraph(3);
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+
+        const size_t removedNodeIndex = N2.getGraphIndex();
+        m_graph.removeNode(N2);
+        EXPECT_FALSE(m_graph.containsNode(N2));
+
+        m_graph.addNode(N4);
+        EXPECT_EQ(removedNodeIndex, N4.getGraphIndex());
+        EXPECT_TRUE(m_graph.containsNode(N4));
+
+        // The new node doesn't inherit any edges of the removed node
+        EXPECT_EQ(0u, m_graph.getInDegree(N4));
+        EXPECT_EQ(0u, m_graph.getOutDegree(N4));
+        EXPECT_EQ(0u, m_graph.getOutDegree(N1));
+        EXPECT_EQ(0u, m_graph.getInDegree(N3));
+    }
+
     TEST_F(ADirectedAcyclicGraph, ReturnsTwoNodesInRightOrder)
     {
         addTestNodesToGraph(2);
@@ -517,6 +538,165 @@ namespace rlogic::internal
         EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
     }
 
+    TEST_F(ADirectedAcyclicGraph, DetectsCycleWhichIsNotReachableFromRootNodes)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N2, N3 -> N4 -> N3 -> .... (infinity)
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N4, N3);
+
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, FindsPathBetweenNodes)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+         * N1 -> N2 -> N3 -> N4
+         *         \
+         *          -> N5    N6
+         */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N2, N5);
+
+        EXPECT_THAT(m_graph.findPath(N1, N4), ::testing::ElementsAre(&N1, &N2, &N3, &N4));
+        EXPECT_THAT(m_graph.findPath(N2, N5), ::testing::ElementsAre(&N2, &N5));
+        EXPECT_TRUE(m_graph.findPath(N4, N1).empty());
+        EXPECT_TRUE(m_graph.findPath(N5, N4).empty());
+        EXPECT_TRUE(m_graph.findPath(N1, N6).empty());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, CollectsUpstreamNodesInTopologicalOrder)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+         * N6 -> N2 -> N3 -> N4
+         *         \    /
+         * N1 ----> N5 -
+         */
+        m_graph.addEdge(N6, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N2, N5);
+        m_graph.addEdge(N1, N5);
+        m_graph.addEdge(N5, N4);
+
+        const std::optional<NodeVector> upstreamOfN4 = m_graph.collectUpstreamNodes(N4);
+        ASSERT_TRUE(upstreamOfN4);
+        ASSERT_EQ(6u, upstreamOfN4->size());
+        EXPECT_EQ(&N4, upstreamOfN4->back());
+        for (size_t i = 1; i < upstreamOfN4->size(); ++i)
+        {
+            EXPECT_LT(m_graph.getTopologicalRank(*(*upstreamOfN4)[i - 1]), m_graph.getTopologicalRank(*(*upstreamOfN4)[i]));
+        }
+
+        EXPECT_THAT(*m_graph.collectUpstreamNodes(N3), ::testing::ElementsAre(&N6, &N2, &N3));
+        EXPECT_THAT(*m_graph.collectUpstreamNodes(N5), ::testing::UnorderedElementsAre(&N6, &N2, &N1, &N5));
+        EXPECT_THAT(*m_graph.collectUpstreamNodes(N1), ::testing::ElementsAre(&N1));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, RecomputesOrderAfterCycleIsRemoved)
+    {
+        addTestNodesToGraph(3);
+
+        // N1 -> N2 -> N3 -> N1 -> .... (infinity)
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        EXPECT_FALSE(m_graph.updateTopologicalOrder());
+
+        // N3 -> N1 -> N2
+        m_graph.removeEdge(N2, N3);
+        EXPECT_TRUE(m_graph.updateTopologicalOrder());
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N1, &N2));
+        EXPECT_LT(m_graph.getTopologicalRank(N3), m_graph.getTopologicalRank(N1));
+        EXPECT_LT(m_graph.getTopologicalRank(N1), m_graph.getTopologicalRank(N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, KeepsRanksOfNodesOutsideOfAffectedRegion_WhenEdgeContradictsOrder)
+    {
+        addTestNodesToGraph(6);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3, &N4, &N5, &N6));
+        EXPECT_TRUE(m_graph.takeRerankedNodes().empty());
+
+        // Edges which agree with the current order don't change any rank
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N4, N6);
+        EXPECT_TRUE(m_graph.takeRerankedNodes().empty());
+
+        // N5 -> N2 contradicts the order, only N2 and N5 are in the affected region [rank(N2), rank(N5)]
+        m_graph.addEdge(N5, N2);
+        EXPECT_THAT(m_graph.takeRerankedNodes(), ::testing::UnorderedElementsAre(&N5, &N2));
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N5, &N3, &N4, &N2, &N6));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, MovesReachableNodesTogether_WhenEdgeContradictsOrder)
+    {
+        addTestNodesToGraph(6);
+
+        // N1 -> N2 -> N3, N4 -> N5
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N4, N5);
+
+        // N5 -> N1 requires N4 and N5 to move before N1, N2 and N3
+        m_graph.addEdge(N5, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N4, &N5, &N1, &N2, &N3, &N6));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReportsCycleOnlyOnceItIsClosed_WhenEdgesAreAddedIncrementally)
+    {
+        addTestNodesToGraph(4);
+
+        m_graph.addEdge(N4, N3);
+        m_graph.addEdge(N3, N2);
+        m_graph.addEdge(N2, N1);
+        EXPECT_TRUE(m_graph.isTopologicalOrderValid());
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N4, &N3, &N2, &N1));
+
+        m_graph.addEdge(N1, N4);
+        EXPECT_FALSE(m_graph.isTopologicalOrderValid());
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, KeepsValidOrder_WhenManyNodesAreRemoved)
+    {
+        std::vector<std::unique_ptr<LogicNodeDummyImpl>> nodes;
+        for (size_t i = 0; i < 200; ++i)
+        {
+            nodes.emplace_back(std::make_unique<LogicNodeDummyImpl>("node", false));
+            m_graph.addNode(*nodes.back());
+        }
+
+        // Chain in reverse order of creation: node199 -> node198 -> ... -> node0
+        for (size_t i = 1; i < nodes.size(); ++i)
+        {
+            m_graph.addEdge(*nodes[i], *nodes[i - 1]);
+        }
+
+        // Remove every node but the first and last five - the gaps left in the order are compacted at some point
+        for (size_t i = 5; i < nodes.size() - 5; ++i)
+        {
+            m_graph.removeNode(*nodes[i]);
+        }
+
+        const std::optional<NodeVector> sortedNodes = m_graph.getTopologicallySortedNodes();
+        ASSERT_TRUE(sortedNodes);
+        ASSERT_EQ(10u, sortedNodes->size());
+        for (size_t i = 0; i + 1 < sortedNodes->size(); ++i)
+        {
+            EXPECT_LT(m_graph.getTopologicalRank(*(*sortedNodes)[i]), m_graph.getTopologicalRank(*(*sortedNodes)[i + 1]));
+        }
+        EXPECT_EQ(nodes[199].get(), sortedNodes->front());
+        EXPECT_EQ(nodes[0].get(), sortedNodes->back());
+    }
+
     TEST_F(ADirectedAcyclicGraph, RemovesMultiLinksBetweenTwoNodes_OneByOne)
     {
         addTestNodesToGraph(2);
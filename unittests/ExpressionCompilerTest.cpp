@@ -0,0 +1,142 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/ExpressionCompiler.h"
+#include "internals/ErrorReporting.h"
+
+namespace rlogic::internal
+{
+    class AnExpressionCompiler : public ::testing::Test
+    {
+    protected:
+        std::optional<ExpressionProgram> compile(std::string_view expression)
+        {
+            return ExpressionCompiler::Compile(expression, m_inputs, "expr", m_errorReporting);
+        }
+
+        std::vector<TypeData> m_inputs{ {"a", EPropertyType::Float}, {"b", EPropertyType::Float}, {"v", EPropertyType::Vec3f} };
+        ErrorReporting m_errorReporting;
+    };
+
+    TEST_F(AnExpressionCompiler, PlacesInputsInFirstRegisters)
+    {
+        const auto program = compile("OUT.x = IN.a * IN.b + IN.a");
+        ASSERT_TRUE(program);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+        EXPECT_TRUE(program->isValid());
+
+        std::vector<ExpressionRegister> registers = program->createRegisters();
+        ASSERT_EQ(program->registerCount, registers.size());
+        registers[0].f[0] = 2.f;
+        registers[1].f[0] = 3.f;
+        program->execute(registers);
+
+        ASSERT_EQ(1u, program->outputRegisters.size());
+        EXPECT_FLOAT_EQ(8.f, registers[program->outputRegisters[0]].f[0]);
+    }
+
+    TEST_F(AnExpressionCompiler, FoldsConstantLiteralsIntoRegisters)
+    {
+        // no instructions to negate, convert or construct constant values
+        const auto program = compile("OUT.v = IN.v + vec3(-1, 2.5, 3)\nOUT.x = IN.a * -2");
+        ASSERT_TRUE(program);
+        EXPECT_EQ(2u, program->instructions.size());
+        EXPECT_EQ(2u, program->constants.size());
+
+        // output registers can be read directly after execution, even if only constants are assigned
+        const auto constantProgram = compile("OUT.x = 4");
+        ASSERT_TRUE(constantProgram);
+        EXPECT_TRUE(constantProgram->instructions.empty());
+        std::vector<ExpressionRegister> registers = constantProgram->createRegisters();
+        constantProgram->execute(registers);
+        EXPECT_EQ(4, registers[constantProgram->outputRegisters[0]].i);
+        EXPECT_EQ(EPropertyType::Int32, constantProgram->outputs[0].type);
+    }
+
+    TEST_F(AnExpressionCompiler, AcceptsOnlyValidIdentifiers)
+    {
+        EXPECT_TRUE(ExpressionCompiler::IsValidIdentifier("a"));
+        EXPECT_TRUE(ExpressionCompiler::IsValidIdentifier("_value2"));
+        EXPECT_FALSE(ExpressionCompiler::IsValidIdentifier(""));
+        EXPECT_FALSE(ExpressionCompiler::IsValidIdentifier("2a"));
+        EXPECT_FALSE(ExpressionCompiler::IsValidIdentifier("a.b"));
+        EXPECT_FALSE(ExpressionCompiler::IsValidIdentifier("a b"));
+    }
+
+    TEST_F(AnExpressionCompiler, ReportsMalformedLiterals)
+    {
+        EXPECT_FALSE(compile("OUT.x = 1.5e"));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_EQ("[expr] Error in expression at line 1: malformed number near '1.5e'", m_errorReporting.getErrors().front().message);
+        m_errorReporting.clear();
+
+        EXPECT_FALSE(compile("OUT.x = 99999999999"));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_EQ("[expr] Error in expression at line 1: integer literal '99999999999' is out of the range of INT32", m_errorReporting.getErrors().front().message);
+    }
+
+    TEST_F(AnExpressionCompiler, ReportsStatementsWhichAreNoOutputAssignments)
+    {
+        EXPECT_FALSE(compile("x = 1"));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_EQ("[expr] Error in expression at line 1: expected assignment to an output ('OUT.name = ...'), got 'x'", m_errorReporting.getErrors().front().message);
+    }
+
+    class AnExpressionProgram : public ::testing::Test
+    {
+    protected:
+        AnExpressionProgram()
+        {
+            m_program.inputs = { {"a", EPropertyType::Float} };
+            m_program.outputs = { {"x", EPropertyType::Float} };
+            m_program.outputRegisters = { 1u };
+            m_program.registerCount = 2u;
+            m_program.instructions = { ExpressionInstruction{ EExpressionOpCode::AddF, 1u, 1u, 0u, 0u, 0u } };
+        }
+
+        ExpressionProgram m_program;
+    };
+
+    TEST_F(AnExpressionProgram, IsValidIfAllIndicesAreWithinBounds)
+    {
+        EXPECT_TRUE(m_program.isValid());
+
+        m_program.instructions.push_back({ EExpressionOpCode::GetComponentF, 1u, 1u, 0u, 3u, 0u });
+        EXPECT_TRUE(m_program.isValid());
+        m_program.instructions.back().b = 4u;
+        EXPECT_FALSE(m_program.isValid());
+    }
+
+    TEST_F(AnExpressionProgram, IsInvalidWithOutOfBoundsRegisters)
+    {
+        m_program.instructions[0].c = 2u;
+        EXPECT_FALSE(m_program.isValid());
+        m_program.instructions[0].c = 0u;
+
+        m_program.outputRegisters = { 2u };
+        EXPECT_FALSE(m_program.isValid());
+        m_program.outputRegisters = { 1u };
+
+        m_program.constants.push_back({ 2u, {} });
+        EXPECT_FALSE(m_program.isValid());
+    }
+
+    TEST_F(AnExpressionProgram, IsInvalidWithUnsupportedWidthOrTypes)
+    {
+        m_program.instructions[0].width = 5u;
+        EXPECT_FALSE(m_program.isValid());
+        m_program.instructions[0].width = 1u;
+
+        m_program.outputs = { {"x", EPropertyType::String} };
+        EXPECT_FALSE(m_program.isValid());
+        m_program.outputs = { {"x", EPropertyType::Float}, {"y", EPropertyType::Float} };
+        EXPECT_FALSE(m_program.isValid());
+    }
+}
@@ -0,0 +1,445 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/ExpressionNode.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "impl/ExpressionNodeImpl.h"
+#include "impl/PropertyImpl.h"
+#include "internals/ErrorReporting.h"
+#include "internals/SerializationMap.h"
+#include "internals/DeserializationMap.h"
+#include "internals/EPropertySemantics.h"
+#include "generated/ExpressionNodeGen.h"
+#include "flatbuffers/flatbuffers.h"
+#include <limits>
+
+namespace rlogic::internal
+{
+    class AnExpressionNode : public ::testing::Test
+    {
+    protected:
+        ExpressionNode* createSumNode(std::string_view name = "")
+        {
+            return m_logicEngine.createExpressionNode("OUT.sum = IN.a * IN.b + IN.c", { {"a"}, {"b"}, {"c"} }, name);
+        }
+
+        void expectCreationError(std::string_view expression, const ExpressionNodeInputs& inputs, std::string_view errorMessage)
+        {
+            EXPECT_EQ(nullptr, m_logicEngine.createExpressionNode(expression, inputs, "expr"));
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_EQ(errorMessage, m_logicEngine.getErrors().front().message);
+        }
+
+        LogicEngine m_logicEngine;
+    };
+
+    TEST_F(AnExpressionNode, IsCreated)
+    {
+        ExpressionNode* expressionNode = createSumNode("expressionNode");
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        ASSERT_NE(nullptr, expressionNode);
+        EXPECT_EQ(expressionNode, m_logicEngine.findByName<ExpressionNode>("expressionNode"));
+        EXPECT_EQ(expressionNode, m_logicEngine.findByName<LogicObject>("expressionNode")->as<ExpressionNode>());
+        EXPECT_EQ(1u, m_logicEngine.getCollection<ExpressionNode>().size());
+
+        EXPECT_EQ("expressionNode", expressionNode->getName());
+        EXPECT_EQ("OUT.sum = IN.a * IN.b + IN.c", expressionNode->getExpression());
+    }
+
+    TEST_F(AnExpressionNode, HasDeclaredInputsAndAssignedOutputsAfterCreation)
+    {
+        const ExpressionNode* expressionNode = m_logicEngine.createExpressionNode(
+            "OUT.scaled = IN.v * IN.factor\nOUT.visible = IN.factor > 0 and IN.enabled\nOUT.count = IN.count + 1",
+            { {"v", EPropertyType::Vec3f}, {"factor", EPropertyType::Float}, {"enabled", EPropertyType::Bool}, {"count", EPropertyType::Int32} });
+        ASSERT_NE(nullptr, expressionNode);
+
+        const Property* rootIn = expressionNode->getInputs();
+        EXPECT_EQ("IN", rootIn->getName());
+        ASSERT_EQ(4u, rootIn->getChildCount());
+        EXPECT_EQ("v", rootIn->getChild(0u)->getName());
+        EXPECT_EQ(EPropertyType::Vec3f, rootIn->getChild(0u)->getType());
+        EXPECT_EQ("factor", rootIn->getChild(1u)->getName());
+        EXPECT_EQ(EPropertyType::Float, rootIn->getChild(1u)->getType());
+        EXPECT_EQ("enabled", rootIn->getChild(2u)->getName());
+        EXPECT_EQ(EPropertyType::Bool, rootIn->getChild(2u)->getType());
+        EXPECT_EQ("count", rootIn->getChild(3u)->getName());
+        EXPECT_EQ(EPropertyType::Int32, rootIn->getChild(3u)->getType());
+
+        // outputs are created in the order of the assignments, with the type of the assigned value
+        const Property* rootOut = expressionNode->getOutputs();
+        EXPECT_EQ("OUT", rootOut->getName());
+        ASSERT_EQ(3u, rootOut->getChildCount());
+        EXPECT_EQ("scaled", rootOut->getChild(0u)->getName());
+        EXPECT_EQ(EPropertyType::Vec3f, rootOut->getChild(0u)->getType());
+        EXPECT_EQ("visible", rootOut->getChild(1u)->getName());
+        EXPECT_EQ(EPropertyType::Bool, rootOut->getChild(1u)->getType());
+        EXPECT_EQ("count", rootOut->getChild(2u)->getName());
+        EXPECT_EQ(EPropertyType::Int32, rootOut->getChild(2u)->getType());
+    }
+
+    TEST_F(AnExpressionNode, FailsToBeCreatedWithInvalidInputs)
+    {
+        expectCreationError("OUT.x = 1", { {"1a"} },
+            "[expr] Invalid input name '1a'! Names must consist of letters, digits and '_' and must not start with a digit");
+        expectCreationError("OUT.x = 1", { {"a"}, {"a", EPropertyType::Int32} },
+            "[expr] Input 'a' is declared more than once!");
+        expectCreationError("OUT.x = 1", { {"a", EPropertyType::String} },
+            "[expr] Input 'a' has unsupported type 'STRING'! Expressions support FLOAT, VEC2F, VEC3F, VEC4F, INT32 and BOOL");
+    }
+
+    TEST_F(AnExpressionNode, FailsToBeCreatedWithInvalidExpression)
+    {
+        expectCreationError("", {},
+            "[expr] Error in expression at line 1: expression must assign at least one output, e.g. 'OUT.x = IN.a'");
+        expectCreationError("OUT.x = IN.q", { {"a"} },
+            "[expr] Error in expression at line 1: unknown input 'q'");
+        expectCreationError("OUT.x = IN.a\nOUT.x = IN.a", { {"a"} },
+            "[expr] Error in expression at line 2: output 'x' is assigned more than once");
+        expectCreationError("OUT.x = IN.v + IN.w", { {"v", EPropertyType::Vec3f}, {"w", EPropertyType::Vec2f} },
+            "[expr] Error in expression at line 1: operator '+' can't combine VEC3F and VEC2F");
+        expectCreationError("OUT.x = IN.b + 1", { {"b", EPropertyType::Bool} },
+            "[expr] Error in expression at line 1: operator '+' expects numbers or vectors, got BOOL");
+        expectCreationError("OUT.x = IN.v.w", { {"v", EPropertyType::Vec3f} },
+            "[expr] Error in expression at line 1: VEC3F value has no component 'w'");
+        expectCreationError("OUT.x = foo(IN.a)", { {"a"} },
+            "[expr] Error in expression at line 1: unknown function 'foo'");
+        expectCreationError("OUT.x = min(IN.a)", { {"a"} },
+            "[expr] Error in expression at line 1: function 'min' expects 2 arguments, got 1");
+        expectCreationError("OUT.x = (IN.a", { {"a"} },
+            "[expr] Error in expression at line 1: expected ')' to close '(', got '<eof>'");
+        expectCreationError("OUT.x = 1\nOUT.y = OUT.x", {},
+            "[expr] Error in expression at line 2: outputs can't be used in expressions, only assigned");
+        expectCreationError("-- comment\nOUT.x = 1\n$", {},
+            "[expr] Error in expression at line 3: unexpected symbol '$'");
+
+        // nothing was created
+        EXPECT_TRUE(m_logicEngine.getCollection<ExpressionNode>().empty());
+    }
+
+    TEST_F(AnExpressionNode, IsDestroyed)
+    {
+        ExpressionNode* expressionNode = createSumNode("expressionNode");
+        ASSERT_NE(nullptr, expressionNode);
+        EXPECT_TRUE(m_logicEngine.destroy(*expressionNode));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<ExpressionNode>("expressionNode"));
+    }
+
+    TEST_F(AnExpressionNode, FailsToBeDestroyedIfFromOtherLogicInstance)
+    {
+        ExpressionNode* expressionNode = createSumNode("expressionNode");
+        ASSERT_NE(nullptr, expressionNode);
+
+        LogicEngine otherEngine;
+        EXPECT_FALSE(otherEngine.destroy(*expressionNode));
+        ASSERT_FALSE(otherEngine.getErrors().empty());
+        EXPECT_EQ("Can't find ExpressionNode in logic engine!", otherEngine.getErrors().front().message);
+    }
+
+    TEST_F(AnExpressionNode, ComputesFloatOutputs)
+    {
+        ExpressionNode* expressionNode = createSumNode();
+        ASSERT_NE(nullptr, expressionNode);
+
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("a")->set<float>(2.f));
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("b")->set<float>(3.f));
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("c")->set<float>(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(7.f, *expressionNode->getOutputs()->getChild("sum")->get<float>());
+
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("c")->set<float>(-1.5f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(4.5f, *expressionNode->getOutputs()->getChild("sum")->get<float>());
+    }
+
+    TEST_F(AnExpressionNode, ComputesFunctionsAndOperatorPrecedence)
+    {
+        ExpressionNode* expressionNode = m_logicEngine.createExpressionNode(R"(
+            -- precedence like in Lua
+            OUT.precedence = 1 + IN.x * 2 - -IN.x / 4
+            OUT.clamped = clamp(IN.x, 0, 1)
+            OUT.mixed = lerp(10, 20, 0.25) + min(IN.x, 3) + max(IN.x, 3)
+            OUT.rounded = floor(IN.x + 0.5) + ceil(0.2) + abs(-2) + sqrt(16)
+        )", { {"x"} });
+        ASSERT_NE(nullptr, expressionNode);
+
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("x")->set<float>(2.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        const Property& outputs = *expressionNode->getOutputs();
+        EXPECT_FLOAT_EQ(5.5f, *outputs.getChild("precedence")->get<float>());
+        EXPECT_FLOAT_EQ(1.f, *outputs.getChild("clamped")->get<float>());
+        EXPECT_FLOAT_EQ(17.5f, *outputs.getChild("mixed")->get<float>());
+        EXPECT_FLOAT_EQ(9.f, *outputs.getChild("rounded")->get<float>());
+    }
+
+    TEST_F(AnExpressionNode, ComputesVectorOutputs)
+    {
+        ExpressionNode* expressionNode = m_logicEngine.createExpressionNode(R"(
+            OUT.position = IN.origin + IN.direction * IN.distance
+            OUT.color = vec4(IN.direction.x, IN.direction.y, IN.direction.z, 1)
+            OUT.length = length(IN.direction * 2)
+            OUT.dot = dot(IN.origin, IN.direction)
+            OUT.xy = vec2(IN.origin.y, IN.origin.x)
+        )", { {"origin", EPropertyType::Vec3f}, {"direction", EPropertyType::Vec3f}, {"distance"} });
+        ASSERT_NE(nullptr, expressionNode);
+
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("origin")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("direction")->set<vec3f>({ 0.f, 1.f, 0.f }));
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("distance")->set<float>(5.f));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        const Property& outputs = *expressionNode->getOutputs();
+        EXPECT_EQ(vec3f({ 1.f, 7.f, 3.f }), *outputs.getChild("position")->get<vec3f>());
+        EXPECT_EQ(vec4f({ 0.f, 1.f, 0.f, 1.f }), *outputs.getChild("color")->get<vec4f>());
+        EXPECT_FLOAT_EQ(2.f, *outputs.getChild("length")->get<float>());
+        EXPECT_FLOAT_EQ(2.f, *outputs.getChild("dot")->get<float>());
+        EXPECT_EQ(vec2f({ 2.f, 1.f }), *outputs.getChild("xy")->get<vec2f>());
+    }
+
+    TEST_F(AnExpressionNode, ComputesIntegerAndBoolOutputs)
+    {
+        ExpressionNode* expressionNode = m_logicEngine.createExpressionNode(R"(
+            OUT.index = clamp(IN.index * 2 - 1, 0, 10)
+            OUT.overflow = IN.index + 2147483647
+            OUT.inRange = IN.index >= 1 and IN.index <= 3 and not IN.disabled
+            OUT.selected = select(IN.index == 2, IN.a, IN.b)
+            OUT.scaled = IN.index * 0.5
+        )", { {"index", EPropertyType::Int32}, {"disabled", EPropertyType::Bool}, {"a", EPropertyType::Vec2f}, {"b", EPropertyType::Vec2f} });
+        ASSERT_NE(nullptr, expressionNode);
+
+        const Property& inputs = *expressionNode->getInputs();
+        EXPECT_TRUE(inputs.getChild("a")->set<vec2f>({ 1.f, 2.f }));
+        EXPECT_TRUE(inputs.getChild("b")->set<vec2f>({ 3.f, 4.f }));
+
+        EXPECT_TRUE(inputs.getChild("index")->set<int32_t>(2));
+        EXPECT_TRUE(m_logicEngine.update());
+        const Property& outputs = *expressionNode->getOutputs();
+        EXPECT_EQ(3, *outputs.getChild("index")->get<int32_t>());
+        EXPECT_EQ(std::numeric_limits<int32_t>::min() + 1, *outputs.getChild("overflow")->get<int32_t>());
+        EXPECT_TRUE(*outputs.getChild("inRange")->get<bool>());
+        EXPECT_EQ(vec2f({ 1.f, 2.f }), *outputs.getChild("selected")->get<vec2f>());
+        EXPECT_FLOAT_EQ(1.f, *outputs.getChild("scaled")->get<float>());
+
+        EXPECT_TRUE(inputs.getChild("index")->set<int32_t>(7));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(10, *outputs.getChild("index")->get<int32_t>());
+        EXPECT_FALSE(*outputs.getChild("inRange")->get<bool>());
+        EXPECT_EQ(vec2f({ 3.f, 4.f }), *outputs.getChild("selected")->get<vec2f>());
+
+        EXPECT_TRUE(inputs.getChild("index")->set<int32_t>(1));
+        EXPECT_TRUE(inputs.getChild("disabled")->set<bool>(true));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(*outputs.getChild("inRange")->get<bool>());
+    }
+
+    TEST_F(AnExpressionNode, IsOnlyUpdatedWhenInputsChange)
+    {
+        ExpressionNode* expressionNode = createSumNode();
+        ASSERT_NE(nullptr, expressionNode);
+        m_logicEngine.enableUpdateReport(true);
+
+        // dirty after creation
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.getLastUpdateReport().getNodesExecuted().empty());
+        ASSERT_EQ(1u, m_logicEngine.getLastUpdateReport().getNodesSkippedExecution().size());
+        EXPECT_EQ(expressionNode, m_logicEngine.getLastUpdateReport().getNodesSkippedExecution().front());
+
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("a")->set<float>(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+        EXPECT_EQ(expressionNode, m_logicEngine.getLastUpdateReport().getNodesExecuted().front().first);
+    }
+
+    TEST_F(AnExpressionNode, CanBeLinkedWithScripts)
+    {
+        LuaScript* source = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = IN.value
+            end
+        )");
+        LuaScript* target = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.doubled = FLOAT
+            end
+            function run()
+                OUT.doubled = IN.value * 2
+            end
+        )");
+        ExpressionNode* expressionNode = createSumNode();
+        ASSERT_TRUE(source && target && expressionNode);
+
+        ASSERT_TRUE(m_logicEngine.link(*source->getOutputs()->getChild("value"), *expressionNode->getInputs()->getChild("a")));
+        ASSERT_TRUE(m_logicEngine.link(*expressionNode->getOutputs()->getChild("sum"), *target->getInputs()->getChild("value")));
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("b")->set<float>(3.f));
+        EXPECT_TRUE(expressionNode->getInputs()->getChild("c")->set<float>(1.f));
+
+        EXPECT_TRUE(source->getInputs()->getChild("value")->set<float>(2.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(14.f, *target->getOutputs()->getChild("doubled")->get<float>());
+
+        EXPECT_TRUE(source->getInputs()->getChild("value")->set<float>(4.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(26.f, *target->getOutputs()->getChild("doubled")->get<float>());
+    }
+
+    TEST_F(AnExpressionNode, CanBeSerializedAndDeserialized)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine otherEngine;
+            ExpressionNode* sum = otherEngine.createExpressionNode("OUT.sum = IN.a * IN.b + IN.c", { {"a"}, {"b"}, {"c"} }, "sumNode");
+            ExpressionNode* scale = otherEngine.createExpressionNode("OUT.scaled = IN.v * IN.factor + vec3(1, 2, 3)",
+                { {"v", EPropertyType::Vec3f}, {"factor"} }, "scaleNode");
+            ASSERT_TRUE(sum && scale);
+            ASSERT_TRUE(otherEngine.link(*sum->getOutputs()->getChild("sum"), *scale->getInputs()->getChild("factor")));
+            EXPECT_TRUE(sum->getInputs()->getChild("a")->set<float>(1.f));
+            EXPECT_TRUE(sum->getInputs()->getChild("b")->set<float>(2.f));
+            EXPECT_TRUE(scale->getInputs()->getChild("v")->set<vec3f>({ 1.f, 0.f, 2.f }));
+            EXPECT_TRUE(otherEngine.update());
+            ASSERT_TRUE(otherEngine.saveToFile("logic_expressionNode.bin"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("logic_expressionNode.bin"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(2u, m_logicEngine.getCollection<ExpressionNode>().size());
+
+        ExpressionNode* sum = m_logicEngine.findByName<ExpressionNode>("sumNode");
+        ExpressionNode* scale = m_logicEngine.findByName<ExpressionNode>("scaleNode");
+        ASSERT_TRUE(sum && scale);
+        EXPECT_EQ("OUT.sum = IN.a * IN.b + IN.c", sum->getExpression());
+        EXPECT_FLOAT_EQ(1.f, *sum->getInputs()->getChild("a")->get<float>());
+        EXPECT_FLOAT_EQ(2.f, *sum->getOutputs()->getChild("sum")->get<float>());
+        EXPECT_TRUE(scale->getInputs()->getChild("factor")->isLinked());
+        EXPECT_EQ(vec3f({ 3.f, 2.f, 7.f }), *scale->getOutputs()->getChild("scaled")->get<vec3f>());
+
+        // the loaded nodes execute the saved program
+        EXPECT_TRUE(sum->getInputs()->getChild("c")->set<float>(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(3.f, *sum->getOutputs()->getChild("sum")->get<float>());
+        EXPECT_EQ(vec3f({ 4.f, 2.f, 9.f }), *scale->getOutputs()->getChild("scaled")->get<vec3f>());
+    }
+
+    class AnExpressionNode_SerializationLifecycle : public AnExpressionNode
+    {
+    protected:
+        enum class ESerializationIssue
+        {
+            AllValid,
+            NameMissing,
+            IdMissing,
+            ExpressionMissing,
+            RootInMissing,
+            RootOutMissing,
+            InstructionsMissing,
+            InvalidRegister,
+            InvalidOpCode,
+            InvalidInstructionSize,
+            InterfaceMismatch
+        };
+
+        std::unique_ptr<ExpressionNodeImpl> deserializeSerializedDataWithIssue(ESerializationIssue issue)
+        {
+            flatbuffers::FlatBufferBuilder flatBufferBuilder;
+            SerializationMap serializationMap;
+            DeserializationMap deserializationMap;
+
+            {
+                // OUT.x = IN.a + IN.a, compiled by hand
+                auto inputsImpl = std::make_unique<PropertyImpl>(MakeStruct("IN", { {"a", EPropertyType::Float} }), EPropertySemantics::ScriptInput);
+                auto outputsImpl = std::make_unique<PropertyImpl>(
+                    MakeStruct("OUT", { {"x", issue == ESerializationIssue::InterfaceMismatch ? EPropertyType::String : EPropertyType::Float} }), EPropertySemantics::ScriptOutput);
+
+                std::vector<uint16_t> instructions = {
+                    static_cast<uint16_t>(issue == ESerializationIssue::InvalidOpCode ? 200u : static_cast<uint16_t>(EExpressionOpCode::AddF)),
+                    1u,
+                    1u,
+                    0u,
+                    0u,
+                    issue == ESerializationIssue::InvalidRegister ? static_cast<uint16_t>(2u) : static_cast<uint16_t>(0u) };
+                if (issue == ESerializationIssue::InvalidInstructionSize)
+                    instructions.pop_back();
+                const std::vector<uint16_t> outputRegisters = { 1u };
+
+                const auto expressionNodeFB = rlogic_serialization::CreateExpressionNode(
+                    flatBufferBuilder,
+                    issue == ESerializationIssue::NameMissing ? 0 : flatBufferBuilder.CreateString("expressionNode"),
+                    issue == ESerializationIssue::IdMissing ? 0 : 1u,
+                    issue == ESerializationIssue::ExpressionMissing ? 0 : flatBufferBuilder.CreateString("OUT.x = IN.a + IN.a"),
+                    issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap),
+                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap),
+                    2u,
+                    issue == ESerializationIssue::InstructionsMissing ? 0 : flatBufferBuilder.CreateVector(instructions),
+                    flatBufferBuilder.CreateVector(std::vector<uint16_t>{}),
+                    flatBufferBuilder.CreateVector(std::vector<float>{}),
+                    flatBufferBuilder.CreateVector(std::vector<int32_t>{}),
+                    flatBufferBuilder.CreateVector(outputRegisters)
+                );
+
+                flatBufferBuilder.Finish(expressionNodeFB);
+            }
+
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::ExpressionNode>(flatBufferBuilder.GetBufferPointer());
+            return ExpressionNodeImpl::Deserialize(serialized, m_errorReporting, deserializationMap);
+        }
+
+        ErrorReporting m_errorReporting;
+    };
+
+    TEST_F(AnExpressionNode_SerializationLifecycle, IsDeserializedFromValidData)
+    {
+        std::unique_ptr<ExpressionNodeImpl> deserialized = deserializeSerializedDataWithIssue(ESerializationIssue::AllValid);
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        EXPECT_EQ("expressionNode", deserialized->getName());
+        EXPECT_EQ(1u, deserialized->getId());
+        EXPECT_EQ("OUT.x = IN.a + IN.a", deserialized->getExpression());
+        EXPECT_TRUE(deserialized->getInputs()->getChild("a")->set<float>(1.5f));
+        EXPECT_FALSE(deserialized->update());
+        EXPECT_FLOAT_EQ(3.f, *deserialized->getOutputs()->getChild("x")->get<float>());
+    }
+
+    TEST_F(AnExpressionNode_SerializationLifecycle, FailsDeserializationIfEssentialDataMissing)
+    {
+        for (const auto issue : { ESerializationIssue::NameMissing, ESerializationIssue::IdMissing, ESerializationIssue::ExpressionMissing, ESerializationIssue::RootInMissing, ESerializationIssue::RootOutMissing })
+        {
+            EXPECT_FALSE(deserializeSerializedDataWithIssue(issue));
+            ASSERT_FALSE(m_errorReporting.getErrors().empty());
+            EXPECT_EQ("Fatal error during loading of ExpressionNode from serialized data: missing name, id, expression or in/out property data!", m_errorReporting.getErrors().front().message);
+            m_errorReporting.clear();
+        }
+
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::InstructionsMissing));
+        ASSERT_FALSE(m_errorReporting.getErrors().empty());
+        EXPECT_EQ("Fatal error during loading of ExpressionNode 'expressionNode' from serialized data: missing compiled expression!", m_errorReporting.getErrors().front().message);
+    }
+
+    TEST_F(AnExpressionNode_SerializationLifecycle, FailsDeserializationIfCompiledExpressionIsInvalid)
+    {
+        for (const auto issue : { ESerializationIssue::InvalidRegister, ESerializationIssue::InvalidOpCode, ESerializationIssue::InvalidInstructionSize, ESerializationIssue::InterfaceMismatch })
+        {
+            EXPECT_FALSE(deserializeSerializedDataWithIssue(issue));
+            ASSERT_FALSE(m_errorReporting.getErrors().empty());
+            EXPECT_EQ("Fatal error during loading of ExpressionNode 'expressionNode' from serialized data: invalid compiled expression!", m_errorReporting.getErrors().front().message);
+            m_errorReporting.clear();
+        }
+    }
+}
@@ -423,4 +423,92 @@ namespace rlogic::internal
         EXPECT_GE(vals[1], 0.1f);
         EXPECT_GE(vals[2], 0.1f);
     }
+
+    TEST_F(ALogicEngine_Animations, UpdatesIndependentAnimationsInParallelAndPropagatesTheirValues)
+    {
+        const auto scriptSrc = R"(
+        function interface()
+            IN.value1 = FLOAT
+            IN.value2 = FLOAT
+            IN.value3 = FLOAT
+            OUT.sum = FLOAT
+        end
+        function run()
+            OUT.sum = IN.value1 + IN.value2 + IN.value3
+        end
+        )";
+        const auto script = m_logicEngine.createLuaScript(scriptSrc);
+        ASSERT_TRUE(m_logicEngine.link(*m_animation1->getOutputs()->getChild("channel"), *script->getInputs()->getChild("value1")));
+        ASSERT_TRUE(m_logicEngine.link(*m_animation2->getOutputs()->getChild("channel"), *script->getInputs()->getChild("value2")));
+        ASSERT_TRUE(m_logicEngine.link(*m_animation3->getOutputs()->getChild("channel"), *script->getInputs()->getChild("value3")));
+
+        m_logicEngine.setUpdateThreadCount(4u);
+        m_animation1->getInputs()->getChild("play")->set(true);
+        m_animation2->getInputs()->getChild("play")->set(true);
+        m_animation3->getInputs()->getChild("play")->set(true);
+
+        advanceAnimationsAndUpdate(0.5f);
+        EXPECT_FLOAT_EQ(0.5f, *m_animation1->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation2->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation3->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(1.5f, *script->getOutputs()->getChild("sum")->get<float>());
+
+        // back to serial execution
+        m_logicEngine.setUpdateThreadCount(1u);
+        advanceAnimationsAndUpdate(0.25f);
+        EXPECT_FLOAT_EQ(2.25f, *script->getOutputs()->getChild("sum")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_Animations, UpdatesAnimationsAndTimersInParallelDuringAsyncUpdate)
+    {
+        // Two timers and the third animation are updated in parallel, then the two linked animations
+        TimerNode* otherTimer = m_logicEngine.createTimerNode("otherTimer");
+        ASSERT_NE(nullptr, otherTimer);
+        ASSERT_TRUE(m_logicEngine.link(*m_timer->getOutputs()->getChild("timeDelta"), *m_animation1->getInputs()->getChild("timeDelta")));
+        ASSERT_TRUE(m_logicEngine.link(*otherTimer->getOutputs()->getChild("timeDelta"), *m_animation2->getInputs()->getChild("timeDelta")));
+
+        m_logicEngine.setUpdateThreadCount(4u);
+        m_animation1->getInputs()->getChild("play")->set(true);
+        m_animation2->getInputs()->getChild("play")->set(true);
+        m_animation3->getInputs()->getChild("play")->set(true);
+
+        m_timer->getInputs()->getChild("ticker_us")->set<int64_t>(1);
+        otherTimer->getInputs()->getChild("ticker_us")->set<int64_t>(1);
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_TRUE(m_logicEngine.commit());
+
+        m_timer->getInputs()->getChild("ticker_us")->set<int64_t>(500001);
+        otherTimer->getInputs()->getChild("ticker_us")->set<int64_t>(500001);
+        m_animation3->getInputs()->getChild("timeDelta")->set(0.5f);
+        std::shared_future<bool> result = m_logicEngine.updateAsync();
+        // Waits for the running update
+        EXPECT_FLOAT_EQ(0.5f, *m_animation1->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_TRUE(result.get());
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation2->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation3->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_Animations, ReportsErrorOfAnimationUpdatedInParallel)
+    {
+        m_logicEngine.setUpdateThreadCount(4u);
+        m_animation1->getInputs()->getChild("play")->set(true);
+        m_animation2->getInputs()->getChild("play")->set(true);
+        m_animation3->getInputs()->getChild("play")->set(true);
+
+        m_animation1->getInputs()->getChild("timeDelta")->set(0.5f);
+        m_animation2->getInputs()->getChild("timeDelta")->set(-1.f);
+        m_animation3->getInputs()->getChild("timeDelta")->set(0.5f);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("AnimationNode 'animNode2' failed to update - cannot use negative timeDelta (-1)", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(m_animation2, m_logicEngine.getErrors()[0].object);
+
+        // the failed node is updated again after fixing its input
+        m_animation2->getInputs()->getChild("timeDelta")->set(0.5f);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation1->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation2->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.5f, *m_animation3->getOutputs()->getChild("channel")->get<float>());
+    }
 }
@@ -272,9 +272,9 @@ namespace rlogic
         EXPECT_TRUE(m_logicEngine.link(*vec3Source, *vec3Target));
     }
 
-    TEST_F(ALogicEngine_Linking, ProducesErrorOnNextUpdateIfLinkCycleWasCreated)
+    TEST_F(ALogicEngine_Linking, ProducesErrorIfLinkWouldCreateALoop)
     {
-        LuaScript& loopScript = *m_logicEngine.createLuaScript(m_minimalLinkScript);
+        LuaScript& loopScript = *m_logicEngine.createLuaScript(m_minimalLinkScript, {}, "LoopScript");
         const Property* sourceInput = m_sourceScript.getInputs()->getChild("target");
         const Property* sourceOutput = m_sourceScript.getOutputs()->getChild("source");
         const Property* targetInput = m_targetScript.getInputs()->getChild("target");
@@ -284,17 +284,16 @@ namespace rlogic
 
         EXPECT_TRUE(m_logicEngine.link(*sourceOutput, *targetInput));
         EXPECT_TRUE(m_logicEngine.link(*targetOutput, *loopInput));
-        EXPECT_TRUE(m_logicEngine.link(*loopOutput, *sourceInput));
-        EXPECT_FALSE(m_logicEngine.update());
+        EXPECT_FALSE(m_logicEngine.link(*loopOutput, *sourceInput));
         auto errors = m_logicEngine.getErrors();
         ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling update()!", errors[0].message);
+        EXPECT_EQ("Failed to link output property 'source' of LogicNode 'LoopScript' to input property 'target' of LogicNode 'SourceScript', the link would create a loop: "
+            "'SourceScript.source' -> 'TargetScript.target', 'TargetScript.source' -> 'LoopScript.target', 'LoopScript.source' -> 'SourceScript.target'", errors[0].message);
 
-        // Also refuse to save to file
-        EXPECT_FALSE(m_logicEngine.saveToFile("will_not_write"));
-        errors = m_logicEngine.getErrors();
-        ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling saveToFile()!", errors[0].message);
+        // The loop was not created
+        EXPECT_TRUE(loopOutput->m_impl->getLinkedOutgoingProperties().empty());
+        EXPECT_EQ(nullptr, sourceInput->m_impl->getLinkedIncomingProperty());
+        EXPECT_TRUE(m_logicEngine.update());
     }
 
     TEST_F(ALogicEngine_Linking, PropagatesValuesAcrossMultipleLinksInAChain)
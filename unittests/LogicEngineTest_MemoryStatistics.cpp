@@ -0,0 +1,191 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
+#include "ramses-logic/LuaConfig.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/MemoryStatistics.h"
+
+#include "impl/PropertyImpl.h"
+
+namespace rlogic
+{
+    class ALogicEngine_MemoryStatistics : public ALogicEngine
+    {
+    protected:
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.speed = FLOAT
+                IN.doors = ARRAY(4, { angle = FLOAT, open = BOOL })
+                OUT.speed = FLOAT
+            end
+            function run()
+                OUT.speed = IN.speed
+            end
+        )";
+    };
+
+    TEST_F(ALogicEngine_MemoryStatistics, IsEmptyWithoutLogicNodes)
+    {
+        const MemoryStatistics statistics = m_logicEngine.getMemoryStatistics();
+        EXPECT_EQ(0u, statistics.propertyCount);
+        EXPECT_EQ(0u, statistics.propertyObjectsSize);
+        EXPECT_EQ(0u, statistics.propertyTypeCount);
+        EXPECT_EQ(0u, statistics.propertyTypesSize);
+        EXPECT_EQ(0u, statistics.propertyTypesUnsharedSize);
+    }
+
+    TEST_F(ALogicEngine_MemoryStatistics, CountsPropertiesOfAllLogicNodes)
+    {
+        m_logicEngine.createLuaScript(m_scriptSource);
+
+        const MemoryStatistics statistics = m_logicEngine.getMemoryStatistics();
+        // IN, speed, doors, 4 x (element, angle, open), OUT, speed
+        EXPECT_EQ(17u, statistics.propertyCount);
+        EXPECT_GT(statistics.propertyObjectsSize, 0u);
+        EXPECT_GT(statistics.propertyValuesSize, 0u);
+        // IN, speed, doors, element, angle, open, OUT, speed (OUT.speed and IN.speed are equal, but not deduplicated)
+        EXPECT_EQ(8u, statistics.propertyTypeCount);
+        EXPECT_LT(statistics.propertyTypesSize, statistics.propertyTypesUnsharedSize);
+    }
+
+    TEST_F(ALogicEngine_MemoryStatistics, ScriptsWithSameInterfaceShareTypeInformation)
+    {
+        LuaScript* firstScript = m_logicEngine.createLuaScript(m_scriptSource);
+        const MemoryStatistics singleScriptStatistics = m_logicEngine.getMemoryStatistics();
+
+        LuaScript* secondScript = m_logicEngine.createLuaScript(m_scriptSource);
+        const MemoryStatistics statistics = m_logicEngine.getMemoryStatistics();
+
+        EXPECT_EQ(firstScript->getInputs()->m_impl->getTypeDescriptor(), secondScript->getInputs()->m_impl->getTypeDescriptor());
+        EXPECT_EQ(firstScript->getOutputs()->m_impl->getTypeDescriptor(), secondScript->getOutputs()->m_impl->getTypeDescriptor());
+
+        EXPECT_EQ(2 * singleScriptStatistics.propertyCount, statistics.propertyCount);
+        EXPECT_EQ(singleScriptStatistics.propertyTypeCount, statistics.propertyTypeCount);
+        EXPECT_EQ(singleScriptStatistics.propertyTypesSize, statistics.propertyTypesSize);
+        EXPECT_EQ(2 * singleScriptStatistics.propertyTypesUnsharedSize, statistics.propertyTypesUnsharedSize);
+    }
+
+    TEST_F(ALogicEngine_MemoryStatistics, ScriptsWithDifferentInterfaceDontShareTypeInformation)
+    {
+        LuaScript* firstScript = m_logicEngine.createLuaScript(m_scriptSource);
+        LuaScript* secondScript = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.speed = INT
+                OUT.speed = FLOAT
+            end
+            function run()
+            end
+        )");
+
+        EXPECT_NE(firstScript->getInputs()->m_impl->getTypeDescriptor(), secondScript->getInputs()->m_impl->getTypeDescriptor());
+        EXPECT_EQ(firstScript->getOutputs()->m_impl->getTypeDescriptor(), secondScript->getOutputs()->m_impl->getTypeDescriptor());
+    }
+
+    TEST_F(ALogicEngine_MemoryStatistics, ScriptsLoadedFromFileShareTypeInformation)
+    {
+        WithTempDirectory tempFolder;
+        m_logicEngine.createLuaScript(m_scriptSource, {}, "first");
+        m_logicEngine.createLuaScript(m_scriptSource, {}, "second");
+        ASSERT_TRUE(m_logicEngine.saveToFile("memoryStatistics.rlogic"));
+
+        LogicEngine loadedEngine;
+        ASSERT_TRUE(loadedEngine.loadFromFile("memoryStatistics.rlogic"));
+        const LuaScript* first = loadedEngine.findByName<LuaScript>("first");
+        const LuaScript* second = loadedEngine.findByName<LuaScript>("second");
+        ASSERT_TRUE(first && second);
+
+        EXPECT_EQ(first->getInputs()->m_impl->getTypeDescriptor(), second->getInputs()->m_impl->getTypeDescriptor());
+        EXPECT_EQ(m_logicEngine.getMemoryStatistics().propertyTypeCount, loadedEngine.getMemoryStatistics().propertyTypeCount);
+    }
+
+    TEST_F(ALogicEngine_MemoryStatistics, IncludesMemoryOfLuaStates)
+    {
+        // standard libraries
+        const MemoryStatistics emptyEngineStatistics = m_logicEngine.getMemoryStatistics();
+        EXPECT_GT(emptyEngineStatistics.luaMemory.allocatedBytes, 0u);
+        EXPECT_GE(emptyEngineStatistics.luaMemory.peakAllocatedBytes, emptyEngineStatistics.luaMemory.allocatedBytes);
+        EXPECT_GT(emptyEngineStatistics.luaMemory.allocationCount, 0u);
+        EXPECT_GT(emptyEngineStatistics.luaPoolsSize, 0u);
+
+        const LuaScript* script = m_logicEngine.createLuaScript(m_scriptSource);
+        ASSERT_NE(nullptr, script);
+        const LuaMemoryStatistics scriptStatistics = script->getLuaMemoryStatistics();
+        EXPECT_GT(scriptStatistics.allocatedBytes, 0u);
+        EXPECT_GT(scriptStatistics.allocationCount, 0u);
+
+        const MemoryStatistics statistics = m_logicEngine.getMemoryStatistics();
+        EXPECT_GE(statistics.luaMemory.allocatedBytes, emptyEngineStatistics.luaMemory.allocatedBytes + scriptStatistics.allocatedBytes);
+        EXPECT_GT(statistics.luaMemory.allocationCount, emptyEngineStatistics.luaMemory.allocationCount);
+
+        // other execution groups have their own Lua state
+        LuaConfig config;
+        config.setExecutionGroup(1u);
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(m_scriptSource, config));
+        EXPECT_GT(m_logicEngine.getMemoryStatistics().luaMemory.allocatedBytes, statistics.luaMemory.allocatedBytes + emptyEngineStatistics.luaMemory.allocatedBytes);
+        EXPECT_GT(m_logicEngine.getMemoryStatistics().luaPoolsSize, statistics.luaPoolsSize);
+    }
+
+    TEST_F(ALogicEngine_MemoryStatistics, AttributesLuaMemoryToScriptsAndModules)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(R"(
+            local mymodule = { data = {} }
+            for i = 1, 1000 do
+                mymodule.data[i] = i
+            end
+            function mymodule.createTable(size)
+                local t = {}
+                for i = 1, size do
+                    t[i] = i
+                end
+                return t
+            end
+            return mymodule
+        )");
+        ASSERT_NE(nullptr, module);
+        const LuaMemoryStatistics moduleStatistics = module->getLuaMemoryStatistics();
+        // 1000 numbers in the array part of the table
+        EXPECT_GT(moduleStatistics.allocatedBytes, 1000u * sizeof(double));
+
+        LuaConfig config;
+        config.addDependency("mymodule", *module);
+        LuaScript* script = m_logicEngine.createLuaScript(R"(
+            modules("mymodule")
+            function interface()
+                IN.size = INT32
+            end
+            function run()
+                GLOBAL.data = mymodule.createTable(IN.size)
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+        const LuaMemoryStatistics scriptStatistics = script->getLuaMemoryStatistics();
+
+        // allocations of module functions are attributed to the calling script
+        script->getInputs()->getChild("size")->set<int32_t>(2000);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_GT(script->getLuaMemoryStatistics().allocatedBytes, scriptStatistics.allocatedBytes + 2000u * sizeof(double));
+        EXPECT_GT(script->getLuaMemoryStatistics().allocationCount, scriptStatistics.allocationCount);
+        EXPECT_EQ(moduleStatistics.allocatedBytes, module->getLuaMemoryStatistics().allocatedBytes);
+
+        // a module is loaded into the Lua state of each execution group it's used in
+        config.setExecutionGroup(1u);
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(R"(
+            modules("mymodule")
+            function interface()
+            end
+            function run()
+            end
+        )", config));
+        EXPECT_GT(module->getLuaMemoryStatistics().allocatedBytes, 2u * 1000u * sizeof(double));
+    }
+}
@@ -0,0 +1,277 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+#include "LogTestUtils.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/Property.h"
+#include "ramses-logic/PropertyHandle.h"
+#include "ramses-logic/LuaScript.h"
+
+#include "fmt/format.h"
+
+namespace rlogic
+{
+    class ALogicEngine_PropertyHandle : public ALogicEngine
+    {
+    protected:
+        const std::string_view m_scriptSource = R"(
+            function interface()
+                IN.speed = FLOAT
+                IN.name = STRING
+                IN.vehicle = {
+                    doors = ARRAY(4, { angle = FLOAT, open = BOOL }),
+                    wheels = ARRAY(2, INT)
+                }
+                OUT.speed = FLOAT
+            end
+            function run()
+                OUT.speed = IN.speed * 2
+            end
+        )";
+
+        LuaScript& m_script{ *m_logicEngine.createLuaScript(m_scriptSource, {}, "script") };
+
+        // Silence logs, unless explicitly enabled, to reduce spam and speed up tests
+        ScopedLogContextLevel m_silenceLogs{ ELogMessageType::Off };
+    };
+
+    TEST_F(ALogicEngine_PropertyHandle, IsInvalidByDefault)
+    {
+        const PropertyHandle handle;
+        EXPECT_FALSE(handle.isValid());
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, ResolvesPathsToPrimitiveInputsAndOutputs)
+    {
+        const PropertyHandle speed = m_logicEngine.resolvePath(m_script, "IN.speed");
+        ASSERT_TRUE(speed.isValid());
+        EXPECT_EQ(EPropertyType::Float, speed.getType());
+
+        const PropertyHandle angle = m_logicEngine.resolvePath(m_script, "IN.vehicle.doors[2].angle");
+        ASSERT_TRUE(angle.isValid());
+        EXPECT_EQ(EPropertyType::Float, angle.getType());
+
+        const PropertyHandle wheel = m_logicEngine.resolvePath(m_script, "IN.vehicle.wheels[1]");
+        ASSERT_TRUE(wheel.isValid());
+        EXPECT_EQ(EPropertyType::Int32, wheel.getType());
+
+        const PropertyHandle output = m_logicEngine.resolvePath(m_script, "OUT.speed");
+        ASSERT_TRUE(output.isValid());
+        EXPECT_EQ(EPropertyType::Float, output.getType());
+
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, SetsAndGetsValuesOfResolvedProperty)
+    {
+        const PropertyHandle angle = m_logicEngine.resolvePath(m_script, "IN.vehicle.doors[2].angle");
+        ASSERT_TRUE(angle.isValid());
+
+        EXPECT_TRUE(m_logicEngine.set<float>(angle, 42.f));
+        EXPECT_EQ(42.f, m_logicEngine.get<float>(angle));
+
+        const Property* angleProperty = m_script.getInputs()->getChild("vehicle")->getChild("doors")->getChild(2u)->getChild("angle");
+        EXPECT_EQ(42.f, *angleProperty->get<float>());
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, ValuesSetOverHandleAreUsedByUpdate)
+    {
+        const PropertyHandle speed = m_logicEngine.resolvePath(m_script, "IN.speed");
+        const PropertyHandle outSpeed = m_logicEngine.resolvePath(m_script, "OUT.speed");
+
+        EXPECT_TRUE(m_logicEngine.set<float>(speed, 5.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(10.f, m_logicEngine.get<float>(outSpeed));
+
+        EXPECT_TRUE(m_logicEngine.set<float>(speed, 6.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(12.f, m_logicEngine.get<float>(outSpeed));
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetOrGetValueWithWrongType)
+    {
+        const PropertyHandle name = m_logicEngine.resolvePath(m_script, "IN.name");
+        ASSERT_TRUE(name.isValid());
+
+        EXPECT_FALSE(m_logicEngine.set<float>(name, 1.f));
+        EXPECT_FALSE(m_logicEngine.get<float>(name));
+
+        EXPECT_TRUE(m_logicEngine.set<std::string>(name, "car"));
+        EXPECT_EQ("car", m_logicEngine.get<std::string>(name));
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetOutput)
+    {
+        const PropertyHandle output = m_logicEngine.resolvePath(m_script, "OUT.speed");
+        ASSERT_TRUE(output.isValid());
+
+        EXPECT_FALSE(m_logicEngine.set<float>(output, 1.f));
+        EXPECT_EQ(0.f, m_logicEngine.get<float>(output));
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetLinkedInput)
+    {
+        LuaScript& targetScript = *m_logicEngine.createLuaScript(m_scriptSource, {}, "target");
+        const PropertyHandle speed = m_logicEngine.resolvePath(targetScript, "IN.speed");
+        ASSERT_TRUE(speed.isValid());
+
+        ASSERT_TRUE(m_logicEngine.link(*m_script.getOutputs()->getChild("speed"), *targetScript.getInputs()->getChild("speed")));
+        EXPECT_FALSE(m_logicEngine.set<float>(speed, 1.f));
+
+        ASSERT_TRUE(m_logicEngine.unlink(*m_script.getOutputs()->getChild("speed"), *targetScript.getInputs()->getChild("speed")));
+        EXPECT_TRUE(m_logicEngine.set<float>(speed, 1.f));
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetOrGetValueOfInvalidHandle)
+    {
+        EXPECT_FALSE(m_logicEngine.set<float>(PropertyHandle{}, 1.f));
+        EXPECT_FALSE(m_logicEngine.get<float>(PropertyHandle{}));
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetOrGetValueWithHandleOfOtherEngine)
+    {
+        LogicEngine otherEngine;
+        LuaScript& otherScript = *otherEngine.createLuaScript(m_scriptSource, {}, "otherScript");
+        const PropertyHandle otherSpeed = otherEngine.resolvePath(otherScript, "IN.speed");
+        ASSERT_TRUE(otherSpeed.isValid());
+
+        std::string errorMessage;
+        ScopedLogContextLevel scopedLogs(ELogMessageType::Error, [&errorMessage](ELogMessageType /*msgType*/, std::string_view message) {
+            errorMessage = message;
+        });
+
+        EXPECT_FALSE(m_logicEngine.set<float>(otherSpeed, 1.f));
+        EXPECT_EQ("Can't set value of property handle which was resolved by another LogicEngine", errorMessage);
+        EXPECT_FALSE(m_logicEngine.get<float>(otherSpeed));
+        EXPECT_EQ("Can't get value of property handle which was resolved by another LogicEngine", errorMessage);
+        EXPECT_EQ(0.f, *otherScript.getInputs()->getChild("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetOrGetValueAfterLogicNodeWasDestroyed)
+    {
+        LuaScript& otherScript = *m_logicEngine.createLuaScript(m_scriptSource, {}, "other");
+        const PropertyHandle otherSpeed = m_logicEngine.resolvePath(otherScript, "IN.speed");
+        ASSERT_TRUE(otherSpeed.isValid());
+        ASSERT_TRUE(m_logicEngine.destroy(otherScript));
+        // May reuse the memory of the destroyed script
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(m_scriptSource, {}, "new"));
+
+        std::string errorMessage;
+        ScopedLogContextLevel scopedLogs(ELogMessageType::Error, [&errorMessage](ELogMessageType /*msgType*/, std::string_view message) {
+            errorMessage = message;
+        });
+
+        EXPECT_FALSE(m_logicEngine.set<float>(otherSpeed, 1.f));
+        EXPECT_EQ("Can't set value of stale property handle, the LogicNode which owns the property was destroyed", errorMessage);
+        EXPECT_FALSE(m_logicEngine.get<float>(otherSpeed));
+        EXPECT_EQ("Can't get value of stale property handle, the LogicNode which owns the property was destroyed", errorMessage);
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToSetOrGetValueAfterFileWasLoaded)
+    {
+        WithTempDirectory tempDirectory;
+        const PropertyHandle speed = m_logicEngine.resolvePath(m_script, "IN.speed");
+        ASSERT_TRUE(speed.isValid());
+        ASSERT_TRUE(m_logicEngine.saveToFile("propertyHandle.rlogic"));
+        ASSERT_TRUE(m_logicEngine.loadFromFile("propertyHandle.rlogic"));
+
+        EXPECT_FALSE(m_logicEngine.set<float>(speed, 1.f));
+        EXPECT_FALSE(m_logicEngine.get<float>(speed));
+
+        // Handles of loaded nodes and of nodes created after loading can be used
+        LuaScript* loadedScript = m_logicEngine.findByName<LuaScript>("script");
+        ASSERT_NE(nullptr, loadedScript);
+        const PropertyHandle loadedSpeed = m_logicEngine.resolvePath(*loadedScript, "IN.speed");
+        EXPECT_TRUE(m_logicEngine.set<float>(loadedSpeed, 1.f));
+        EXPECT_EQ(1.f, m_logicEngine.get<float>(loadedSpeed));
+
+        LuaScript* newScript = m_logicEngine.createLuaScript(m_scriptSource, {}, "new");
+        ASSERT_NE(nullptr, newScript);
+        const PropertyHandle newSpeed = m_logicEngine.resolvePath(*newScript, "IN.speed");
+        EXPECT_TRUE(m_logicEngine.set<float>(newSpeed, 2.f));
+        EXPECT_EQ(2.f, m_logicEngine.get<float>(newSpeed));
+        EXPECT_EQ(1.f, m_logicEngine.get<float>(loadedSpeed));
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, StaysValidWhenOtherNodesAreCreatedAndDestroyed)
+    {
+        const PropertyHandle speed = m_logicEngine.resolvePath(m_script, "IN.speed");
+        ASSERT_TRUE(m_logicEngine.set<float>(speed, 3.f));
+
+        for (int i = 0; i < 10; ++i)
+        {
+            LuaScript* otherScript = m_logicEngine.createLuaScript(m_scriptSource, {}, "other");
+            ASSERT_NE(nullptr, otherScript);
+            if (i % 2 == 0)
+            {
+                ASSERT_TRUE(m_logicEngine.destroy(*otherScript));
+            }
+        }
+
+        EXPECT_EQ(3.f, m_logicEngine.get<float>(speed));
+        EXPECT_TRUE(m_logicEngine.set<float>(speed, 4.f));
+        EXPECT_EQ(4.f, *m_script.getInputs()->getChild("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToResolveInvalidPaths)
+    {
+        const std::vector<std::pair<std::string_view, std::string_view>> invalidPaths = {
+            { "", "no root property with name ''" },
+            { "INPUT.speed", "no root property with name 'INPUT'" },
+            { "IN", "only properties with primitive types have a value" },
+            { "IN.vehicle", "only properties with primitive types have a value" },
+            { "IN.vehicle.doors[1]", "only properties with primitive types have a value" },
+            { "IN.unknown", "property 'IN' has no field 'unknown'" },
+            { "IN.speed.value", "property 'speed' is not a struct, can't access field 'value'" },
+            { "IN.vehicle[0]", "property 'vehicle' is not an array, can't access index 0" },
+            { "IN.vehicle.doors[4].angle", "index 4 is out of range of array 'doors' with size 4" },
+            { "IN.vehicle.doors[-1].angle", "invalid array index '-1'" },
+            { "IN.vehicle.doors[].angle", "invalid array index ''" },
+            { "IN.vehicle.doors[1x].angle", "invalid array index '1x'" },
+            { "IN.vehicle.doors[1", "missing ']'" },
+            { "IN.vehicle.wheels[1]x", "unexpected character 'x' at position 20" },
+        };
+
+        for (const auto& [path, reason] : invalidPaths)
+        {
+            const PropertyHandle handle = m_logicEngine.resolvePath(m_script, path);
+            EXPECT_FALSE(handle.isValid()) << path;
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size()) << path;
+            EXPECT_EQ(fmt::format("Failed to resolve path '{}' of LogicNode 'script': {}", path, reason), m_logicEngine.getErrors()[0].message);
+            EXPECT_EQ(&m_script, m_logicEngine.getErrors()[0].object);
+        }
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, FailsToResolvePathOfNodeFromOtherEngine)
+    {
+        LogicEngine otherEngine;
+        LuaScript& otherScript = *otherEngine.createLuaScript(m_scriptSource, {}, "otherScript");
+
+        EXPECT_FALSE(m_logicEngine.resolvePath(otherScript, "IN.speed").isValid());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("LogicNode 'otherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_PropertyHandle, ResolvesPathsOfBindingInputs)
+    {
+        RamsesNodeBinding& nodeBinding = *m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+
+        const PropertyHandle translation = m_logicEngine.resolvePath(nodeBinding, "IN.translation");
+        ASSERT_TRUE(translation.isValid());
+        EXPECT_EQ(EPropertyType::Vec3f, translation.getType());
+
+        EXPECT_TRUE(m_logicEngine.set<vec3f>(translation, { 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        vec3f translationValue;
+        m_node->getTranslation(translationValue[0], translationValue[1], translationValue[2]);
+        EXPECT_EQ(translationValue, (vec3f{ 1.f, 2.f, 3.f }));
+    }
+}
@@ -0,0 +1,278 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+
+#include "impl/PropertyImpl.h"
+
+#include <fstream>
+#include <iterator>
+
+namespace rlogic
+{
+    class ALogicEngine_ScriptInstances : public ALogicEngine
+    {
+    protected:
+        const std::string_view m_scriptSource = R"(
+            function init()
+                GLOBAL.counter = 0
+            end
+            function interface()
+                IN.speed = FLOAT
+                IN.name = STRING
+                OUT.speed = FLOAT
+                OUT.counter = INT
+            end
+            function run()
+                -- unique_source_marker
+                GLOBAL.counter = GLOBAL.counter + 1
+                OUT.speed = IN.speed
+                OUT.counter = GLOBAL.counter
+            end
+        )";
+    };
+
+    TEST_F(ALogicEngine_ScriptInstances, CreatesInstanceWithSameInterfaceAsPrototype)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSource, {}, "prototype");
+        ASSERT_NE(nullptr, prototype);
+
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype, "instance");
+        ASSERT_NE(nullptr, instance);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_NE(prototype, instance);
+        EXPECT_EQ("instance", instance->getName());
+        EXPECT_NE(prototype->getId(), instance->getId());
+        EXPECT_EQ(instance, m_logicEngine.findByName<LuaScript>("instance"));
+
+        ASSERT_EQ(2u, instance->getInputs()->getChildCount());
+        EXPECT_EQ(EPropertyType::Float, instance->getInputs()->getChild("speed")->getType());
+        EXPECT_EQ(EPropertyType::String, instance->getInputs()->getChild("name")->getType());
+        ASSERT_EQ(2u, instance->getOutputs()->getChildCount());
+        EXPECT_EQ(EPropertyType::Float, instance->getOutputs()->getChild("speed")->getType());
+        EXPECT_EQ(EPropertyType::Int32, instance->getOutputs()->getChild("counter")->getType());
+
+        EXPECT_EQ(prototype->getInputs()->m_impl->getTypeDescriptor(), instance->getInputs()->m_impl->getTypeDescriptor());
+        EXPECT_EQ(prototype->getOutputs()->m_impl->getTypeDescriptor(), instance->getOutputs()->m_impl->getTypeDescriptor());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, InstanceHasDefaultValuesInsteadOfValuesOfPrototype)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSource);
+        ASSERT_TRUE(prototype->getInputs()->getChild("speed")->set<float>(5.f));
+        ASSERT_TRUE(prototype->getInputs()->getChild("name")->set<std::string>("prototype"));
+
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+        EXPECT_FLOAT_EQ(0.f, *instance->getInputs()->getChild("speed")->get<float>());
+        EXPECT_EQ("", *instance->getInputs()->getChild("name")->get<std::string>());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, InstancesHaveIndependentInputsAndGlobals)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSource);
+        LuaScript* instance1 = m_logicEngine.createLuaScriptInstance(*prototype);
+        LuaScript* instance2 = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance1);
+        ASSERT_NE(nullptr, instance2);
+
+        ASSERT_TRUE(prototype->getInputs()->getChild("speed")->set<float>(1.f));
+        ASSERT_TRUE(instance1->getInputs()->getChild("speed")->set<float>(2.f));
+        ASSERT_TRUE(instance2->getInputs()->getChild("speed")->set<float>(3.f));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FLOAT_EQ(1.f, *prototype->getOutputs()->getChild("speed")->get<float>());
+        EXPECT_FLOAT_EQ(2.f, *instance1->getOutputs()->getChild("speed")->get<float>());
+        EXPECT_FLOAT_EQ(3.f, *instance2->getOutputs()->getChild("speed")->get<float>());
+
+        // only instance1 is dirty, the globals of the others are not incremented
+        ASSERT_TRUE(instance1->getInputs()->getChild("speed")->set<float>(4.f));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_EQ(1, *prototype->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(2, *instance1->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(1, *instance2->getOutputs()->getChild("counter")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, InstanceCanBeLinked)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSource);
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+
+        ASSERT_TRUE(m_logicEngine.link(*prototype->getOutputs()->getChild("speed"), *instance->getInputs()->getChild("speed")));
+        ASSERT_TRUE(prototype->getInputs()->getChild("speed")->set<float>(7.f));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_FLOAT_EQ(7.f, *instance->getOutputs()->getChild("speed")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, InstanceStaysValidWhenPrototypeIsDestroyed)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSource);
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+        ASSERT_TRUE(m_logicEngine.destroy(*prototype));
+
+        ASSERT_TRUE(instance->getInputs()->getChild("speed")->set<float>(2.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.f, *instance->getOutputs()->getChild("speed")->get<float>());
+
+        LuaScript* instanceOfInstance = m_logicEngine.createLuaScriptInstance(*instance);
+        ASSERT_NE(nullptr, instanceOfInstance);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1, *instanceOfInstance->getOutputs()->getChild("counter")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, InstanceUsesModulesOfPrototype)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(R"(
+            local mymath = {}
+            function mymath.double(x)
+                return x * 2
+            end
+            return mymath
+        )");
+        LuaScript* prototype = m_logicEngine.createLuaScript(R"(
+            modules("mymath")
+            function interface()
+                IN.value = INT
+                OUT.value = INT
+            end
+            function run()
+                OUT.value = mymath.double(IN.value)
+            end
+        )", CreateDeps({ { "mymath", module } }));
+        ASSERT_NE(nullptr, prototype);
+
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+        ASSERT_TRUE(instance->getInputs()->getChild("value")->set<int32_t>(21));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *instance->getOutputs()->getChild("value")->get<int32_t>());
+
+        EXPECT_FALSE(m_logicEngine.destroy(*module));
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, InstanceDoesNotSeeGlobalVariablesOfPrototype)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(R"(
+            function init()
+                if initialized ~= nil then
+                    error("init was executed in the same environment before")
+                end
+                initialized = true
+            end
+            function interface()
+            end
+            function run()
+            end
+        )");
+        ASSERT_NE(nullptr, prototype);
+
+        EXPECT_NE(nullptr, m_logicEngine.createLuaScriptInstance(*prototype));
+        EXPECT_NE(nullptr, m_logicEngine.createLuaScriptInstance(*prototype));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances, FailsToCreateInstanceOfScriptFromOtherLogicEngine)
+    {
+        LogicEngine otherEngine;
+        LuaScript* prototype = otherEngine.createLuaScript(m_scriptSource, {}, "foreignScript");
+        ASSERT_NE(nullptr, prototype);
+
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScriptInstance(*prototype));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to create instance of LuaScript 'foreignScript'! It was created on a different instance of LogicEngine.", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(prototype, m_logicEngine.getErrors()[0].object);
+    }
+
+    class ALogicEngine_ScriptInstances_Serialization : public ALogicEngine_ScriptInstances
+    {
+    protected:
+        WithTempDirectory m_tempFolder;
+    };
+
+    TEST_F(ALogicEngine_ScriptInstances_Serialization, StoresSourceCodeOnlyOnce)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSource);
+        for (int i = 0; i < 5; ++i)
+        {
+            ASSERT_NE(nullptr, m_logicEngine.createLuaScriptInstance(*prototype));
+        }
+        ASSERT_TRUE(m_logicEngine.saveToFile("instances.rlogic"));
+
+        std::ifstream file("instances.rlogic", std::ios::binary);
+        const std::string fileContent{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        const std::string marker = "unique_source_marker";
+        const size_t firstOccurrence = fileContent.find(marker);
+        ASSERT_NE(std::string::npos, firstOccurrence);
+        EXPECT_EQ(std::string::npos, fileContent.find(marker, firstOccurrence + 1));
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances_Serialization, LoadsInstancesWithTheirValuesAndIndependentGlobals)
+    {
+        {
+            LogicEngine logicEngine;
+            LuaScript* prototype = logicEngine.createLuaScript(m_scriptSource, {}, "prototype");
+            LuaScript* instance = logicEngine.createLuaScriptInstance(*prototype, "instance");
+            ASSERT_NE(nullptr, instance);
+            ASSERT_TRUE(instance->getInputs()->getChild("speed")->set<float>(3.f));
+            ASSERT_TRUE(instance->getInputs()->getChild("name")->set<std::string>("instance"));
+            ASSERT_TRUE(logicEngine.saveToFile("instances.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("instances.rlogic"));
+        LuaScript* prototype = m_logicEngine.findByName<LuaScript>("prototype");
+        LuaScript* instance = m_logicEngine.findByName<LuaScript>("instance");
+        ASSERT_NE(nullptr, prototype);
+        ASSERT_NE(nullptr, instance);
+
+        EXPECT_FLOAT_EQ(3.f, *instance->getInputs()->getChild("speed")->get<float>());
+        EXPECT_EQ("instance", *instance->getInputs()->getChild("name")->get<std::string>());
+        EXPECT_EQ(prototype->getInputs()->m_impl->getTypeDescriptor(), instance->getInputs()->m_impl->getTypeDescriptor());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(0.f, *prototype->getOutputs()->getChild("speed")->get<float>());
+        EXPECT_FLOAT_EQ(3.f, *instance->getOutputs()->getChild("speed")->get<float>());
+
+        ASSERT_TRUE(instance->getInputs()->getChild("speed")->set<float>(4.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1, *prototype->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(2, *instance->getOutputs()->getChild("counter")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ScriptInstances_Serialization, LoadsInstancesOfDestroyedPrototype)
+    {
+        {
+            LogicEngine logicEngine;
+            LuaScript* prototype = logicEngine.createLuaScript(m_scriptSource, {}, "prototype");
+            ASSERT_NE(nullptr, logicEngine.createLuaScriptInstance(*prototype, "instance1"));
+            ASSERT_NE(nullptr, logicEngine.createLuaScriptInstance(*prototype, "instance2"));
+            ASSERT_TRUE(logicEngine.destroy(*prototype));
+            ASSERT_TRUE(logicEngine.saveToFile("instances.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("instances.rlogic"));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<LuaScript>("prototype"));
+        LuaScript* instance1 = m_logicEngine.findByName<LuaScript>("instance1");
+        LuaScript* instance2 = m_logicEngine.findByName<LuaScript>("instance2");
+        ASSERT_NE(nullptr, instance1);
+        ASSERT_NE(nullptr, instance2);
+
+        ASSERT_TRUE(instance2->getInputs()->getChild("speed")->set<float>(5.f));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(5.f, *instance2->getOutputs()->getChild("speed")->get<float>());
+        EXPECT_EQ(1, *instance1->getOutputs()->getChild("counter")->get<int32_t>());
+    }
+}
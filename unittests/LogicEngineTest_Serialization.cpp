@@ -19,6 +19,7 @@
 #include "ramses-logic/DataArray.h"
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/Logger.h"
+#include "ramses-logic/SaveFileConfig.h"
 #include "ramses-logic/RamsesLogicVersion.h"
 
 #include "ramses-client-api/EffectDescription.h"
@@ -642,6 +643,70 @@ namespace rlogic::internal
         EXPECT_FLOAT_EQ(3.1415f, *script->getOutputs()->getChild("pi")->get<float>());
     }
 
+    TEST_F(ALogicEngine_Serialization, SavesLuaByteCodeOnlyWhenEnabled)
+    {
+        LogicEngine logicEngineForSaving;
+        logicEngineForSaving.createLuaModule("return {}", {}, "module");
+        logicEngineForSaving.createLuaScript(R"(
+            function interface()
+                OUT.value = INT
+            end
+            function run()
+                OUT.value = 42
+            end
+        )", {}, "script");
+
+        ASSERT_TRUE(logicEngineForSaving.saveToFile("sourceOnly.bin"));
+        SaveFileConfig config;
+        config.setLuaByteCodeEnabled(true);
+        ASSERT_TRUE(logicEngineForSaving.saveToFile("withByteCode.bin", config));
+
+        const std::vector<char> sourceOnlyData = *FileUtils::LoadBinary("sourceOnly.bin");
+        const auto* sourceOnly = rlogic_serialization::GetLogicEngine(sourceOnlyData.data());
+        const std::vector<char> withByteCodeData = *FileUtils::LoadBinary("withByteCode.bin");
+        const auto* withByteCode = rlogic_serialization::GetLogicEngine(withByteCodeData.data());
+        EXPECT_FALSE(sourceOnly->apiObjects()->luaScripts()->Get(0)->luaByteCode());
+        EXPECT_FALSE(sourceOnly->apiObjects()->luaModules()->Get(0)->byteCode());
+        EXPECT_TRUE(withByteCode->apiObjects()->luaScripts()->Get(0)->luaByteCode());
+        EXPECT_TRUE(withByteCode->apiObjects()->luaModules()->Get(0)->byteCode());
+    }
+
+    TEST_F(ALogicEngine_Serialization, LoadsLuaByteCodeOnlyWhenRequestedWithoutMemoryVerification)
+    {
+        {
+            LogicEngine logicEngineForSaving;
+            logicEngineForSaving.createLuaScript(R"(
+                function interface()
+                    OUT.value = INT
+                end
+                function run()
+                    OUT.value = 42
+                end
+            )", {}, "script");
+            SaveFileConfig config;
+            config.setLuaByteCodeEnabled(true);
+            ASSERT_TRUE(logicEngineForSaving.saveToFile("withByteCode.bin", config));
+        }
+
+        std::string warningMessage;
+        ScopedLogContextLevel scopedLogs(ELogMessageType::Warn, [&warningMessage](ELogMessageType /*msgType*/, std::string_view message) {
+            warningMessage = message;
+        });
+
+        // memory verification can't check byte code, it is ignored
+        ASSERT_TRUE(m_logicEngine.loadFromFile("withByteCode.bin", nullptr, true, true));
+        EXPECT_THAT(warningMessage, ::testing::HasSubstr("Lua byte code of file 'withByteCode.bin'"));
+        EXPECT_THAT(warningMessage, ::testing::HasSubstr("is not loaded because memory verification is enabled"));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *m_logicEngine.findByName<LuaScript>("script")->getOutputs()->getChild("value")->get<int32_t>());
+
+        warningMessage.clear();
+        ASSERT_TRUE(m_logicEngine.loadFromFile("withByteCode.bin", nullptr, false, true));
+        EXPECT_TRUE(warningMessage.empty());
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *m_logicEngine.findByName<LuaScript>("script")->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
     class ALogicEngine_Serialization_Compatibility : public ALogicEngine
     {
     protected:
@@ -656,7 +721,7 @@ namespace rlogic::internal
                 rlogic_serialization::CreateVersion(m_fbBuilder,
                     logicVersion.major, logicVersion.minor, logicVersion.patch, m_fbBuilder.CreateString(logicVersion.string),
                     fileFormatVersion),
-                ApiObjects::Serialize(emptyApiObjects, m_fbBuilder)
+                ApiObjects::Serialize(emptyApiObjects, m_fbBuilder, false)
             );
 
             m_fbBuilder.Finish(logicEngine);
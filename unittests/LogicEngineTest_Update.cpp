@@ -23,6 +23,7 @@
 #include "ramses-client-api/UniformInput.h"
 #include "ramses-client-api/Appearance.h"
 #include "ramses-client-api/PerspectiveCamera.h"
+#include "ramses-client-api/OrthographicCamera.h"
 #include "ramses-client-api/Node.h"
 
 #include "impl/LogicNodeImpl.h"
@@ -473,4 +474,500 @@ namespace rlogic
         EXPECT_EQ(sourceScript, executedNodes[0].first);
         EXPECT_EQ(targetScript, executedNodes[1].first);
     }
+
+    TEST_F(ALogicEngine_Update, AppliesOtherBindingValuesWhenRamsesRejectsAValue_AndRetriesRejectedValueInNextUpdate)
+    {
+        RamsesCameraBinding* cameraBinding = m_logicEngine.createRamsesCameraBinding(*m_camera, "camera");
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "node");
+        Property* frustum = cameraBinding->getInputs()->getChild("frustum");
+        // left plane must be smaller than right plane, Ramses rejects the frustum
+        EXPECT_TRUE(frustum->getChild("leftPlane")->set<float>(2.f));
+        EXPECT_TRUE(frustum->getChild("rightPlane")->set<float>(1.f));
+        EXPECT_TRUE(cameraBinding->getInputs()->getChild("viewport")->getChild("width")->set<int32_t>(8));
+        EXPECT_TRUE(nodeBinding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Camera::setFrustum failed - check validity of given frustum planes", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(cameraBinding, m_logicEngine.getErrors()[0].object);
+
+        // values of the same batch are applied regardless of the failed one
+        EXPECT_EQ(8u, m_camera->getViewportWidth());
+        vec3f translation;
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), translation);
+
+        // rejected values are applied again, also without new input values
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Camera::setFrustum failed - check validity of given frustum planes", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_TRUE(frustum->getChild("rightPlane")->set<float>(3.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.f, m_camera->getLeftPlane());
+        EXPECT_FLOAT_EQ(3.f, m_camera->getRightPlane());
+    }
+
+    class ALogicEngine_UpdateSubgraph : public ALogicEngine
+    {
+    protected:
+        LuaScript* createScript(std::string_view name)
+        {
+            return m_logicEngine.createLuaScript(R"(
+                function interface()
+                    IN.inFloat = FLOAT
+                    OUT.outFloat = FLOAT
+                end
+                function run()
+                    OUT.outFloat = IN.inFloat + 1
+                end
+            )", {}, name);
+        }
+
+        bool linkScripts(LuaScript& source, LuaScript& target)
+        {
+            return m_logicEngine.link(*source.getOutputs()->getChild("outFloat"), *target.getInputs()->getChild("inFloat"));
+        }
+
+        static float getOutput(const LuaScript& script)
+        {
+            return *script.getOutputs()->getChild("outFloat")->get<float>();
+        }
+    };
+
+    TEST_F(ALogicEngine_UpdateSubgraph, ExecutesOnlyNodesWhichTargetDependsOn)
+    {
+        /*
+         *  source -> middle -> target
+         *        \
+         *         -> sibling     unrelated
+         */
+        LuaScript* source = createScript("source");
+        LuaScript* middle = createScript("middle");
+        LuaScript* target = createScript("target");
+        LuaScript* sibling = createScript("sibling");
+        LuaScript* unrelated = createScript("unrelated");
+        ASSERT_TRUE(linkScripts(*source, *middle));
+        ASSERT_TRUE(linkScripts(*middle, *target));
+        ASSERT_TRUE(linkScripts(*source, *sibling));
+
+        EXPECT_TRUE(source->getInputs()->getChild("inFloat")->set(10.f));
+        EXPECT_TRUE(m_logicEngine.updateSubgraph(*target));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_FLOAT_EQ(11.f, getOutput(*source));
+        EXPECT_FLOAT_EQ(12.f, getOutput(*middle));
+        EXPECT_FLOAT_EQ(13.f, getOutput(*target));
+        EXPECT_FALSE(source->m_impl.isDirty());
+        EXPECT_FALSE(middle->m_impl.isDirty());
+        EXPECT_FALSE(target->m_impl.isDirty());
+
+        // Nodes outside of the subgraph were not executed, but received the values over links
+        EXPECT_FLOAT_EQ(0.f, getOutput(*sibling));
+        EXPECT_FLOAT_EQ(0.f, getOutput(*unrelated));
+        EXPECT_FLOAT_EQ(11.f, *sibling->getInputs()->getChild("inFloat")->get<float>());
+        EXPECT_TRUE(sibling->m_impl.isDirty());
+        EXPECT_TRUE(unrelated->m_impl.isDirty());
+
+        // Full update executes the remaining dirty nodes
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(12.f, getOutput(*sibling));
+        EXPECT_FLOAT_EQ(1.f, getOutput(*unrelated));
+        EXPECT_FLOAT_EQ(13.f, getOutput(*target));
+        EXPECT_FALSE(sibling->m_impl.isDirty());
+        EXPECT_FALSE(unrelated->m_impl.isDirty());
+    }
+
+    TEST_F(ALogicEngine_UpdateSubgraph, ExecutesNodesWhichBecameDirtyAgainAfterSubgraphUpdate)
+    {
+        LuaScript* source = createScript("source");
+        LuaScript* target = createScript("target");
+        ASSERT_TRUE(linkScripts(*source, *target));
+
+        EXPECT_TRUE(m_logicEngine.updateSubgraph(*target));
+        EXPECT_FLOAT_EQ(2.f, getOutput(*target));
+
+        // Executed nodes are clean, but still queued from before the subgraph update
+        EXPECT_TRUE(source->getInputs()->getChild("inFloat")->set(5.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(6.f, getOutput(*source));
+        EXPECT_FLOAT_EQ(7.f, getOutput(*target));
+
+        EXPECT_TRUE(source->getInputs()->getChild("inFloat")->set(7.f));
+        EXPECT_TRUE(m_logicEngine.updateSubgraph(*target));
+        EXPECT_FLOAT_EQ(9.f, getOutput(*target));
+    }
+
+    TEST_F(ALogicEngine_UpdateSubgraph, ConsidersLinksCreatedAfterPreviousSubgraphUpdate)
+    {
+        LuaScript* source = createScript("source");
+        LuaScript* target = createScript("target");
+
+        EXPECT_TRUE(m_logicEngine.updateSubgraph(*target));
+        EXPECT_FLOAT_EQ(0.f, getOutput(*source));
+        EXPECT_FLOAT_EQ(1.f, getOutput(*target));
+
+        ASSERT_TRUE(linkScripts(*source, *target));
+        EXPECT_TRUE(m_logicEngine.updateSubgraph(*target));
+        EXPECT_FLOAT_EQ(1.f, getOutput(*source));
+        EXPECT_FLOAT_EQ(2.f, getOutput(*target));
+
+        ASSERT_TRUE(m_logicEngine.unlink(*source->getOutputs()->getChild("outFloat"), *target->getInputs()->getChild("inFloat")));
+        EXPECT_TRUE(source->getInputs()->getChild("inFloat")->set(5.f));
+        EXPECT_TRUE(m_logicEngine.updateSubgraph(*target));
+        EXPECT_FLOAT_EQ(1.f, getOutput(*source));
+        EXPECT_TRUE(source->m_impl.isDirty());
+    }
+
+    TEST_F(ALogicEngine_UpdateSubgraph, ProducesErrorIfScriptInSubgraphHasRuntimeError)
+    {
+        LuaScript* failingScript = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.outFloat = FLOAT
+            end
+            function run()
+                error("fail")
+            end
+        )", {}, "FailingScript");
+        LuaScript* target = createScript("target");
+        ASSERT_TRUE(m_logicEngine.link(*failingScript->getOutputs()->getChild("outFloat"), *target->getInputs()->getChild("inFloat")));
+
+        EXPECT_FALSE(m_logicEngine.updateSubgraph(*target));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(failingScript, m_logicEngine.getErrors()[0].object);
+        EXPECT_TRUE(failingScript->m_impl.isDirty());
+        EXPECT_TRUE(target->m_impl.isDirty());
+    }
+
+    TEST_F(ALogicEngine_UpdateSubgraph, ProducesErrorIfTargetIsFromOtherLogicEngine)
+    {
+        LogicEngine otherEngine;
+        LuaScript* foreignScript = otherEngine.createLuaScript(m_valid_empty_script, {}, "ForeignScript");
+
+        EXPECT_FALSE(m_logicEngine.updateSubgraph(*foreignScript));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("LogicNode 'ForeignScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+    }
+
+    class ALogicEngine_UpdateWithTimeBudget : public ALogicEngine
+    {
+    protected:
+        LuaScript* createScript(std::string_view name)
+        {
+            return m_logicEngine.createLuaScript(R"(
+                function interface()
+                    IN.inFloat = FLOAT
+                    OUT.outFloat = FLOAT
+                    OUT.visible = BOOL
+                end
+                function run()
+                    OUT.outFloat = IN.inFloat + 1
+                    OUT.visible = IN.inFloat > 0
+                end
+            )", {}, name);
+        }
+
+        bool linkScripts(LuaScript& source, LuaScript& target)
+        {
+            return m_logicEngine.link(*source.getOutputs()->getChild("outFloat"), *target.getInputs()->getChild("inFloat"));
+        }
+
+        static float getOutput(const LuaScript& script)
+        {
+            return *script.getOutputs()->getChild("outFloat")->get<float>();
+        }
+
+        // Every call executes only a single node (apart from nodes which must be updated atomically)
+        const std::chrono::microseconds m_exceededBudget{ 0 };
+    };
+
+    TEST_F(ALogicEngine_UpdateWithTimeBudget, ContinuesInterruptedUpdateWithRemainingNodes)
+    {
+        LuaScript* first = createScript("first");
+        LuaScript* second = createScript("second");
+        LuaScript* third = createScript("third");
+        ASSERT_TRUE(linkScripts(*first, *second));
+        ASSERT_TRUE(linkScripts(*second, *third));
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdatePending());
+        EXPECT_FLOAT_EQ(1.f, getOutput(*first));
+        EXPECT_FLOAT_EQ(0.f, getOutput(*second));
+        EXPECT_TRUE(second->m_impl.isDirty());
+        EXPECT_TRUE(third->m_impl.isDirty());
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdatePending());
+        EXPECT_FLOAT_EQ(2.f, getOutput(*second));
+        EXPECT_FLOAT_EQ(0.f, getOutput(*third));
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdatePending());
+        EXPECT_FLOAT_EQ(3.f, getOutput(*third));
+        EXPECT_FALSE(third->m_impl.isDirty());
+    }
+
+    TEST_F(ALogicEngine_UpdateWithTimeBudget, ReportsNodesExecutedByEachCall)
+    {
+        LuaScript* first = createScript("first");
+        LuaScript* second = createScript("second");
+        ASSERT_TRUE(linkScripts(*first, *second));
+        m_logicEngine.enableUpdateReport(true);
+        // Nodes are executed one after another while the report is enabled
+        m_logicEngine.setUpdateThreadCount(2u);
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        auto executedNodes = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(1u, executedNodes.size());
+        EXPECT_EQ(first, executedNodes[0].first);
+        EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getTotalLinkActivations());
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdatePending());
+        executedNodes = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(1u, executedNodes.size());
+        EXPECT_EQ(second, executedNodes[0].first);
+        EXPECT_TRUE(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution().empty());
+    }
+
+    TEST_F(ALogicEngine_UpdateWithTimeBudget, FinishesUpdateWhenBudgetIsNotExceeded)
+    {
+        LuaScript* first = createScript("first");
+        LuaScript* second = createScript("second");
+        ASSERT_TRUE(linkScripts(*first, *second));
+
+        EXPECT_TRUE(m_logicEngine.update(std::chrono::hours(1)));
+        EXPECT_FALSE(m_logicEngine.isUpdatePending());
+        EXPECT_FLOAT_EQ(2.f, getOutput(*second));
+    }
+
+    TEST_F(ALogicEngine_UpdateWithTimeBudget, FullUpdateFinishesInterruptedUpdate)
+    {
+        LuaScript* first = createScript("first");
+        LuaScript* second = createScript("second");
+        ASSERT_TRUE(linkScripts(*first, *second));
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdatePending());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(m_logicEngine.isUpdatePending());
+        EXPECT_FLOAT_EQ(2.f, getOutput(*second));
+    }
+
+    TEST_F(ALogicEngine_UpdateWithTimeBudget, ContinuedUpdateRespectsLinksCreatedInBetween)
+    {
+        LuaScript* first = createScript("first");
+        LuaScript* second = createScript("second");
+        LuaScript* third = createScript("third");
+
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdatePending());
+        EXPECT_FLOAT_EQ(1.f, getOutput(*first));
+
+        // third is executed after second now, although it was created before
+        ASSERT_TRUE(linkScripts(*third, *second));
+        while (m_logicEngine.isUpdatePending())
+        {
+            EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        }
+
+        EXPECT_FLOAT_EQ(1.f, getOutput(*third));
+        EXPECT_FLOAT_EQ(2.f, getOutput(*second));
+    }
+
+    TEST_F(ALogicEngine_UpdateWithTimeBudget, IsNotInterruptedBetweenBindingAndItsSources)
+    {
+        /*
+         *  source -> binding
+         *  other
+         */
+        LuaScript* source = createScript("source");
+        LuaScript* other = createScript("other");
+        RamsesNodeBinding* binding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+        ASSERT_TRUE(m_logicEngine.link(*source->getOutputs()->getChild("visible"), *binding->getInputs()->getChild("visibility")));
+        EXPECT_TRUE(source->getInputs()->getChild("inFloat")->set(1.f));
+
+        // source and other have lower level than the binding - once source executed, the update can't stop until the binding executed
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdatePending());
+        EXPECT_FALSE(binding->m_impl.isDirty());
+        EXPECT_FALSE(other->m_impl.isDirty());
+        EXPECT_EQ(ramses::EVisibilityMode::Visible, m_node->getVisibility());
+
+        EXPECT_TRUE(source->getInputs()->getChild("inFloat")->set(-1.f));
+        EXPECT_TRUE(m_logicEngine.update(m_exceededBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdatePending());
+        EXPECT_EQ(ramses::EVisibilityMode::Invisible, m_node->getVisibility());
+    }
+
+    class ALogicEngine_UpdateAsync : public ALogicEngine
+    {
+    protected:
+        void SetUp() override
+        {
+            m_script = m_logicEngine.createLuaScript(R"(
+                function interface()
+                    IN.translation = VEC3F
+                    OUT.translation = VEC3F
+                end
+                function run()
+                    OUT.translation = IN.translation
+                end
+            )", {}, "script");
+            m_binding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+            ASSERT_TRUE(m_logicEngine.link(*m_script->getOutputs()->getChild("translation"), *m_binding->getInputs()->getChild("translation")));
+        }
+
+        [[nodiscard]] vec3f getNodeTranslation() const
+        {
+            vec3f translation;
+            m_node->getTranslation(translation[0], translation[1], translation[2]);
+            return translation;
+        }
+
+        LuaScript* m_script = nullptr;
+        RamsesNodeBinding* m_binding = nullptr;
+    };
+
+    TEST_F(ALogicEngine_UpdateAsync, AppliesBindingValuesToRamsesOnlyOnCommit)
+    {
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+
+        std::shared_future<bool> result = m_logicEngine.updateAsync();
+        EXPECT_TRUE(result.get());
+        EXPECT_EQ((vec3f{ 0.f, 0.f, 0.f }), getNodeTranslation());
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), *m_binding->getInputs()->getChild("translation")->get<vec3f>());
+
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), getNodeTranslation());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, WaitsForAsyncUpdateWhenEngineIsAccessed)
+    {
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+
+        std::shared_future<bool> result = m_logicEngine.updateAsync();
+        // Must not interfere with the running update
+        LuaScript* otherScript = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "other");
+        EXPECT_NE(nullptr, otherScript);
+        EXPECT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        EXPECT_TRUE(result.get());
+
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), getNodeTranslation());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, WaitsForAsyncUpdateWhenPropertyIsAccessed)
+    {
+        LuaScript* slowScript = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.value = INT32
+                OUT.value = INT32
+            end
+            function run()
+                local sum = 0
+                for i = 1, 1000000 do
+                    sum = sum + i
+                end
+                OUT.value = IN.value
+            end
+        )", {}, "slowScript");
+        ASSERT_NE(nullptr, slowScript);
+        EXPECT_TRUE(slowScript->getInputs()->getChild("value")->set<int32_t>(5));
+
+        std::shared_future<bool> result = m_logicEngine.updateAsync();
+        // Properties have the values of the finished update
+        EXPECT_EQ(5, *slowScript->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+
+        result = m_logicEngine.updateAsync();
+        // Not overwritten by the running update
+        EXPECT_TRUE(slowScript->getInputs()->getChild("value")->set<int32_t>(6));
+        EXPECT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        EXPECT_TRUE(result.get());
+        EXPECT_EQ(5, *slowScript->getOutputs()->getChild("value")->get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(6, *slowScript->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_TRUE(m_logicEngine.commit());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, RecordsSynchronousUpdatesBeforeCommit)
+    {
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 4.f, 5.f, 6.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ((vec3f{ 0.f, 0.f, 0.f }), getNodeTranslation());
+
+        // Commands are applied in recording order, the last update wins
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_EQ((vec3f{ 4.f, 5.f, 6.f }), getNodeTranslation());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, AppliesBindingValuesRightAwayInSynchronousUpdateAfterCommit)
+    {
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_TRUE(m_logicEngine.commit());
+
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), getNodeTranslation());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, DiscardsRecordedValuesOfDestroyedBinding)
+    {
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+
+        EXPECT_TRUE(m_logicEngine.destroy(*m_binding));
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_EQ((vec3f{ 0.f, 0.f, 0.f }), getNodeTranslation());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, CommitsOtherBindingValuesWhenRamsesRejectsAValue_AndRetriesRejectedValueInNextUpdate)
+    {
+        RamsesCameraBinding* cameraBinding = m_logicEngine.createRamsesCameraBinding(*m_camera, "camera");
+        Property* frustum = cameraBinding->getInputs()->getChild("frustum");
+        // left plane must be smaller than right plane, Ramses rejects the frustum
+        EXPECT_TRUE(frustum->getChild("leftPlane")->set<float>(2.f));
+        EXPECT_TRUE(frustum->getChild("rightPlane")->set<float>(1.f));
+        EXPECT_TRUE(m_script->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_FALSE(m_logicEngine.commit());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Camera::setFrustum failed - check validity of given frustum planes", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(cameraBinding, m_logicEngine.getErrors()[0].object);
+        EXPECT_EQ((vec3f{ 1.f, 2.f, 3.f }), getNodeTranslation());
+
+        // rejected values are recorded again by the next update, also without new input values
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_FALSE(m_logicEngine.commit());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+
+        EXPECT_TRUE(frustum->getChild("rightPlane")->set<float>(3.f));
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_FLOAT_EQ(2.f, m_camera->getLeftPlane());
+        EXPECT_FLOAT_EQ(3.f, m_camera->getRightPlane());
+    }
+
+    TEST_F(ALogicEngine_UpdateAsync, ReportsScriptErrorsThroughFuture)
+    {
+        LuaScript* failingScript = m_logicEngine.createLuaScript(R"(
+            function interface()
+            end
+            function run()
+                error("fail")
+            end
+        )", {}, "failing");
+        ASSERT_NE(nullptr, failingScript);
+
+        EXPECT_FALSE(m_logicEngine.updateAsync().get());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(failingScript, m_logicEngine.getErrors()[0].object);
+    }
 }
@@ -9,6 +9,9 @@
 #include <gmock/gmock.h>
 #include "LogicEngineTest_Base.h"
 #include "ramses-logic/Property.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/RamsesNodeBinding.h"
+#include "ramses-client-api/Node.h"
 #include <numeric>
 
 namespace rlogic
@@ -63,6 +66,8 @@ namespace rlogic
         EXPECT_EQ(report.getTopologySortExecutionTime().count(), 0);
         EXPECT_EQ(report.getTotalUpdateExecutionTime().count(), 0);
         EXPECT_EQ(report.getTotalLinkActivations(), 0);
+        EXPECT_EQ(report.getLuaAllocations(), 0u);
+        EXPECT_EQ(report.getLuaAllocatedBytesDelta(), 0);
     }
 
     TEST_F(ALogicEngine_UpdateReport, UpdateReportContainsUpdatedAndNotUpdatedNodes)
@@ -243,6 +248,84 @@ namespace rlogic
         }
     }
 
+    TEST_F(ALogicEngine_UpdateReport, HasAppliedRamsesCommands)
+    {
+        RamsesNodeBinding* binding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+        m_logicEngine.enableUpdateReport(true);
+
+        EXPECT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(binding->getInputs()->getChild("scaling")->set<vec3f>({ 2.f, 2.f, 2.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        {
+            const auto report = m_logicEngine.getLastUpdateReport();
+            EXPECT_EQ(2u, report.getAppliedRamsesCommands());
+            EXPECT_EQ(0u, report.getElidedRamsesCommands());
+        }
+
+        EXPECT_TRUE(m_logicEngine.update());
+        {
+            const auto report = m_logicEngine.getLastUpdateReport();
+            EXPECT_EQ(0u, report.getAppliedRamsesCommands());
+            EXPECT_EQ(0u, report.getElidedRamsesCommands());
+        }
+    }
+
+    TEST_F(ALogicEngine_UpdateReport, HasElidedRamsesCommandsWhenPropertyIsWrittenAgainBeforeCommit)
+    {
+        RamsesNodeBinding* binding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+        m_logicEngine.enableUpdateReport(true);
+
+        EXPECT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_TRUE(binding->getInputs()->getChild("translation")->set<vec3f>({ 4.f, 5.f, 6.f }));
+        EXPECT_TRUE(binding->getInputs()->getChild("visibility")->set(false));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.commit());
+
+        // The first translation is overwritten by the second one and never reaches Ramses
+        const auto report = m_logicEngine.getLastUpdateReport();
+        EXPECT_EQ(2u, report.getAppliedRamsesCommands());
+        EXPECT_EQ(1u, report.getElidedRamsesCommands());
+
+        vec3f translation;
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((vec3f{ 4.f, 5.f, 6.f }), translation);
+        EXPECT_EQ(ramses::EVisibilityMode::Invisible, m_node->getVisibility());
+    }
+
+    TEST_F(ALogicEngine_UpdateReport, HasLuaAllocationsOfExecutedScripts)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.size = INT32
+            end
+            function run()
+                GLOBAL.data = {}
+                for i = 1, IN.size do
+                    GLOBAL.data[i] = i
+                end
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+        m_logicEngine.enableUpdateReport(true);
+
+        EXPECT_TRUE(script->getInputs()->getChild("size")->set<int32_t>(1000));
+        EXPECT_TRUE(m_logicEngine.update());
+        {
+            const auto report = m_logicEngine.getLastUpdateReport();
+            EXPECT_GT(report.getLuaAllocations(), 0u);
+            EXPECT_GT(report.getLuaAllocatedBytesDelta(), static_cast<int64_t>(1000u * sizeof(double)));
+        }
+
+        // script is not executed again
+        EXPECT_TRUE(m_logicEngine.update());
+        {
+            const auto report = m_logicEngine.getLastUpdateReport();
+            EXPECT_EQ(0u, report.getLuaAllocations());
+            EXPECT_EQ(0, report.getLuaAllocatedBytesDelta());
+        }
+    }
+
     TEST_F(ALogicEngine_UpdateReport, UpdateReportCanBeRetrievedNextSuccessUpdateAfterFailedUpdate)
     {
         constexpr auto scriptSource = R"(
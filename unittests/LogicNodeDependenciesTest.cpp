@@ -214,6 +214,178 @@ namespace rlogic::internal
         expectNoLinks(outputA);
     }
 
+    TEST_F(ALogicNodeDependencies, CompilesLinkProgramOfSourceNode_InOrderOfOutputs)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+
+        PropertyImpl& output1A = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& output2A = *m_nodeA.getOutputs()->getChild("output2")->m_impl;
+        PropertyImpl& input1B = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+        PropertyImpl& input2B = *m_nodeB.getInputs()->getChild("input2")->m_impl;
+
+        EXPECT_TRUE(m_nodeA.getLinkProgram().empty());
+
+        // link in reverse order to make sure the program is sorted by outputs, not by link creation
+        EXPECT_TRUE(m_dependencies.link(output2A, input1B, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output1A, input2B, m_errorReporting));
+
+        const LinkProgram& program = m_nodeA.getLinkProgram();
+        ASSERT_EQ(2u, program.size());
+        EXPECT_EQ(&output1A, program[0].source);
+        EXPECT_EQ(&input2B, program[0].target);
+        EXPECT_EQ(&output2A, program[1].source);
+        EXPECT_EQ(&input1B, program[1].target);
+
+        EXPECT_TRUE(m_nodeB.getLinkProgram().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, RecompilesLinkProgram_WhenUnlinking)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+
+        PropertyImpl& output = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& input = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+
+        EXPECT_TRUE(m_dependencies.link(output, input, m_errorReporting));
+        EXPECT_EQ(1u, m_nodeA.getLinkProgram().size());
+
+        EXPECT_TRUE(m_dependencies.unlink(output, input, m_errorReporting));
+        EXPECT_TRUE(m_nodeA.getLinkProgram().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, RecompilesLinkProgram_WhenTargetNodeIsRemoved)
+    {
+        auto nodeToDelete = std::make_unique<LogicNodeDummyImpl>("node");
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(*nodeToDelete);
+
+        PropertyImpl& output = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        EXPECT_TRUE(m_dependencies.link(output, *nodeToDelete->getInputs()->getChild("input1")->m_impl, m_errorReporting));
+        EXPECT_EQ(1u, m_nodeA.getLinkProgram().size());
+
+        m_dependencies.removeNode(*nodeToDelete);
+        nodeToDelete = nullptr;
+
+        EXPECT_TRUE(m_nodeA.getLinkProgram().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, QueuesDirtyNodes_OrderedByTopologicalRank)
+    {
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(m_nodeA);
+
+        PropertyImpl& output = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& input = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+        EXPECT_TRUE(m_dependencies.link(output, input, m_errorReporting));
+
+        // Ranks are updated when linking
+        EXPECT_LT(m_nodeA.getTopologicalRank(), m_nodeB.getTopologicalRank());
+        expectSortedNodeOrder({ &m_nodeA, &m_nodeB });
+
+        DirtyNodeQueue& dirtyNodes = m_dependencies.getDirtyNodes();
+        ASSERT_EQ(2u, dirtyNodes.size());
+        EXPECT_EQ(&m_nodeA, &dirtyNodes.top());
+        dirtyNodes.pop();
+        EXPECT_EQ(&m_nodeB, &dirtyNodes.top());
+        dirtyNodes.pop();
+        EXPECT_TRUE(dirtyNodes.empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, UpdatesTopologicalLevels_WhenLinksAreAddedAndRemoved)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        EXPECT_EQ(0u, m_nodeA.getTopologicalLevel());
+        EXPECT_EQ(0u, m_nodeB.getTopologicalLevel());
+
+        PropertyImpl& output = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& input = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+        EXPECT_TRUE(m_dependencies.link(output, input, m_errorReporting));
+        EXPECT_EQ(0u, m_nodeA.getTopologicalLevel());
+        EXPECT_EQ(1u, m_nodeB.getTopologicalLevel());
+
+        EXPECT_TRUE(m_dependencies.unlink(output, input, m_errorReporting));
+        EXPECT_EQ(0u, m_nodeA.getTopologicalLevel());
+        EXPECT_EQ(0u, m_nodeB.getTopologicalLevel());
+    }
+
+    TEST_F(ALogicNodeDependencies, RefusesLinkWhichWouldCreateALoop)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+
+        PropertyImpl& outputA = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& inputA = *m_nodeA.getInputs()->getChild("input1")->m_impl;
+        PropertyImpl& outputB = *m_nodeB.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& inputB = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+        EXPECT_TRUE(m_dependencies.link(outputA, inputB, m_errorReporting));
+        EXPECT_FALSE(m_dependencies.link(outputB, inputA, m_errorReporting));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_EQ("Failed to link output property 'output1' of LogicNode 'B' to input property 'input1' of LogicNode 'A', the link would create a loop: 'A.output1' -> 'B.input1', 'B.output1' -> 'A.input1'",
+            m_errorReporting.getErrors()[0].message);
+
+        expectNoLinks(inputA);
+        EXPECT_TRUE(m_dependencies.updateTopologicalOrder());
+        expectSortedNodeOrder({ &m_nodeA, &m_nodeB });
+        EXPECT_EQ(0u, m_nodeA.getTopologicalLevel());
+        EXPECT_EQ(1u, m_nodeB.getTopologicalLevel());
+    }
+
+    TEST_F(ALogicNodeDependencies, QueuesNodeOnlyWhenItBecomesDirty)
+    {
+        m_dependencies.addNode(m_nodeA);
+
+        DirtyNodeQueue& dirtyNodes = m_dependencies.getDirtyNodes();
+        ASSERT_EQ(1u, dirtyNodes.size());
+        dirtyNodes.pop();
+        m_nodeA.setDirty(false);
+
+        m_nodeA.setDirty(true);
+        EXPECT_EQ(1u, dirtyNodes.size());
+
+        // Already dirty - not queued again
+        m_nodeA.setDirty(true);
+        EXPECT_EQ(1u, dirtyNodes.size());
+    }
+
+    TEST_F(ALogicNodeDependencies, QueuesNodeOnlyOnce_WhenItBecomesDirtyAgainWhileQueued)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+
+        DirtyNodeQueue& dirtyNodes = m_dependencies.getDirtyNodes();
+        ASSERT_EQ(2u, dirtyNodes.size());
+
+        // Node stays queued (as a stale entry) when it is cleaned without popping it
+        m_nodeB.setDirty(false);
+        m_nodeB.setDirty(true);
+        EXPECT_EQ(2u, dirtyNodes.size());
+
+        EXPECT_EQ(&m_nodeA, &dirtyNodes.top());
+        dirtyNodes.pop();
+        EXPECT_EQ(&m_nodeB, &dirtyNodes.top());
+        dirtyNodes.pop();
+        EXPECT_TRUE(dirtyNodes.empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, RemovesQueuedDirtyNode_WhenNodeIsRemoved)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        EXPECT_EQ(2u, m_dependencies.getDirtyNodes().size());
+
+        m_dependencies.removeNode(m_nodeA);
+        ASSERT_EQ(1u, m_dependencies.getDirtyNodes().size());
+        EXPECT_EQ(&m_nodeB, &m_dependencies.getDirtyNodes().top());
+
+        // Removed node is not queued anymore
+        m_nodeA.setDirty(false);
+        m_nodeA.setDirty(true);
+        EXPECT_EQ(1u, m_dependencies.getDirtyNodes().size());
+    }
+
     class ALogicNodeDependencies_NestedLinks : public ALogicNodeDependencies
     {
     protected:
@@ -0,0 +1,191 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/LuaAllocator.h"
+
+#include <cstring>
+#include <string>
+
+namespace rlogic::internal
+{
+    class ALuaAllocator : public ::testing::Test
+    {
+    protected:
+        void* allocate(void* ptr, size_t oldSize, size_t newSize)
+        {
+            return LuaAllocator::Allocate(&m_allocator, ptr, oldSize, newSize);
+        }
+
+        LuaAllocator m_allocator;
+    };
+
+    TEST_F(ALuaAllocator, TakesSmallBlocksFromPools)
+    {
+        void* first = allocate(nullptr, 0u, 24u);
+        void* second = allocate(nullptr, 0u, 24u);
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(first) % alignof(double));
+        EXPECT_EQ(8192u, m_allocator.getPoolsSize());
+
+        // freed blocks are reused
+        EXPECT_EQ(nullptr, allocate(second, 24u, 0u));
+        EXPECT_EQ(second, allocate(nullptr, 0u, 20u));
+        EXPECT_EQ(8192u, m_allocator.getPoolsSize());
+
+        // large blocks don't use the pools
+        void* large = allocate(nullptr, 0u, 1000u);
+        ASSERT_NE(nullptr, large);
+        EXPECT_EQ(8192u, m_allocator.getPoolsSize());
+
+        allocate(first, 24u, 0u);
+        allocate(second, 20u, 0u);
+        allocate(large, 1000u, 0u);
+        EXPECT_EQ(0u, m_allocator.getTotalStatistics().allocatedBytes);
+    }
+
+    TEST_F(ALuaAllocator, KeepsContentWhenResizingAcrossSizeClasses)
+    {
+        auto* data = static_cast<char*>(allocate(nullptr, 0u, 8u));
+        std::memcpy(data, "abcdefg", 8u);
+
+        // same size class keeps the block
+        EXPECT_EQ(data, allocate(data, 8u, 5u));
+        data = static_cast<char*>(allocate(data, 5u, 100u));
+        EXPECT_EQ("abcd", std::string(data, 4u));
+        data = static_cast<char*>(allocate(data, 100u, 4000u));
+        EXPECT_EQ("abcd", std::string(data, 4u));
+        data = static_cast<char*>(allocate(data, 4000u, 8000u));
+        EXPECT_EQ("abcd", std::string(data, 4u));
+        data = static_cast<char*>(allocate(data, 8000u, 4u));
+        EXPECT_EQ("abcd", std::string(data, 4u));
+
+        EXPECT_EQ(4u, m_allocator.getTotalStatistics().allocatedBytes);
+        EXPECT_EQ(8000u, m_allocator.getTotalStatistics().peakAllocatedBytes);
+        EXPECT_EQ(6u, m_allocator.getTotalStatistics().allocationCount);
+        allocate(data, 4u, 0u);
+    }
+
+    TEST_F(ALuaAllocator, AttributesAllocationsToCurrentAccount)
+    {
+        LuaMemoryAccount script(m_allocator, 0u);
+        void* stateData = allocate(nullptr, 0u, 10u);
+        void* scriptData = nullptr;
+        {
+            LuaMemoryScope scope(script);
+            scriptData = allocate(nullptr, 0u, 30u);
+            scriptData = allocate(scriptData, 30u, 50u);
+        }
+        EXPECT_EQ(LuaAllocator::StateAccount, m_allocator.getCurrentAccount());
+
+        EXPECT_EQ(50u, script.getStatistics().allocatedBytes);
+        EXPECT_EQ(50u, script.getStatistics().peakAllocatedBytes);
+        EXPECT_EQ(2u, script.getStatistics().allocationCount);
+        EXPECT_EQ(10u, m_allocator.getStatistics(LuaAllocator::StateAccount).allocatedBytes);
+        EXPECT_EQ(60u, m_allocator.getTotalStatistics().allocatedBytes);
+
+        // frees are attributed to the owner of the block, regardless of the current account
+        allocate(scriptData, 50u, 0u);
+        EXPECT_EQ(0u, script.getStatistics().allocatedBytes);
+        EXPECT_EQ(50u, script.getStatistics().peakAllocatedBytes);
+
+        // resizing moves the block to the current account
+        {
+            LuaMemoryScope scope(script);
+            stateData = allocate(stateData, 10u, 20u);
+        }
+        EXPECT_EQ(20u, script.getStatistics().allocatedBytes);
+        EXPECT_EQ(0u, m_allocator.getStatistics(LuaAllocator::StateAccount).allocatedBytes);
+        allocate(stateData, 20u, 0u);
+    }
+
+    TEST_F(ALuaAllocator, FailsAllocationsWhichExceedTheLimit)
+    {
+        LuaMemoryAccount script(m_allocator, 100u);
+        EXPECT_EQ(100u, script.getMemoryLimit());
+        LuaMemoryScope scope(script);
+
+        void* data = allocate(nullptr, 0u, 60u);
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(nullptr, allocate(nullptr, 0u, 50u));
+        EXPECT_TRUE(script.hasExceededMemoryLimit());
+        script.resetExceededMemoryLimit();
+        EXPECT_FALSE(script.hasExceededMemoryLimit());
+
+        // own block counts only once when resizing
+        data = allocate(data, 60u, 100u);
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(nullptr, allocate(data, 100u, 101u));
+        EXPECT_TRUE(script.hasExceededMemoryLimit());
+
+        // shrinking never fails
+        data = allocate(data, 100u, 10u);
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(10u, script.getStatistics().allocatedBytes);
+        allocate(data, 10u, 0u);
+    }
+
+    TEST_F(ALuaAllocator, ReusesReleasedAccountsOnceTheirMemoryIsFreed)
+    {
+        void* data = nullptr;
+        LuaMemoryAccountId releasedId = 0u;
+        {
+            LuaMemoryAccount script(m_allocator, 50u);
+            LuaMemoryScope scope(script);
+            data = allocate(nullptr, 0u, 40u);
+            releasedId = m_allocator.getCurrentAccount();
+        }
+        EXPECT_EQ(40u, m_allocator.getStatistics(releasedId).allocatedBytes);
+        EXPECT_EQ(0u, m_allocator.getMemoryLimit(releasedId));
+
+        const LuaMemoryAccountId otherId = m_allocator.createAccount(0u);
+        EXPECT_NE(releasedId, otherId);
+
+        allocate(data, 40u, 0u);
+        const LuaMemoryAccountId reusedId = m_allocator.createAccount(10u);
+        EXPECT_EQ(releasedId, reusedId);
+        EXPECT_EQ(0u, m_allocator.getStatistics(reusedId).allocationCount);
+        EXPECT_EQ(0u, m_allocator.getStatistics(reusedId).peakAllocatedBytes);
+        EXPECT_EQ(10u, m_allocator.getMemoryLimit(reusedId));
+
+        m_allocator.releaseAccount(otherId);
+        m_allocator.releaseAccount(reusedId);
+    }
+
+    TEST_F(ALuaAllocator, RestoresPreviousAccountAfterNestedScopes)
+    {
+        LuaMemoryAccount module(m_allocator, 0u);
+        LuaMemoryAccount script(m_allocator, 0u);
+        LuaMemoryAccount movedScript(std::move(script));
+
+        LuaMemoryScope moduleScope(module);
+        const LuaMemoryAccountId moduleId = m_allocator.getCurrentAccount();
+        {
+            LuaMemoryScope scriptScope(movedScript);
+            EXPECT_NE(moduleId, m_allocator.getCurrentAccount());
+        }
+        EXPECT_EQ(moduleId, m_allocator.getCurrentAccount());
+    }
+
+    TEST(LuaMemoryStatistics, AddsStatistics)
+    {
+        LuaMemoryStatistics sum{ 1u, 2u, 3u };
+        AddLuaMemoryStatistics(sum, { 10u, 20u, 30u });
+        EXPECT_EQ(11u, sum.allocatedBytes);
+        EXPECT_EQ(20u, sum.peakAllocatedBytes);
+        EXPECT_EQ(33u, sum.allocationCount);
+
+        // peaks of different states are reached at different times, only the largest one is known to have happened
+        AddLuaMemoryStatistics(sum, { 1u, 5u, 1u });
+        EXPECT_EQ(12u, sum.allocatedBytes);
+        EXPECT_EQ(20u, sum.peakAllocatedBytes);
+        EXPECT_EQ(34u, sum.allocationCount);
+    }
+}
@@ -44,6 +44,8 @@ namespace rlogic::internal
     {
         LuaConfig config;
         EXPECT_TRUE(config.m_impl->getModuleMapping().empty());
+        EXPECT_EQ(0u, config.m_impl->getExecutionGroup());
+        EXPECT_EQ(0u, config.m_impl->getMemoryLimit());
     }
 
     TEST_F(ALuaConfig, IsCopied)
@@ -52,10 +54,14 @@ namespace rlogic::internal
         config.addDependency("mod1", *m_module);
         config.addDependency("mod2", *m_module);
         config.addStandardModuleDependency(EStandardModule::Debug);
+        config.setExecutionGroup(3u);
+        config.setMemoryLimit(4096u);
 
         LuaConfig configCopy(config);
         EXPECT_EQ(config.m_impl->getModuleMapping(), configCopy.m_impl->getModuleMapping());
         EXPECT_EQ(config.m_impl->getStandardModules(), configCopy.m_impl->getStandardModules());
+        EXPECT_EQ(3u, configCopy.m_impl->getExecutionGroup());
+        EXPECT_EQ(4096u, configCopy.m_impl->getMemoryLimit());
     }
 
     TEST_F(ALuaConfig, IsCopyAssigned)
@@ -139,6 +145,8 @@ namespace rlogic::internal
         EXPECT_EQ("Failed to add dependency 'debug'! The alias collides with a standard library name!", m_errorMessage);
         EXPECT_FALSE(config.addDependency("table", *m_module));
         EXPECT_EQ("Failed to add dependency 'table'! The alias collides with a standard library name!", m_errorMessage);
+        EXPECT_FALSE(config.addDependency("arraymath", *m_module));
+        EXPECT_EQ("Failed to add dependency 'arraymath'! The alias collides with a standard library name!", m_errorMessage);
     }
 
     class ALuaConfig_StdModules : public ::testing::Test
@@ -178,6 +186,7 @@ namespace rlogic::internal
             EStandardModule::String,
             EStandardModule::Table,
             EStandardModule::Math,
-            EStandardModule::Debug));
+            EStandardModule::Debug,
+            EStandardModule::ArrayMath));
     }
 }
@@ -384,7 +384,7 @@ namespace rlogic::internal
 
         // Apply environment, same as for real modules
         sol::protected_function mainFunction = loadResult;
-        sol::environment env = solState.createEnvironment({EStandardModule::Base}, {});
+        sol::environment env = *solState.createEnvironment({EStandardModule::Base}, {}, errors);
         env.set_on(mainFunction);
         env["mod"] = mod->moduleTable;
 
@@ -515,7 +515,7 @@ namespace rlogic::internal
 
         // Apply environment, same as for real modules
         sol::protected_function mainFunction = loadResult;
-        sol::environment env = solState.createEnvironment({ EStandardModule::Base }, {});
+        sol::environment env = *solState.createEnvironment({ EStandardModule::Base }, {}, errors);
         env.set_on(mainFunction);
         env["mod"] = mod->moduleTable;
 
@@ -613,7 +613,7 @@ namespace rlogic::internal
 
         // Apply environment, same as for real modules
         sol::protected_function mainFunction = loadResult;
-        sol::environment env = solState.createEnvironment({ EStandardModule::Base }, {});
+        sol::environment env = *solState.createEnvironment({ EStandardModule::Base }, {}, errors);
         env.set_on(mainFunction);
         env["mod"] = mod->moduleTable;
 
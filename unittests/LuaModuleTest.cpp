@@ -18,6 +18,7 @@
 #include "internals/ErrorReporting.h"
 #include "internals/SolState.h"
 #include "internals/DeserializationMap.h"
+#include "internals/SerializationMap.h"
 
 #include "generated/LuaModuleGen.h"
 
@@ -137,7 +138,7 @@ namespace rlogic::internal
         }
 
         const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -156,7 +157,7 @@ namespace rlogic::internal
         }
 
         const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -176,7 +177,7 @@ namespace rlogic::internal
         }
 
         const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -197,13 +198,103 @@ namespace rlogic::internal
         }
 
         const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
         EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of LuaModule from serialized data: missing dependencies!");
     }
 
+    TEST_F(ALuaModule_SerializationLifecycle, SerializesByteCodeOfSource)
+    {
+        const auto module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        ASSERT_NE(nullptr, module);
+
+        SerializationMap serializationMap;
+        m_flatBufferBuilder.Finish(LuaModuleImpl::Serialize(module->m_impl, m_flatBufferBuilder, serializationMap, true));
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
+        ASSERT_TRUE(serialized.byteCode());
+        EXPECT_TRUE(m_solState.isCompatibleByteCode(std::string_view(reinterpret_cast<const char*>(serialized.byteCode()->data()), serialized.byteCode()->size())));
+    }
+
+    TEST_F(ALuaModule_SerializationLifecycle, DoesNotSerializeByteCodeUnlessRequested)
+    {
+        const auto module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        ASSERT_NE(nullptr, module);
+
+        SerializationMap serializationMap;
+        m_flatBufferBuilder.Finish(LuaModuleImpl::Serialize(module->m_impl, m_flatBufferBuilder, serializationMap, false));
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
+        EXPECT_FALSE(serialized.byteCode());
+        EXPECT_EQ(m_moduleSourceCode, serialized.source()->string_view());
+    }
+
+    TEST_F(ALuaModule_SerializationLifecycle, LoadsByteCodeInsteadOfCompilingSource)
+    {
+        {
+            const sol::protected_function mainFunction = m_solState.loadScript(m_moduleSourceCode, "name");
+            const sol::bytecode byteCode = SolState::DumpByteCode(mainFunction);
+            const auto* byteCodeData = reinterpret_cast<const uint8_t*>(byteCode.data());
+
+            auto module = rlogic_serialization::CreateLuaModule(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("name"),
+                1u,
+                m_flatBufferBuilder.CreateString("this.is.bad.code"),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<uint8_t>{}),
+                m_flatBufferBuilder.CreateVector(byteCodeData, byteCode.size())
+            );
+            m_flatBufferBuilder.Finish(module);
+        }
+
+        const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, true, m_errorReporting, m_deserializationMap);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+        EXPECT_EQ("this.is.bad.code", deserialized->getSourceCode());
+    }
+
+    TEST_F(ALuaModule_SerializationLifecycle, ReportsErrorWhenModuleFailsToLoadIntoLuaStateOfOtherExecutionGroup)
+    {
+        {
+            const sol::protected_function mainFunction = m_solState.loadScript(m_moduleSourceCode, "name");
+            const sol::bytecode byteCode = SolState::DumpByteCode(mainFunction);
+            const auto* byteCodeData = reinterpret_cast<const uint8_t*>(byteCode.data());
+
+            // Other Lua states compile the source, which doesn't match the byte code
+            auto module = rlogic_serialization::CreateLuaModule(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("name"),
+                1u,
+                m_flatBufferBuilder.CreateString("return 42"),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<uint8_t>{}),
+                m_flatBufferBuilder.CreateVector(byteCodeData, byteCode.size())
+            );
+            m_flatBufferBuilder.Finish(module);
+        }
+
+        const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaModule>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaModuleImpl> deserialized = LuaModuleImpl::Deserialize(m_solState, serialized, true, m_errorReporting, m_deserializationMap);
+        ASSERT_TRUE(deserialized);
+
+        SolState otherSolState;
+        EXPECT_EQ(nullptr, deserialized->getModule(otherSolState, m_errorReporting));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("Failed to load LuaModule 'name' into the Lua state of another execution group"));
+        EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("Module script must return a table!"));
+
+        // Failures are not cached
+        EXPECT_EQ(nullptr, deserialized->getModule(otherSolState, m_errorReporting));
+        EXPECT_EQ(2u, m_errorReporting.getErrors().size());
+
+        EXPECT_NE(nullptr, deserialized->getModule(m_solState, m_errorReporting));
+    }
+
     class ALuaModuleWithDependency : public ALuaModule
     {
     protected:
@@ -0,0 +1,267 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LuaScriptTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "fmt/format.h"
+
+namespace rlogic
+{
+    class ALuaScript_ArrayMath : public ALuaScript
+    {
+    protected:
+        LuaScript* createScript(std::string_view interfaceFunction, std::string_view runFunction)
+        {
+            const std::string scriptSrc = fmt::format(R"(
+                function interface()
+                    {}
+                end
+                function run()
+                    {}
+                end
+            )", interfaceFunction, runFunction);
+
+            return m_logicEngine.createLuaScript(scriptSrc, WithStdModules({EStandardModule::ArrayMath}));
+        }
+
+        void expectRuntimeError(std::string_view runFunction, std::string_view expectedErrorMessage)
+        {
+            ASSERT_NE(nullptr, createScript(R"(
+                    IN.floats = ARRAY(3, FLOAT)
+                    IN.ints = ARRAY(3, INT)
+                    IN.vec2s = ARRAY(3, VEC2F)
+                    OUT.floats = ARRAY(3, FLOAT)
+                    OUT.moreFloats = ARRAY(4, FLOAT)
+                    OUT.ints = ARRAY(3, INT)
+                    OUT.vec2s = ARRAY(3, VEC2F)
+                    OUT.float = FLOAT)",
+                runFunction));
+
+            EXPECT_FALSE(m_logicEngine.update());
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr(expectedErrorMessage));
+        }
+
+        static void SetVec3Array(Property& array, const std::vector<vec3f>& values)
+        {
+            ASSERT_TRUE(array.setArray(values.data(), values.size()));
+        }
+    };
+
+    TEST_F(ALuaScript_ArrayMath, IsOnlyAvailableWhenRequested)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.floats = ARRAY(2, FLOAT)
+            end
+            function run()
+                arraymath.scale(OUT.floats, OUT.floats, 2)
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("attempt to index global 'arraymath' (a nil value)"));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, CopiesArraysOfPrimitiveTypes)
+    {
+        auto* script = createScript(R"(
+                IN.ints = ARRAY(2, INT)
+                IN.strings = ARRAY(2, STRING)
+                IN.vec3s = ARRAY(2, VEC3F)
+                OUT.ints = ARRAY(2, INT)
+                OUT.strings = ARRAY(2, STRING)
+                OUT.vec3s = ARRAY(2, VEC3F))", R"(
+                arraymath.copy(OUT.ints, IN.ints)
+                arraymath.copy(OUT.strings, IN.strings)
+                arraymath.copy(OUT.vec3s, IN.vec3s))");
+        ASSERT_NE(nullptr, script);
+
+        Property* inputs = script->getInputs();
+        inputs->getChild("ints")->getChild(0)->set<int32_t>(1);
+        inputs->getChild("ints")->getChild(1)->set<int32_t>(2);
+        inputs->getChild("strings")->getChild(1)->set<std::string>("two");
+        SetVec3Array(*inputs->getChild("vec3s"), {{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}});
+
+        ASSERT_TRUE(m_logicEngine.update());
+        const Property* outputs = script->getOutputs();
+        EXPECT_EQ(1, *outputs->getChild("ints")->getChild(0)->get<int32_t>());
+        EXPECT_EQ(2, *outputs->getChild("ints")->getChild(1)->get<int32_t>());
+        EXPECT_EQ("", *outputs->getChild("strings")->getChild(0)->get<std::string>());
+        EXPECT_EQ("two", *outputs->getChild("strings")->getChild(1)->get<std::string>());
+        EXPECT_THAT(*outputs->getChild("vec3s")->getChild(0)->get<vec3f>(), ::testing::ElementsAre(1.f, 2.f, 3.f));
+        EXPECT_THAT(*outputs->getChild("vec3s")->getChild(1)->get<vec3f>(), ::testing::ElementsAre(4.f, 5.f, 6.f));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ScalesAddsAndLerpsFloatArrays)
+    {
+        auto* script = createScript(R"(
+                IN.a = ARRAY(2, VEC3F)
+                IN.b = ARRAY(2, VEC3F)
+                OUT.scaled = ARRAY(2, VEC3F)
+                OUT.added = ARRAY(2, VEC3F)
+                OUT.lerped = ARRAY(2, VEC3F))", R"(
+                arraymath.scale(OUT.scaled, IN.a, 2)
+                arraymath.add(OUT.added, IN.a, IN.b)
+                arraymath.lerp(OUT.lerped, IN.a, IN.b, 0.25))");
+        ASSERT_NE(nullptr, script);
+
+        SetVec3Array(*script->getInputs()->getChild("a"), {{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}});
+        SetVec3Array(*script->getInputs()->getChild("b"), {{5.f, 6.f, 7.f}, {8.f, 9.f, 10.f}});
+
+        ASSERT_TRUE(m_logicEngine.update());
+        const Property* outputs = script->getOutputs();
+        EXPECT_THAT(*outputs->getChild("scaled")->getChild(0)->get<vec3f>(), ::testing::ElementsAre(2.f, 4.f, 6.f));
+        EXPECT_THAT(*outputs->getChild("scaled")->getChild(1)->get<vec3f>(), ::testing::ElementsAre(8.f, 10.f, 12.f));
+        EXPECT_THAT(*outputs->getChild("added")->getChild(0)->get<vec3f>(), ::testing::ElementsAre(6.f, 8.f, 10.f));
+        EXPECT_THAT(*outputs->getChild("added")->getChild(1)->get<vec3f>(), ::testing::ElementsAre(12.f, 14.f, 16.f));
+        EXPECT_THAT(*outputs->getChild("lerped")->getChild(0)->get<vec3f>(), ::testing::ElementsAre(2.f, 3.f, 4.f));
+        EXPECT_THAT(*outputs->getChild("lerped")->getChild(1)->get<vec3f>(), ::testing::ElementsAre(5.f, 6.f, 7.f));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ClampsComponentsOfFloatArrays)
+    {
+        auto* script = createScript(R"(
+                IN.floats = ARRAY(3, FLOAT)
+                OUT.floats = ARRAY(3, FLOAT))", R"(
+                arraymath.clamp(OUT.floats, IN.floats, 0, 1))");
+        ASSERT_NE(nullptr, script);
+
+        const std::array<float, 3> values{-1.f, 0.5f, 2.f};
+        ASSERT_TRUE(script->getInputs()->getChild("floats")->setArray(values.data(), values.size()));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        std::array<float, 3> result{};
+        ASSERT_TRUE(script->getOutputs()->getChild("floats")->getArray(result.data(), result.size()));
+        EXPECT_THAT(result, ::testing::ElementsAre(0.f, 0.5f, 1.f));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, TransformsPointsAndVectorsWithColumnMajorMatrix)
+    {
+        auto* script = createScript(R"(
+                IN.points = ARRAY(2, VEC3F)
+                IN.vectors = ARRAY(1, VEC4F)
+                IN.matrix = ARRAY(16, FLOAT)
+                OUT.points = ARRAY(2, VEC3F)
+                OUT.vectors = ARRAY(1, VEC4F))", R"(
+                -- scale by 2, translate by (10, 20, 30)
+                local matrix = {
+                    2, 0, 0, 0,
+                    0, 2, 0, 0,
+                    0, 0, 2, 0,
+                    10, 20, 30, 1 }
+                arraymath.transform(OUT.points, IN.points, matrix)
+                arraymath.transform(OUT.vectors, IN.vectors, IN.matrix))");
+        ASSERT_NE(nullptr, script);
+
+        SetVec3Array(*script->getInputs()->getChild("points"), {{1.f, 2.f, 3.f}, {0.f, 0.f, 0.f}});
+        script->getInputs()->getChild("vectors")->getChild(0)->set<vec4f>({1.f, 2.f, 3.f, 0.f});
+        // Swaps x and y, keeps z and w, translates by 5 in x
+        const std::array<float, 16> matrix{
+            0.f, 1.f, 0.f, 0.f,
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            5.f, 0.f, 0.f, 1.f };
+        ASSERT_TRUE(script->getInputs()->getChild("matrix")->setArray(matrix.data(), matrix.size()));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        const Property* outputs = script->getOutputs();
+        EXPECT_THAT(*outputs->getChild("points")->getChild(0)->get<vec3f>(), ::testing::ElementsAre(12.f, 24.f, 36.f));
+        EXPECT_THAT(*outputs->getChild("points")->getChild(1)->get<vec3f>(), ::testing::ElementsAre(10.f, 20.f, 30.f));
+        // w == 0, translation has no effect
+        EXPECT_THAT(*outputs->getChild("vectors")->getChild(0)->get<vec4f>(), ::testing::ElementsAre(2.f, 1.f, 3.f, 0.f));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, SumsFloatArraysToNumbersAndVectors)
+    {
+        auto* script = createScript(R"(
+                IN.floats = ARRAY(3, FLOAT)
+                IN.vec3s = ARRAY(2, VEC3F)
+                OUT.floatSum = FLOAT
+                OUT.vec3Sum = VEC3F)", R"(
+                OUT.floatSum = arraymath.sum(IN.floats)
+                OUT.vec3Sum = arraymath.sum(IN.vec3s))");
+        ASSERT_NE(nullptr, script);
+
+        const std::array<float, 3> values{1.f, 2.f, 3.5f};
+        ASSERT_TRUE(script->getInputs()->getChild("floats")->setArray(values.data(), values.size()));
+        SetVec3Array(*script->getInputs()->getChild("vec3s"), {{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}});
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(6.5f, *script->getOutputs()->getChild("floatSum")->get<float>());
+        EXPECT_THAT(*script->getOutputs()->getChild("vec3Sum")->get<vec3f>(), ::testing::ElementsAre(5.f, 7.f, 9.f));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, CanUseTargetArrayAsSource)
+    {
+        auto* script = createScript(R"(
+                IN.floats = ARRAY(2, FLOAT)
+                OUT.floats = ARRAY(2, FLOAT))", R"(
+                arraymath.copy(OUT.floats, IN.floats)
+                arraymath.add(OUT.floats, OUT.floats, OUT.floats)
+                arraymath.scale(OUT.floats, OUT.floats, 10))");
+        ASSERT_NE(nullptr, script);
+
+        const std::array<float, 2> values{1.f, 2.f};
+        ASSERT_TRUE(script->getInputs()->getChild("floats")->setArray(values.data(), values.size()));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        std::array<float, 2> result{};
+        ASSERT_TRUE(script->getOutputs()->getChild("floats")->getArray(result.data(), result.size()));
+        EXPECT_THAT(result, ::testing::ElementsAre(20.f, 40.f));
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenWritingToInputArray)
+    {
+        expectRuntimeError("arraymath.scale(IN.floats, OUT.floats, 2)", "arraymath.scale: can't write to array 'floats', only outputs can be written!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenArgumentIsNotAnArray)
+    {
+        expectRuntimeError("arraymath.copy(OUT.floats, {1, 2, 3})", "arraymath.copy: expected an array property as argument #2, but got table!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenArraySizesDiffer)
+    {
+        expectRuntimeError("arraymath.add(OUT.moreFloats, IN.floats, IN.floats)",
+            "arraymath.add: array 'floats' (ARRAY(3, FLOAT)) doesn't match array 'moreFloats' (ARRAY(4, FLOAT))!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenElementTypesDiffer)
+    {
+        expectRuntimeError("arraymath.copy(OUT.ints, IN.floats)",
+            "arraymath.copy: array 'floats' (ARRAY(3, FLOAT)) doesn't match array 'ints' (ARRAY(3, INT32))!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenComputingWithIntegerArrays)
+    {
+        expectRuntimeError("arraymath.scale(OUT.ints, IN.ints, 2)",
+            "arraymath.scale: expected an array of FLOAT, VEC2F, VEC3F or VEC4F elements as argument #2, but got ARRAY(3, INT32)!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenTransformingVec2Array)
+    {
+        expectRuntimeError("arraymath.transform(OUT.vec2s, IN.vec2s, {1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1})",
+            "arraymath.transform: expected an array of VEC3F or VEC4F elements, but got ARRAY(3, VEC2F)!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenMatrixHasWrongSize)
+    {
+        expectRuntimeError("arraymath.transform(OUT.floats, IN.floats, {1, 2, 3})",
+            "arraymath.transform: can't convert table to a 4x4 matrix! Error while extracting array: expected 16 array components in table but got 3 instead!");
+    }
+
+    TEST_F(ALuaScript_ArrayMath, ReportsErrorWhenClampRangeIsEmpty)
+    {
+        expectRuntimeError("arraymath.clamp(OUT.floats, IN.floats, 1, 0)", "arraymath.clamp: min (1) must not be greater than max (0)!");
+    }
+}
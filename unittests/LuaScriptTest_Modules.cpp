@@ -512,6 +512,88 @@ namespace rlogic::internal
         EXPECT_EQ(30, *script2->getOutputs()->getChild("v")->get<int32_t>());
     }
 
+    TEST_F(ALuaScriptWithModule, UsesModulesInScriptsOfDifferentExecutionGroups)
+    {
+        const auto module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        LuaConfig moduleConfig;
+        moduleConfig.addDependency("mymath", *module);
+        // Depends on the first module, which has to be loaded into the other Lua states too
+        const auto dependentModule = m_logicEngine.createLuaModule(R"(
+            modules("mymath")
+            local wrapper = {}
+            function wrapper.add3(a,b,c)
+                return mymath.add(mymath.add(a,b), c)
+            end
+            return wrapper
+        )", moduleConfig, "dependentmodule");
+        ASSERT_TRUE(module && dependentModule);
+
+        std::vector<LuaScript*> scripts;
+        for (uint32_t group = 0u; group < 3u; ++group)
+        {
+            LuaConfig config;
+            config.addDependency("mymath", *module);
+            config.addDependency("wrapper", *dependentModule);
+            config.setExecutionGroup(group);
+            scripts.push_back(m_logicEngine.createLuaScript(R"(
+                modules("mymath", "wrapper")
+                function interface()
+                    IN.v = INT
+                    OUT.v = INT
+                end
+                function run()
+                    OUT.v = wrapper.add3(IN.v, 1, 2) + mymath.add(0, 10)
+                end
+            )", config));
+            ASSERT_NE(nullptr, scripts.back());
+            EXPECT_EQ(group, scripts.back()->m_script.getExecutionGroup());
+        }
+
+        m_logicEngine.setUpdateThreadCount(3u);
+        for (size_t i = 0; i < scripts.size(); ++i)
+        {
+            scripts[i]->getInputs()->getChild("v")->set(static_cast<int32_t>(i) * 100);
+        }
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_EQ(13, *scripts[0]->getOutputs()->getChild("v")->get<int32_t>());
+        EXPECT_EQ(113, *scripts[1]->getOutputs()->getChild("v")->get<int32_t>());
+        EXPECT_EQ(213, *scripts[2]->getOutputs()->getChild("v")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScriptWithModule, KeepsExecutionGroupOfScriptsWhenSerialized)
+    {
+        WithTempDirectory tempDir;
+
+        {
+            LogicEngine logic;
+            const auto module = logic.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+            LuaConfig config;
+            config.addDependency("mymath", *module);
+            config.setExecutionGroup(5u);
+
+            logic.createLuaScript(R"(
+                modules("mymath")
+                function interface()
+                    OUT.v = INT
+                end
+                function run()
+                    OUT.v = mymath.add(1,2)
+                end
+            )", config, "script");
+
+            EXPECT_TRUE(logic.saveToFile("scriptgroups.tmp"));
+        }
+
+        EXPECT_TRUE(m_logicEngine.loadFromFile("scriptgroups.tmp"));
+        const auto script = m_logicEngine.findByName<LuaScript>("script");
+        ASSERT_NE(nullptr, script);
+        EXPECT_EQ(5u, script->m_script.getExecutionGroup());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *script->getOutputs()->getChild("v")->get<int32_t>());
+    }
+
     TEST_F(ALuaScriptWithModule, UsesStructPropertyInInterfaceDefinedInModule)
     {
         const std::string_view moduleDefiningInterfaceType = R"(
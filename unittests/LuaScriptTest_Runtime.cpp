@@ -14,6 +14,7 @@
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
+#include "impl/LuaScriptImpl.h"
 
 #include "ramses-framework-api/RamsesFramework.h"
 #include "ramses-client-api/RamsesClient.h"
@@ -119,6 +120,118 @@ namespace rlogic
         EXPECT_EQ(script, m_logicEngine.getErrors()[0].object);
     }
 
+    TEST_F(ALuaScript_Runtime, ReportsErrorWhenScriptExceedsItsMemoryLimit)
+    {
+        LuaConfig config;
+        config.setMemoryLimit(100000u);
+        LuaScript* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.size = INT32
+            end
+            function run()
+                local data = {}
+                for i = 1, IN.size do
+                    data[i] = i
+                end
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        EXPECT_TRUE(script->getInputs()->getChild("size")->set<int32_t>(100));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(script->getInputs()->getChild("size")->set<int32_t>(100000));
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(m_logicEngine.getErrors().size(), 1u);
+        EXPECT_EQ("Script exceeded its memory limit of 100000 bytes", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(script, m_logicEngine.getErrors()[0].object);
+        EXPECT_LE(script->getLuaMemoryStatistics().peakAllocatedBytes, 100000u);
+
+        // garbage of the failed update is collected
+        EXPECT_TRUE(script->getInputs()->getChild("size")->set<int32_t>(100));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALuaScript_Runtime, ExecutesRunOnlyOnceWhenScriptExceedsItsMemoryLimit)
+    {
+        LuaConfig config;
+        config.setMemoryLimit(100000u);
+        LuaScript* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.size = INT32
+                OUT.runs = INT32
+            end
+            function init()
+                GLOBAL.runs = 0
+            end
+            function run()
+                GLOBAL.runs = GLOBAL.runs + 1
+                OUT.runs = GLOBAL.runs
+                local data = {}
+                for i = 1, IN.size do
+                    data[i] = i
+                end
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        EXPECT_TRUE(script->getInputs()->getChild("size")->set<int32_t>(100000));
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(m_logicEngine.getErrors().size(), 1u);
+        EXPECT_EQ("Script exceeded its memory limit of 100000 bytes", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(1, *script->getOutputs()->getChild("runs")->get<int32_t>());
+
+        // the garbage of the failed run is collected before the next update
+        EXPECT_TRUE(script->getInputs()->getChild("size")->set<int32_t>(3000));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2, *script->getOutputs()->getChild("runs")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Runtime, ReportsErrorWhenScriptCatchesErrorOfExceededMemoryLimit)
+    {
+        LuaConfig config = WithStdModules({ EStandardModule::Base });
+        config.setMemoryLimit(100000u);
+        LuaScript* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+            end
+            function run()
+                pcall(function()
+                    local data = {}
+                    for i = 1, 100000 do
+                        data[i] = i
+                    end
+                end)
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(m_logicEngine.getErrors().size(), 1u);
+        EXPECT_EQ("Script exceeded its memory limit of 100000 bytes", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALuaScript_Runtime, InstancesHaveMemoryLimitOfPrototype)
+    {
+        LuaConfig config;
+        config.setMemoryLimit(100000u);
+        LuaScript* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+            end
+            function run()
+                local data = {}
+                for i = 1, 100000 do
+                    data[i] = i
+                end
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*script, "instance");
+        ASSERT_NE(nullptr, instance);
+        EXPECT_EQ(100000u, instance->m_script.getMemoryLimit());
+        // the instance has its own environment
+        EXPECT_GT(instance->getLuaMemoryStatistics().allocatedBytes, 0u);
+    }
+
     TEST_F(ALuaScript_Runtime, ProducesErrorWhenTryingToWriteInputValues)
     {
         LuaScript* script = m_logicEngine.createLuaScript(R"(
@@ -1567,6 +1680,30 @@ namespace rlogic
         EXPECT_EQ("They look right... ...and you...", *script->getOutputs()->getChild("str")->get<std::string>());
     }
 
+    TEST_F(ALuaScript_Runtime, ExecutesNewRunFunction_WhenItIsOverwrittenInsideTheRunFunction)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.trigger = INT
+                OUT.str = STRING
+            end
+            function run()
+                OUT.str = "original"
+
+                run = function()
+                    OUT.str = "overwritten"
+                end
+            end
+        )");
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ("original", *script->getOutputs()->getChild("str")->get<std::string>());
+
+        ASSERT_TRUE(script->getInputs()->getChild("trigger")->set<int32_t>(1));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ("overwritten", *script->getOutputs()->getChild("str")->get<std::string>());
+    }
+
     TEST_F(ALuaScript_Runtime, ProducesErrorIfInvalidOutPropertyIsAccessed)
     {
         auto scriptWithInvalidOutParam = m_logicEngine.createLuaScript(R"(
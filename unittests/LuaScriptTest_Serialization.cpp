@@ -28,7 +28,33 @@ namespace rlogic::internal
         {
             return std::make_unique<LuaScriptImpl>(
                 *LuaCompilationUtils::CompileScript(m_solState, {}, {}, std::string{ source }, scriptName, m_errorReporting),
-                scriptName, 1u);
+                scriptName, 1u, 0u, m_solState.createMemoryAccount());
+        }
+
+        std::vector<uint8_t> compileByteCode(std::string_view source)
+        {
+            const sol::protected_function mainFunction = m_solState.loadScript(source, "script");
+            const sol::bytecode byteCode = SolState::DumpByteCode(mainFunction);
+            const auto* byteCodeData = reinterpret_cast<const uint8_t*>(byteCode.data());
+            return std::vector<uint8_t>(byteCodeData, byteCodeData + byteCode.size());
+        }
+
+        void serializeScriptWithByteCode(std::string_view source, const std::vector<uint8_t>& byteCode)
+        {
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                m_flatBufferBuilder.CreateString("script"),
+                1u,
+                m_flatBufferBuilder.CreateString(source),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<uint8_t>{}),
+                m_testUtils.serializeTestProperty("IN"),
+                m_testUtils.serializeTestProperty("OUT"),
+                0u,
+                0u,
+                m_flatBufferBuilder.CreateVector(byteCode)
+            );
+            m_flatBufferBuilder.Finish(script);
         }
 
         std::string_view m_minimalScript = R"(
@@ -53,7 +79,7 @@ namespace rlogic::internal
         // Serialize
         {
             std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "name");
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, false);
         }
 
         // Inspect flatbuffers data
@@ -75,7 +101,7 @@ namespace rlogic::internal
 
         // Deserialize
         {
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(m_solState, serializedScript, m_errorReporting, m_deserializationMap);
+            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(m_solState, serializedScript, false, m_errorReporting, m_deserializationMap);
 
             ASSERT_TRUE(deserializedScript);
             EXPECT_TRUE(m_errorReporting.getErrors().empty());
@@ -89,7 +115,7 @@ namespace rlogic::internal
     {
         {
             std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "");
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, false);
         }
 
         const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
@@ -97,6 +123,105 @@ namespace rlogic::internal
         EXPECT_EQ(serializedScript.luaSourceCode()->string_view(), m_minimalScript);
     }
 
+    TEST_F(ALuaScript_Serialization, SerializesByteCodeOfLuaSourceCode)
+    {
+        {
+            std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "");
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, true);
+        }
+
+        const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        ASSERT_TRUE(serializedScript.luaByteCode());
+        const std::string_view byteCode(reinterpret_cast<const char*>(serializedScript.luaByteCode()->data()), serializedScript.luaByteCode()->size());
+        EXPECT_TRUE(m_solState.isCompatibleByteCode(byteCode));
+    }
+
+    TEST_F(ALuaScript_Serialization, SerializesMemoryLimit)
+    {
+        {
+            auto script = std::make_unique<LuaScriptImpl>(
+                *LuaCompilationUtils::CompileScript(m_solState, {}, {}, std::string{ m_minimalScript }, "", m_errorReporting),
+                "script", 1u, 0u, m_solState.createMemoryAccount(100000u));
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, false);
+        }
+
+        const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        EXPECT_EQ(100000u, serializedScript.memoryLimit());
+
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serializedScript, false, m_errorReporting, m_deserializationMap);
+        ASSERT_TRUE(deserialized);
+        EXPECT_EQ(100000u, deserialized->getMemoryLimit());
+        EXPECT_GT(deserialized->getLuaMemoryStatistics().allocatedBytes, 0u);
+    }
+
+    TEST_F(ALuaScript_Serialization, DoesNotSerializeByteCodeUnlessRequested)
+    {
+        {
+            std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "");
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, false);
+        }
+
+        const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        EXPECT_FALSE(serializedScript.luaByteCode());
+        EXPECT_EQ(serializedScript.luaSourceCode()->string_view(), m_minimalScript);
+    }
+
+    TEST_F(ALuaScript_Serialization, CompilesSourceInsteadOfLoadingByteCodeUnlessRequested)
+    {
+        // byte code is not used, otherwise loading would succeed
+        serializeScriptWithByteCode("this.is.bad.code", compileByteCode(m_minimalScript));
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("Fatal error during loading of LuaScript 'script' from serialized data: failed parsing Lua source code"));
+    }
+
+    TEST_F(ALuaScript_Serialization, LoadsByteCodeInsteadOfCompilingSource)
+    {
+        // source is not used, otherwise loading would fail
+        serializeScriptWithByteCode("this.is.bad.code", compileByteCode(m_minimalScript));
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, true, m_errorReporting, m_deserializationMap);
+
+        EXPECT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+    }
+
+    TEST_F(ALuaScript_Serialization, CompilesSourceWhenByteCodeIsFromOtherLuaVersionOrArchitecture)
+    {
+        std::vector<uint8_t> byteCode = compileByteCode(m_minimalScript);
+        // byte after the signature is the Lua version
+        byteCode[4] = 0x42;
+        ASSERT_FALSE(m_solState.isCompatibleByteCode(std::string_view(reinterpret_cast<const char*>(byteCode.data()), byteCode.size())));
+
+        serializeScriptWithByteCode(m_minimalScript, byteCode);
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, true, m_errorReporting, m_deserializationMap);
+
+        EXPECT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+    }
+
+    TEST_F(ALuaScript_Serialization, CompilesSourceWhenByteCodeIsCorrupted)
+    {
+        std::vector<uint8_t> byteCode = compileByteCode(m_minimalScript);
+        byteCode.resize(byteCode.size() / 2);
+
+        serializeScriptWithByteCode("this.is.bad.code", byteCode);
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, true, m_errorReporting, m_deserializationMap);
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("Fatal error during loading of LuaScript 'script' from serialized data: failed parsing Lua source code"));
+    }
+
     TEST_F(ALuaScript_Serialization, ProducesErrorWhenNameMissing)
     {
         {
@@ -109,7 +234,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -127,7 +252,7 @@ namespace rlogic::internal
         }
 
         const auto&                    serialized   = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -147,7 +272,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -171,7 +296,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        EXPECT_EQ(nullptr, LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap));
+        EXPECT_EQ(nullptr, LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap));
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
         EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of LuaScript from serialized data: missing user module dependencies!");
     }
@@ -193,7 +318,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        EXPECT_EQ(nullptr, LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap));
+        EXPECT_EQ(nullptr, LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap));
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
         EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of LuaScript from serialized data: missing standard module dependencies!");
     }
@@ -214,7 +339,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -238,7 +363,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -262,7 +387,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -286,7 +411,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -310,7 +435,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -334,7 +459,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -364,7 +489,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
@@ -393,7 +518,7 @@ namespace rlogic::internal
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
-        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, false, m_errorReporting, m_deserializationMap);
 
         EXPECT_FALSE(deserialized);
         ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
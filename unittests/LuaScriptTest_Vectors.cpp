@@ -0,0 +1,379 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LuaScriptTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
+#include "ramses-logic/Property.h"
+#include "fmt/format.h"
+
+namespace rlogic
+{
+    class ALuaScript_Vectors : public ALuaScript
+    {
+    protected:
+        void expectRuntimeError(std::string_view runFunction, std::string_view expectedErrorMessage)
+        {
+            const std::string scriptSrc = fmt::format(R"(
+                function interface()
+                    IN.vec3f = VEC3F
+                    IN.vec3i = VEC3I
+                    OUT.vec2f = VEC2F
+                    OUT.vec3f = VEC3F
+                    OUT.vec3i = VEC3I
+                    OUT.float = FLOAT
+                end
+                function run()
+                    {}
+                end
+            )", runFunction);
+
+            ASSERT_NE(nullptr, m_logicEngine.createLuaScript(scriptSrc));
+            EXPECT_FALSE(m_logicEngine.update());
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr(expectedErrorMessage));
+        }
+    };
+
+    TEST_F(ALuaScript_Vectors, AssignsVectorsToVectorOutputs)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.vec2f = VEC2F
+                OUT.vec3f = VEC3F
+                OUT.vec4f = VEC4F
+            end
+            function run()
+                OUT.vec2f = vec2(1, 2)
+                OUT.vec3f = vec3(1, 2, 3)
+                OUT.vec4f = vec4(1, 2, 3, 4)
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*script->getOutputs()->getChild("vec2f")->get<vec2f>(), ::testing::ElementsAre(1.f, 2.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("vec3f")->get<vec3f>(), ::testing::ElementsAre(1.f, 2.f, 3.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("vec4f")->get<vec4f>(), ::testing::ElementsAre(1.f, 2.f, 3.f, 4.f));
+    }
+
+    TEST_F(ALuaScript_Vectors, CreatesVectorsFromSingleNumberTablesPropertiesAndOtherVectors)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.vec3f = VEC3F
+                OUT.fromNumber = VEC3F
+                OUT.fromTable = VEC3F
+                OUT.fromProperty = VEC3F
+                OUT.fromVector = VEC3F
+            end
+            function run()
+                OUT.fromNumber = vec3(5)
+                OUT.fromTable = vec3({1, 2, 3})
+                OUT.fromProperty = vec3(IN.vec3f)
+                OUT.fromVector = vec3(vec3(4, 5, 6))
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+        script->getInputs()->getChild("vec3f")->set<vec3f>({7.f, 8.f, 9.f});
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*script->getOutputs()->getChild("fromNumber")->get<vec3f>(), ::testing::ElementsAre(5.f, 5.f, 5.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("fromTable")->get<vec3f>(), ::testing::ElementsAre(1.f, 2.f, 3.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("fromProperty")->get<vec3f>(), ::testing::ElementsAre(7.f, 8.f, 9.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("fromVector")->get<vec3f>(), ::testing::ElementsAre(4.f, 5.f, 6.f));
+    }
+
+    TEST_F(ALuaScript_Vectors, ReadsComponentsByIndexAndByName)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.components = VEC4F
+                OUT.size = INT
+            end
+            function run()
+                local v = vec4(1, 2, 3, 4)
+                OUT.components = {v[1] + v.x, v[2] + v.y, v[3] + v.z, v[4] + v.w}
+                OUT.size = #v + rl_len(v)
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*script->getOutputs()->getChild("components")->get<vec4f>(), ::testing::ElementsAre(2.f, 4.f, 6.f, 8.f));
+        EXPECT_EQ(8, *script->getOutputs()->getChild("size")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Vectors, SupportsArithmeticOperators)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.add = VEC3F
+                OUT.sub = VEC3F
+                OUT.mul = VEC3F
+                OUT.div = VEC3F
+                OUT.scaledLeft = VEC3F
+                OUT.scaledRight = VEC3F
+                OUT.divByScalar = VEC3F
+                OUT.negated = VEC3F
+                OUT.withTable = VEC3F
+            end
+            function run()
+                local a = vec3(1, 2, 3)
+                local b = vec3(4, 6, 12)
+                OUT.add = a + b
+                OUT.sub = b - a
+                OUT.mul = a * b
+                OUT.div = b / a
+                OUT.scaledLeft = 2 * a
+                OUT.scaledRight = a * 2
+                OUT.divByScalar = b / 2
+                OUT.negated = -a
+                OUT.withTable = {10, 10, 10} - a
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        const Property* outputs = script->getOutputs();
+        EXPECT_THAT(*outputs->getChild("add")->get<vec3f>(), ::testing::ElementsAre(5.f, 8.f, 15.f));
+        EXPECT_THAT(*outputs->getChild("sub")->get<vec3f>(), ::testing::ElementsAre(3.f, 4.f, 9.f));
+        EXPECT_THAT(*outputs->getChild("mul")->get<vec3f>(), ::testing::ElementsAre(4.f, 12.f, 36.f));
+        EXPECT_THAT(*outputs->getChild("div")->get<vec3f>(), ::testing::ElementsAre(4.f, 3.f, 4.f));
+        EXPECT_THAT(*outputs->getChild("scaledLeft")->get<vec3f>(), ::testing::ElementsAre(2.f, 4.f, 6.f));
+        EXPECT_THAT(*outputs->getChild("scaledRight")->get<vec3f>(), ::testing::ElementsAre(2.f, 4.f, 6.f));
+        EXPECT_THAT(*outputs->getChild("divByScalar")->get<vec3f>(), ::testing::ElementsAre(2.f, 3.f, 6.f));
+        EXPECT_THAT(*outputs->getChild("negated")->get<vec3f>(), ::testing::ElementsAre(-1.f, -2.f, -3.f));
+        EXPECT_THAT(*outputs->getChild("withTable")->get<vec3f>(), ::testing::ElementsAre(9.f, 8.f, 7.f));
+    }
+
+    TEST_F(ALuaScript_Vectors, SupportsVectorMath)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.dot = FLOAT
+                OUT.cross = VEC3F
+                OUT.length = FLOAT
+                OUT.normalized = VEC2F
+                OUT.normalizedZero = VEC2F
+                OUT.lerp = VEC4F
+            end
+            function run()
+                OUT.dot = vec3(1, 2, 3):dot(vec3(4, 5, 6))
+                OUT.cross = vec3(1, 0, 0):cross(vec3(0, 1, 0))
+                OUT.length = vec2(3, 4):length()
+                OUT.normalized = vec2(3, 4):normalize()
+                OUT.normalizedZero = vec2(0, 0):normalize()
+                OUT.lerp = vec4(0, 0, 0, 0):lerp(vec4(2, 4, 6, 8), 0.5)
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        const Property* outputs = script->getOutputs();
+        EXPECT_FLOAT_EQ(32.f, *outputs->getChild("dot")->get<float>());
+        EXPECT_THAT(*outputs->getChild("cross")->get<vec3f>(), ::testing::ElementsAre(0.f, 0.f, 1.f));
+        EXPECT_FLOAT_EQ(5.f, *outputs->getChild("length")->get<float>());
+        EXPECT_FLOAT_EQ(0.6f, (*outputs->getChild("normalized")->get<vec2f>())[0]);
+        EXPECT_FLOAT_EQ(0.8f, (*outputs->getChild("normalized")->get<vec2f>())[1]);
+        EXPECT_THAT(*outputs->getChild("normalizedZero")->get<vec2f>(), ::testing::ElementsAre(0.f, 0.f));
+        EXPECT_THAT(*outputs->getChild("lerp")->get<vec4f>(), ::testing::ElementsAre(1.f, 2.f, 3.f, 4.f));
+    }
+
+    TEST_F(ALuaScript_Vectors, ComparesAndPrintsVectors)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.equal = BOOL
+                OUT.notEqual = BOOL
+                OUT.asString = STRING
+            end
+            function run()
+                OUT.equal = vec3(1, 2, 3) == vec3(1, 2, 3)
+                OUT.notEqual = vec3(1, 2, 3) ~= vec3(1, 2, 4)
+                OUT.asString = tostring(vec2(1.5, -2))
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(*script->getOutputs()->getChild("equal")->get<bool>());
+        EXPECT_TRUE(*script->getOutputs()->getChild("notEqual")->get<bool>());
+        EXPECT_EQ("vec2(1.5, -2)", *script->getOutputs()->getChild("asString")->get<std::string>());
+    }
+
+    TEST_F(ALuaScript_Vectors, SupportsArithmeticOnFloatVectorProperties)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.position = VEC3F
+                IN.velocity = VEC3F
+                IN.dt = FLOAT
+                OUT.position = VEC3F
+                OUT.negated = VEC3F
+                OUT.speed = FLOAT
+            end
+            function run()
+                OUT.position = IN.position + IN.velocity * IN.dt
+                OUT.negated = -IN.velocity
+                OUT.speed = vec3(IN.velocity):length()
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+        script->getInputs()->getChild("position")->set<vec3f>({1.f, 2.f, 3.f});
+        script->getInputs()->getChild("velocity")->set<vec3f>({0.f, 3.f, 4.f});
+        script->getInputs()->getChild("dt")->set<float>(2.f);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*script->getOutputs()->getChild("position")->get<vec3f>(), ::testing::ElementsAre(1.f, 8.f, 11.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("negated")->get<vec3f>(), ::testing::ElementsAre(0.f, -3.f, -4.f));
+        EXPECT_FLOAT_EQ(5.f, *script->getOutputs()->getChild("speed")->get<float>());
+    }
+
+    TEST_F(ALuaScript_Vectors, AssignsVectorsToArrayElementsAndStructFields)
+    {
+        auto* script = m_logicEngine.createLuaScript(R"(
+            function interface()
+                OUT.array = ARRAY(2, VEC2F)
+                OUT.struct = {position = VEC3F, scale = FLOAT}
+            end
+            function run()
+                OUT.array = {vec2(1, 2), vec2(3, 4)}
+                OUT.struct = {position = vec3(5, 6, 7), scale = 2}
+            end
+        )");
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        const Property* array = script->getOutputs()->getChild("array");
+        EXPECT_THAT(*array->getChild(0)->get<vec2f>(), ::testing::ElementsAre(1.f, 2.f));
+        EXPECT_THAT(*array->getChild(1)->get<vec2f>(), ::testing::ElementsAre(3.f, 4.f));
+        EXPECT_THAT(*script->getOutputs()->getChild("struct")->getChild("position")->get<vec3f>(), ::testing::ElementsAre(5.f, 6.f, 7.f));
+    }
+
+    TEST_F(ALuaScript_Vectors, CanBeUsedInModules)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(R"(
+            local mymath = {}
+            function mymath.midpoint(a, b)
+                return (vec3(a) + vec3(b)) / 2
+            end
+            return mymath
+        )");
+        ASSERT_NE(nullptr, module);
+        LuaConfig config;
+        config.addDependency("mymath", *module);
+
+        auto* script = m_logicEngine.createLuaScript(R"(
+            modules("mymath")
+            function interface()
+                OUT.midpoint = VEC3F
+            end
+            function run()
+                OUT.midpoint = mymath.midpoint({0, 0, 0}, vec3(2, 4, 6))
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(*script->getOutputs()->getChild("midpoint")->get<vec3f>(), ::testing::ElementsAre(1.f, 2.f, 3.f));
+    }
+
+    TEST_F(ALuaScript_Vectors, UserModuleWithNameOfVectorConstructorHidesTheConstructor)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(R"(
+            local vec3 = {}
+            vec3.answer = 42
+            return vec3
+        )");
+        ASSERT_NE(nullptr, module);
+        LuaConfig config;
+        config.addDependency("vec3", *module);
+
+        auto* script = m_logicEngine.createLuaScript(R"(
+            modules("vec3")
+            function interface()
+                OUT.answer = INT
+            end
+            function run()
+                OUT.answer = vec3.answer
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *script->getOutputs()->getChild("answer")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenAssigningVectorOfWrongSize)
+    {
+        expectRuntimeError("OUT.vec2f = vec3(1, 2, 3)", "Can't assign vec3 value to property 'vec2f' (type VEC2F)!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenAssigningVectorToIntegerVectorOutput)
+    {
+        expectRuntimeError("OUT.vec3i = vec3(1, 2, 3)", "Can't assign vec3 value to property 'vec3i' (type VEC3I)!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenAssigningVectorToFloatOutput)
+    {
+        expectRuntimeError("OUT.float = vec3(1, 2, 3)", "Can't assign vec3 value to property 'float' (type FLOAT)!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenModifyingComponents)
+    {
+        expectRuntimeError("local v = vec3(1, 2, 3)\nv.x = 5", "Can't assign individual components of vec3 values, must create a new value (e.g. with vec3())!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenAccessingComponentOutOfRange)
+    {
+        expectRuntimeError("local x = vec2(1, 2)[3]", "Bad index '3', expected 1 <= i <= 2!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenAccessingUndefinedField)
+    {
+        expectRuntimeError("local z = vec2(1, 2).z", "Tried to access undefined field 'z' of vec2 value!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenConstructorReceivesWrongNumberOfArguments)
+    {
+        expectRuntimeError("local v = vec3(1, 2)", "vec3() expects 3 numbers or a single argument, but received 2 arguments!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenConstructorReceivesNonNumbers)
+    {
+        expectRuntimeError("local v = vec3(1, 'two', 3)", "Bad argument #2 to vec3()!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenConstructingFromTableOfWrongSize)
+    {
+        expectRuntimeError("local v = vec3({1, 2})", "Can't convert table to vec3! Error while extracting array: expected 3 array components in table but got 2 instead!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenCombiningVectorsOfDifferentSize)
+    {
+        expectRuntimeError("local v = vec3(1, 2, 3) + vec2(1, 2)", "Expected vec3 value, VEC3F property or table with 3 numbers, but got vec2!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorForArithmeticOnIntegerVectorProperties)
+    {
+        expectRuntimeError("local v = IN.vec3i + IN.vec3i",
+            "Can't apply operator '+' to VEC3I property and VEC3I property! Arithmetic operators are only supported for VEC2F, VEC3F and VEC4F properties and vec2, vec3 and vec4 values");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenCombiningFloatVectorPropertyWithIntegerVectorProperty)
+    {
+        expectRuntimeError("local v = IN.vec3f + IN.vec3i", "Expected vec3 value, VEC3F property or table with 3 numbers, but got VEC3I property!");
+    }
+
+    TEST_F(ALuaScript_Vectors, ReportsErrorWhenCrossProductIsUsedOnVec2)
+    {
+        expectRuntimeError("local v = vec2(1, 2):cross(vec2(3, 4))", "Tried to access undefined field 'cross' of vec2 value!");
+    }
+}
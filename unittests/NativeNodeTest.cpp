@@ -0,0 +1,491 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/NativeNode.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "impl/NativeNodeImpl.h"
+#include "impl/PropertyImpl.h"
+#include "internals/ErrorReporting.h"
+#include "internals/SerializationMap.h"
+#include "internals/DeserializationMap.h"
+#include "internals/EPropertySemantics.h"
+#include "generated/NativeNodeGen.h"
+#include "flatbuffers/flatbuffers.h"
+#include <array>
+
+namespace rlogic::internal
+{
+    class ANativeNode : public ::testing::Test
+    {
+    protected:
+        ANativeNode()
+        {
+            registerSumType(m_logicEngine);
+        }
+
+        // OUT.sum = IN.a + IN.b, counts its updates
+        void registerSumType(LogicEngine& logicEngine, std::string_view typeName = "sum")
+        {
+            const bool success = logicEngine.registerNativeNodeType(typeName,
+                { {"a", EPropertyType::Float}, {"b", EPropertyType::Float} },
+                { {"sum", EPropertyType::Float} },
+                [this](NativeNodeUpdateContext& context) {
+                    ++m_updateCount;
+                    const Property& inputs = context.getInputs();
+                    EXPECT_TRUE(context.setOutput<float>(0u, *inputs.getChild(0u)->get<float>() + *inputs.getChild(1u)->get<float>()));
+                });
+            ASSERT_TRUE(success);
+        }
+
+        // OUT.smoothed[i] = OUT.smoothed[i] + (IN.signals[i] - OUT.smoothed[i]) * IN.factor
+        static void RegisterSmoothingType(LogicEngine& logicEngine)
+        {
+            const bool success = logicEngine.registerNativeNodeType("smoothing",
+                { {"factor", EPropertyType::Float}, {"signals", EPropertyType::Array, EPropertyType::Float, 4u} },
+                { {"smoothed", EPropertyType::Array, EPropertyType::Float, 4u} },
+                [](NativeNodeUpdateContext& context) {
+                    const float factor = *context.getInputs().getChild(0u)->get<float>();
+                    std::array<float, 4u> signals{};
+                    std::array<float, 4u> smoothed{};
+                    EXPECT_TRUE(context.getInputs().getChild(1u)->getArray(signals.data(), signals.size()));
+                    EXPECT_TRUE(context.getOutputs().getChild(0u)->getArray(smoothed.data(), smoothed.size()));
+                    for (size_t i = 0; i < smoothed.size(); ++i)
+                        smoothed[i] += (signals[i] - smoothed[i]) * factor;
+                    EXPECT_TRUE(context.setOutputArray(0u, smoothed.data(), smoothed.size()));
+                });
+            ASSERT_TRUE(success);
+        }
+
+        void expectRegistrationError(std::string_view typeName, const NativeNodePropertyDeclarations& inputs, const NativeNodePropertyDeclarations& outputs, std::string_view errorMessage)
+        {
+            EXPECT_FALSE(m_logicEngine.registerNativeNodeType(typeName, inputs, outputs, [](NativeNodeUpdateContext& /*context*/) {}));
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_EQ(errorMessage, m_logicEngine.getErrors().front().message);
+        }
+
+        LogicEngine m_logicEngine;
+        size_t m_updateCount = 0u;
+    };
+
+    TEST_F(ANativeNode, IsCreated)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum", "nativeNode");
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        ASSERT_NE(nullptr, nativeNode);
+        EXPECT_EQ(nativeNode, m_logicEngine.findByName<NativeNode>("nativeNode"));
+        EXPECT_EQ(nativeNode, m_logicEngine.findByName<LogicObject>("nativeNode")->as<NativeNode>());
+        EXPECT_EQ(1u, m_logicEngine.getCollection<NativeNode>().size());
+
+        EXPECT_EQ("nativeNode", nativeNode->getName());
+        EXPECT_EQ("sum", nativeNode->getTypeName());
+    }
+
+    TEST_F(ANativeNode, HasDeclaredPropertiesAfterCreation)
+    {
+        RegisterSmoothingType(m_logicEngine);
+        const NativeNode* nativeNode = m_logicEngine.createNativeNode("smoothing");
+        ASSERT_NE(nullptr, nativeNode);
+
+        const Property* rootIn = nativeNode->getInputs();
+        EXPECT_EQ("IN", rootIn->getName());
+        ASSERT_EQ(2u, rootIn->getChildCount());
+        EXPECT_EQ("factor", rootIn->getChild(0u)->getName());
+        EXPECT_EQ(EPropertyType::Float, rootIn->getChild(0u)->getType());
+        EXPECT_EQ("signals", rootIn->getChild(1u)->getName());
+        EXPECT_EQ(EPropertyType::Array, rootIn->getChild(1u)->getType());
+        ASSERT_EQ(4u, rootIn->getChild(1u)->getChildCount());
+        EXPECT_EQ(EPropertyType::Float, rootIn->getChild(1u)->getChild(0u)->getType());
+
+        const Property* rootOut = nativeNode->getOutputs();
+        EXPECT_EQ("OUT", rootOut->getName());
+        ASSERT_EQ(1u, rootOut->getChildCount());
+        EXPECT_EQ("smoothed", rootOut->getChild(0u)->getName());
+        EXPECT_EQ(EPropertyType::Array, rootOut->getChild(0u)->getType());
+        EXPECT_EQ(4u, rootOut->getChild(0u)->getChildCount());
+    }
+
+    TEST_F(ANativeNode, FailsToBeCreatedIfTypeIsNotRegistered)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine.createNativeNode("unknown", "nativeNode"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to create NativeNode 'nativeNode': type 'unknown' is not registered!", m_logicEngine.getErrors().front().message);
+
+        // types are registered per logic engine
+        LogicEngine otherEngine;
+        EXPECT_EQ(nullptr, otherEngine.createNativeNode("sum"));
+    }
+
+    TEST_F(ANativeNode, IsDestroyed)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum", "nativeNode");
+        ASSERT_NE(nullptr, nativeNode);
+        EXPECT_TRUE(m_logicEngine.destroy(*nativeNode));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<NativeNode>("nativeNode"));
+    }
+
+    TEST_F(ANativeNode, FailsToBeDestroyedIfFromOtherLogicInstance)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum", "nativeNode");
+        ASSERT_NE(nullptr, nativeNode);
+
+        LogicEngine otherEngine;
+        EXPECT_FALSE(otherEngine.destroy(*nativeNode));
+        ASSERT_FALSE(otherEngine.getErrors().empty());
+        EXPECT_EQ("Can't find NativeNode in logic engine!", otherEngine.getErrors().front().message);
+    }
+
+    TEST_F(ANativeNode, FailsToRegisterTypeWithInvalidNameOrFunction)
+    {
+        expectRegistrationError("", {}, {}, "Failed to register native node type: type name must not be empty!");
+        expectRegistrationError("sum", {}, {}, "Failed to register native node type 'sum': a type with this name is already registered!");
+
+        EXPECT_FALSE(m_logicEngine.registerNativeNodeType("noFunction", {}, {}, nullptr));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to register native node type 'noFunction': missing update function!", m_logicEngine.getErrors().front().message);
+    }
+
+    TEST_F(ANativeNode, FailsToRegisterTypeWithInvalidPropertyDeclarations)
+    {
+        expectRegistrationError("type", { {"", EPropertyType::Float} }, {},
+            "Failed to register native node type 'type': IN property without name!");
+        expectRegistrationError("type", {}, { {"x", EPropertyType::Float}, {"x", EPropertyType::Int32} },
+            "Failed to register native node type 'type': OUT property 'x' is declared twice!");
+        expectRegistrationError("type", { {"x", EPropertyType::Struct} }, {},
+            "Failed to register native node type 'type': IN property 'x' must be a primitive or an array of 1 to 255 primitives!");
+        expectRegistrationError("type", { {"x", EPropertyType::Array, EPropertyType::Float, 0u} }, {},
+            "Failed to register native node type 'type': IN property 'x' must be a primitive or an array of 1 to 255 primitives!");
+        expectRegistrationError("type", { {"x", EPropertyType::Array, EPropertyType::Float, 256u} }, {},
+            "Failed to register native node type 'type': IN property 'x' must be a primitive or an array of 1 to 255 primitives!");
+        expectRegistrationError("type", {}, { {"x", EPropertyType::Array, EPropertyType::Array, 2u} },
+            "Failed to register native node type 'type': OUT property 'x' must be a primitive or an array of 1 to 255 primitives!");
+
+        // nothing was registered
+        EXPECT_EQ(nullptr, m_logicEngine.createNativeNode("type"));
+    }
+
+    TEST_F(ANativeNode, ComputesOutputsFromInputs)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum");
+        ASSERT_NE(nullptr, nativeNode);
+
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("a")->set<float>(1.5f));
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("b")->set<float>(2.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(3.5f, *nativeNode->getOutputs()->getChild("sum")->get<float>());
+    }
+
+    TEST_F(ANativeNode, ReadsItsInputsDuringAsyncUpdate)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum");
+        ASSERT_NE(nullptr, nativeNode);
+
+        // Property::get waits for a running async update, except when it's called by the update itself
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("a")->set<float>(1.5f));
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("b")->set<float>(2.f));
+        EXPECT_TRUE(m_logicEngine.updateAsync().get());
+        EXPECT_TRUE(m_logicEngine.commit());
+        EXPECT_FLOAT_EQ(3.5f, *nativeNode->getOutputs()->getChild("sum")->get<float>());
+    }
+
+    TEST_F(ANativeNode, IsOnlyUpdatedWhenInputsChange)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum");
+        ASSERT_NE(nullptr, nativeNode);
+
+        // dirty after creation
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_updateCount);
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_updateCount);
+
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("a")->set<float>(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_updateCount);
+
+        // same value again
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("a")->set<float>(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_updateCount);
+    }
+
+    TEST_F(ANativeNode, CanBeLinkedWithScripts)
+    {
+        LuaScript* source = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.value = FLOAT
+            end
+            function run()
+                OUT.value = IN.value
+            end
+        )");
+        LuaScript* target = m_logicEngine.createLuaScript(R"(
+            function interface()
+                IN.value = FLOAT
+                OUT.doubled = FLOAT
+            end
+            function run()
+                OUT.doubled = IN.value * 2
+            end
+        )");
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum");
+        ASSERT_TRUE(source && target && nativeNode);
+
+        ASSERT_TRUE(m_logicEngine.link(*source->getOutputs()->getChild("value"), *nativeNode->getInputs()->getChild("a")));
+        ASSERT_TRUE(m_logicEngine.link(*nativeNode->getOutputs()->getChild("sum"), *target->getInputs()->getChild("value")));
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("b")->set<float>(1.f));
+
+        EXPECT_TRUE(source->getInputs()->getChild("value")->set<float>(2.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(6.f, *target->getOutputs()->getChild("doubled")->get<float>());
+
+        EXPECT_TRUE(source->getInputs()->getChild("value")->set<float>(4.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(10.f, *target->getOutputs()->getChild("doubled")->get<float>());
+    }
+
+    TEST_F(ANativeNode, AppearsInUpdateReport)
+    {
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("sum");
+        ASSERT_NE(nullptr, nativeNode);
+        m_logicEngine.enableUpdateReport(true);
+
+        EXPECT_TRUE(m_logicEngine.update());
+        LogicEngineReport report = m_logicEngine.getLastUpdateReport();
+        ASSERT_EQ(1u, report.getNodesExecuted().size());
+        EXPECT_EQ(nativeNode, report.getNodesExecuted().front().first);
+        EXPECT_TRUE(report.getNodesSkippedExecution().empty());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        report = m_logicEngine.getLastUpdateReport();
+        EXPECT_TRUE(report.getNodesExecuted().empty());
+        ASSERT_EQ(1u, report.getNodesSkippedExecution().size());
+        EXPECT_EQ(nativeNode, report.getNodesSkippedExecution().front());
+    }
+
+    TEST_F(ANativeNode, SetsArrayOutputs)
+    {
+        RegisterSmoothingType(m_logicEngine);
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("smoothing");
+        ASSERT_NE(nullptr, nativeNode);
+
+        const std::array<float, 4u> signals{ 1.f, 2.f, 4.f, 8.f };
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("factor")->set<float>(0.5f));
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("signals")->setArray(signals.data(), signals.size()));
+
+        std::array<float, 4u> smoothed{};
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(nativeNode->getOutputs()->getChild("smoothed")->getArray(smoothed.data(), smoothed.size()));
+        EXPECT_THAT(smoothed, ::testing::ElementsAre(0.5f, 1.f, 2.f, 4.f));
+
+        // outputs keep their values between updates
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("factor")->set<float>(0.25f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(nativeNode->getOutputs()->getChild("smoothed")->getArray(smoothed.data(), smoothed.size()));
+        EXPECT_THAT(smoothed, ::testing::ElementsAre(0.625f, 1.25f, 2.5f, 5.f));
+    }
+
+    TEST_F(ANativeNode, RejectsOutputsWithWrongIndexOrType)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeNodeType("invalidOutputs",
+            {},
+            { {"value", EPropertyType::Int32}, {"array", EPropertyType::Array, EPropertyType::Float, 2u} },
+            [](NativeNodeUpdateContext& context) {
+                const std::array<float, 3u> values{};
+                const std::array<int32_t, 2u> intValues{};
+                EXPECT_FALSE(context.setOutput<int32_t>(2u, 1));
+                EXPECT_FALSE(context.setOutput<float>(0u, 1.f));
+                EXPECT_FALSE(context.setOutput<float>(1u, 1.f));
+                EXPECT_FALSE(context.setOutputArray(0u, values.data(), 2u));
+                EXPECT_FALSE(context.setOutputArray(1u, values.data(), 3u));
+                EXPECT_FALSE(context.setOutputArray(1u, intValues.data(), 2u));
+                EXPECT_TRUE(context.setOutput<int32_t>(0u, 5));
+                EXPECT_TRUE(context.setOutputArray(1u, values.data(), 2u));
+            }));
+
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("invalidOutputs");
+        ASSERT_NE(nullptr, nativeNode);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(5, *nativeNode->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ANativeNode, ReportsErrorsOfUpdateFunction)
+    {
+        ASSERT_TRUE(m_logicEngine.registerNativeNodeType("failing",
+            { {"fail", EPropertyType::Bool} },
+            {},
+            [](NativeNodeUpdateContext& context) {
+                if (*context.getInputs().getChild(0u)->get<bool>())
+                {
+                    context.reportError("first error");
+                    context.reportError("second error");
+                }
+            }));
+
+        NativeNode* nativeNode = m_logicEngine.createNativeNode("failing", "failingNode");
+        ASSERT_NE(nullptr, nativeNode);
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("fail")->set<bool>(true));
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("NativeNode 'failingNode' (type 'failing') failed to update: first error", m_logicEngine.getErrors().front().message);
+        EXPECT_EQ(nativeNode, m_logicEngine.getErrors().front().object);
+
+        // error is reset for the next update
+        EXPECT_TRUE(nativeNode->getInputs()->getChild("fail")->set<bool>(false));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ANativeNode, CanBeSerializedAndDeserialized)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine otherEngine;
+            registerSumType(otherEngine);
+            RegisterSmoothingType(otherEngine);
+
+            NativeNode* sum = otherEngine.createNativeNode("sum", "sumNode");
+            NativeNode* smoothing = otherEngine.createNativeNode("smoothing", "smoothingNode");
+            ASSERT_TRUE(sum && smoothing);
+            ASSERT_TRUE(otherEngine.link(*sum->getOutputs()->getChild("sum"), *smoothing->getInputs()->getChild("factor")));
+            EXPECT_TRUE(sum->getInputs()->getChild("a")->set<float>(0.25f));
+            EXPECT_TRUE(sum->getInputs()->getChild("b")->set<float>(0.25f));
+            const std::array<float, 4u> signals{ 2.f, 4.f, 6.f, 8.f };
+            EXPECT_TRUE(smoothing->getInputs()->getChild("signals")->setArray(signals.data(), signals.size()));
+            EXPECT_TRUE(otherEngine.update());
+            ASSERT_TRUE(otherEngine.saveToFile("logic_nativeNode.bin"));
+        }
+
+        RegisterSmoothingType(m_logicEngine);
+        ASSERT_TRUE(m_logicEngine.loadFromFile("logic_nativeNode.bin"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(2u, m_logicEngine.getCollection<NativeNode>().size());
+
+        NativeNode* sum = m_logicEngine.findByName<NativeNode>("sumNode");
+        NativeNode* smoothing = m_logicEngine.findByName<NativeNode>("smoothingNode");
+        ASSERT_TRUE(sum && smoothing);
+        EXPECT_EQ("sum", sum->getTypeName());
+        EXPECT_EQ("smoothing", smoothing->getTypeName());
+        EXPECT_FLOAT_EQ(0.25f, *sum->getInputs()->getChild("a")->get<float>());
+        EXPECT_FLOAT_EQ(0.5f, *sum->getOutputs()->getChild("sum")->get<float>());
+        EXPECT_TRUE(smoothing->getInputs()->getChild("factor")->isLinked());
+
+        std::array<float, 4u> smoothed{};
+        EXPECT_TRUE(smoothing->getOutputs()->getChild("smoothed")->getArray(smoothed.data(), smoothed.size()));
+        EXPECT_THAT(smoothed, ::testing::ElementsAre(1.f, 2.f, 3.f, 4.f));
+
+        // the loaded nodes execute the registered update functions
+        EXPECT_TRUE(sum->getInputs()->getChild("b")->set<float>(0.75f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *sum->getOutputs()->getChild("sum")->get<float>());
+        EXPECT_TRUE(smoothing->getOutputs()->getChild("smoothed")->getArray(smoothed.data(), smoothed.size()));
+        EXPECT_THAT(smoothed, ::testing::ElementsAre(2.f, 4.f, 6.f, 8.f));
+    }
+
+    TEST_F(ANativeNode, FailsToLoadIfTypeIsNotRegistered)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine otherEngine;
+            registerSumType(otherEngine, "otherSum");
+            ASSERT_TRUE(otherEngine.createNativeNode("otherSum", "nativeNode"));
+            ASSERT_TRUE(otherEngine.saveToFile("logic_nativeNode.bin"));
+        }
+
+        EXPECT_FALSE(m_logicEngine.loadFromFile("logic_nativeNode.bin"));
+        ASSERT_FALSE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ("Fatal error during loading of NativeNode 'nativeNode': type 'otherSum' is not registered! Register all native node types before loading.",
+            m_logicEngine.getErrors().front().message);
+    }
+
+    TEST_F(ANativeNode, FailsToLoadIfRegisteredTypeHasDifferentInterface)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine otherEngine;
+            ASSERT_TRUE(otherEngine.registerNativeNodeType("sum",
+                { {"a", EPropertyType::Float}, {"c", EPropertyType::Float} },
+                { {"sum", EPropertyType::Float} },
+                [](NativeNodeUpdateContext& /*context*/) {}));
+            ASSERT_TRUE(otherEngine.createNativeNode("sum", "nativeNode"));
+            ASSERT_TRUE(otherEngine.saveToFile("logic_nativeNode.bin"));
+        }
+
+        EXPECT_FALSE(m_logicEngine.loadFromFile("logic_nativeNode.bin"));
+        ASSERT_FALSE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ("Fatal error during loading of NativeNode 'nativeNode': properties don't match the interface of the registered type 'sum'!",
+            m_logicEngine.getErrors().front().message);
+    }
+
+    class ANativeNode_SerializationLifecycle : public ANativeNode
+    {
+    protected:
+        enum class ESerializationIssue
+        {
+            AllValid,
+            NameMissing,
+            IdMissing,
+            TypeNameMissing,
+            RootInMissing,
+            RootOutMissing
+        };
+
+        std::unique_ptr<NativeNodeImpl> deserializeSerializedDataWithIssue(ESerializationIssue issue)
+        {
+            flatbuffers::FlatBufferBuilder flatBufferBuilder;
+            SerializationMap serializationMap;
+            DeserializationMap deserializationMap;
+
+            {
+                auto inputsImpl = std::make_unique<PropertyImpl>(MakeStruct("IN", { {"value", EPropertyType::Int32} }), EPropertySemantics::ScriptInput);
+                auto outputsImpl = std::make_unique<PropertyImpl>(MakeStruct("OUT", {}), EPropertySemantics::ScriptOutput);
+
+                const auto nativeNodeFB = rlogic_serialization::CreateNativeNode(
+                    flatBufferBuilder,
+                    issue == ESerializationIssue::NameMissing ? 0 : flatBufferBuilder.CreateString("nativeNode"),
+                    issue == ESerializationIssue::IdMissing ? 0 : 1u,
+                    issue == ESerializationIssue::TypeNameMissing ? 0 : flatBufferBuilder.CreateString("type"),
+                    issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap),
+                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap)
+                );
+
+                flatBufferBuilder.Finish(nativeNodeFB);
+            }
+
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::NativeNode>(flatBufferBuilder.GetBufferPointer());
+            return NativeNodeImpl::Deserialize(serialized, m_nativeNodeTypes, m_errorReporting, deserializationMap);
+        }
+
+        NativeNodeTypeRegistry m_nativeNodeTypes{
+            {"type", std::make_shared<NativeNodeType>(NativeNodeType{ "type", MakeStruct("IN", { {"value", EPropertyType::Int32} }), MakeStruct("OUT", {}), [](NativeNodeUpdateContext& /*context*/) {} })}
+        };
+        ErrorReporting m_errorReporting;
+    };
+
+    TEST_F(ANativeNode_SerializationLifecycle, FailsDeserializationIfEssentialDataMissing)
+    {
+        EXPECT_TRUE(deserializeSerializedDataWithIssue(ESerializationIssue::AllValid));
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        for (const auto issue : { ESerializationIssue::NameMissing, ESerializationIssue::IdMissing, ESerializationIssue::TypeNameMissing, ESerializationIssue::RootInMissing, ESerializationIssue::RootOutMissing })
+        {
+            EXPECT_FALSE(deserializeSerializedDataWithIssue(issue));
+            ASSERT_FALSE(m_errorReporting.getErrors().empty());
+            EXPECT_EQ("Fatal error during loading of NativeNode from serialized data: missing name, id, type name or in/out property data!", m_errorReporting.getErrors().front().message);
+            m_errorReporting.clear();
+        }
+    }
+}
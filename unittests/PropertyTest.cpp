@@ -24,6 +24,7 @@
 #include "LogTestUtils.h"
 
 #include <memory>
+#include <array>
 #include <fmt/format.h>
 
 namespace rlogic::internal
@@ -568,6 +569,48 @@ namespace rlogic::internal
         EXPECT_FALSE(c3);
     }
 
+    TEST_F(AProperty, FindsChildrenOfLargeStructByName)
+    {
+        // Names are not created in alphabetical order, the order of children must not depend on the lookup table
+        std::vector<TypeData> childTypes;
+        for (size_t i = 0; i < 200; ++i)
+        {
+            childTypes.emplace_back(fmt::format("child{}", (i * 7) % 200), EPropertyType::Float);
+        }
+        const PropertyImpl root(MakeStruct("root", childTypes), EPropertySemantics::ScriptInput);
+
+        for (size_t i = 0; i < 200; ++i)
+        {
+            const std::string name = fmt::format("child{}", (i * 7) % 200);
+            EXPECT_EQ(i, root.findChildIndex(name));
+            EXPECT_EQ(root.getChild(i), root.getChild(name));
+            EXPECT_TRUE(root.hasChild(name));
+        }
+
+        EXPECT_FALSE(root.findChildIndex("child200"));
+        EXPECT_FALSE(root.findChildIndex("child"));
+        EXPECT_FALSE(root.findChildIndex(""));
+        EXPECT_FALSE(root.hasChild("child200"));
+    }
+
+    TEST_F(AProperty, FindsChildrenByNameAfterMove)
+    {
+        PropertyImpl root(MakeStruct("root", { {"b", EPropertyType::Int32}, {"a", EPropertyType::Float} }), EPropertySemantics::ScriptInput);
+        PropertyImpl movedRoot(std::move(root));
+
+        EXPECT_EQ(0u, movedRoot.findChildIndex("b"));
+        EXPECT_EQ(1u, movedRoot.findChildIndex("a"));
+        EXPECT_EQ("a", movedRoot.getChild("a")->getName());
+    }
+
+    TEST_F(AProperty, DoesNotFindChildOfArrayByName)
+    {
+        const PropertyImpl array(MakeArray("array", 3, EPropertyType::Float), EPropertySemantics::ScriptInput);
+
+        EXPECT_FALSE(array.findChildIndex("array"));
+        EXPECT_FALSE(array.hasChild("array"));
+    }
+
     class AProperty_SerializationLifecycle : public AProperty
     {
     protected:
@@ -622,6 +665,30 @@ namespace rlogic::internal
         EXPECT_EQ("child2", deserialized->getChild(2)->getName());
     }
 
+    TEST_F(AProperty_SerializationLifecycle, FindsChildrenByNameAfterDeserialization)
+    {
+        {
+            auto structType = MakeStruct("parent",
+                {
+                    TypeData{"c", EPropertyType::Float},
+                    TypeData{"a", EPropertyType::Int32},
+                    TypeData{"b", EPropertyType::Bool}
+                });
+            PropertyImpl structProperty(structType, EPropertySemantics::ScriptInput);
+            (void)PropertyImpl::Serialize(structProperty, m_flatBufferBuilder, m_serializationMap);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_EQ(0u, deserialized->findChildIndex("c"));
+        EXPECT_EQ(1u, deserialized->findChildIndex("a"));
+        EXPECT_EQ(2u, deserialized->findChildIndex("b"));
+        EXPECT_FALSE(deserialized->findChildIndex("d"));
+        EXPECT_EQ(EPropertyType::Bool, deserialized->getChild("b")->getType());
+    }
+
     TEST_F(AProperty_SerializationLifecycle, MultiLevelNesting)
     {
         {
@@ -1044,4 +1111,103 @@ namespace rlogic::internal
         EXPECT_EQ(logMessage, fmt::format("Invalid value when setting property 'int64input', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
             -maxIntegerAsDouble - 1).c_str());
     }
+
+    TEST_F(AProperty, SetsAndGetsAllElementsOfArray)
+    {
+        Property array{ CreateProperty(MakeArray("array", 3, EPropertyType::Vec4f), EPropertySemantics::ScriptInput, true) };
+
+        const std::array<vec4f, 3> values = { vec4f{ 1.f, 2.f, 3.f, 4.f }, vec4f{ 5.f, 6.f, 7.f, 8.f }, vec4f{ 9.f, 10.f, 11.f, 12.f } };
+        EXPECT_TRUE(array.setArray(values.data(), values.size()));
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            EXPECT_EQ(values[i], *array.getChild(i)->get<vec4f>());
+        }
+
+        std::array<vec4f, 3> readValues{};
+        EXPECT_TRUE(array.getArray(readValues.data(), readValues.size()));
+        EXPECT_EQ(values, readValues);
+    }
+
+    TEST_F(AProperty, SetArrayMarksLogicNodeDirtyOnlyIfAnElementChanged)
+    {
+        Property array{ CreateProperty(MakeArray("array", 3, EPropertyType::Int32), EPropertySemantics::ScriptInput, true) };
+
+        const std::array<int32_t, 3> values = { 1, 2, 3 };
+        EXPECT_TRUE(array.setArray(values.data(), values.size()));
+        EXPECT_TRUE(m_dummyNode.isDirty());
+
+        m_dummyNode.setDirty(false);
+        EXPECT_TRUE(array.setArray(values.data(), values.size()));
+        EXPECT_FALSE(m_dummyNode.isDirty());
+
+        const std::array<int32_t, 3> changedValues = { 1, 2, 4 };
+        EXPECT_TRUE(array.setArray(changedValues.data(), changedValues.size()));
+        EXPECT_TRUE(m_dummyNode.isDirty());
+    }
+
+    TEST_F(AProperty, FailsToSetOrGetArrayWithWrongTypeOrSize)
+    {
+        Property array{ CreateProperty(MakeArray("array", 2, EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+        Property notAnArray{ CreateProperty(MakeType("float", EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+
+        std::string logMessage;
+        ScopedLogContextLevel logCollector{ ELogMessageType::Error, [&](ELogMessageType /*type*/, std::string_view message)
+        {
+            logMessage = message;
+        }
+        };
+
+        std::array<float, 3> floats = { 1.f, 2.f, 3.f };
+        std::array<int32_t, 2> ints = { 1, 2 };
+
+        EXPECT_FALSE(array.setArray(ints.data(), ints.size()));
+        EXPECT_EQ("Invalid element type 'INT32' when accessing array 'array', correct type is 'FLOAT'", logMessage);
+        EXPECT_FALSE(array.getArray(ints.data(), ints.size()));
+        EXPECT_EQ("Invalid element type 'INT32' when accessing array 'array', correct type is 'FLOAT'", logMessage);
+
+        EXPECT_FALSE(array.setArray(floats.data(), floats.size()));
+        EXPECT_EQ("Invalid element count 3 when accessing array 'array', the array has 2 elements", logMessage);
+        EXPECT_FALSE(array.getArray(floats.data(), 1u));
+        EXPECT_EQ("Invalid element count 1 when accessing array 'array', the array has 2 elements", logMessage);
+
+        EXPECT_FALSE(notAnArray.setArray(floats.data(), 1u));
+        EXPECT_EQ("Property 'float' is not an array, can't access its elements as array!", logMessage);
+
+        EXPECT_EQ(0.f, *array.getChild(0)->get<float>());
+        EXPECT_EQ(0.f, *array.getChild(1)->get<float>());
+    }
+
+    TEST_F(AProperty, FailsToSetArrayWhichIsOutput)
+    {
+        Property array{ CreateProperty(MakeArray("array", 2, EPropertyType::Float), EPropertySemantics::ScriptOutput, true) };
+
+        const std::array<float, 2> values = { 1.f, 2.f };
+        EXPECT_FALSE(array.setArray(values.data(), values.size()));
+        EXPECT_EQ(0.f, *array.getChild(0)->get<float>());
+    }
+
+    TEST_F(AProperty, FailsToSetArrayWithLinkedElement)
+    {
+        Property array{ CreateProperty(MakeArray("array", 2, EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+        PropertyImpl output(MakeType("output", EPropertyType::Float), EPropertySemantics::ScriptOutput);
+
+        array.getChild(1)->m_impl->setLinkedOutput(output);
+        const std::array<float, 2> values = { 1.f, 2.f };
+        EXPECT_FALSE(array.setArray(values.data(), values.size()));
+        EXPECT_EQ(0.f, *array.getChild(0)->get<float>());
+
+        array.getChild(1)->m_impl->unsetLinkedOutput();
+        EXPECT_TRUE(array.setArray(values.data(), values.size()));
+        EXPECT_EQ(2.f, *array.getChild(1)->get<float>());
+    }
+
+    TEST_F(AProperty, FailsToSetINT64ArrayWithValueThatCannotBeRepresentedInLua)
+    {
+        Property array{ CreateProperty(MakeArray("array", 2, EPropertyType::Int64), EPropertySemantics::ScriptInput, true) };
+
+        const std::array<int64_t, 2> values = { 1, std::numeric_limits<int64_t>::max() };
+        EXPECT_FALSE(array.setArray(values.data(), values.size()));
+        EXPECT_EQ(0, *array.getChild(0)->get<int64_t>());
+    }
 }
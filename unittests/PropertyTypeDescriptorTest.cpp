@@ -0,0 +1,143 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/PropertyTypeDescriptor.h"
+#include "internals/PropertyTypeRegistry.h"
+#include "impl/PropertyImpl.h"
+#include "ramses-logic/Property.h"
+
+#include "fmt/format.h"
+
+namespace rlogic::internal
+{
+    class APropertyTypeDescriptor : public ::testing::Test
+    {
+    protected:
+        const HierarchicalTypeData m_type{ TypeData{"IN", EPropertyType::Struct}, {
+            MakeType("speed", EPropertyType::Float),
+            MakeType("name", EPropertyType::String),
+            MakeArray("doors", 4, EPropertyType::Vec3f)
+        } };
+    };
+
+    TEST_F(APropertyTypeDescriptor, CreatesDescriptorTreeOfType)
+    {
+        const SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(m_type);
+
+        EXPECT_EQ("IN", descriptor->getName());
+        EXPECT_EQ(EPropertyType::Struct, descriptor->getType());
+        ASSERT_EQ(3u, descriptor->getChildCount());
+        EXPECT_EQ("speed", descriptor->getChild(0)->getName());
+        EXPECT_EQ(EPropertyType::String, descriptor->getChild(1)->getType());
+        ASSERT_EQ(4u, descriptor->getChild(2)->getChildCount());
+        EXPECT_EQ(EPropertyType::Vec3f, descriptor->getChild(2)->getChild(3)->getType());
+    }
+
+    TEST_F(APropertyTypeDescriptor, SharesDescriptorOfEqualArrayElements)
+    {
+        const SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(m_type);
+        const PropertyTypeDescriptor& doors = *descriptor->getChild(2);
+
+        EXPECT_EQ(doors.getChild(0), doors.getChild(1));
+        EXPECT_EQ(doors.getChild(0), doors.getChild(3));
+    }
+
+    TEST_F(APropertyTypeDescriptor, FindsStructChildrenByName)
+    {
+        const SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(m_type);
+
+        EXPECT_EQ(0u, descriptor->findStructChildIndex("speed"));
+        EXPECT_EQ(2u, descriptor->findStructChildIndex("doors"));
+        EXPECT_FALSE(descriptor->findStructChildIndex("door"));
+        EXPECT_FALSE(descriptor->findStructChildIndex(""));
+    }
+
+    TEST_F(APropertyTypeDescriptor, ComparesWholeLayout)
+    {
+        const SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(m_type);
+        const SharedPropertyTypeDescriptor equalDescriptor = PropertyTypeDescriptor::Create(m_type);
+        EXPECT_EQ(*descriptor, *equalDescriptor);
+        EXPECT_EQ(descriptor->getHash(), equalDescriptor->getHash());
+
+        HierarchicalTypeData otherType = m_type;
+        otherType.children[2] = MakeArray("doors", 4, EPropertyType::Vec3i);
+        EXPECT_NE(*descriptor, *PropertyTypeDescriptor::Create(otherType));
+
+        otherType = m_type;
+        otherType.children[0].typeData.name = "velocity";
+        EXPECT_NE(*descriptor, *PropertyTypeDescriptor::Create(otherType));
+    }
+
+    class APropertyTypeRegistry : public APropertyTypeDescriptor
+    {
+    protected:
+        PropertyTypeRegistry m_registry;
+    };
+
+    TEST_F(APropertyTypeRegistry, ReturnsRegisteredDescriptorForEqualLayout)
+    {
+        const SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(m_type);
+        EXPECT_EQ(descriptor, m_registry.getOrRegister(descriptor));
+
+        const SharedPropertyTypeDescriptor equalDescriptor = PropertyTypeDescriptor::Create(m_type);
+        EXPECT_EQ(descriptor, m_registry.getOrRegister(equalDescriptor));
+
+        const SharedPropertyTypeDescriptor otherDescriptor = PropertyTypeDescriptor::Create(MakeStruct("IN", { TypeData{"speed", EPropertyType::Float} }));
+        EXPECT_EQ(otherDescriptor, m_registry.getOrRegister(otherDescriptor));
+        EXPECT_EQ(2u, m_registry.getTypeCount());
+    }
+
+    TEST_F(APropertyTypeRegistry, DoesNotKeepUnusedDescriptors)
+    {
+        SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(m_type);
+        EXPECT_EQ(descriptor, m_registry.getOrRegister(descriptor));
+        EXPECT_EQ(1u, m_registry.getTypeCount());
+
+        descriptor.reset();
+        EXPECT_EQ(0u, m_registry.getTypeCount());
+
+        const SharedPropertyTypeDescriptor newDescriptor = PropertyTypeDescriptor::Create(m_type);
+        EXPECT_EQ(newDescriptor, m_registry.getOrRegister(newDescriptor));
+        EXPECT_EQ(1u, m_registry.getTypeCount());
+    }
+
+    TEST_F(APropertyTypeRegistry, PrunesEntriesOfReleasedDescriptorsWithOtherHashes)
+    {
+        const SharedPropertyTypeDescriptor usedDescriptor = PropertyTypeDescriptor::Create(m_type);
+        EXPECT_EQ(usedDescriptor, m_registry.getOrRegister(usedDescriptor));
+
+        // Each descriptor has another layout and is released right away, like scripts with different interfaces
+        for (size_t i = 0u; i < 1000u; ++i)
+        {
+            const SharedPropertyTypeDescriptor descriptor = PropertyTypeDescriptor::Create(MakeStruct("IN", { TypeData{fmt::format("input{}", i), EPropertyType::Float} }));
+            EXPECT_EQ(descriptor, m_registry.getOrRegister(descriptor));
+        }
+
+        EXPECT_EQ(1u, m_registry.getTypeCount());
+        EXPECT_LE(m_registry.getEntryCount(), 64u);
+        EXPECT_EQ(usedDescriptor, m_registry.getOrRegister(PropertyTypeDescriptor::Create(m_type)));
+    }
+
+    TEST_F(APropertyTypeRegistry, SharesDescriptorsOfPropertyTrees)
+    {
+        PropertyImpl firstTree(m_type, EPropertySemantics::ScriptInput);
+        PropertyImpl secondTree(m_type, EPropertySemantics::ScriptInput);
+        EXPECT_NE(firstTree.getTypeDescriptor(), secondTree.getTypeDescriptor());
+
+        firstTree.shareTypeDescriptor(m_registry);
+        secondTree.shareTypeDescriptor(m_registry);
+        EXPECT_EQ(firstTree.getTypeDescriptor(), secondTree.getTypeDescriptor());
+        EXPECT_EQ(firstTree.getChild(2)->getChild(1)->m_impl->getTypeDescriptor(), secondTree.getChild(2)->getChild(1)->m_impl->getTypeDescriptor());
+
+        // Names are taken from the shared descriptor
+        EXPECT_EQ("doors", secondTree.getChild(2)->getName());
+        EXPECT_EQ(secondTree.getChild(0), secondTree.getChild("speed"));
+    }
+}
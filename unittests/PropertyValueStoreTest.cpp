@@ -0,0 +1,181 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/PropertyValueStore.h"
+#include "impl/PropertyImpl.h"
+#include "ramses-logic/Property.h"
+
+namespace rlogic::internal
+{
+    class APropertyValueStore : public ::testing::Test
+    {
+    protected:
+        PropertyValueStore m_store;
+    };
+
+    TEST_F(APropertyValueStore, AddsDefaultValues)
+    {
+        const PropertyValueStore::Index floatIndex = m_store.add(EPropertyType::Float);
+        const PropertyValueStore::Index vec3iIndex = m_store.add(EPropertyType::Vec3i);
+        const PropertyValueStore::Index stringIndex = m_store.add(EPropertyType::String);
+        const PropertyValueStore::Index boolIndex = m_store.add(EPropertyType::Bool);
+
+        EXPECT_EQ(4u, m_store.getValueCount());
+        EXPECT_FLOAT_EQ(0.f, m_store.get<float>(floatIndex));
+        EXPECT_EQ((vec3i{ 0, 0, 0 }), m_store.get<vec3i>(vec3iIndex));
+        EXPECT_EQ("", m_store.get<std::string>(stringIndex));
+        EXPECT_FALSE(m_store.get<bool>(boolIndex));
+    }
+
+    TEST_F(APropertyValueStore, KeepsValuesOfSameTypeNextToEachOther)
+    {
+        const PropertyValueStore::Index first = m_store.add(PropertyValue{ 1.f });
+        const PropertyValueStore::Index second = m_store.add(PropertyValue{ 2.f });
+
+        EXPECT_EQ(&m_store.get<float>(first) + 1, &m_store.get<float>(second));
+        EXPECT_FLOAT_EQ(2.f, m_store.get<float>(second));
+    }
+
+    TEST_F(APropertyValueStore, ReportsIfValueChanged)
+    {
+        const PropertyValueStore::Index index = m_store.add(EPropertyType::Vec2f);
+
+        EXPECT_TRUE(m_store.setValue(index, vec2f{ 1.f, 2.f }));
+        EXPECT_FALSE(m_store.setValue(index, vec2f{ 1.f, 2.f }));
+        EXPECT_EQ(PropertyValue{ (vec2f{ 1.f, 2.f }) }, m_store.getValue(EPropertyType::Vec2f, index));
+    }
+
+    TEST_F(APropertyValueStore, CopiesValuesWithinAndAcrossStores)
+    {
+        PropertyValueStore otherStore;
+        const PropertyValueStore::Index source = otherStore.add(PropertyValue{ std::string("value") });
+        const PropertyValueStore::Index target = m_store.add(EPropertyType::String);
+
+        EXPECT_TRUE(m_store.copyValue(EPropertyType::String, target, otherStore, source));
+        EXPECT_FALSE(m_store.copyValue(EPropertyType::String, target, otherStore, source));
+        EXPECT_EQ("value", m_store.get<std::string>(target));
+
+        const PropertyValueStore::Index secondTarget = m_store.add(EPropertyType::String);
+        EXPECT_TRUE(m_store.copyValue(EPropertyType::String, secondTarget, m_store, target));
+        EXPECT_EQ("value", m_store.get<std::string>(secondTarget));
+    }
+
+    TEST_F(APropertyValueStore, ReusesIndicesOfReleasedValues)
+    {
+        const PropertyValueStore::Index first = m_store.add(PropertyValue{ 1 });
+        const PropertyValueStore::Index second = m_store.add(PropertyValue{ 2 });
+
+        m_store.release(EPropertyType::Int32, first);
+        EXPECT_EQ(1u, m_store.getValueCount());
+
+        EXPECT_EQ(first, m_store.add(PropertyValue{ 3 }));
+        EXPECT_EQ(3, m_store.get<int32_t>(first));
+        EXPECT_EQ(2, m_store.get<int32_t>(second));
+        EXPECT_EQ(2u, m_store.getValueCount());
+    }
+
+    TEST_F(APropertyValueStore, MovesValueFromOtherStore)
+    {
+        PropertyValueStore otherStore;
+        const PropertyValueStore::Index sourceIndex = otherStore.add(PropertyValue{ vec4i{ 1, 2, 3, 4 } });
+
+        const PropertyValueStore::Index index = m_store.moveFrom(otherStore, EPropertyType::Vec4i, sourceIndex);
+        EXPECT_EQ((vec4i{ 1, 2, 3, 4 }), m_store.get<vec4i>(index));
+        EXPECT_EQ(0u, otherStore.getValueCount());
+        EXPECT_EQ(1u, m_store.getValueCount());
+    }
+
+    TEST_F(APropertyValueStore, SharesStringBufferWhenCopyingStrings)
+    {
+        PropertyValueStore otherStore;
+        const PropertyValueStore::Index source = otherStore.add(PropertyValue{ std::string("a string which doesn't fit into small string buffer") });
+        const PropertyValueStore::Index target = m_store.add(EPropertyType::String);
+
+        EXPECT_TRUE(m_store.copyValue(EPropertyType::String, target, otherStore, source));
+        EXPECT_TRUE(m_store.sharesStringBuffer(target, otherStore, source));
+        EXPECT_EQ(&otherStore.get<std::string>(source), &m_store.get<std::string>(target));
+
+        // Same buffer - nothing changed
+        EXPECT_FALSE(m_store.copyValue(EPropertyType::String, target, otherStore, source));
+    }
+
+    TEST_F(APropertyValueStore, DoesNotReportChangeWhenCopyingEqualStringFromOtherBuffer)
+    {
+        const PropertyValueStore::Index source = m_store.add(PropertyValue{ std::string("value") });
+        const PropertyValueStore::Index target = m_store.add(PropertyValue{ std::string("value") });
+        EXPECT_FALSE(m_store.sharesStringBuffer(target, m_store, source));
+
+        EXPECT_FALSE(m_store.copyValue(EPropertyType::String, target, m_store, source));
+        EXPECT_TRUE(m_store.sharesStringBuffer(target, m_store, source));
+    }
+
+    TEST_F(APropertyValueStore, DoesNotChangeSharedStringBufferWhenSettingString)
+    {
+        const PropertyValueStore::Index source = m_store.add(PropertyValue{ std::string("source") });
+        const PropertyValueStore::Index target = m_store.add(EPropertyType::String);
+        EXPECT_TRUE(m_store.copyValue(EPropertyType::String, target, m_store, source));
+
+        EXPECT_TRUE(m_store.setString(source, "changed"));
+        EXPECT_EQ("changed", m_store.get<std::string>(source));
+        EXPECT_EQ("source", m_store.get<std::string>(target));
+        EXPECT_FALSE(m_store.sharesStringBuffer(target, m_store, source));
+    }
+
+    TEST_F(APropertyValueStore, ReusesStringBufferWhichIsNotShared)
+    {
+        const PropertyValueStore::Index index = m_store.add(PropertyValue{ std::string("a string which doesn't fit into small string buffer") });
+        const std::string* buffer = &m_store.get<std::string>(index);
+        const char* data = buffer->data();
+
+        EXPECT_TRUE(m_store.setString(index, "another string which doesn't fit into small string buffer"));
+        EXPECT_FALSE(m_store.setString(index, "another string which doesn't fit into small string buffer"));
+        EXPECT_EQ(buffer, &m_store.get<std::string>(index));
+        EXPECT_EQ(data, m_store.get<std::string>(index).data());
+        EXPECT_EQ("another string which doesn't fit into small string buffer", m_store.get<std::string>(index));
+    }
+
+    TEST_F(APropertyValueStore, SharesBufferOfEmptyStrings)
+    {
+        const PropertyValueStore::Index first = m_store.add(EPropertyType::String);
+        const PropertyValueStore::Index second = m_store.add(PropertyValue{ std::string() });
+        EXPECT_TRUE(m_store.sharesStringBuffer(first, m_store, second));
+
+        // Shared empty buffer is never modified
+        EXPECT_TRUE(m_store.setString(first, "value"));
+        EXPECT_EQ("value", m_store.get<std::string>(first));
+        EXPECT_EQ("", m_store.get<std::string>(second));
+    }
+
+    TEST_F(APropertyValueStore, TakesOverValuesOfPropertyTree)
+    {
+        PropertyImpl property(MakeStruct("root", { TypeData{"float", EPropertyType::Float}, TypeData{"string", EPropertyType::String} }), EPropertySemantics::ScriptInput);
+        EXPECT_TRUE(property.getChild(0)->m_impl->setValue(4.f));
+        EXPECT_TRUE(property.getChild(1)->m_impl->setValue(std::string("value")));
+
+        property.moveValuesToStore(m_store);
+        EXPECT_EQ(2u, m_store.getValueCount());
+        EXPECT_FLOAT_EQ(4.f, property.getChild(0)->m_impl->getValueAs<float>());
+        EXPECT_EQ("value", property.getChild(1)->m_impl->getValueAs<std::string>());
+
+        EXPECT_TRUE(property.getChild(0)->m_impl->setValue(5.f));
+        EXPECT_FLOAT_EQ(5.f, m_store.get<float>(0u));
+    }
+
+    TEST_F(APropertyValueStore, ReleasesValuesOfDestroyedProperties)
+    {
+        {
+            PropertyImpl property(MakeStruct("root", { TypeData{"float", EPropertyType::Float}, TypeData{"bool", EPropertyType::Bool} }), EPropertySemantics::ScriptInput);
+            property.moveValuesToStore(m_store);
+            EXPECT_EQ(2u, m_store.getValueCount());
+        }
+
+        EXPECT_EQ(0u, m_store.getValueCount());
+    }
+}
@@ -0,0 +1,47 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2021 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "ramses-logic/SaveFileConfig.h"
+#include "impl/SaveFileConfigImpl.h"
+
+namespace rlogic::internal
+{
+    TEST(ASaveFileConfig, DoesNotSaveLuaByteCodeByDefault)
+    {
+        SaveFileConfig config;
+        EXPECT_FALSE(config.m_impl->getLuaByteCodeEnabled());
+    }
+
+    TEST(ASaveFileConfig, IsCopied)
+    {
+        SaveFileConfig config;
+        config.setLuaByteCodeEnabled(true);
+
+        SaveFileConfig configCopy(config);
+        EXPECT_TRUE(configCopy.m_impl->getLuaByteCodeEnabled());
+
+        SaveFileConfig configCopyAssigned;
+        configCopyAssigned = config;
+        EXPECT_TRUE(configCopyAssigned.m_impl->getLuaByteCodeEnabled());
+    }
+
+    TEST(ASaveFileConfig, IsMoved)
+    {
+        SaveFileConfig config;
+        config.setLuaByteCodeEnabled(true);
+
+        SaveFileConfig movedConfig(std::move(config));
+        EXPECT_TRUE(movedConfig.m_impl->getLuaByteCodeEnabled());
+
+        SaveFileConfig movedAssigned;
+        movedAssigned = std::move(movedConfig);
+        EXPECT_TRUE(movedAssigned.m_impl->getLuaByteCodeEnabled());
+    }
+}
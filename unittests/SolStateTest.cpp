@@ -19,6 +19,7 @@ namespace rlogic::internal
     {
         protected:
             SolState m_solState;
+            ErrorReporting m_errorReporting;
 
             const std::string_view m_valid_empty_script = R"(
                 function interface()
@@ -26,6 +27,11 @@ namespace rlogic::internal
                 function run()
                 end
             )";
+
+            static std::string DumpByteCodeAsString(const sol::protected_function& function)
+            {
+                return std::string(SolState::DumpByteCode(function).as_string_view());
+            }
     };
 
     TEST_F(ASolState, DoesNotHaveErrorsAfterLoadingEmptyScript)
@@ -49,9 +55,60 @@ namespace rlogic::internal
         EXPECT_THAT(error.what(), ::testing::HasSubstr("'<name>' expected near 'not'"));
     }
 
+    TEST_F(ASolState, LoadsCompatibleByteCodeInsteadOfSource)
+    {
+        const sol::protected_function mainFunction = m_solState.loadScript(m_valid_empty_script, "validEmptyScript");
+        const sol::bytecode byteCode = SolState::DumpByteCode(mainFunction);
+        ASSERT_TRUE(m_solState.isCompatibleByteCode(byteCode.as_string_view()));
+
+        auto load_result = m_solState.loadByteCodeOrScript("this.does.not.compile", byteCode.as_string_view(), "validEmptyScript");
+        EXPECT_TRUE(load_result.valid());
+    }
+
+    TEST_F(ASolState, LoadsSourceIfByteCodeIsIncompatible)
+    {
+        const sol::protected_function mainFunction = m_solState.loadScript(m_valid_empty_script, "validEmptyScript");
+        std::string byteCode(DumpByteCodeAsString(mainFunction));
+        // byte after the signature is the Lua version
+        byteCode[4] = '\x42';
+        EXPECT_FALSE(m_solState.isCompatibleByteCode(byteCode));
+        EXPECT_FALSE(m_solState.isCompatibleByteCode(""));
+        EXPECT_FALSE(m_solState.isCompatibleByteCode("function run() end"));
+
+        EXPECT_TRUE(m_solState.loadByteCodeOrScript(m_valid_empty_script, byteCode, "validEmptyScript").valid());
+        EXPECT_FALSE(m_solState.loadByteCodeOrScript("this.does.not.compile", byteCode, "cantCompileScript").valid());
+    }
+
+    TEST_F(ASolState, LoadsSourceIfByteCodeIsCorrupted)
+    {
+        const sol::protected_function mainFunction = m_solState.loadScript(m_valid_empty_script, "validEmptyScript");
+        std::string byteCode(DumpByteCodeAsString(mainFunction));
+        byteCode.resize(byteCode.size() / 2);
+        ASSERT_TRUE(m_solState.isCompatibleByteCode(byteCode));
+
+        EXPECT_TRUE(m_solState.loadByteCodeOrScript(m_valid_empty_script, byteCode, "validEmptyScript").valid());
+    }
+
+    TEST_F(ASolState, CopiesFunctionWithoutSharingItsEnvironment)
+    {
+        sol::protected_function original = m_solState.loadScript("return data", "script");
+        sol::environment originalEnv = *m_solState.createEnvironment({}, {}, m_errorReporting);
+        originalEnv["data"] = "original";
+        originalEnv.set_on(original);
+
+        sol::protected_function copy = m_solState.copyFunction(original, "copy");
+        ASSERT_TRUE(copy.valid());
+        sol::environment copyEnv = *m_solState.createEnvironment({}, {}, m_errorReporting);
+        copyEnv["data"] = "copy";
+        copyEnv.set_on(copy);
+
+        EXPECT_EQ("original", original().get<std::string>());
+        EXPECT_EQ("copy", copy().get<std::string>());
+    }
+
     TEST_F(ASolState, CreatesNewEnvironment)
     {
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         EXPECT_TRUE(env.valid());
     }
 
@@ -59,7 +116,7 @@ namespace rlogic::internal
     // to have nothing in the global environment
     TEST_F(ASolState, NewEnvironment_ExposesTypeSymbols)
     {
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_TRUE(env["INT"].valid());
@@ -74,7 +131,7 @@ namespace rlogic::internal
 
     TEST_F(ASolState, CreatesCustomMethods)
     {
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_TRUE(env["modules"].valid());
@@ -84,7 +141,7 @@ namespace rlogic::internal
     // Those are created on-demand in the interface() function and during runtime
     TEST_F(ASolState, NewEnvironment_HasNo_IN_OUT_globals)
     {
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_FALSE(env["IN"].valid());
@@ -93,7 +150,7 @@ namespace rlogic::internal
 
     TEST_F(ASolState, NewEnvironment_HidesGlobalStandardModulesByDefault)
     {
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_FALSE(env["print"].valid());
@@ -102,11 +159,12 @@ namespace rlogic::internal
         EXPECT_FALSE(env["table"].valid());
         EXPECT_FALSE(env["error"].valid());
         EXPECT_FALSE(env["math"].valid());
+        EXPECT_FALSE(env["arraymath"].valid());
     }
 
     TEST_F(ASolState, NewEnvironment_ExposesOnlyRequestedGlobalStandardModules)
     {
-        sol::environment env = m_solState.createEnvironment({EStandardModule::Math}, {});
+        sol::environment env = *m_solState.createEnvironment({EStandardModule::Math}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_TRUE(env["math"].valid());
@@ -120,7 +178,7 @@ namespace rlogic::internal
 
     TEST_F(ASolState, NewEnvironment_ExposesRequestedGlobalStandardModules_TwoModules)
     {
-        sol::environment env = m_solState.createEnvironment({ EStandardModule::String, EStandardModule::Table }, {});
+        sol::environment env = *m_solState.createEnvironment({ EStandardModule::String, EStandardModule::Table }, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_TRUE(env["string"].valid());
@@ -132,9 +190,21 @@ namespace rlogic::internal
         EXPECT_FALSE(env["error"].valid());
     }
 
+    TEST_F(ASolState, NewEnvironment_ExposesRequestedGlobalStandardModules_ArrayMath)
+    {
+        sol::environment env = *m_solState.createEnvironment({ EStandardModule::ArrayMath }, {}, m_errorReporting);
+        ASSERT_TRUE(env.valid());
+
+        EXPECT_TRUE(env["arraymath"].valid());
+        EXPECT_TRUE(env["arraymath"]["transform"].valid());
+
+        EXPECT_FALSE(env["math"].valid());
+        EXPECT_FALSE(env["print"].valid());
+    }
+
     TEST_F(ASolState, NewEnvironment_ExposesRequestedGlobalStandardModules_BaseLib)
     {
-        sol::environment env = m_solState.createEnvironment({ EStandardModule::Base }, {});
+        sol::environment env = *m_solState.createEnvironment({ EStandardModule::Base }, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_TRUE(env["error"].valid());
@@ -149,7 +219,7 @@ namespace rlogic::internal
 
     TEST_F(ASolState, NewEnvironment_HasNoFunctionsExpectedByUserScript)
     {
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
 
         EXPECT_FALSE(env["interface"].valid());
@@ -158,8 +228,8 @@ namespace rlogic::internal
 
     TEST_F(ASolState, NewEnvironment_TwoEnvironmentsShareNoData)
     {
-        sol::environment env1 = m_solState.createEnvironment({}, {});
-        sol::environment env2 = m_solState.createEnvironment({}, {});
+        sol::environment env1 = *m_solState.createEnvironment({}, {}, m_errorReporting);
+        sol::environment env2 = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env1.valid());
         ASSERT_TRUE(env2.valid());
 
@@ -188,7 +258,7 @@ namespace rlogic::internal
         sol::function func = loadedScript();
 
         // Apply fresh environment to func
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
         env.set_on(func);
 
@@ -212,7 +282,7 @@ namespace rlogic::internal
         sol::protected_function loadedScript = m_solState.loadScript(script, "test script");
 
         // Apply a fresh environments to loaded script _before_ executing it
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         env.set_on(loadedScript);
         sol::function func = loadedScript();
 
@@ -236,7 +306,7 @@ namespace rlogic::internal
         std::string dataStatus = script();
         EXPECT_EQ(dataStatus, "no data");
 
-        sol::environment env = m_solState.createEnvironment({}, {});
+        sol::environment env = *m_solState.createEnvironment({}, {}, m_errorReporting);
         ASSERT_TRUE(env.valid());
         env["data"] = "a lot of data!";
 